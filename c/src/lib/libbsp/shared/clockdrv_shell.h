@@ -17,10 +17,22 @@
 
 #include <bsp.h>
 
+#if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE)
+  #if defined(__RTEMS_APPLICATION__)
+    #error "clockdrv_shell.h: Tickless Idle needs __RTEMS_VIOLATE_KERNEL_VISIBILITY__"
+  #endif
+  #include <rtems/score/thread.h>
+#endif
+
 #if defined(CLOCK_DRIVER_USE_FAST_IDLE) && defined(CLOCK_DRIVER_ISRS_PER_TICK)
 #error "clockdrv_shell.h: Fast Idle PLUS n ISRs per tick is not supported"
 #endif
 
+#if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE) && \
+    (defined(CLOCK_DRIVER_USE_FAST_IDLE) || defined(CLOCK_DRIVER_ISRS_PER_TICK))
+#error "clockdrv_shell.h: Tickless Idle PLUS Fast Idle or n ISRs per tick is not supported"
+#endif
+
 /*
  * This method is rarely used so default it.
  */
@@ -40,6 +52,45 @@
  */
 volatile uint32_t    Clock_driver_ticks;
 
+#if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE)
+  /*
+   *  Tickless idle support.  The BSP provides
+   *
+   *    Clock_driver_support_start_oneshot( ticks ) - stop the periodic tick
+   *      and interrupt once at the boundary of the tick number ticks,
+   *      returns false if a tick interrupt is already pending
+   *
+   *    Clock_driver_support_stop_oneshot( expired ) - restart the periodic
+   *      tick in phase with the previous ticks, returns the number of tick
+   *      boundaries not yet reached
+   *
+   *  and optionally
+   *
+   *    Clock_driver_support_maximum_oneshot_ticks() - the longest one-shot
+   *      interval supported by the hardware
+   *
+   *    Clock_driver_support_idle_wait() - wait for an interrupt
+   */
+  #ifndef Clock_driver_support_maximum_oneshot_ticks
+    #define Clock_driver_support_maximum_oneshot_ticks() \
+      rtems_clock_get_ticks_per_second()
+  #endif
+
+  #ifndef Clock_driver_support_idle_wait
+    #define Clock_driver_support_idle_wait()
+  #endif
+
+  /*
+   *  True while the periodic tick is replaced by a one-shot interrupt
+   */
+  volatile bool        Clock_driver_oneshot_active;
+
+  /*
+   *  True if the one-shot interrupt occurred
+   */
+  volatile bool        Clock_driver_oneshot_expired;
+#endif
+
 void Clock_exit( void );
 
 /*
@@ -70,6 +121,18 @@ rtems_isr Clock_isr(
    */
   Clock_driver_ticks += 1;
 
+  #if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE)
+    /*
+     *  The idle thread announces the ticks elapsed during the one-shot
+     *  interval once it leaves the tickless state.
+     */
+    if ( Clock_driver_oneshot_active ) {
+      Clock_driver_oneshot_expired = true;
+      Clock_driver_support_at_tick();
+      return;
+    }
+  #endif
+
   #ifdef CLOCK_DRIVER_USE_FAST_IDLE
     do {
       rtems_clock_tick();
@@ -105,6 +168,107 @@ rtems_isr Clock_isr(
   #endif
 }
 
+#if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE)
+/*
+ *  Clock_driver_tickless_wakeup_necessary
+ *
+ *  This routine returns true if the idle thread must leave the tickless
+ *  state.  This is the case if the one-shot interrupt occurred, a thread
+ *  became ready or an interrupt service routine started a timeout which
+ *  expires before the one-shot interval ends.
+ *
+ *  Input parameters:
+ *    ticks - length of the one-shot interval in ticks
+ *
+ *  Output parameters:  NONE
+ *
+ *  Return values:
+ *    true if the idle thread must leave the tickless state
+ */
+static bool Clock_driver_tickless_wakeup_necessary( rtems_interval ticks )
+{
+  rtems_interrupt_level level;
+  bool                  wakeup;
+
+  rtems_interrupt_disable( level );
+    wakeup = Clock_driver_oneshot_expired ||
+      _Thread_Is_context_switch_necessary() ||
+      rtems_clock_get_ticks_until_next_event() < ticks;
+  rtems_interrupt_enable( level );
+
+  return wakeup;
+}
+
+/*
+ *  Clock_driver_tickless_idle_body
+ *
+ *  This is the body of the idle thread if the application configured
+ *  tickless idle.  The periodic tick is replaced by a one-shot interrupt
+ *  at the next watchdog expiration while the system is idle.  Thread
+ *  dispatching is disabled in the tickless state, so a thread made ready
+ *  by an interrupt runs after the elapsed ticks have been announced.
+ *
+ *  Timeouts started by interrupt service routines in the tickless state
+ *  are relative to the last announced tick.
+ *
+ *  Input parameters:
+ *    ignored - not used
+ *
+ *  Output parameters:  NONE
+ *
+ *  Return values:      NONE
+ */
+void *Clock_driver_tickless_idle_body( uintptr_t ignored )
+{
+  for ( ; ; ) {
+    rtems_interrupt_level level;
+    rtems_interval        ticks;
+    rtems_interval        remaining;
+
+    _Thread_Disable_dispatch();
+
+    rtems_interrupt_disable( level );
+
+    ticks = rtems_clock_get_ticks_until_next_event();
+    if ( ticks > Clock_driver_support_maximum_oneshot_ticks() )
+      ticks = Clock_driver_support_maximum_oneshot_ticks();
+
+    if ( ticks <= 1 || _Thread_Is_context_switch_necessary() ||
+         !Clock_driver_support_start_oneshot( ticks ) ) {
+      rtems_interrupt_enable( level );
+      _Thread_Enable_dispatch();
+
+      Clock_driver_support_idle_wait();
+      continue;
+    }
+
+    Clock_driver_oneshot_expired = false;
+    Clock_driver_oneshot_active = true;
+
+    rtems_interrupt_enable( level );
+
+    while ( !Clock_driver_tickless_wakeup_necessary( ticks ) )
+      Clock_driver_support_idle_wait();
+
+    rtems_interrupt_disable( level );
+      Clock_driver_oneshot_active = false;
+      remaining = Clock_driver_support_stop_oneshot(
+        Clock_driver_oneshot_expired
+      );
+      if ( Clock_driver_oneshot_expired )
+        remaining = 0;
+    rtems_interrupt_enable( level );
+
+    if ( remaining < ticks )
+      rtems_clock_tick_announce( ticks - remaining );
+
+    _Thread_Enable_dispatch();
+  }
+
+  return NULL;   /* to avoid warning */
+}
+#endif
+
 /*
  *  Clock_exit
  *
@@ -168,6 +332,14 @@ rtems_device_driver Clock_initialize(
     );
   #endif
 
+  #if defined(Clock_driver_counter_read)
+    rtems_clock_set_counter(
+      Clock_driver_counter_read,
+      Clock_driver_counter_frequency,
+      Clock_driver_counter_mask
+    );
+  #endif
+
   /*
    *  Now initialize the hardware that is the source of the tick ISR.
    */
@@ -135,7 +135,8 @@ Thread_Control *rtems_gdb_index_to_stub_id(
    max_id = obj_info->maximum_id;
 
    if (thread <= (first_rtems_id + (max_id - min_id))) {
-      th = (Thread_Control *)(obj_info->local_table[thread - first_rtems_id + 1]);
+      th = (Thread_Control *)_Objects_Get_local_object(obj_info,
+             thread - first_rtems_id + 1);
 
       if (th != NULL) {
          goto found;
@@ -152,7 +153,8 @@ Thread_Control *rtems_gdb_index_to_stub_id(
    min_id = obj_info->minimum_id;
    max_id = obj_info->maximum_id;
 
-   th = (Thread_Control *)(obj_info->local_table[thread - first_posix_id + 1]);
+   th = (Thread_Control *)_Objects_Get_local_object(obj_info,
+          thread - first_posix_id + 1);
    if (th == NULL) {
       /* Thread does not exist */
       return NULL;
@@ -203,7 +205,8 @@ int rtems_gdb_stub_get_next_thread(int athread)
     }
 
     for (id=start; id<=lim; id++) {
-      if (obj_info->local_table[id - first_rtems_id + 1] != NULL) {
+      if (_Objects_Get_local_object(obj_info,
+            id - first_rtems_id + 1) != NULL) {
         return id;
       }
     }
@@ -226,7 +229,8 @@ int rtems_gdb_stub_get_next_thread(int athread)
     }
 
     for (id=start; id<=lim; id++) {
-      if (obj_info->local_table[id - first_posix_id + 1] != NULL) {
+      if (_Objects_Get_local_object(obj_info,
+            id - first_posix_id + 1) != NULL) {
         return id;
       }
     }
@@ -313,8 +317,8 @@ int rtems_gdb_stub_get_thread_info(
    max_id = obj_info->maximum_id;
 
    if (thread <= (first_rtems_id + (max_id - min_id))) {
-      th = (Thread_Control *)(obj_info->local_table[thread -
-                                                    first_rtems_id + 1]);
+      th = (Thread_Control *)_Objects_Get_local_object(obj_info,
+             thread - first_rtems_id + 1);
 
       if (th == NULL) {
          /* Thread does not exist */
@@ -347,7 +351,8 @@ int rtems_gdb_stub_get_thread_info(
    min_id = obj_info->minimum_id;
    max_id = obj_info->maximum_id;
 
-   th = (Thread_Control *)(obj_info->local_table[thread - first_posix_id + 1]);
+   th = (Thread_Control *)_Objects_Get_local_object(obj_info,
+          thread - first_posix_id + 1);
    if (th == NULL) {
       /* Thread does not exist */
       return 0;
@@ -22,11 +22,14 @@
  *  European Space Agency.
  */
 
+#define __RTEMS_VIOLATE_KERNEL_VISIBILITY__
 #include <bsp.h>
 #include <bspopts.h>
 
 #if SIMSPARC_FAST_IDLE==1
 #define CLOCK_DRIVER_USE_FAST_IDLE
+#else
+#define CLOCK_DRIVER_USE_TICKLESS_IDLE
 #endif
 
 /*
@@ -44,6 +47,16 @@
 
 extern int CLOCK_SPEED;
 
+#if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE)
+/*
+ *  Microseconds from the last announced tick to the end of the one-shot
+ *  interval.  It is zero while the clock runs periodically.  The one-shot
+ *  interval is at most one second (the default of the clock driver shell),
+ *  so the interval in nanoseconds fits into 32 bits.
+ */
+static uint32_t erc32_clock_oneshot_length;
+#endif
+
 uint32_t bsp_clock_nanoseconds_since_last_tick(void)
 {
   uint32_t clicks;
@@ -51,6 +64,14 @@ uint32_t bsp_clock_nanoseconds_since_last_tick(void)
 
   clicks = ERC32_MEC.Real_Time_Clock_Counter;
 
+#if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE)
+  if ( erc32_clock_oneshot_length != 0 ) {
+    if ( ERC32_Is_interrupt_pending( ERC32_INTERRUPT_REAL_TIME_CLOCK ) )
+      clicks = 0;
+    return (erc32_clock_oneshot_length - clicks) * 1000;
+  }
+#endif
+
   if ( ERC32_Is_interrupt_pending( ERC32_INTERRUPT_REAL_TIME_CLOCK ) ) {
     clicks = ERC32_MEC.Real_Time_Clock_Counter;
     usecs = (2*rtems_configuration_get_microseconds_per_tick() - clicks);
@@ -63,6 +84,76 @@ uint32_t bsp_clock_nanoseconds_since_last_tick(void)
 #define Clock_driver_nanoseconds_since_last_tick \
   bsp_clock_nanoseconds_since_last_tick
 
+#if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE)
+/*
+ *  The Real Time Clock Counter counts down from the reload value.  The
+ *  one-shot interval starts at the current counter value so that it
+ *  ends exactly at a tick boundary of the periodic tick.
+ */
+static bool erc32_clock_start_oneshot( uint32_t ticks )
+{
+  uint32_t usecs_per_tick = rtems_configuration_get_microseconds_per_tick();
+  uint32_t clicks;
+
+  if ( ERC32_Is_interrupt_pending( ERC32_INTERRUPT_REAL_TIME_CLOCK ) )
+    return false;
+
+  clicks = ERC32_MEC.Real_Time_Clock_Counter + (ticks - 1) * usecs_per_tick;
+
+  ERC32_MEC.Real_Time_Clock_Counter = clicks;
+  ERC32_MEC_Set_Real_Time_Clock_Timer_Control(
+    ERC32_MEC_TIMER_COUNTER_ENABLE_COUNTING |
+      ERC32_MEC_TIMER_COUNTER_LOAD_COUNTER |
+      ERC32_MEC_TIMER_COUNTER_STOP_AT_ZERO
+  );
+
+  erc32_clock_oneshot_length = ticks * usecs_per_tick;
+
+  return true;
+}
+
+/*
+ *  The first period after the one-shot interval ends at the next tick
+ *  boundary of the one-shot interval.  The counter reloads the full tick
+ *  period afterwards.
+ */
+static uint32_t erc32_clock_stop_oneshot( bool expired )
+{
+  uint32_t usecs_per_tick = rtems_configuration_get_microseconds_per_tick();
+  uint32_t clicks;
+  uint32_t remaining;
+  uint32_t partial;
+
+  clicks = expired ? 0 : ERC32_MEC.Real_Time_Clock_Counter;
+  remaining = (clicks + usecs_per_tick - 1) / usecs_per_tick;
+  partial = remaining == 0 ?
+    usecs_per_tick : clicks - (remaining - 1) * usecs_per_tick;
+
+  ERC32_MEC.Real_Time_Clock_Counter = partial;
+  ERC32_MEC_Set_Real_Time_Clock_Timer_Control(
+    ERC32_MEC_TIMER_COUNTER_ENABLE_COUNTING |
+      ERC32_MEC_TIMER_COUNTER_LOAD_COUNTER |
+      ERC32_MEC_TIMER_COUNTER_RELOAD_AT_ZERO
+  );
+  ERC32_MEC.Real_Time_Clock_Counter = usecs_per_tick;
+
+  erc32_clock_oneshot_length = 0;
+
+  return remaining;
+}
+
+#define Clock_driver_support_start_oneshot( _ticks ) \
+  erc32_clock_start_oneshot( _ticks )
+
+#define Clock_driver_support_stop_oneshot( _expired ) \
+  erc32_clock_stop_oneshot( _expired )
+
+#define Clock_driver_support_idle_wait() \
+  do { \
+    ERC32_MEC.Power_Down = 0;   /* value is irrelevant */ \
+  } while (0)
+#endif
+
 #define Clock_driver_support_initialize_hardware() \
   do { \
     /* approximately 1 us per countdown */ \
@@ -39,6 +39,13 @@ extern "C" {
 void *bsp_idle_thread( uintptr_t ignored );
 #define BSP_IDLE_TASK_BODY bsp_idle_thread
 
+/*
+ *  The clock driver supports tickless idle unless fast idle is enabled
+ */
+#if SIMSPARC_FAST_IDLE != 1
+  #define BSP_FEATURE_TICKLESS_IDLE
+#endif
+
 /*
  * Network driver configuration
  */
@@ -39,6 +39,9 @@ typedef struct {
     uint32_t    max_depth;		     /* most ever malloc'd at 1 time */
     uintmax_t   lifetime_allocated;
     uintmax_t   lifetime_freed;
+    uint32_t    cache_malloc_hits;           /* # malloc via task cache */
+    uint32_t    cache_free_hits;             /* # free via task cache */
+    uint32_t    cached;                      /* bytes held by task caches */
 } rtems_malloc_statistics_t;
 
 /*
@@ -65,6 +68,18 @@ typedef struct {
 extern rtems_malloc_sbrk_functions_t rtems_malloc_sbrk_helpers_table;
 extern rtems_malloc_sbrk_functions_t *rtems_malloc_sbrk_helpers;
 
+/*
+ *  Malloc per task cache plugin
+ */
+typedef struct {
+  void  (*initialize)(void);
+  void *(*allocate)(size_t);
+  bool  (*free)(void *);
+} rtems_malloc_cache_functions_t;
+
+extern rtems_malloc_cache_functions_t rtems_malloc_cache_helpers_table;
+extern rtems_malloc_cache_functions_t *rtems_malloc_cache_helpers;
+
 /*
  * Malloc Plugin to Dirty Memory at Allocation Time
  */
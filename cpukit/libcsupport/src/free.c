@@ -35,6 +35,16 @@ void free(
       return;
   }
 
+  /*
+   *  If configured, try to put the memory into the per task cache.  The
+   *  cache accounts the memory it holds in the statistics.
+   */
+  if ( rtems_malloc_cache_helpers &&
+       (*rtems_malloc_cache_helpers->free)(ptr) ) {
+    MSBUMP(cache_free_hits, 1);
+    return;
+  }
+
   /*
    *  If configured, update the statistics
    */
@@ -25,6 +25,7 @@ void *malloc(
 )
 {
   void        *return_this;
+  bool         from_cache;
 
   MSBUMP(malloc_calls, 1);
 
@@ -52,7 +53,24 @@ void *malloc(
    * If this fails then return a NULL pointer.
    */
 
-  return_this = _Protected_heap_Allocate( RTEMS_Malloc_Heap, size );
+  return_this = NULL;
+  from_cache = false;
+
+  /*
+   *  If configured, try the per task cache first.  It avoids the allocator
+   *  mutex in most cases.  The cache accounts the memory it hands out in
+   *  the statistics.
+   */
+  if ( rtems_malloc_cache_helpers ) {
+    return_this = (*rtems_malloc_cache_helpers->allocate)( size );
+    if ( return_this ) {
+      MSBUMP(cache_malloc_hits, 1);
+      from_cache = true;
+    }
+  }
+
+  if ( !return_this )
+    return_this = _Protected_heap_Allocate( RTEMS_Malloc_Heap, size );
 
   if ( !return_this ) {
     if (rtems_malloc_sbrk_helpers)
@@ -72,7 +90,7 @@ void *malloc(
   /*
    *  If configured, update the statistics
    */
-  if ( rtems_malloc_statistics_helpers )
+  if ( rtems_malloc_statistics_helpers && !from_cache )
     (*rtems_malloc_statistics_helpers->at_malloc)(return_this);
 
   return return_this;
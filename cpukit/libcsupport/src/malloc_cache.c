@@ -0,0 +1,504 @@
+/**
+ * @file
+ *
+ * @brief Malloc per task cache implementation.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef RTEMS_NEWLIB
+#include "malloc_p.h"
+
+#include <string.h>
+
+#include <rtems/score/apimutex.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/object.h>
+#include <rtems/score/sysstate.h>
+#include <rtems/score/thread.h>
+
+/*
+ *  The cache serves allocations up to the size of the largest size class.
+ *  The size of size class n is MALLOC_CACHE_MINIMUM_SIZE << n.  A cached
+ *  memory area is large enough to hold two pointers.
+ */
+#define MALLOC_CACHE_CLASS_COUNT 6
+
+#define MALLOC_CACHE_MINIMUM_SIZE (2 * sizeof(void *))
+
+#define MALLOC_CACHE_MAXIMUM_SIZE \
+  (MALLOC_CACHE_MINIMUM_SIZE << (MALLOC_CACHE_CLASS_COUNT - 1))
+
+/*
+ *  Memory areas move between the task caches and the depot in batches of
+ *  this size.  A task cache holds at most two batches for each size class.
+ */
+#define MALLOC_CACHE_BATCH_SIZE 8
+
+/*
+ *  If the depot holds this number of batches for a size class, further
+ *  batches are returned to the heap.
+ */
+#define MALLOC_CACHE_DEPOT_LIMIT 16
+
+typedef struct Malloc_cache_area Malloc_cache_area;
+
+/*
+ *  A cached memory area.  The memory areas of a batch are linked via the
+ *  next field.  The first area of a batch links the batches of the depot.
+ */
+struct Malloc_cache_area {
+  Malloc_cache_area *next;
+  Malloc_cache_area *next_batch;
+};
+
+typedef struct {
+  Malloc_cache_area *first[ MALLOC_CACHE_CLASS_COUNT ];
+  uint32_t           count[ MALLOC_CACHE_CLASS_COUNT ];
+} Malloc_cache_task;
+
+/*
+ *  The depot is protected by the allocator mutex.
+ */
+typedef struct {
+  Malloc_cache_area *batches[ MALLOC_CACHE_CLASS_COUNT ];
+  uint32_t           batch_count[ MALLOC_CACHE_CLASS_COUNT ];
+} Malloc_cache_depot;
+
+static Malloc_cache_depot malloc_cache_depot;
+
+static void malloc_cache_delete_hook(
+  rtems_tcb *current_task,
+  rtems_tcb *deleted_task
+);
+
+/*
+ *  The task cache pointer lives in the user extension area of the task.
+ *  The user extension which owns the slot returns the cached memory areas
+ *  of a deleted task to the C Program Heap.
+ */
+static const rtems_extensions_table malloc_cache_extension_table = {
+  NULL,                     /* task create */
+  NULL,                     /* task start */
+  NULL,                     /* task restart */
+  malloc_cache_delete_hook, /* task delete */
+  NULL,                     /* task switch */
+  NULL,                     /* task begin */
+  NULL,                     /* task exitted */
+  NULL                      /* fatal */
+};
+
+static uint32_t malloc_cache_extension_index;
+
+/*
+ *  The malloc statistics account memory areas held by the task caches and
+ *  the depot separately.  Areas taken from the heap for a cache count as
+ *  allocated and areas which a cache returns to the heap count as freed.
+ *  Areas which move between the application and a cache change only the
+ *  cached size.
+ */
+static void malloc_cache_statistics_update_cached( uint32_t delta )
+{
+  ISR_Level level;
+
+  _ISR_Disable_on_this_core( level );
+    MSBUMP(cached, delta);
+  _ISR_Enable_on_this_core( level );
+}
+
+static void malloc_cache_statistics_at_heap_allocate( void *area )
+{
+  if ( rtems_malloc_statistics_helpers ) {
+    uintptr_t size = 0;
+
+    (*rtems_malloc_statistics_helpers->at_malloc)( area );
+    _Heap_Size_of_alloc_area( RTEMS_Malloc_Heap, area, &size );
+    malloc_cache_statistics_update_cached( (uint32_t) size );
+  }
+}
+
+static void malloc_cache_statistics_at_heap_free( void *area )
+{
+  if ( rtems_malloc_statistics_helpers ) {
+    uintptr_t size = 0;
+
+    (*rtems_malloc_statistics_helpers->at_free)( area );
+    _Heap_Size_of_alloc_area( RTEMS_Malloc_Heap, area, &size );
+    malloc_cache_statistics_update_cached( (uint32_t) -size );
+  }
+}
+
+static uint32_t malloc_cache_class_of_size( size_t size )
+{
+  uint32_t class_index = 0;
+  size_t   class_size = MALLOC_CACHE_MINIMUM_SIZE;
+
+  while ( class_size < size ) {
+    class_size <<= 1;
+    ++class_index;
+  }
+
+  return class_index;
+}
+
+/*
+ *  Returns the largest size class which fits into a memory area of this
+ *  usable size.
+ */
+static uint32_t malloc_cache_class_of_area( uintptr_t usable_size )
+{
+  uint32_t class_index = 0;
+
+  while (
+    class_index + 1 < MALLOC_CACHE_CLASS_COUNT
+      && (MALLOC_CACHE_MINIMUM_SIZE << (class_index + 1)) <= usable_size
+  ) {
+    ++class_index;
+  }
+
+  return class_index;
+}
+
+/*
+ *  The cache is only used by tasks.  Only the owner task and the task
+ *  delete extension access a task cache.
+ */
+static Malloc_cache_task *malloc_cache_get_task_cache( void )
+{
+  Thread_Control    *executing;
+  Malloc_cache_task *cache;
+  uint32_t           index = malloc_cache_extension_index;
+
+  if ( !_System_state_Is_up( _System_state_Get() ) )
+    return NULL;
+
+  executing = _Thread_Executing;
+  cache = executing->extensions[ index ];
+
+  if ( cache == NULL ) {
+    cache = _Protected_heap_Allocate( RTEMS_Malloc_Heap, sizeof( *cache ) );
+    if ( cache != NULL ) {
+      memset( cache, 0, sizeof( *cache ) );
+      executing->extensions[ index ] = cache;
+    }
+  }
+
+  return cache;
+}
+
+#if defined(RTEMS_DEBUG)
+/*
+ *  Returns true if the memory area is in the task cache or the depot.  The
+ *  allocator mutex must be owned by the caller.
+ */
+static bool malloc_cache_contains(
+  const Malloc_cache_task *cache,
+  uint32_t                 class_index,
+  const Malloc_cache_area *area
+)
+{
+  const Malloc_cache_area *batch;
+  const Malloc_cache_area *other;
+
+  for ( other = cache->first[ class_index ] ; other ; other = other->next ) {
+    if ( other == area )
+      return true;
+  }
+
+  for (
+    batch = malloc_cache_depot.batches[ class_index ] ;
+    batch != NULL ;
+    batch = batch->next_batch
+  ) {
+    for ( other = batch ; other != NULL ; other = other->next ) {
+      if ( other == area )
+        return true;
+    }
+  }
+
+  return false;
+}
+#endif
+
+/*
+ *  Returns a batch of memory areas from the depot or the heap.  The
+ *  allocator mutex must be owned by the caller.
+ */
+static Malloc_cache_area *malloc_cache_get_batch(
+  uint32_t  class_index,
+  uint32_t *count
+)
+{
+  Malloc_cache_depot *depot = &malloc_cache_depot;
+  Malloc_cache_area  *batch = depot->batches[ class_index ];
+
+  if ( batch != NULL ) {
+    depot->batches[ class_index ] = batch->next_batch;
+    --depot->batch_count[ class_index ];
+    *count = MALLOC_CACHE_BATCH_SIZE;
+  } else {
+    uintptr_t const class_size = MALLOC_CACHE_MINIMUM_SIZE << class_index;
+    uint32_t        i;
+
+    for ( i = 0 ; i < MALLOC_CACHE_BATCH_SIZE ; ++i ) {
+      Malloc_cache_area *area =
+        _Heap_Allocate( RTEMS_Malloc_Heap, class_size );
+
+      if ( area == NULL )
+        break;
+
+      malloc_cache_statistics_at_heap_allocate( area );
+
+      area->next = batch;
+      batch = area;
+    }
+
+    *count = i;
+  }
+
+  return batch;
+}
+
+/*
+ *  Puts a batch of memory areas into the depot or returns them to the heap
+ *  if the depot is full.  The allocator mutex must be owned by the caller.
+ */
+static void malloc_cache_put_batch(
+  uint32_t           class_index,
+  Malloc_cache_area *batch
+)
+{
+  Malloc_cache_depot *depot = &malloc_cache_depot;
+
+  if ( depot->batch_count[ class_index ] < MALLOC_CACHE_DEPOT_LIMIT ) {
+    batch->next_batch = depot->batches[ class_index ];
+    depot->batches[ class_index ] = batch;
+    ++depot->batch_count[ class_index ];
+  } else {
+    while ( batch != NULL ) {
+      Malloc_cache_area *next = batch->next;
+
+      malloc_cache_statistics_at_heap_free( batch );
+      _Heap_Free( RTEMS_Malloc_Heap, batch );
+      batch = next;
+    }
+  }
+}
+
+/*
+ *  The user extension is created during system initialization, so that no
+ *  other user extension used its slot before.
+ */
+static void malloc_cache_initialize( void )
+{
+  rtems_id          id;
+  rtems_status_code sc;
+
+  sc = rtems_extension_create(
+    rtems_build_name( 'M', 'C', 'A', 'C' ),
+    &malloc_cache_extension_table,
+    &id
+  );
+  if ( sc != RTEMS_SUCCESSFUL )
+    rtems_fatal_error_occurred( sc );
+
+  malloc_cache_extension_index = _Objects_Get_index( id );
+}
+
+static void *malloc_cache_allocate( size_t size )
+{
+  Malloc_cache_task *cache;
+  Malloc_cache_area *area;
+  uint32_t           class_index;
+  ISR_Level          level;
+
+  if ( size > MALLOC_CACHE_MAXIMUM_SIZE )
+    return NULL;
+
+  cache = malloc_cache_get_task_cache();
+  if ( cache == NULL )
+    return NULL;
+
+  class_index = malloc_cache_class_of_size( size );
+
+  if ( cache->count[ class_index ] == 0 ) {
+    uint32_t count;
+
+    _RTEMS_Lock_allocator();
+      area = malloc_cache_get_batch( class_index, &count );
+    _RTEMS_Unlock_allocator();
+
+    if ( area == NULL )
+      return NULL;
+
+    _ISR_Disable_on_this_core( level );
+      cache->first[ class_index ] = area;
+      cache->count[ class_index ] = count;
+    _ISR_Enable_on_this_core( level );
+  }
+
+  /*
+   *  Protect against the task delete extension.
+   */
+  _ISR_Disable_on_this_core( level );
+    area = cache->first[ class_index ];
+    cache->first[ class_index ] = area->next;
+    --cache->count[ class_index ];
+  _ISR_Enable_on_this_core( level );
+
+  if ( rtems_malloc_statistics_helpers ) {
+    uintptr_t size = 0;
+
+    _Heap_Size_of_alloc_area( RTEMS_Malloc_Heap, area, &size );
+    malloc_cache_statistics_update_cached( (uint32_t) -size );
+  }
+
+  return area;
+}
+
+static bool malloc_cache_free( void *ptr )
+{
+  Heap_Control      *heap = RTEMS_Malloc_Heap;
+  Heap_Block        *block;
+  Heap_Block        *next_block;
+  Malloc_cache_task *cache;
+  Malloc_cache_area *area = ptr;
+  Malloc_cache_area *batch = NULL;
+  uintptr_t          usable_size;
+  uint32_t           class_index;
+  ISR_Level          level;
+
+  /*
+   *  The size of a used block is stable, so it can be read without the
+   *  allocator mutex.  Invalid pointers are left to _Heap_Free().
+   */
+  block = _Heap_Block_of_alloc_area( (uintptr_t) ptr, heap->page_size );
+  if ( !_Heap_Is_block_in_heap( heap, block ) )
+    return false;
+
+  next_block = _Heap_Block_at( block, _Heap_Block_size( block ) );
+  if (
+    !_Heap_Is_block_in_heap( heap, next_block )
+      || !_Heap_Is_prev_used( next_block )
+  )
+    return false;
+
+  usable_size = (uintptr_t) next_block - (uintptr_t) ptr + HEAP_ALLOC_BONUS;
+  if (
+    usable_size < MALLOC_CACHE_MINIMUM_SIZE
+      || usable_size >= 2 * MALLOC_CACHE_MAXIMUM_SIZE
+  )
+    return false;
+
+  cache = malloc_cache_get_task_cache();
+  if ( cache == NULL )
+    return false;
+
+  class_index = malloc_cache_class_of_area( usable_size );
+
+#if defined(RTEMS_DEBUG)
+  /*
+   *  A cached memory area is still a used block of the heap, so the heap
+   *  cannot detect a second free of it.  Only the owner task changes its
+   *  cache, so the search needs only the allocator mutex for the depot.
+   */
+  {
+    bool is_cached;
+
+    _RTEMS_Lock_allocator();
+      is_cached = malloc_cache_contains( cache, class_index, area );
+    _RTEMS_Unlock_allocator();
+
+    if ( is_cached ) {
+      printk( "Program heap: free of cached pointer %p\n", ptr );
+      return true;
+    }
+  }
+#endif
+
+  if ( rtems_malloc_statistics_helpers )
+    malloc_cache_statistics_update_cached( (uint32_t) usable_size );
+
+  _ISR_Disable_on_this_core( level );
+    area->next = cache->first[ class_index ];
+    cache->first[ class_index ] = area;
+
+    /*
+     *  Flush the older batch to the depot if the cache is full.
+     */
+    if ( ++cache->count[ class_index ] == 2 * MALLOC_CACHE_BATCH_SIZE ) {
+      Malloc_cache_area *last = area;
+      uint32_t           i;
+
+      for ( i = 1 ; i < MALLOC_CACHE_BATCH_SIZE ; ++i ) {
+        last = last->next;
+      }
+
+      batch = last->next;
+      last->next = NULL;
+      cache->count[ class_index ] = MALLOC_CACHE_BATCH_SIZE;
+    }
+  _ISR_Enable_on_this_core( level );
+
+  if ( batch != NULL ) {
+    _RTEMS_Lock_allocator();
+      malloc_cache_put_batch( class_index, batch );
+    _RTEMS_Unlock_allocator();
+  }
+
+  return true;
+}
+
+static void malloc_cache_delete_hook(
+  rtems_tcb *current_task,
+  rtems_tcb *deleted_task
+)
+{
+  uint32_t           index = malloc_cache_extension_index;
+  Malloc_cache_task *cache = deleted_task->extensions[ index ];
+  uint32_t           class_index;
+
+  if ( cache == NULL )
+    return;
+
+  deleted_task->extensions[ index ] = NULL;
+
+  _RTEMS_Lock_allocator();
+    for (
+      class_index = 0 ;
+      class_index < MALLOC_CACHE_CLASS_COUNT ;
+      ++class_index
+    ) {
+      Malloc_cache_area *area = cache->first[ class_index ];
+
+      while ( area != NULL ) {
+        Malloc_cache_area *next = area->next;
+
+        malloc_cache_statistics_at_heap_free( area );
+        _Heap_Free( RTEMS_Malloc_Heap, area );
+        area = next;
+      }
+    }
+
+    _Heap_Free( RTEMS_Malloc_Heap, cache );
+  _RTEMS_Unlock_allocator();
+}
+
+rtems_malloc_cache_functions_t rtems_malloc_cache_helpers_table = {
+  malloc_cache_initialize,
+  malloc_cache_allocate,
+  malloc_cache_free
+};
+
+#endif
@@ -95,17 +95,36 @@ void RTEMS_Malloc_Initialize(
    */
 
   if ( separate_areas ) {
-    uintptr_t status = _Protected_heap_Initialize(
-      RTEMS_Malloc_Heap,
-      heap_begin,
-      heap_size,
-      CPU_HEAP_ALIGNMENT
-    );
+    uintptr_t status = 0;
+
+    if ( rtems_configuration_get_malloc_segregated_fit() ) {
+      status = _Protected_heap_Initialize_segregated_fit(
+        RTEMS_Malloc_Heap,
+        heap_begin,
+        heap_size,
+        CPU_HEAP_ALIGNMENT
+      );
+    } else {
+      status = _Protected_heap_Initialize(
+        RTEMS_Malloc_Heap,
+        heap_begin,
+        heap_size,
+        CPU_HEAP_ALIGNMENT
+      );
+    }
     if ( status == 0 ) {
       rtems_fatal_error_occurred( RTEMS_NO_MEMORY );
     }
   }
 
+  /*
+   *  If configured, initialize the per task cache.  It creates a user
+   *  extension, so the heap must be ready.
+   */
+  if ( rtems_malloc_cache_helpers != NULL ) {
+    (*rtems_malloc_cache_helpers->initialize)();
+  }
+
   MSBUMP( space_available, _Protected_heap_Get_size(RTEMS_Malloc_Heap) );
 }
 #endif
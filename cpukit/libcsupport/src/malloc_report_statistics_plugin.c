@@ -24,7 +24,8 @@ void malloc_report_statistics_with_plugin(
 {
   rtems_malloc_statistics_t *s = &rtems_malloc_statistics;
   uint32_t space_available = s->space_available;
-  uint32_t allocated = (uint32_t) (s->lifetime_allocated - s->lifetime_freed);
+  uint32_t allocated = (uint32_t) (s->lifetime_allocated - s->lifetime_freed)
+    - s->cached;
   uint32_t max_depth = s->max_depth;
     /* avoid float! */
   uint32_t allocated_per_cent = (allocated * 100) / space_available;
@@ -54,6 +55,16 @@ void malloc_report_statistics_with_plugin(
     s->realloc_calls,
     s->calloc_calls
   );
+  if ( rtems_malloc_cache_helpers ) {
+    (*print)(
+      context,
+      "  Task cache:    malloc:%"PRIu32"   free:%"PRIu32"   cached:%"PRIu32
+        "k\n",
+      s->cache_malloc_hits,
+      s->cache_free_hits,
+      s->cached / 1024
+    );
+  }
 }
 
 #endif
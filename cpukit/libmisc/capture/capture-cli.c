@@ -1303,6 +1303,8 @@ rtems_capture_cli_trace_records (int                          argc,
   int                     count;
   uint32_t                read;
   rtems_capture_record_t* rec;
+  uint32_t                overflows = 0;
+  uint32_t                b;
   int                     arg;
 
   for (arg = 1; arg < argc; arg++)
@@ -1361,20 +1363,22 @@ rtems_capture_cli_trace_records (int                          argc,
     while (count--)
     {
       if (csv)
-        fprintf (stdout, "%08" PRIxPTR ",%03" PRIu32
+        fprintf (stdout, "%08" PRIx32 ",%03" PRIu32
                    ",%03" PRIu32 ",%04" PRIx32 ",%" PRId32 ",%" PRId32 "\n",
-                (uintptr_t) rec->task,
+                rec->task_id,
                 (rec->events >> RTEMS_CAPTURE_REAL_PRIORITY_EVENT) & 0xff,
                 (rec->events >> RTEMS_CAPTURE_CURR_PRIORITY_EVENT) & 0xff,
                 (rec->events >> RTEMS_CAPTURE_EVENT_START),
                 rec->ticks, rec->tick_offset);
       else
       {
-        unsigned long long t;
-        uint32_t     event;
-        int                e;
+        unsigned long long    t;
+        uint32_t              event;
+        int                   e;
+        rtems_capture_task_t* task;
 
         event = rec->events >> RTEMS_CAPTURE_EVENT_START;
+        task  = rtems_capture_find_task (rec->task_id);
 
         t  = rec->ticks;
         t *= rtems_capture_tick_time ();
@@ -1386,9 +1390,10 @@ rtems_capture_cli_trace_records (int                          argc,
           {
             fprintf (stdout, "%9li.%06li ", (unsigned long) (t / 1000000),
                     (unsigned long) (t % 1000000));
-            rtems_monitor_dump_id (rtems_capture_task_id (rec->task));
+            rtems_monitor_dump_id (rec->task_id);
             fprintf (stdout, " ");
-            rtems_monitor_dump_name (rtems_capture_task_name (rec->task));
+            rtems_monitor_dump_name (task ?
+                                     rtems_capture_task_name (task) : 0);
             fprintf (stdout, " %3" PRId32 " %3" PRId32 " %s\n",
                     (rec->events >> RTEMS_CAPTURE_REAL_PRIORITY_EVENT) & 0xff,
                     (rec->events >> RTEMS_CAPTURE_CURR_PRIORITY_EVENT) & 0xff,
@@ -1409,6 +1414,13 @@ rtems_capture_cli_trace_records (int                          argc,
 
     rtems_capture_release (count);
   }
+
+  for (b = 0; b < rtems_capture_buffer_count (); b++)
+    overflows += rtems_capture_buffer_overflows (b);
+
+  if (overflows)
+    fprintf (stdout, "warning: %" PRIu32 " records lost to overflow\n",
+             overflows);
 }
 
 /*
@@ -25,10 +25,13 @@
 #include "config.h"
 #endif
 
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "capture.h"
+#include <rtems/score/atomic.h>
 #include <rtems/score/states.inl>
 #include <rtems/score/wkspace.h>
 #include <rtems/score/wkspace.inl>
@@ -67,14 +70,42 @@
 #define RTEMS_CAPTURE_GLOBAL_WATCH   (1U << 6)
 #define RTEMS_CAPTURE_ONLY_MONITOR   (1U << 7)
 
+/*
+ * The processor a capture record is made on and the number of
+ * processors.
+ */
+#if defined (RTEMS_SMP)
+#define rtems_capture_processor()       rtems_smp_get_current_processor ()
+#define rtems_capture_processor_count() rtems_smp_get_number_of_processors ()
+#else
+#define rtems_capture_processor()       (0)
+#define rtems_capture_processor_count() (1)
+#endif
+
+/*
+ * The capture buffer of a processor. A processor records into its own
+ * buffer with only its interrupts disabled so a context switch never
+ * waits for another processor. The free running 'in' index is only
+ * written by the processor and the free running 'out' index only by
+ * the reader so the buffer needs no lock. The record is written before
+ * the 'in' index moves. The SMP ports order stores so a compiler barrier
+ * is enough to publish the record to the reader.
+ */
+typedef struct rtems_capture_buffer_s
+{
+  rtems_capture_record_t* records;
+  uint32_t                size;
+  volatile uint32_t       in;
+  volatile uint32_t       out;
+  volatile uint32_t       overflows;
+} rtems_capture_buffer_t;
+
 /*
  * RTEMS Capture Data.
  */
-static rtems_capture_record_t*  capture_records;
-static uint32_t                 capture_size;
-static uint32_t                 capture_count;
-static rtems_capture_record_t*  capture_in;
-static uint32_t                 capture_out;
+static rtems_capture_buffer_t*  capture_buffers;
+static uint32_t                 capture_buffer_count;
+static rtems_capture_buffer_t*  capture_read_buffer;
 static uint32_t                 capture_flags;
 static rtems_capture_task_t*    capture_tasks;
 static rtems_capture_control_t* capture_controls;
@@ -85,6 +116,12 @@ static rtems_task_priority      capture_ceiling;
 static rtems_task_priority      capture_floor;
 static uint32_t                 capture_tick_period;
 static rtems_id                 capture_reader;
+static rtems_id                 capture_drain_id;
+static rtems_id                 capture_drain_waiter;
+static volatile bool            capture_drain_stop;
+static int                      capture_drain_fd;
+static rtems_interval           capture_drain_period;
+static int                      capture_drain_errno;
 
 /*
  * RTEMS Event text.
@@ -251,36 +288,6 @@ rtems_capture_by_in_to (uint32_t                 events,
   return 0;
 }
 
-/*
- * rtems_capture_refcount_up
- *
- *  DESCRIPTION:
- *
- * This function raises the reference count.
- *
- */
-static inline void
-rtems_capture_refcount_up (rtems_capture_task_t* task)
-{
-  task->refcount++;
-}
-
-/*
- * rtems_capture_refcount_down
- *
- *  DESCRIPTION:
- *
- * This function lowers the reference count and if the count
- * reaches 0 the task control block is returned to the heap.
- *
- */
-static inline void
-rtems_capture_refcount_down (rtems_capture_task_t* task)
-{
-  if (task->refcount)
-    task->refcount--;
-}
-
 /*
  * rtems_capture_init_stack_usage
  *
@@ -417,8 +424,8 @@ rtems_capture_create_capture_task (rtems_tcb* new_task)
 
   task->id               = new_task->Object.id;
   task->flags            = 0;
-  task->in               = 0;
   task->refcount         = 0;
+  task->in               = 0;
   task->out              = 0;
   task->tcb              = new_task;
   task->ticks            = 0;
@@ -464,8 +471,9 @@ rtems_capture_create_capture_task (rtems_tcb* new_task)
  *  DESCRIPTION:
  *
  * This function destroy the task structure if the reference count
- * is 0 and the tcb has been cleared signalling the task has been
- * deleted.
+ * is zero and the tcb has been cleared signalling the task has been
+ * deleted. The records only hold the task id so the task is kept for
+ * the decoder until the last record referring to it is released.
  *
  */
 static inline void
@@ -496,12 +504,35 @@ rtems_capture_destroy_capture_task (rtems_capture_task_t* task)
   }
 }
 
+/*
+ * rtems_capture_refcount_add
+ *
+ *  DESCRIPTION:
+ *
+ * This function adds the delta to the reference count of the task. Any
+ * processor can record a task, so the count is changed atomically.
+ * Interrupts must be disabled.
+ *
+ */
+static inline void
+rtems_capture_refcount_add (rtems_capture_task_t* task, uint32_t delta)
+{
+  uint32_t refcount;
+
+  do {
+    refcount = task->refcount;
+  } while (!_Atomic_Compare_and_swap_uint32 (&task->refcount,
+                                             refcount, refcount + delta));
+}
+
 /*
  * rtems_capture_record
  *
  *  DESCRIPTION:
  *
- * This function records a capture record into the capture buffer.
+ * This function records a capture record into the capture buffer
+ * of the current processor. The record holds a reference to the task
+ * until it is released.
  *
  */
 static inline void
@@ -533,32 +564,54 @@ rtems_capture_record (rtems_capture_task_t* task,
          ((capture_flags & RTEMS_CAPTURE_GLOBAL_WATCH) ||
           (control && (control->flags & RTEMS_CAPTURE_WATCH)))))
     {
-      rtems_interrupt_level level;
+      rtems_interrupt_level   level;
+      rtems_capture_buffer_t* buffer;
+      uint32_t                in;
 
       rtems_interrupt_disable (level);
 
-      if (capture_count < capture_size)
+      /*
+       * A close clears the buffers before it deletes the extension.
+       */
+      buffer = capture_buffers;
+
+      if (buffer == NULL)
       {
-        capture_count++;
-        capture_in->task   = task;
-        capture_in->events = (events |
-                              (task->tcb->real_priority) |
-                              (task->tcb->current_priority << 8));
+        rtems_interrupt_enable (level);
+        return;
+      }
+
+      buffer += rtems_capture_processor ();
+      in      = buffer->in;
+
+      if ((in - buffer->out) < buffer->size)
+      {
+        rtems_capture_record_t* rec;
+
+        rec = &buffer->records[in & (buffer->size - 1)];
+
+        rec->task_id = task->id;
+        rec->events  = (events |
+                        (task->tcb->real_priority) |
+                        (task->tcb->current_priority << 8));
 
         if ((events & RTEMS_CAPTURE_RECORD_EVENTS) == 0)
           task->flags |= RTEMS_CAPTURE_TRACED;
 
-        rtems_capture_get_time (&capture_in->ticks, &capture_in->tick_offset);
+        rtems_capture_refcount_add (task, 1);
 
-        if (capture_in == &capture_records[capture_size - 1])
-          capture_in = capture_records;
-        else
-          capture_in++;
+        rtems_capture_get_time (&rec->ticks, &rec->tick_offset);
+
+        RTEMS_COMPILER_MEMORY_BARRIER ();
 
-        rtems_capture_refcount_up (task);
+        buffer->in = in + 1;
       }
       else
+      {
+        buffer->overflows++;
         capture_flags |= RTEMS_CAPTURE_OVERFLOW;
+      }
+
       rtems_interrupt_enable (level);
     }
   }
@@ -910,11 +963,7 @@ rtems_capture_switch_task (rtems_tcb* current_task,
     if (_States_Is_transient (current_task->current_state)
      || _States_Is_dormant (current_task->current_state))
     {
-      rtems_id ct_id = current_task->Object.id;
-
-      for (ct = capture_tasks; ct; ct = ct->forw)
-        if (ct->id == ct_id)
-          break;
+      ct = rtems_capture_find_task (current_task->Object.id);
     }
     else
     {
@@ -984,32 +1033,64 @@ rtems_capture_switch_task (rtems_tcb* current_task,
  *  DESCRIPTION:
  *
  * This function initialises the realtime capture engine allocating the trace
- * buffer. It is assumed we have a working heap at stage of initialisation.
+ * buffers. Each processor has a buffer of 'size' records. It is assumed we
+ * have a working heap at stage of initialisation.
  *
  */
 rtems_status_code
 rtems_capture_open (uint32_t   size, rtems_capture_timestamp timestamp __attribute__((unused)))
 {
-  rtems_extensions_table capture_extensions;
-  rtems_name             name;
-  rtems_status_code      sc;
+  rtems_extensions_table  capture_extensions;
+  rtems_name              name;
+  rtems_status_code       sc;
+  rtems_capture_record_t* records;
+  uint32_t                count;
+  uint32_t                b;
 
   /*
    * See if the capture engine is already open.
    */
 
-  if (capture_records)
+  if (capture_buffers)
     return RTEMS_RESOURCE_IN_USE;
 
-  capture_records = malloc (size * sizeof (rtems_capture_record_t));
+  if ((size == 0) || (size > (UINT32_C (1) << 31)))
+    return RTEMS_INVALID_SIZE;
+
+  /*
+   * The free running indices only wrap correctly with a power of two
+   * buffer size.
+   */
+  while (size & (size - 1))
+    size += size & -size;
+
+  count = rtems_capture_processor_count ();
 
-  if (capture_records == NULL)
+  capture_buffers = malloc (count * sizeof (rtems_capture_buffer_t));
+
+  if (capture_buffers == NULL)
+    return RTEMS_NO_MEMORY;
+
+  records = malloc (count * size * sizeof (rtems_capture_record_t));
+
+  if (records == NULL)
+  {
+    free (capture_buffers);
+    capture_buffers = NULL;
     return RTEMS_NO_MEMORY;
+  }
+
+  for (b = 0; b < count; b++)
+  {
+    capture_buffers[b].records   = &records[b * size];
+    capture_buffers[b].size      = size;
+    capture_buffers[b].in        = 0;
+    capture_buffers[b].out       = 0;
+    capture_buffers[b].overflows = 0;
+  }
 
-  capture_size    = size;
-  capture_count   = 0;
-  capture_in      = capture_records;
-  capture_out     = 0;
+  capture_buffer_count = count;
+  capture_read_buffer  = NULL;
   capture_flags   = 0;
   capture_tasks   = NULL;
   capture_ceiling = 0;
@@ -1042,8 +1123,9 @@ rtems_capture_open (uint32_t   size, rtems_capture_timestamp timestamp __attribu
   if (sc != RTEMS_SUCCESSFUL)
   {
     capture_id = 0;
-    free (capture_records);
-    capture_records = NULL;
+    free (capture_buffers[0].records);
+    free (capture_buffers);
+    capture_buffers = NULL;
   }
   else
   {
@@ -1071,21 +1153,25 @@ rtems_capture_close (void)
   rtems_interrupt_level    level;
   rtems_capture_task_t*    task;
   rtems_capture_control_t* control;
-  rtems_capture_record_t*  records;
+  rtems_capture_buffer_t*  buffers;
   rtems_status_code        sc;
 
-  rtems_interrupt_disable (level);
-
-  if (!capture_records)
-  {
-    rtems_interrupt_enable (level);
+  if (!capture_buffers)
     return RTEMS_SUCCESSFUL;
-  }
+
+  /*
+   * The drain task reads the buffers so stop it first. A write error
+   * has been reported to the drain task and is not an error here.
+   */
+
+  rtems_capture_drain_stop ();
+
+  rtems_interrupt_disable (level);
 
   capture_flags &= ~(RTEMS_CAPTURE_ON | RTEMS_CAPTURE_ONLY_MONITOR);
 
-  records = capture_records;
-  capture_records = NULL;
+  buffers = capture_buffers;
+  capture_buffers = NULL;
 
   rtems_interrupt_enable (level);
 
@@ -1121,11 +1207,8 @@ rtems_capture_close (void)
 
   capture_controls = NULL;
 
-  if (capture_records)
-  {
-    free (capture_records);
-    capture_records = NULL;
-  }
+  free (buffers[0].records);
+  free (buffers);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -1144,7 +1227,7 @@ rtems_capture_control (bool enable)
 
   rtems_interrupt_disable (level);
 
-  if (!capture_records)
+  if (!capture_buffers)
   {
     rtems_interrupt_enable (level);
     return RTEMS_UNSATISFIED;
@@ -1176,7 +1259,7 @@ rtems_capture_monitor (bool enable)
 
   rtems_interrupt_disable (level);
 
-  if (!capture_records)
+  if (!capture_buffers)
   {
     rtems_interrupt_enable (level);
     return RTEMS_UNSATISFIED;
@@ -1205,6 +1288,7 @@ rtems_capture_flush (bool prime)
 {
   rtems_interrupt_level level;
   rtems_capture_task_t* task;
+  uint32_t              b;
 
   rtems_interrupt_disable (level);
 
@@ -1219,12 +1303,22 @@ rtems_capture_flush (bool prime)
   else
     capture_flags &= ~RTEMS_CAPTURE_OVERFLOW;
 
-  capture_count = 0;
-  capture_in    = capture_records;
-  capture_out   = 0;
-
   rtems_interrupt_enable (level);
 
+  /*
+   * The buffers are emptied from the reader side. A processor which
+   * records at the same time only adds to its buffer.
+   */
+
+  if (capture_buffers)
+  {
+    for (b = 0; b < capture_buffer_count; b++)
+    {
+      capture_buffers[b].out       = capture_buffers[b].in;
+      capture_buffers[b].overflows = 0;
+    }
+  }
+
   task = capture_tasks;
 
   while (task)
@@ -1670,6 +1764,72 @@ rtems_capture_clear_trigger (rtems_name                   from_name,
   return RTEMS_SUCCESSFUL;
 }
 
+/*
+ * rtems_capture_record_before
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns true if the lhs record was made before the
+ * rhs record. The tick count is allowed to wrap.
+ */
+static inline bool
+rtems_capture_record_before (const rtems_capture_record_t* lhs,
+                             const rtems_capture_record_t* rhs)
+{
+  int32_t delta = (int32_t) (lhs->ticks - rhs->ticks);
+
+  return (delta < 0) ||
+    ((delta == 0) && (lhs->tick_offset < rhs->tick_offset));
+}
+
+/*
+ * rtems_capture_oldest_buffer
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the buffer holding the oldest record and the
+ * number of records held by all buffers. NULL is returned if the buffers
+ * are empty. The records of a processor are in order so only the first
+ * record of each buffer is checked.
+ */
+static rtems_capture_buffer_t*
+rtems_capture_oldest_buffer (uint32_t* total)
+{
+  rtems_capture_buffer_t* oldest = NULL;
+  rtems_capture_record_t* oldest_rec = NULL;
+  uint32_t                b;
+
+  *total = 0;
+
+  for (b = 0; b < capture_buffer_count; b++)
+  {
+    rtems_capture_buffer_t* buffer = &capture_buffers[b];
+    uint32_t                count = buffer->in - buffer->out;
+
+    if (count)
+    {
+      rtems_capture_record_t* rec;
+
+      rec = &buffer->records[buffer->out & (buffer->size - 1)];
+
+      if (!oldest || rtems_capture_record_before (rec, oldest_rec))
+      {
+        oldest     = buffer;
+        oldest_rec = rec;
+      }
+
+      *total += count;
+    }
+  }
+
+  /*
+   * The records are read after the 'in' index.
+   */
+  RTEMS_COMPILER_MEMORY_BARRIER ();
+
+  return oldest;
+}
+
 /*
  * rtems_capture_read
  *
@@ -1680,12 +1840,14 @@ rtems_capture_clear_trigger (rtems_name                   from_name,
  * specific number of records available or a specific time has
  * elasped.
  *
- * The function returns the number of record that is has that are
- * in a continous block of memory. If the number of available records
+ * Each processor records into its own buffer. The function returns the
+ * number of records that are in a continous block of memory of the
+ * buffer with the oldest record. If the number of available records
  * wrap then only those records are provided. This removes the need for
  * caller to be concerned about buffer wrappings. If the number of
  * requested records cannot be met due to the wrapping of the records
- * less than the specified number will be returned.
+ * or records held by other processors less than the specified number
+ * will be returned.
  *
  * The user must release the records. This is achieved with a call to
  * rtems_capture_release. Calls this function without a release will
@@ -1707,9 +1869,10 @@ rtems_capture_read (uint32_t                 threshold,
                     uint32_t*                read,
                     rtems_capture_record_t** recs)
 {
-  rtems_interrupt_level level;
-  rtems_status_code     sc = RTEMS_SUCCESSFUL;
-  uint32_t              count;
+  rtems_interrupt_level   level;
+  rtems_status_code       sc = RTEMS_SUCCESSFUL;
+  rtems_capture_buffer_t* buffer;
+  uint32_t                count;
 
   *read = 0;
   *recs = NULL;
@@ -1727,23 +1890,33 @@ rtems_capture_read (uint32_t                 threshold,
   }
 
   capture_flags |= RTEMS_CAPTURE_READER_ACTIVE;
-  *read = count = capture_count;
 
   rtems_interrupt_enable (level);
 
-  *recs = &capture_records[capture_out];
-
   for (;;)
   {
-    /*
-     * See if the count wraps the end of the record buffer.
-     */
-    if (count && ((capture_out + count) >= capture_size))
-      *read = capture_size - capture_out;
+    buffer = rtems_capture_oldest_buffer (&count);
+    *read  = 0;
+
+    if (buffer)
+    {
+      uint32_t out = buffer->out & (buffer->size - 1);
+
+      *read = buffer->in - buffer->out;
+
+      /*
+       * See if the count wraps the end of the record buffer.
+       */
+      if ((out + *read) > buffer->size)
+        *read = buffer->size - out;
+
+      *recs = &buffer->records[out];
+    }
 
     /*
      * Do we have a threshold and the current count has not wrapped
-     * around the end of the capture record buffer ?
+     * around the end of the capture record buffer and is not split
+     * over the buffers of the processors ?
      */
     if ((*read == count) && threshold)
     {
@@ -1775,12 +1948,6 @@ rtems_capture_read (uint32_t                 threshold,
         if ((sc != RTEMS_SUCCESSFUL) && (sc != RTEMS_TIMEOUT))
           break;
 
-        rtems_interrupt_disable (level);
-
-        *read = count = capture_count;
-
-        rtems_interrupt_enable (level);
-
         continue;
       }
     }
@@ -1791,54 +1958,268 @@ rtems_capture_read (uint32_t                 threshold,
     break;
   }
 
+  capture_read_buffer = buffer;
+
   return sc;
 }
 
+/*
+ * rtems_capture_find_referenced_task
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the task referenced by a record with the id or
+ * NULL if there is none. The id of a deleted task can be reused while
+ * records still refer to it. New tasks are added to the front of the
+ * list and the records are released in order, so the oldest task with
+ * references is the one referenced by the record.
+ */
+static rtems_capture_task_t*
+rtems_capture_find_referenced_task (rtems_id id)
+{
+  rtems_capture_task_t* task;
+  rtems_capture_task_t* referenced = NULL;
+
+  for (task = capture_tasks; task != NULL; task = task->forw)
+    if ((task->id == id) && task->refcount)
+      referenced = task;
+
+  return referenced;
+}
+
 /*
  * rtems_capture_release
  *
  *  DESCRIPTION:
  *
  * This function releases the requested number of record slots back
- * to the capture engine. The count must match the number read.
+ * to the capture engine. The count must match the number read. The
+ * records drop their task references, and a deleted task is destroyed
+ * with its last record.
  */
 rtems_status_code
 rtems_capture_release (uint32_t count)
 {
-  rtems_capture_record_t* rec;
-  uint32_t                counted;
+  rtems_capture_buffer_t* buffer = capture_read_buffer;
+  rtems_interrupt_level   level;
 
-  rtems_interrupt_level level;
+  if (buffer)
+  {
+    rtems_capture_task_t* task = NULL;
+    uint32_t              out = buffer->out;
+    uint32_t              r;
+
+    if (count > (buffer->in - out))
+      count = buffer->in - out;
+
+    for (r = 0; r < count; r++)
+    {
+      rtems_capture_record_t* rec;
+
+      rec = &buffer->records[(out + r) & (buffer->size - 1)];
+
+      /*
+       * Consecutive records often refer to the same task.
+       */
+      if (!task || (task->id != rec->task_id) || !task->refcount)
+        task = rtems_capture_find_referenced_task (rec->task_id);
+
+      if (task)
+      {
+        rtems_interrupt_disable (level);
+        rtems_capture_refcount_add (task, (uint32_t) -1);
+        rtems_interrupt_enable (level);
+
+        if (task->refcount == 0 && task->tcb == NULL)
+        {
+          rtems_capture_destroy_capture_task (task);
+          task = NULL;
+        }
+      }
+    }
+
+    /*
+     * The records are read before the slots are handed back to the
+     * processor.
+     */
+    RTEMS_COMPILER_MEMORY_BARRIER ();
+
+    buffer->out = out + count;
+  }
+
+  capture_read_buffer = NULL;
 
   rtems_interrupt_disable (level);
 
-  if (count > capture_count)
-    count = capture_count;
+  capture_flags &= ~RTEMS_CAPTURE_READER_ACTIVE;
 
   rtems_interrupt_enable (level);
 
-  counted = count;
+  return RTEMS_SUCCESSFUL;
+}
+
+/*
+ * rtems_capture_drain_task
+ *
+ *  DESCRIPTION:
+ *
+ * This function is the body of the drain task. The records are written
+ * as is to the file descriptor. The records stay in the buffers if the
+ * write fails and the processors account the records they cannot
+ * record as overflows.
+ */
+static rtems_task
+rtems_capture_drain_task (rtems_task_argument arg __attribute__((unused)))
+{
+  while (!capture_drain_stop)
+  {
+    rtems_capture_record_t* recs;
+    uint32_t                read;
+
+    if (rtems_capture_read (0, 0, &read, &recs) != RTEMS_SUCCESSFUL)
+      read = 0;
 
-  rec = &capture_records[capture_out];
+    if (read && !capture_drain_errno)
+    {
+      const char* data = (const char*) recs;
+      size_t      left = read * sizeof (rtems_capture_record_t);
 
-  while (counted--)
+      /*
+       * A socket can take less than the whole block.
+       */
+      while (left)
+      {
+        ssize_t written = write (capture_drain_fd, data, left);
+
+        if (written < 0)
+        {
+          capture_drain_errno = errno;
+          break;
+        }
+
+        data += written;
+        left -= written;
+      }
+    }
+
+    if (capture_drain_errno)
+      read = 0;
+
+    rtems_capture_release (read);
+
+    if (read == 0)
+      rtems_task_wake_after (capture_drain_period);
+  }
+
+  rtems_event_send (capture_drain_waiter, RTEMS_EVENT_0);
+  rtems_task_delete (RTEMS_SELF);
+}
+
+/*
+ * rtems_capture_drain_start
+ *
+ *  DESCRIPTION:
+ *
+ * This function starts a task which drains the capture buffers and
+ * writes the records as is to a file descriptor.
+ */
+rtems_status_code
+rtems_capture_drain_start (rtems_task_priority priority,
+                           int                 fd,
+                           rtems_interval      period)
+{
+  rtems_status_code sc;
+  rtems_name        name;
+
+  if (!capture_buffers)
+    return RTEMS_UNSATISFIED;
+
+  if (capture_drain_id)
+    return RTEMS_RESOURCE_IN_USE;
+
+  capture_drain_fd     = fd;
+  capture_drain_period = period ? period : 1;
+  capture_drain_errno  = 0;
+  capture_drain_stop   = false;
+
+  name = rtems_build_name ('C', 'D', 'R', 'N');
+  sc   = rtems_task_create (name, priority, RTEMS_MINIMUM_STACK_SIZE * 2,
+                            RTEMS_NO_FLOATING_POINT | RTEMS_LOCAL,
+                            RTEMS_PREEMPT | RTEMS_TIMESLICE | RTEMS_NO_ASR,
+                            &capture_drain_id);
+
+  if (sc != RTEMS_SUCCESSFUL)
   {
-    rtems_capture_refcount_down (rec->task);
-    rtems_capture_destroy_capture_task (rec->task);
-    rec++;
+    capture_drain_id = 0;
+    return sc;
   }
 
-  rtems_interrupt_disable (level);
+  sc = rtems_task_start (capture_drain_id, rtems_capture_drain_task, 0);
 
-  capture_count -= count;
+  if (sc != RTEMS_SUCCESSFUL)
+  {
+    rtems_task_delete (capture_drain_id);
+    capture_drain_id = 0;
+  }
 
-  capture_out = (capture_out + count) % capture_size;
+  return sc;
+}
 
-  capture_flags &= ~RTEMS_CAPTURE_READER_ACTIVE;
+/*
+ * rtems_capture_drain_stop
+ *
+ *  DESCRIPTION:
+ *
+ * This function stops the drain task and waits for it to finish the
+ * write in progress.
+ */
+rtems_status_code
+rtems_capture_drain_stop (void)
+{
+  rtems_event_set event_out;
 
-  rtems_interrupt_enable (level);
+  if (!capture_drain_id)
+    return RTEMS_SUCCESSFUL;
 
-  return RTEMS_SUCCESSFUL;
+  rtems_task_ident (RTEMS_SELF, RTEMS_LOCAL, &capture_drain_waiter);
+
+  capture_drain_stop = true;
+
+  rtems_event_receive (RTEMS_EVENT_0, RTEMS_WAIT | RTEMS_EVENT_ANY,
+                       RTEMS_NO_TIMEOUT, &event_out);
+
+  capture_drain_id = 0;
+
+  return capture_drain_errno ? RTEMS_IO_ERROR : RTEMS_SUCCESSFUL;
+}
+
+/*
+ * rtems_capture_buffer_count
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the number of capture buffers.
+ */
+uint32_t
+rtems_capture_buffer_count (void)
+{
+  return capture_buffers ? capture_buffer_count : 0;
+}
+
+/*
+ * rtems_capture_buffer_overflows
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the number of records the processor has lost
+ * because its buffer was full.
+ */
+uint32_t
+rtems_capture_buffer_overflows (uint32_t processor)
+{
+  if (!capture_buffers || (processor >= capture_buffer_count))
+    return 0;
+  return capture_buffers[processor].overflows;
 }
 
 /*
@@ -1885,6 +2266,26 @@ rtems_capture_get_task_list (void)
   return capture_tasks;
 }
 
+/*
+ * rtems_capture_find_task
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the task with the id or NULL if the capture
+ * engine does not know the task.
+ */
+rtems_capture_task_t*
+rtems_capture_find_task (rtems_id id)
+{
+  rtems_capture_task_t* task;
+
+  for (task = capture_tasks; task != NULL; task = task->forw)
+    if (task->id == id)
+      break;
+
+  return task;
+}
+
 /*
  * rtems_capture_task_stack_usage
  *
@@ -127,13 +127,13 @@ typedef struct rtems_capture_control_s
  *  DESCRIPTION:
  *
  * RTEMS capture control provdes the information about a task, along
- * with its trigger state. The control is referenced by each
- * capture record. This is information neeed by the decoder. The
+ * with its trigger state. The control is found by the task id held in
+ * each capture record. This is information neeed by the decoder. The
  * capture record cannot assume the task will exist when the record is
  * dumped via the target interface so task info needed for tracing is
- * copied and held here. Once the references in the trace buffer
- * have been removed and the task is deleted this structure is
- * released back to the heap.
+ * copied and held here. Each record in the buffers holds a reference
+ * to it. Once the task is deleted and the last record referring to it
+ * is released this structure is released back to the heap.
  *
  * The inline helper functions provide more details about the info
  * contained in this structure.
@@ -146,7 +146,7 @@ typedef struct rtems_capture_task_s
   rtems_name                   name;
   rtems_id                     id;
   uint32_t                     flags;
-  uint32_t                     refcount;
+  volatile uint32_t            refcount;
   rtems_tcb*                   tcb;
   uint32_t                     in;
   uint32_t                     out;
@@ -176,11 +176,13 @@ typedef struct rtems_capture_task_s
  *
  * RTEMS capture record. This is a record that is written into
  * the buffer. The events includes the priority of the task
- * at the time of the context switch.
+ * at the time of the context switch. The record is a compact binary
+ * record which holds the task id rather than a reference to the task
+ * control so it can be streamed off the target as is.
  */
 typedef struct rtems_capture_record_s
 {
-  rtems_capture_task_t* task;
+  rtems_id              task_id;
   uint32_t              events;
   uint32_t              ticks;
   uint32_t              tick_offset;
@@ -468,12 +470,14 @@ rtems_capture_clear_trigger (rtems_name                   from_name,
  * specific number of records available or a specific time has
  * elasped.
  *
- * The function returns the number of record that is has that are
- * in a continous block of memory. If the number of available records
+ * Each processor records into its own buffer. The function returns the
+ * number of records that are in a continous block of memory of the
+ * buffer with the oldest record. If the number of available records
  * wrap then only those records are provided. This removes the need for
  * caller to be concerned about buffer wrappings. If the number of
  * requested records cannot be met due to the wrapping of the records
- * less than the specified number will be returned.
+ * or records held by other processors less than the specified number
+ * will be returned.
  *
  * The user must release the records. This is achieved with a call to
  * rtems_capture_release. Calls this function without a release will
@@ -506,6 +510,56 @@ rtems_capture_read (uint32_t                 threshold,
 rtems_status_code
 rtems_capture_release (uint32_t count);
 
+/**
+ * rtems_capture_drain_start
+ *
+ *  DESCRIPTION:
+ *
+ * This function starts a task which drains the capture buffers and
+ * writes the records as is to a file descriptor. The file descriptor
+ * can be a file or a socket. The task polls the buffers every 'period'
+ * clock ticks. While the drain task runs it is the only reader of the
+ * capture engine.
+ */
+rtems_status_code
+rtems_capture_drain_start (rtems_task_priority priority,
+                           int                 fd,
+                           rtems_interval      period);
+
+/**
+ * rtems_capture_drain_stop
+ *
+ *  DESCRIPTION:
+ *
+ * This function stops the drain task. The file descriptor is not
+ * closed. The function returns RTEMS_IO_ERROR if a write to the file
+ * descriptor failed.
+ */
+rtems_status_code
+rtems_capture_drain_stop (void);
+
+/**
+ * rtems_capture_buffer_count
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the number of capture buffers. There is one
+ * buffer per processor.
+ */
+uint32_t
+rtems_capture_buffer_count (void);
+
+/**
+ * rtems_capture_buffer_overflows
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the number of records lost because the buffer
+ * of the processor was full. The count is reset by a flush.
+ */
+uint32_t
+rtems_capture_buffer_overflows (uint32_t processor);
+
 /**
  * rtems_capture_tick_time
  *
@@ -549,6 +603,17 @@ rtems_capture_event_text (int event);
 rtems_capture_task_t*
 rtems_capture_get_task_list (void);
 
+/**
+ * rtems_capture_find_task
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the task the capture engine knows by the id
+ * or NULL if the task is not known.
+ */
+rtems_capture_task_t*
+rtems_capture_find_task (rtems_id id);
+
 /**
  * rtems_capture_next_task
  *
@@ -88,7 +88,8 @@ void rtems_cpu_usage_report_with_plugin(
       information = _Objects_Information_table[ api_index ][ 1 ];
       if ( information ) {
         for ( i=1 ; i <= information->maximum ; i++ ) {
-          the_thread = (Thread_Control *)information->local_table[ i ];
+          the_thread = (Thread_Control *)
+            _Objects_Get_local_object( information, i );
 
           if ( the_thread )
             total_units += the_thread->cpu_time_used;
@@ -119,7 +120,8 @@ void rtems_cpu_usage_report_with_plugin(
     information = _Objects_Information_table[ api_index ][ 1 ];
     if ( information ) {
       for ( i=1 ; i <= information->maximum ; i++ ) {
-        the_thread = (Thread_Control *)information->local_table[ i ];
+        the_thread = (Thread_Control *)
+          _Objects_Get_local_object( information, i );
 
         if ( !the_thread )
           continue;
@@ -0,0 +1,435 @@
+/*
+ *  CPU Usage Sampler
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+
+#include <rtems/cpuuse.h>
+#include <rtems/score/atomic.h>
+
+/*
+ *  A snapshot holds the CPU time used by the thread in each slot of the
+ *  thread object tables at the end of an interval.  The sequence is odd
+ *  while the sampler writes the snapshot, so a reader detects a snapshot
+ *  which changed under it and tries again instead of blocking the sampler.
+ *  On SMP configurations the sampler and a reader may run on different
+ *  processors, so the sequence accesses are ordered by memory fences.
+ */
+typedef struct {
+  volatile uint32_t  sequence;
+  uint64_t           uptime;
+  rtems_id          *ids;
+  uint64_t          *used;
+} CPU_usage_Snapshot;
+
+/*
+ *  The sampler writes one snapshot while a reader may use the snapshots of
+ *  the last intervals, so two more snapshots than intervals are kept.
+ */
+static CPU_usage_Snapshot *CPU_usage_Snapshots;
+static uint32_t            CPU_usage_Snapshot_count;
+static uint32_t            CPU_usage_Slot_count;
+static volatile uint32_t   CPU_usage_Taken;
+static rtems_id            CPU_usage_Sampler_id;
+static rtems_id            CPU_usage_Sampler_waiter;
+static rtems_interval      CPU_usage_Sampler_period;
+static volatile bool       CPU_usage_Sampler_stop;
+
+/*
+ *  The number of readers in rtems_cpu_usage_get_samples().  It is protected
+ *  by disabled thread dispatching.  Once the sampler is stopped no reader
+ *  enters, and the last reader wakes up the stopping task, so the snapshots
+ *  are not freed under a reader.
+ */
+static uint32_t            CPU_usage_Readers;
+
+#ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+  static uint64_t CPU_usage_Nanoseconds(
+    const Timestamp_Control *time
+  )
+  {
+    return (uint64_t) _Timestamp_Get_seconds( time ) *
+      TOD_NANOSECONDS_PER_SECOND + _Timestamp_Get_nanoseconds( time );
+  }
+#endif
+
+/*
+ *  Returns the CPU time used by the thread including the time since the
+ *  last context switch if it executes.  Thread dispatching is disabled.
+ */
+static uint64_t CPU_usage_Thread_used(
+  Thread_Control *the_thread,
+  uint64_t        uptime
+)
+{
+  #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+    uint64_t used = CPU_usage_Nanoseconds( &the_thread->cpu_time_used );
+
+    #ifndef RTEMS_SMP
+      if ( _Thread_Executing == the_thread )
+        used += uptime -
+          CPU_usage_Nanoseconds( &_Thread_Time_of_last_context_switch );
+    #else
+      int cpu;
+
+      for ( cpu=0 ; cpu < rtems_smp_get_number_of_processors() ; cpu++ ) {
+        Per_CPU_Control *p = &_Per_CPU_Information[cpu];
+
+        if ( p->executing == the_thread ) {
+          used += uptime -
+            CPU_usage_Nanoseconds( &p->time_of_last_context_switch );
+          break;
+        }
+      }
+    #endif
+
+    return used;
+  #else
+    return the_thread->cpu_time_used;
+  #endif
+}
+
+static uint64_t CPU_usage_Uptime( void )
+{
+  #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+    Timestamp_Control uptime;
+
+    _TOD_Get_uptime( &uptime );
+
+    return CPU_usage_Nanoseconds( &uptime );
+  #else
+    return _Watchdog_Ticks_since_boot;
+  #endif
+}
+
+/*
+ *  Thread dispatching is only disabled while one thread is sampled, so a
+ *  large number of threads does not add to the dispatch latency.
+ */
+static void CPU_usage_Take_snapshot(
+  CPU_usage_Snapshot *snapshot
+)
+{
+  uint32_t             api_index;
+  uint32_t             slot = 0;
+  uint64_t             uptime;
+
+  ++snapshot->sequence;
+  _Atomic_Fence();
+
+  uptime = CPU_usage_Uptime();
+  snapshot->uptime = uptime;
+
+  for ( api_index = 1 ; api_index <= OBJECTS_APIS_LAST ; api_index++ ) {
+    Objects_Information *information;
+    uint32_t             i;
+
+    #if !defined(RTEMS_POSIX_API) || defined(RTEMS_DEBUG)
+      if ( !_Objects_Information_table[ api_index ] )
+        continue;
+    #endif
+
+    information = _Objects_Information_table[ api_index ][ 1 ];
+    if ( !information )
+      continue;
+
+    for ( i=1 ;
+          i <= information->maximum && slot < CPU_usage_Slot_count ;
+          i++, slot++ ) {
+      Thread_Control *the_thread;
+
+      _Thread_Disable_dispatch();
+
+      the_thread = (Thread_Control *)
+        _Objects_Get_local_object( information, i );
+      if ( the_thread ) {
+        snapshot->ids[ slot ]  = the_thread->Object.id;
+        snapshot->used[ slot ] = CPU_usage_Thread_used( the_thread, uptime );
+      } else {
+        snapshot->ids[ slot ]  = 0;
+      }
+
+      _Thread_Enable_dispatch();
+    }
+  }
+
+  _Atomic_Fence();
+  ++snapshot->sequence;
+}
+
+static rtems_task CPU_usage_Sampler(
+  rtems_task_argument argument
+)
+{
+  while ( !CPU_usage_Sampler_stop ) {
+    uint32_t taken = CPU_usage_Taken;
+
+    CPU_usage_Take_snapshot(
+      &CPU_usage_Snapshots[ taken % CPU_usage_Snapshot_count ]
+    );
+
+    /* The reader only uses published snapshots */
+    _Atomic_Fence();
+    CPU_usage_Taken = taken + 1;
+
+    (void) rtems_task_wake_after( CPU_usage_Sampler_period );
+  }
+
+  (void) rtems_event_send( CPU_usage_Sampler_waiter, RTEMS_EVENT_0 );
+  (void) rtems_task_delete( RTEMS_SELF );
+}
+
+static void CPU_usage_Free_snapshots( void )
+{
+  free( CPU_usage_Snapshots[ 0 ].ids );
+  free( CPU_usage_Snapshots[ 0 ].used );
+  free( CPU_usage_Snapshots );
+  CPU_usage_Snapshots = NULL;
+}
+
+/*
+ *  rtems_cpu_usage_sampler_start
+ */
+rtems_status_code rtems_cpu_usage_sampler_start(
+  rtems_task_priority priority,
+  rtems_interval      period,
+  uint32_t            intervals
+)
+{
+  rtems_status_code    status;
+  uint32_t             api_index;
+  uint32_t             slots = 0;
+  uint32_t             count;
+  uint32_t             i;
+  rtems_id            *ids;
+  uint64_t            *used;
+
+  if ( CPU_usage_Sampler_id )
+    return RTEMS_RESOURCE_IN_USE;
+
+  if ( period == 0 || intervals == 0 )
+    return RTEMS_INVALID_NUMBER;
+
+  /*
+   *  Threads in slots added to an unlimited object table after the start
+   *  are not sampled.
+   */
+  for ( api_index = 1 ; api_index <= OBJECTS_APIS_LAST ; api_index++ ) {
+    Objects_Information *information;
+
+    #if !defined(RTEMS_POSIX_API) || defined(RTEMS_DEBUG)
+      if ( !_Objects_Information_table[ api_index ] )
+        continue;
+    #endif
+
+    information = _Objects_Information_table[ api_index ][ 1 ];
+    if ( information )
+      slots += information->maximum;
+  }
+
+  count = intervals + 2;
+
+  CPU_usage_Snapshots = calloc( count, sizeof( *CPU_usage_Snapshots ) );
+  ids = calloc( count * slots, sizeof( *ids ) );
+  used = calloc( count * slots, sizeof( *used ) );
+
+  if ( !CPU_usage_Snapshots || !ids || !used ) {
+    free( ids );
+    free( used );
+    free( CPU_usage_Snapshots );
+    CPU_usage_Snapshots = NULL;
+    return RTEMS_NO_MEMORY;
+  }
+
+  for ( i=0 ; i < count ; i++ ) {
+    CPU_usage_Snapshots[ i ].ids  = &ids[ i * slots ];
+    CPU_usage_Snapshots[ i ].used = &used[ i * slots ];
+  }
+
+  CPU_usage_Snapshot_count = count;
+  CPU_usage_Slot_count     = slots;
+  CPU_usage_Taken          = 0;
+  CPU_usage_Sampler_period = period;
+  CPU_usage_Sampler_stop   = false;
+
+  status = rtems_task_create(
+    rtems_build_name( 'C', 'P', 'U', 'S' ),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &CPU_usage_Sampler_id
+  );
+  if ( status != RTEMS_SUCCESSFUL ) {
+    CPU_usage_Sampler_id = 0;
+    CPU_usage_Free_snapshots();
+    return status;
+  }
+
+  status = rtems_task_start( CPU_usage_Sampler_id, CPU_usage_Sampler, 0 );
+  if ( status != RTEMS_SUCCESSFUL ) {
+    (void) rtems_task_delete( CPU_usage_Sampler_id );
+    CPU_usage_Sampler_id = 0;
+    CPU_usage_Free_snapshots();
+  }
+
+  return status;
+}
+
+/*
+ *  rtems_cpu_usage_sampler_stop
+ */
+rtems_status_code rtems_cpu_usage_sampler_stop( void )
+{
+  rtems_event_set events = RTEMS_EVENT_0;
+
+  if ( !CPU_usage_Sampler_id )
+    return RTEMS_UNSATISFIED;
+
+  /*
+   *  Wait for the sampler and for the readers which entered before the
+   *  stop request.
+   */
+  _Thread_Disable_dispatch();
+    CPU_usage_Sampler_waiter = rtems_task_self();
+    CPU_usage_Sampler_stop = true;
+
+    if ( CPU_usage_Readers != 0 )
+      events |= RTEMS_EVENT_1;
+  _Thread_Enable_dispatch();
+
+  (void) rtems_event_receive(
+    events,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+
+  CPU_usage_Sampler_id = 0;
+  CPU_usage_Taken = 0;
+  CPU_usage_Free_snapshots();
+
+  return RTEMS_SUCCESSFUL;
+}
+
+/*
+ *  rtems_cpu_usage_sampler_maximum_threads
+ */
+uint32_t rtems_cpu_usage_sampler_maximum_threads( void )
+{
+  return CPU_usage_Sampler_id ? CPU_usage_Slot_count : 0;
+}
+
+/*
+ *  rtems_cpu_usage_get_samples
+ */
+rtems_status_code rtems_cpu_usage_get_samples(
+  uint32_t                intervals,
+  rtems_cpu_usage_sample *samples,
+  uint32_t               *count
+)
+{
+  rtems_status_code status = RTEMS_SUCCESSFUL;
+  uint32_t          taken;
+  uint32_t          size = *count;
+
+  *count = 0;
+
+  _Thread_Disable_dispatch();
+    if ( !CPU_usage_Sampler_id || CPU_usage_Sampler_stop ) {
+      _Thread_Enable_dispatch();
+      return RTEMS_UNSATISFIED;
+    }
+
+    ++CPU_usage_Readers;
+  _Thread_Enable_dispatch();
+
+  for (;;) {
+    const CPU_usage_Snapshot *newest;
+    const CPU_usage_Snapshot *oldest;
+    uint32_t                  newest_sequence;
+    uint32_t                  oldest_sequence;
+    uint64_t                  window;
+    uint32_t                  slot;
+
+    taken = CPU_usage_Taken;
+    _Atomic_Fence();
+
+    /* The first interval ends with the second snapshot */
+    if ( taken < 2 ) {
+      status = RTEMS_UNSATISFIED;
+      break;
+    }
+
+    if ( intervals > taken - 1 )
+      intervals = taken - 1;
+    if ( intervals > CPU_usage_Snapshot_count - 2 )
+      intervals = CPU_usage_Snapshot_count - 2;
+
+    newest = &CPU_usage_Snapshots[ (taken - 1) % CPU_usage_Snapshot_count ];
+    oldest = &CPU_usage_Snapshots[
+      (taken - 1 - intervals) % CPU_usage_Snapshot_count
+    ];
+
+    newest_sequence = newest->sequence;
+    oldest_sequence = oldest->sequence;
+    _Atomic_Fence();
+
+    if ( (newest_sequence | oldest_sequence) & 1 )
+      continue;
+
+    window = newest->uptime - oldest->uptime;
+    *count = 0;
+
+    for ( slot=0 ;
+          slot < CPU_usage_Slot_count && *count < size ;
+          slot++ ) {
+      rtems_id id = newest->ids[ slot ];
+      uint64_t used;
+
+      if ( !id )
+        continue;
+
+      /*
+       *  A thread created in the window used its whole CPU time in the
+       *  window.
+       */
+      used = newest->used[ slot ];
+      if ( oldest->ids[ slot ] == id ) {
+        if ( used > oldest->used[ slot ] )
+          used -= oldest->used[ slot ];
+        else
+          used = 0;
+      }
+
+      samples[ *count ].id    = id;
+      samples[ *count ].usage =
+        window ? (uint32_t) ((used * 100000) / window) : 0;
+      ++*count;
+    }
+
+    _Atomic_Fence();
+
+    if ( newest->sequence == newest_sequence &&
+         oldest->sequence == oldest_sequence )
+      break;
+  }
+
+  _Thread_Disable_dispatch();
+    if ( --CPU_usage_Readers == 0 && CPU_usage_Sampler_stop )
+      (void) rtems_event_send( CPU_usage_Sampler_waiter, RTEMS_EVENT_1 );
+  _Thread_Enable_dispatch();
+
+  return status;
+}
@@ -55,6 +55,58 @@ void rtems_cpu_usage_report( void );
 
 void rtems_cpu_usage_reset( void );
 
+/*
+ *  The CPU usage of a thread in the last intervals of the sampler.  The
+ *  usage is in thousandths of a percent of one processor.
+ */
+
+typedef struct {
+  rtems_id id;
+  uint32_t usage;
+} rtems_cpu_usage_sample;
+
+/*
+ *  rtems_cpu_usage_sampler_start
+ *
+ *  Starts a task which takes a snapshot of the CPU time used by each
+ *  thread every period ticks.  The last intervals snapshots are kept.
+ */
+
+rtems_status_code rtems_cpu_usage_sampler_start(
+  rtems_task_priority priority,
+  rtems_interval      period,
+  uint32_t            intervals
+);
+
+/*
+ *  rtems_cpu_usage_sampler_stop
+ */
+
+rtems_status_code rtems_cpu_usage_sampler_stop( void );
+
+/*
+ *  rtems_cpu_usage_sampler_maximum_threads
+ *
+ *  Returns the number of threads the sampler samples at most, or zero if
+ *  the sampler does not run.
+ */
+
+uint32_t rtems_cpu_usage_sampler_maximum_threads( void );
+
+/*
+ *  rtems_cpu_usage_get_samples
+ *
+ *  Returns the CPU usage of the threads in the last intervals of the
+ *  sampler.  On entry count is the size of the samples array, on return
+ *  the number of samples.  The sampler is never blocked by this call.
+ */
+
+rtems_status_code rtems_cpu_usage_get_samples(
+  uint32_t                intervals,
+  rtems_cpu_usage_sample *samples,
+  uint32_t               *count
+);
+
 #ifdef __cplusplus
 }
 #endif
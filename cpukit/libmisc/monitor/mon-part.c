@@ -24,7 +24,8 @@ rtems_monitor_part_canonical(
     canonical_part->start_addr = rtems_part->starting_address;
     canonical_part->length = rtems_part->length;
     canonical_part->buf_size = rtems_part->buffer_size;
-    canonical_part->used_blocks = rtems_part->number_of_used_blocks;
+    canonical_part->used_blocks =
+      _Partition_Get_number_of_used_blocks( rtems_part );
 }
 
 
@@ -0,0 +1,195 @@
+/*
+ *  TOP Command Implementation
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/cpuuse.h>
+#include <rtems/error.h>
+#include <rtems/shell.h>
+#include <rtems/stringto.h>
+#include "internal.h"
+
+/*
+ *  The sampler must preempt the threads it measures, so it runs at a
+ *  high priority.  It only executes once per second for a short time.
+ */
+#define TOP_SAMPLER_PRIORITY 2
+
+#define TOP_MAXIMUM_INTERVALS 60
+
+#define TOP_LINES 20
+
+typedef struct {
+  uint32_t                intervals;
+  uint32_t                count;
+  rtems_cpu_usage_sample *samples;
+} rtems_shell_top_context;
+
+static int rtems_shell_top_compare(
+  const void *lhs,
+  const void *rhs
+)
+{
+  const rtems_cpu_usage_sample *a = lhs;
+  const rtems_cpu_usage_sample *b = rhs;
+
+  if ( a->usage != b->usage )
+    return a->usage < b->usage ? 1 : -1;
+
+  return a->id < b->id ? -1 : (a->id > b->id);
+}
+
+static void rtems_shell_top_print(
+  int   fd,
+  int   seconds_remaining,
+  void *arg
+)
+{
+  rtems_shell_top_context *context = arg;
+  rtems_status_code        status;
+  uint32_t                 count = context->count;
+  uint32_t                 i;
+
+  status = rtems_cpu_usage_get_samples(
+    context->intervals,
+    context->samples,
+    &count
+  );
+
+  /* Move the cursor home and clear the screen */
+  printf( "\x1b[H\x1b[J" );
+  printf(
+    "CPU usage of the last %" PRIu32 " second(s), press a key to exit\n"
+    "   ID         NAME         PERCENT\n",
+    context->intervals
+  );
+
+  if ( status != RTEMS_SUCCESSFUL ) {
+    printf( "waiting for samples\n" );
+    fflush( stdout );
+    return;
+  }
+
+  qsort(
+    context->samples,
+    count,
+    sizeof( *context->samples ),
+    rtems_shell_top_compare
+  );
+
+  for ( i=0 ; i < count && i < TOP_LINES ; i++ ) {
+    char name[13];
+
+    rtems_object_get_name( context->samples[ i ].id, sizeof(name), name );
+    printf(
+      "0x%08" PRIx32 "   %-12s %4" PRIu32 ".%03" PRIu32 "\n",
+      context->samples[ i ].id,
+      name,
+      context->samples[ i ].usage / 1000,
+      context->samples[ i ].usage % 1000
+    );
+  }
+
+  fflush( stdout );
+}
+
+static int rtems_shell_main_top(
+  int   argc,
+  char *argv[]
+)
+{
+  rtems_shell_top_context context;
+  rtems_status_code       status;
+  unsigned long           value;
+  int                     iterations = 0x7fffffff;
+  bool                    started;
+  int                     arg;
+
+  context.intervals = 1;
+
+  for ( arg = 1 ; arg < argc ; arg++ ) {
+    if ( arg + 1 < argc && !strcmp( argv[arg], "-n" ) &&
+         rtems_string_to_unsigned_long( argv[++arg], &value, NULL, 0 ) ==
+           RTEMS_SUCCESSFUL && value > 0 ) {
+      iterations = value;
+    } else if ( arg + 1 < argc && !strcmp( argv[arg], "-w" ) &&
+         rtems_string_to_unsigned_long( argv[++arg], &value, NULL, 0 ) ==
+           RTEMS_SUCCESSFUL && value > 0 && value <= TOP_MAXIMUM_INTERVALS ) {
+      context.intervals = value;
+    } else {
+      fprintf( stderr, "%s: [-n iterations] [-w seconds]\n", argv[0] );
+      return -1;
+    }
+  }
+
+  /*
+   *  Use the sampler of the application if it runs, otherwise run one
+   *  while the command executes.
+   */
+  status = rtems_cpu_usage_sampler_start(
+    TOP_SAMPLER_PRIORITY,
+    rtems_clock_get_ticks_per_second(),
+    TOP_MAXIMUM_INTERVALS
+  );
+  if ( status != RTEMS_SUCCESSFUL && status != RTEMS_RESOURCE_IN_USE ) {
+    fprintf( stderr, "%s: %s\n", argv[0], rtems_status_text( status ) );
+    return -1;
+  }
+  started = status == RTEMS_SUCCESSFUL;
+
+  context.count = rtems_cpu_usage_sampler_maximum_threads();
+  context.samples = calloc( context.count, sizeof( *context.samples ) );
+
+  if ( context.samples ) {
+    status = rtems_shell_wait_for_input(
+      STDIN_FILENO,
+      iterations,
+      rtems_shell_top_print,
+      &context
+    );
+
+    /* Print one report if the input is no terminal */
+    if ( status == RTEMS_UNSATISFIED )
+      rtems_shell_top_print( STDIN_FILENO, 0, &context );
+
+    free( context.samples );
+  } else {
+    fprintf(
+      stderr,
+      "%s: %s\n",
+      argv[0],
+      rtems_status_text( RTEMS_NO_MEMORY )
+    );
+  }
+
+  if ( started )
+    (void) rtems_cpu_usage_sampler_stop();
+
+  return context.samples ? 0 : -1;
+}
+
+rtems_shell_cmd_t rtems_shell_TOP_Command = {
+  "top",                                      /* name */
+  "[-n iterations] [-w seconds] print recent per thread cpu usage",
+  "rtems",                                    /* topic */
+  rtems_shell_main_top,                       /* command */
+  NULL,                                       /* alias */
+  NULL                                        /* next */
+};
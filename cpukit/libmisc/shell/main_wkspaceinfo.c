@@ -29,6 +29,34 @@ void rtems_shell_print_unified_work_area_message(void)
   );
 }
 
+static void rtems_shell_print_workspace_slab_info(void)
+{
+  Workspace_Slab_information info;
+  uint32_t                   index = 0;
+
+  if ( !rtems_workspace_get_slab_info( index, &info ) )
+    return;
+
+  printf(
+    "\nSlab cache              Size  Objects     Free     Used  Max used"
+    "   Failed\n"
+  );
+
+  do {
+    printf(
+      "%-21s %6" PRIuPTR " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %9" PRIu32
+        " %8" PRIu32 "\n",
+      info.name,
+      info.object_size,
+      info.object_count,
+      info.free_count,
+      info.used_count,
+      info.max_used_count,
+      info.failed_count
+    );
+  } while ( rtems_workspace_get_slab_info( ++index, &info ) );
+}
+
 static int rtems_shell_main_wkspace_info(
   int   argc __attribute__((unused)),
   char *argv[] __attribute__((unused))
@@ -42,6 +70,8 @@ static int rtems_shell_main_wkspace_info(
   rtems_shell_print_heap_info( "free", &info.Free );
   rtems_shell_print_heap_info( "used", &info.Used );
 
+  rtems_shell_print_workspace_slab_info();
+
   return 0;
 }
 
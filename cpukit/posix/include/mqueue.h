@@ -5,7 +5,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2011.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -162,6 +162,38 @@ int mq_getattr(
   struct mq_attr *mqstat
 );
 
+/*
+ *  Zero-Copy Message Buffers, RTEMS extension
+ *
+ *  A sender obtains a message buffer of the message queue, fills it in
+ *  place and sends it.  A receiver gets the address of the message buffer
+ *  and returns it when done.  This avoids the copies of mq_send() and
+ *  mq_receive() for large messages.
+ */
+
+int mq_get_buffer_np(
+  mqd_t   mqdes,
+  void  **msg_buf
+);
+
+int mq_send_buffer_np(
+  mqd_t         mqdes,
+  void         *msg_buf,
+  size_t        msg_len,
+  unsigned int  msg_prio
+);
+
+ssize_t mq_receive_buffer_np(
+  mqd_t          mqdes,
+  void         **msg_buf,
+  unsigned int  *msg_prio
+);
+
+int mq_return_buffer_np(
+  mqd_t  mqdes,
+  void  *msg_buf
+);
+
 #ifdef __cplusplus
 }
 #endif
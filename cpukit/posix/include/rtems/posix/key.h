@@ -6,7 +6,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2011.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -17,7 +17,11 @@
 #ifndef _RTEMS_POSIX_KEY_H
 #define _RTEMS_POSIX_KEY_H
 
+#include <pthread.h>
+
 #include <rtems/score/object.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/wkspace.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -26,24 +30,72 @@ extern "C" {
 /**
  *  This is the data Structure used to manage a POSIX key.
  *
- *  @note The Values is a table indexed by the index portion of the
- *        ID of the currently executing thread.
+ *  @note The values of the key are stored by the threads.
  */
 typedef struct {
    /** This field is the Object control structure. */
    Objects_Control     Object;
    /** This field points to the optional destructor method. */
    void              (*destructor)( void * );
-   /** This field points to the values per thread. */
-   void              **Values[ OBJECTS_APIS_LAST + 1 ];
+   /**
+    *  This field is the generation of the key.  It distinguishes the key
+    *  from deleted keys with the same ID.
+    */
+   uint32_t            generation;
 }  POSIX_Keys_Control;
 
+/**
+ *  This is the number of value entries stored in the value store of a
+ *  thread before a larger table is allocated.  It must be a power of two.
+ */
+#define POSIX_KEYS_INLINE_VALUES 8
+
+/**
+ *  This is the value of a thread for a key.
+ */
+typedef struct {
+   /** This field is the ID of the key or zero for an empty entry. */
+   Objects_Id          key;
+   /** This field is the generation of the key when the value was set. */
+   uint32_t            generation;
+   /** This field is the value. */
+   void               *value;
+}  POSIX_Keys_Value;
+
+/**
+ *  This is the value store of a thread.  It is allocated with the first
+ *  non-NULL value set by the thread.  The values are in an open addressing
+ *  hash table indexed by the index portion of the key ID.  At most three
+ *  quarters of the table entries are used.
+ */
+typedef struct {
+   /** This field is the number of table entries minus one. */
+   uint32_t            mask;
+   /** This field is the number of used table entries. */
+   uint32_t            count;
+   /** This field points to the table of values. */
+   POSIX_Keys_Value   *table;
+   /** This field is the initial table of values. */
+   POSIX_Keys_Value    Inline_values[ POSIX_KEYS_INLINE_VALUES ];
+}  POSIX_Keys_Thread_values;
+
 /**
  *  The following defines the information control block used to manage
  *  this class of objects.
  */
 POSIX_EXTERN Objects_Information  _POSIX_Keys_Information;
 
+/**
+ *  The following is the workspace slab cache for the value stores of the
+ *  threads.
+ */
+POSIX_EXTERN Workspace_Slab _POSIX_Keys_Thread_values_slab;
+
+/**
+ *  The following is the generation of the most recently created key.
+ */
+POSIX_EXTERN uint32_t _POSIX_Keys_Generation;
+
 /**
  *  @brief _POSIX_Keys_Manager_initialization
  *
@@ -51,11 +103,32 @@ POSIX_EXTERN Objects_Information  _POSIX_Keys_Information;
  */
 void _POSIX_Key_Manager_initialization(void);
 
+/**
+ *  @brief _POSIX_Keys_Set_value
+ *
+ *  This function sets the value of key @a the_key in the value store
+ *  @a values_p of a thread.  The value store is allocated or enlarged if
+ *  necessary.
+ *
+ *  @param[in,out] values_p points to the value store pointer of the thread.
+ *  @param[in] the_key is the key.
+ *  @param[in] value is the new value.
+ *
+ *  @retval 0 Successful operation.
+ *  @retval ENOMEM Not enough memory to store the value.
+ */
+int _POSIX_Keys_Set_value(
+  POSIX_Keys_Thread_values **values_p,
+  POSIX_Keys_Control        *the_key,
+  const void                *value
+);
+
 /**
  *  @brief _POSIX_Keys_Run_destructors
  *
  *  This function executes all the destructors associated with the thread's
  *  keys.  This function will execute until all values have been set to NULL.
+ *  The value store of the thread is freed afterwards.
  *
  *  @param[in] thread is the thread whose keys should have all their
  *             destructors run.
@@ -67,17 +140,6 @@ void _POSIX_Keys_Run_destructors(
   Thread_Control *thread
 );
 
-/**
- *  @brief Free Key Memory
- *
- *  This memory frees the key table memory associated with @a the_key.
- *
- *  @param[in] the_key is the POSIX key to free the table memory of.
- */
-void _POSIX_Keys_Free_memory(
-  POSIX_Keys_Control *the_key
-);
-
 /**
  *  @brief _POSIX_Keys_Free
  *
@@ -90,7 +152,9 @@ RTEMS_INLINE_ROUTINE void _POSIX_Keys_Free (
   POSIX_Keys_Control *the_key
 );
 
+#ifndef __RTEMS_APPLICATION__
 #include <rtems/posix/key.inl>
+#endif
 
 #ifdef __cplusplus
 }
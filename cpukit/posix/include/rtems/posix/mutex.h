@@ -23,6 +23,7 @@ extern "C" {
 
 #include <rtems/score/coremutex.h>
 #include <pthread.h>
+#include <rtems/posix/mutexnp.h>
 
 /*
  *  Data Structure used to manage a POSIX mutex
@@ -0,0 +1,33 @@
+/**
+ * @file rtems/posix/mutexnp.h
+ *
+ * This include file contains the non-portable POSIX mutex types provided
+ * by RTEMS.  Applications may include it together with <pthread.h>.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef _RTEMS_POSIX_MUTEXNP_H
+#define _RTEMS_POSIX_MUTEXNP_H
+
+#include <pthread.h>
+
+#if defined(_UNIX98_THREAD_MUTEX_ATTRIBUTES)
+/*
+ *  This non-portable mutex type behaves like PTHREAD_MUTEX_NORMAL, but a
+ *  thread which finds the mutex locked by a thread executing on another
+ *  processor spins for a bounded time before it blocks.
+ */
+
+#define PTHREAD_MUTEX_ADAPTIVE_NP 4
+#endif
+
+#endif
+/*  end of include file */
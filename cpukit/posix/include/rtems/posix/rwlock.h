@@ -29,6 +29,15 @@ extern "C" {
 
 #include <rtems/score/object.h>
 #include <rtems/score/corerwlock.h>
+#include <pthread.h>
+
+/**
+ *  This flag is set in the process shared field of a RWLock attributes
+ *  object to create big reader RWLocks.  The readers of a big reader
+ *  RWLock are counted per processor, so read-mostly data does not bounce
+ *  a shared cache line on SMP configurations.  Writers are expensive.
+ */
+#define POSIX_RWLOCK_ATTR_BIG_READER 0x100
 
 /**
  *  This type defines the control block used to manage each RWLock.
@@ -74,6 +83,39 @@ int _POSIX_RWLock_Translate_core_RWLock_return_code(
   CORE_RWLock_Status  the_RWLock_status
 );
 
+/**
+ *  @brief pthread_rwlockattr_setbigreader_np
+ *
+ *  This non-portable routine selects whether RWLocks created with the
+ *  attributes are big reader RWLocks.
+ *
+ *  @param[in] attr is the RWLock attributes object
+ *  @param[in] big_reader is non-zero to create big reader RWLocks
+ *
+ *  @return This method returns 0 if successful and EINVAL otherwise.
+ */
+int pthread_rwlockattr_setbigreader_np(
+  pthread_rwlockattr_t *attr,
+  int                   big_reader
+);
+
+/**
+ *  @brief pthread_rwlockattr_getbigreader_np
+ *
+ *  This non-portable routine returns whether RWLocks created with the
+ *  attributes are big reader RWLocks.
+ *
+ *  @param[in] attr is the RWLock attributes object
+ *  @param[out] big_reader is set to 1 for big reader RWLocks and to 0
+ *              otherwise
+ *
+ *  @return This method returns 0 if successful and EINVAL otherwise.
+ */
+int pthread_rwlockattr_getbigreader_np(
+  const pthread_rwlockattr_t *attr,
+  int                        *big_reader
+);
+
 #ifndef __RTEMS_APPLICATION__
 #include <rtems/posix/rwlock.inl>
 #endif
@@ -6,7 +6,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-1999.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -46,6 +46,81 @@ RTEMS_INLINE_ROUTINE void _POSIX_Keys_Free (
   _Objects_Free( &_POSIX_Keys_Information, &the_key->Object );
 }
  
+/**
+ *  @brief _POSIX_Keys_Find_value
+ *
+ *  This function returns the entry of the key with ID @a key in the value
+ *  store @a values or NULL if there is no entry for this key.
+ */
+RTEMS_INLINE_ROUTINE POSIX_Keys_Value *_POSIX_Keys_Find_value(
+  const POSIX_Keys_Thread_values *values,
+  Objects_Id                      key
+)
+{
+  uint32_t index = _Objects_Get_index( key );
+
+  /*
+   *  The table has always an empty entry, so the search terminates.
+   */
+  while ( true ) {
+    POSIX_Keys_Value *entry = &values->table[ index & values->mask ];
+
+    if ( entry->key == key )
+      return entry;
+
+    if ( entry->key == 0 )
+      return NULL;
+
+    ++index;
+  }
+}
+
+/**
+ *  @brief _POSIX_Keys_Get_value
+ *
+ *  This function returns the value of key @a the_key in the value store
+ *  @a values.  A thread without a value store or an entry has a NULL value.
+ *  The entry of a deleted key with the same ID has a different generation.
+ */
+RTEMS_INLINE_ROUTINE void *_POSIX_Keys_Get_value(
+  const POSIX_Keys_Thread_values *values,
+  const POSIX_Keys_Control       *the_key
+)
+{
+  POSIX_Keys_Value *entry;
+
+  if ( values == NULL )
+    return NULL;
+
+  entry = _POSIX_Keys_Find_value( values, the_key->Object.id );
+  if ( entry == NULL || entry->generation != the_key->generation )
+    return NULL;
+
+  return entry->value;
+}
+
+/**
+ *  @brief _POSIX_Keys_Get_key_of_value
+ *
+ *  This function returns the key of the value entry @a entry or NULL if
+ *  this key was deleted.
+ */
+RTEMS_INLINE_ROUTINE POSIX_Keys_Control *_POSIX_Keys_Get_key_of_value(
+  const POSIX_Keys_Value *entry
+)
+{
+  POSIX_Keys_Control *the_key = (POSIX_Keys_Control *)
+    _Objects_Get_local_object(
+      &_POSIX_Keys_Information,
+      _Objects_Get_index( entry->key )
+    );
+
+  if ( the_key == NULL || the_key->generation != entry->generation )
+    return NULL;
+
+  return the_key;
+}
+
 /**
  *  @brief _POSIX_Keys_Get
  *
@@ -71,6 +71,28 @@ RTEMS_INLINE_ROUTINE POSIX_RWLock_Control *_POSIX_RWLock_Get (
   );
 }
 
+/**
+ *  @brief _POSIX_RWLock_Get_interrupt_disable
+ *
+ *  This function maps RWLock IDs to RWLock control blocks like
+ *  _POSIX_RWLock_Get(), but it disables interrupts instead of thread
+ *  dispatching.  It is used by the fast paths of big reader RWLocks.
+ */
+RTEMS_INLINE_ROUTINE POSIX_RWLock_Control *
+_POSIX_RWLock_Get_interrupt_disable (
+  pthread_rwlock_t  *RWLock,
+  Objects_Locations *location,
+  ISR_Level         *level
+)
+{
+  return (POSIX_RWLock_Control *) _Objects_Get_isr_disable(
+      &_POSIX_RWLock_Information,
+      (Objects_Id) *RWLock,
+      location,
+      level
+  );
+}
+
 /**
  *  @brief _POSIX_RWLock_Is_null
  *
@@ -1,5 +1,5 @@
 /*
- *  COPYRIGHT (c) 1989-2008.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -53,4 +53,16 @@ void _POSIX_Key_Manager_initialization(void)
     NULL                        /* Proxy extraction support callout */
 #endif
   );
+
+  _POSIX_Keys_Generation = 0;
+
+  /*
+   *  The value stores of the threads have a fixed size.  Only the larger
+   *  tables of threads with many values are allocated from the workspace.
+   */
+  _Workspace_Slab_initialize(
+    &_POSIX_Keys_Thread_values_slab,
+    "key value stores",
+    sizeof( POSIX_Keys_Thread_values )
+  );
 }
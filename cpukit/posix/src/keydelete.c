@@ -1,5 +1,5 @@
 /*
- *  COPYRIGHT (c) 1989-2007.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -37,11 +37,11 @@ int pthread_key_delete(
     case OBJECTS_LOCAL:
       _Objects_Close( &_POSIX_Keys_Information, &the_key->Object );
 
-      _POSIX_Keys_Free_memory( the_key );
-
       /*
        *  NOTE:  The destructor is not called and it is the responsibility
-       *         of the application to free the memory.
+       *         of the application to free the memory.  The values stored
+       *         by the threads become invalid with the generation of the
+       *         key.
        */
       _POSIX_Keys_Free( the_key );
       _Thread_Enable_dispatch();
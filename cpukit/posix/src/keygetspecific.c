@@ -1,5 +1,5 @@
 /*
- *  COPYRIGHT (c) 1989-2007.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -20,6 +20,7 @@
 #include <rtems/score/thread.h>
 #include <rtems/score/wkspace.h>
 #include <rtems/posix/key.h>
+#include <rtems/posix/threadsup.h>
 
 /*
  *  17.1.2 Thread-Specific Data Management, P1003.1c/Draft 10, p. 165
@@ -30,8 +31,7 @@ void *pthread_getspecific(
 )
 {
   register POSIX_Keys_Control *the_key;
-  uint32_t                     api;
-  uint32_t                     index;
+  POSIX_API_Control           *api;
   Objects_Locations            location;
   void                        *key_data;
 
@@ -39,9 +39,8 @@ void *pthread_getspecific(
   switch ( location ) {
 
     case OBJECTS_LOCAL:
-      api      = _Objects_Get_API( _Thread_Executing->Object.id );
-      index    = _Objects_Get_index( _Thread_Executing->Object.id );
-      key_data = (void *) the_key->Values[ api ][ index ];
+      api      = _Thread_Executing->API_Extensions[ THREAD_API_POSIX ];
+      key_data = _POSIX_Keys_Get_value( api->Key_values, the_key );
       _Thread_Enable_dispatch();
       return key_data;
 
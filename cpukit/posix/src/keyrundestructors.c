@@ -1,7 +1,7 @@
 /*
  *  Copyright (c) 2010 embedded brains GmbH.
  *
- *  COPYRIGHT (c) 1989-2007.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -13,10 +13,13 @@
 #include "config.h"
 #endif
 
+#include <pthread.h>
+
 #include <rtems/system.h>
 #include <rtems/score/object.h>
 #include <rtems/score/thread.h>
 #include <rtems/posix/key.h>
+#include <rtems/posix/threadsup.h>
 
 /*
  *  _POSIX_Keys_Run_destructors
@@ -31,9 +34,12 @@ void _POSIX_Keys_Run_destructors(
   Thread_Control *thread
 )
 {
-  Objects_Maximum thread_index = _Objects_Get_index( thread->Object.id );
-  Objects_APIs thread_api = _Objects_Get_API( thread->Object.id );
-  bool done = false;
+  POSIX_API_Control        *api = thread->API_Extensions[ THREAD_API_POSIX ];
+  POSIX_Keys_Thread_values *values = api->Key_values;
+  bool                      done = false;
+
+  if ( values == NULL )
+    return;
 
   /*
    *  The standard allows one to avoid a potential infinite loop and limit the
@@ -41,26 +47,37 @@ void _POSIX_Keys_Run_destructors(
    *  thread specific data.  This can be considered dubious.
    *
    *  Reference: 17.1.1.2 P1003.1c/Draft 10, p. 163, line 99.
+   *
+   *  NOTE: A destructor may set values, so the table is reloaded for each
+   *        entry.  Entries moved by a table growth are visited in the next
+   *        iteration.
    */
   while ( !done ) {
-    Objects_Maximum index = 0;
-    Objects_Maximum max = _POSIX_Keys_Information.maximum;
+    uint32_t index;
 
     done = true;
 
-    for ( index = 1 ; index <= max ; ++index ) {
-      POSIX_Keys_Control *key = (POSIX_Keys_Control *)
-        _POSIX_Keys_Information.local_table [ index ];
+    for ( index = 0 ; index <= values->mask ; ++index ) {
+      POSIX_Keys_Value *entry = &values->table[ index ];
+      void             *value = entry->value;
+
+      if ( entry->key != 0 && value != NULL ) {
+        POSIX_Keys_Control *key = _POSIX_Keys_Get_key_of_value( entry );
 
-      if ( key != NULL && key->destructor != NULL ) {
-        void *value = key->Values [ thread_api ][ thread_index ];
+        entry->value = NULL;
 
-        if ( value != NULL ) {
-          key->Values [ thread_api ][ thread_index ] = NULL;
+        if ( key != NULL && key->destructor != NULL ) {
           (*key->destructor)( value );
           done = false;
         }
       }
     }
   }
+
+  api->Key_values = NULL;
+
+  if ( values->table != values->Inline_values )
+    _Workspace_Free( values->table );
+
+  _Workspace_Slab_free( &_POSIX_Keys_Thread_values_slab, values );
 }
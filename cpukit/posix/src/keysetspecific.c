@@ -1,5 +1,5 @@
 /*
- *  COPYRIGHT (c) 1989-2007.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -20,6 +20,7 @@
 #include <rtems/score/thread.h>
 #include <rtems/score/wkspace.h>
 #include <rtems/posix/key.h>
+#include <rtems/posix/threadsup.h>
 
 /*
  *  17.1.2 Thread-Specific Data Management, P1003.1c/Draft 10, p. 165
@@ -31,19 +32,18 @@ int pthread_setspecific(
 )
 {
   register POSIX_Keys_Control *the_key;
-  uint32_t                     api;
-  uint32_t                     index;
+  POSIX_API_Control           *api;
   Objects_Locations            location;
+  int                          status;
 
   the_key = _POSIX_Keys_Get( key, &location );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
-      api   = _Objects_Get_API( _Thread_Executing->Object.id );
-      index = _Objects_Get_index( _Thread_Executing->Object.id );
-      the_key->Values[ api ][ index ] = (void *) value;
+      api    = _Thread_Executing->API_Extensions[ THREAD_API_POSIX ];
+      status = _POSIX_Keys_Set_value( &api->Key_values, the_key, value );
       _Thread_Enable_dispatch();
-      return 0;
+      return status;
 
 #if defined(RTEMS_MULTIPROCESSING)
     case OBJECTS_REMOTE:   /* should never happen */
@@ -0,0 +1,134 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <string.h>
+
+#include <rtems/system.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/wkspace.h>
+#include <rtems/posix/key.h>
+
+/*
+ *  This routine returns the empty entry for the key with ID key.  The key
+ *  must not have an entry in the table.
+ */
+static POSIX_Keys_Value *_POSIX_Keys_Empty_value(
+  POSIX_Keys_Value *table,
+  uint32_t          mask,
+  Objects_Id        key
+)
+{
+  uint32_t index = _Objects_Get_index( key );
+
+  while ( table[ index & mask ].key != 0 )
+    ++index;
+
+  return &table[ index & mask ];
+}
+
+/*
+ *  This routine doubles the table size of the value store.  The entries of
+ *  deleted keys and NULL values are dropped.
+ */
+static bool _POSIX_Keys_Grow_values(
+  POSIX_Keys_Thread_values *values
+)
+{
+  POSIX_Keys_Value *table;
+  uint32_t          mask;
+  uint32_t          count;
+  uint32_t          index;
+
+  mask = 2 * values->mask + 1;
+  table = _Workspace_Allocate( (mask + 1) * sizeof( *table ) );
+  if ( table == NULL )
+    return false;
+
+  memset( table, 0, (mask + 1) * sizeof( *table ) );
+
+  count = 0;
+  for ( index = 0 ; index <= values->mask ; ++index ) {
+    POSIX_Keys_Value *entry = &values->table[ index ];
+
+    if (
+      entry->key != 0
+        && entry->value != NULL
+        && _POSIX_Keys_Get_key_of_value( entry ) != NULL
+    ) {
+      *_POSIX_Keys_Empty_value( table, mask, entry->key ) = *entry;
+      ++count;
+    }
+  }
+
+  if ( values->table != values->Inline_values )
+    _Workspace_Free( values->table );
+
+  values->table = table;
+  values->mask = mask;
+  values->count = count;
+
+  return true;
+}
+
+int _POSIX_Keys_Set_value(
+  POSIX_Keys_Thread_values **values_p,
+  POSIX_Keys_Control        *the_key,
+  const void                *value
+)
+{
+  POSIX_Keys_Thread_values *values = *values_p;
+  POSIX_Keys_Value         *entry;
+
+  if ( values == NULL ) {
+    /*
+     *  A NULL value needs no value store.
+     */
+    if ( value == NULL )
+      return 0;
+
+    values = _Workspace_Slab_allocate( &_POSIX_Keys_Thread_values_slab );
+    if ( values == NULL )
+      return ENOMEM;
+
+    memset( values->Inline_values, 0, sizeof( values->Inline_values ) );
+    values->table = values->Inline_values;
+    values->mask = POSIX_KEYS_INLINE_VALUES - 1;
+    values->count = 0;
+    *values_p = values;
+  }
+
+  entry = _POSIX_Keys_Find_value( values, the_key->Object.id );
+  if ( entry == NULL ) {
+    if ( value == NULL )
+      return 0;
+
+    if ( 4 * (values->count + 1) > 3 * (values->mask + 1) ) {
+      if ( !_POSIX_Keys_Grow_values( values ) )
+        return ENOMEM;
+    }
+
+    entry = _POSIX_Keys_Empty_value(
+      values->table,
+      values->mask,
+      the_key->Object.id
+    );
+    entry->key = the_key->Object.id;
+    ++values->count;
+  }
+
+  entry->generation = the_key->generation;
+  entry->value = (void *) value;
+
+  return 0;
+}
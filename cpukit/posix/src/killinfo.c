@@ -59,7 +59,6 @@ int killinfo(
   uint32_t                     index;
   uint32_t                     maximum;
   Objects_Information         *the_info;
-  Objects_Control            **object_table;
   Thread_Control              *the_thread;
   Thread_Control              *interested;
   Priority_Control             interested_priority;
@@ -200,10 +199,10 @@ int killinfo(
     #endif
 
     maximum = the_info->maximum;
-    object_table = the_info->local_table;
 
     for ( index = 1 ; index <= maximum ; index++ ) {
-      the_thread = (Thread_Control *) object_table[ index ];
+      the_thread = (Thread_Control *)
+        _Objects_Get_local_object( the_info, index );
 
       if ( !the_thread )
         continue;
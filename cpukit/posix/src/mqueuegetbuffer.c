@@ -0,0 +1,75 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdarg.h>
+
+#include <pthread.h>
+#include <limits.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <mqueue.h>
+
+#include <rtems/system.h>
+#include <rtems/score/watchdog.h>
+#include <rtems/seterr.h>
+#include <rtems/posix/mqueue.h>
+#include <rtems/posix/time.h>
+
+/*
+ *  Get a Message Buffer of a Message Queue, RTEMS extension
+ */
+
+int mq_get_buffer_np(
+  mqd_t   mqdes,
+  void  **msg_buf
+)
+{
+  POSIX_Message_queue_Control        *the_mq;
+  POSIX_Message_queue_Control_fd     *the_mq_fd;
+  Objects_Locations                   location;
+  CORE_message_queue_Buffer_control  *the_message;
+
+  if ( !msg_buf )
+    rtems_set_errno_and_return_minus_one( EINVAL );
+
+  the_mq_fd = _POSIX_Message_queue_Get_fd( mqdes, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      if ( (the_mq_fd->oflag & O_ACCMODE) == O_RDONLY ) {
+        _Thread_Enable_dispatch();
+        rtems_set_errno_and_return_minus_one( EBADF );
+      }
+
+      the_mq = the_mq_fd->Queue;
+
+      the_message = _CORE_message_queue_Allocate_message_buffer(
+        &the_mq->Message_queue
+      );
+      _Thread_Enable_dispatch();
+
+      if ( !the_message )
+        rtems_set_errno_and_return_minus_one( EAGAIN );
+
+      *msg_buf = the_message->Contents.buffer;
+      return 0;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+#endif
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  rtems_set_errno_and_return_minus_one( EBADF );
+}
@@ -0,0 +1,105 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdarg.h>
+
+#include <pthread.h>
+#include <limits.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <mqueue.h>
+
+#include <rtems/system.h>
+#include <rtems/score/watchdog.h>
+#include <rtems/seterr.h>
+#include <rtems/posix/mqueue.h>
+#include <rtems/posix/time.h>
+
+/*
+ *  Receive a Message Buffer From a Message Queue, RTEMS extension
+ *
+ *  The message buffer must be returned by mq_return_buffer_np().
+ */
+
+ssize_t mq_receive_buffer_np(
+  mqd_t          mqdes,
+  void         **msg_buf,
+  unsigned int  *msg_prio
+)
+{
+  POSIX_Message_queue_Control     *the_mq;
+  POSIX_Message_queue_Control_fd  *the_mq_fd;
+  Objects_Locations                location;
+  size_t                           length_out;
+  bool                             do_wait;
+
+  if ( !msg_buf )
+    rtems_set_errno_and_return_minus_one( EINVAL );
+
+  the_mq_fd = _POSIX_Message_queue_Get_fd( mqdes, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      if ( (the_mq_fd->oflag & O_ACCMODE) == O_WRONLY ) {
+        _Thread_Enable_dispatch();
+        rtems_set_errno_and_return_minus_one( EBADF );
+      }
+
+      the_mq = the_mq_fd->Queue;
+
+      /*
+       *  Now if something goes wrong, we return a "length" of -1
+       *  to indicate an error.
+       */
+
+      length_out = -1;
+
+      do_wait = (the_mq_fd->oflag & O_NONBLOCK) ? false : true;
+
+      /*
+       *  Now perform the actual message receive
+       */
+      _CORE_message_queue_Seize_buffer(
+        &the_mq->Message_queue,
+        mqdes,
+        msg_buf,
+        &length_out,
+        do_wait,
+        THREAD_QUEUE_WAIT_FOREVER
+      );
+
+      _Thread_Enable_dispatch();
+      if (msg_prio) {
+        *msg_prio = _POSIX_Message_queue_Priority_from_core(
+             _Thread_Executing->Wait.count
+          );
+      }
+
+      if ( !_Thread_Executing->Wait.return_code )
+        return length_out;
+
+      rtems_set_errno_and_return_minus_one(
+        _POSIX_Message_queue_Translate_core_message_queue_return_code(
+          _Thread_Executing->Wait.return_code
+        )
+      );
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+#endif
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  rtems_set_errno_and_return_minus_one( EBADF );
+}
@@ -0,0 +1,99 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdarg.h>
+
+#include <pthread.h>
+#include <limits.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <mqueue.h>
+
+#include <rtems/system.h>
+#include <rtems/score/watchdog.h>
+#include <rtems/seterr.h>
+#include <rtems/posix/mqueue.h>
+#include <rtems/posix/time.h>
+
+/*
+ *  Send a Message Buffer to a Message Queue, RTEMS extension
+ *
+ *  The message buffer must be obtained by mq_get_buffer_np().  This
+ *  routine never blocks.
+ */
+
+int mq_send_buffer_np(
+  mqd_t         mqdes,
+  void         *msg_buf,
+  size_t        msg_len,
+  unsigned int  msg_prio
+)
+{
+  POSIX_Message_queue_Control        *the_mq;
+  POSIX_Message_queue_Control_fd     *the_mq_fd;
+  Objects_Locations                   location;
+  CORE_message_queue_Buffer_control  *the_message;
+  CORE_message_queue_Status           msg_status;
+
+  if ( msg_prio > MQ_PRIO_MAX )
+    rtems_set_errno_and_return_minus_one( EINVAL );
+
+  the_mq_fd = _POSIX_Message_queue_Get_fd( mqdes, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      if ( (the_mq_fd->oflag & O_ACCMODE) == O_RDONLY ) {
+        _Thread_Enable_dispatch();
+        rtems_set_errno_and_return_minus_one( EBADF );
+      }
+
+      the_mq = the_mq_fd->Queue;
+
+      the_message = _CORE_message_queue_Get_buffer_control(
+        &the_mq->Message_queue,
+        msg_buf
+      );
+      if ( !the_message ) {
+        _Thread_Enable_dispatch();
+        rtems_set_errno_and_return_minus_one( EINVAL );
+      }
+
+      msg_status = _CORE_message_queue_Submit_buffer(
+        &the_mq->Message_queue,
+        the_message,
+        msg_len,
+        mqdes,      /* mqd_t is an object id */
+        NULL,
+        _POSIX_Message_queue_Priority_to_core( msg_prio )
+      );
+
+      _Thread_Enable_dispatch();
+
+      if ( !msg_status )
+        return msg_status;
+
+      rtems_set_errno_and_return_minus_one(
+        _POSIX_Message_queue_Translate_core_message_queue_return_code(
+          msg_status
+        )
+      );
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+#endif
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  rtems_set_errno_and_return_minus_one( EBADF );
+}
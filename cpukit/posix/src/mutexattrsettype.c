@@ -35,6 +35,7 @@ int pthread_mutexattr_settype(
     case PTHREAD_MUTEX_RECURSIVE:
     case PTHREAD_MUTEX_ERRORCHECK:
     case PTHREAD_MUTEX_DEFAULT:
+    case PTHREAD_MUTEX_ADAPTIVE_NP:
       attr->type = type;
       return 0;
 
@@ -135,6 +135,7 @@ int pthread_mutex_init(
     case PTHREAD_MUTEX_RECURSIVE:
     case PTHREAD_MUTEX_ERRORCHECK:
     case PTHREAD_MUTEX_DEFAULT:
+    case PTHREAD_MUTEX_ADAPTIVE_NP:
       break;
 
     default:
@@ -166,6 +167,11 @@ int pthread_mutex_init(
   the_mutex_attr->priority_ceiling =
     _POSIX_Priority_To_core( the_attr->prio_ceiling );
   the_mutex_attr->discipline = the_discipline;
+#if defined(_UNIX98_THREAD_MUTEX_ATTRIBUTES)
+  the_mutex_attr->adaptive = the_attr->type == PTHREAD_MUTEX_ADAPTIVE_NP;
+#else
+  the_mutex_attr->adaptive = false;
+#endif
 
   /*
    *  Must be initialized to unlocked.
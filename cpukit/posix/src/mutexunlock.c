@@ -36,12 +36,22 @@ int pthread_mutex_unlock(
 {
   register POSIX_Mutex_Control *the_mutex;
   Objects_Locations             location;
+  ISR_Level                     level;
   CORE_mutex_Status             status;
 
-  the_mutex = _POSIX_Mutex_Get( mutex, &location );
+  the_mutex = _POSIX_Mutex_Get_interrupt_disable( mutex, &location, &level );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
+      /*
+       *  If the mutex is held once by the executing thread and no thread
+       *  waits on it, then the thread dispatch disable lock is not needed.
+       */
+      if ( _CORE_mutex_Fast_surrender( &the_mutex->Mutex, &level ) )
+        return 0;
+
+      _Thread_Disable_dispatch();
+      _ISR_Enable( level );
       status = _CORE_mutex_Surrender(
         &the_mutex->Mutex,
         the_mutex->Object.id,
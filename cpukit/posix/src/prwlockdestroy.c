@@ -62,6 +62,8 @@ int pthread_rwlock_destroy(
 
       _Objects_Close( &_POSIX_RWLock_Information, &the_rwlock->Object );
 
+      _CORE_RWLock_Close( &the_rwlock->RWLock );
+
       _POSIX_RWLock_Free( the_rwlock );
 
       _Thread_Enable_dispatch();
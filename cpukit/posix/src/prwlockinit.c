@@ -66,7 +66,7 @@ int pthread_rwlock_init(
   if ( !the_attr->is_initialized )
     return EINVAL;
 
-  switch ( the_attr->process_shared ) {
+  switch ( the_attr->process_shared & ~POSIX_RWLOCK_ATTR_BIG_READER ) {
     case PTHREAD_PROCESS_PRIVATE:    /* only supported values */
       break;
     case PTHREAD_PROCESS_SHARED:
@@ -76,10 +76,10 @@ int pthread_rwlock_init(
 
   /*
    * Convert from POSIX attributes to Core RWLock attributes
-   * 
-   * NOTE: Currently there are no core rwlock attributes
    */
   _CORE_RWLock_Initialize_attributes( &the_attributes );
+  the_attributes.big_reader =
+    (the_attr->process_shared & POSIX_RWLOCK_ATTR_BIG_READER) != 0;
 
   /*
    * Enter dispatching critical section to allocate and initialize RWLock
@@ -93,7 +93,11 @@ int pthread_rwlock_init(
     return EAGAIN;
   }
 
-  _CORE_RWLock_Initialize( &the_rwlock->RWLock, &the_attributes );
+  if ( !_CORE_RWLock_Initialize( &the_rwlock->RWLock, &the_attributes ) ) {
+    _POSIX_RWLock_Free( the_rwlock );
+    _Thread_Enable_dispatch();
+    return ENOMEM;
+  }
 
   _Objects_Open_u32(
     &_POSIX_RWLock_Information,
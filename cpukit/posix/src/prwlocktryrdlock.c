@@ -38,14 +38,31 @@ int pthread_rwlock_tryrdlock(
 {
   POSIX_RWLock_Control  *the_rwlock;
   Objects_Locations      location;
+  ISR_Level              level;
 
   if ( !rwlock )
     return EINVAL;
 
-  the_rwlock = _POSIX_RWLock_Get( rwlock, &location );
+  the_rwlock = _POSIX_RWLock_Get_interrupt_disable(
+    rwlock,
+    &location,
+    &level
+  );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
+      /*
+       *  The readers of a big reader rwlock do not need the thread
+       *  dispatch disable lock unless a writer holds or waits for it.
+       */
+      if ( _CORE_RWLock_Fast_obtain_for_reading(
+             &the_rwlock->RWLock,
+             &level
+           ) )
+        return 0;
+
+      _Thread_Disable_dispatch();
+      _ISR_Enable( level );
 
       _CORE_RWLock_Obtain_for_reading(
 	&the_rwlock->RWLock,
@@ -38,15 +38,29 @@ int pthread_rwlock_unlock(
 {
   POSIX_RWLock_Control  *the_rwlock;
   Objects_Locations      location;
+  ISR_Level              level;
   CORE_RWLock_Status     status;
 
   if ( !rwlock )
     return EINVAL;
 
-  the_rwlock = _POSIX_RWLock_Get( rwlock, &location );
+  the_rwlock = _POSIX_RWLock_Get_interrupt_disable(
+    rwlock,
+    &location,
+    &level
+  );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
+      /*
+       *  A reader of a big reader rwlock only changes the reader counter of
+       *  its processor.
+       */
+      if ( _CORE_RWLock_Fast_release( &the_rwlock->RWLock, &level ) )
+        return 0;
+
+      _Thread_Disable_dispatch();
+      _ISR_Enable( level );
       status = _CORE_RWLock_Release( &the_rwlock->RWLock );
       _Thread_Enable_dispatch();
       return _POSIX_RWLock_Translate_core_RWLock_return_code( status );
@@ -1,5 +1,5 @@
 /*
- *  COPYRIGHT (c) 1989-2010.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -193,6 +193,11 @@ static bool _POSIX_Threads_Create_extension(
   api->cancelability_type = PTHREAD_CANCEL_DEFERRED;
   _Chain_Initialize_empty (&api->Cancellation_Handlers);
 
+  /*
+   *  The thread-specific data is allocated on demand.
+   */
+  api->Key_values = NULL;
+
   /*
    *  If the thread is not a posix thread, then all posix signals are blocked
    *  by default.
@@ -315,7 +320,6 @@ API_extensions_Control _POSIX_Threads_API_extensions = {
 
 User_extensions_Control _POSIX_Threads_User_extensions = {
   { NULL, NULL },
-  { { NULL, NULL }, NULL },
   { _POSIX_Threads_Create_extension,          /* create */
     NULL,                                     /* start */
     NULL,                                     /* restart */
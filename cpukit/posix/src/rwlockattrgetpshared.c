@@ -14,6 +14,9 @@
 #include <pthread.h>
 #include <errno.h>
 
+#include <rtems/system.h>
+#include <rtems/posix/rwlock.h>
+
 /*
  *  RWLock Attributes Get Process Shared
  */
@@ -29,6 +32,6 @@ int pthread_rwlockattr_getpshared(
   if ( !attr->is_initialized )
     return EINVAL;
 
-  *pshared = attr->process_shared;
+  *pshared = attr->process_shared & ~POSIX_RWLOCK_ATTR_BIG_READER;
   return 0;
 }
@@ -0,0 +1,40 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <pthread.h>
+#include <errno.h>
+
+#include <rtems/system.h>
+#include <rtems/posix/rwlock.h>
+
+/*
+ *  RWLock Attributes Set Big Reader
+ */
+
+int pthread_rwlockattr_setbigreader_np(
+  pthread_rwlockattr_t *attr,
+  int                   big_reader
+)
+{
+  if ( !attr )
+    return EINVAL;
+
+  if ( !attr->is_initialized )
+    return EINVAL;
+
+  if ( big_reader )
+    attr->process_shared |= POSIX_RWLOCK_ATTR_BIG_READER;
+  else
+    attr->process_shared &= ~POSIX_RWLOCK_ATTR_BIG_READER;
+  return 0;
+}
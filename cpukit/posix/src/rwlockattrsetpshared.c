@@ -14,6 +14,9 @@
 #include <pthread.h>
 #include <errno.h>
 
+#include <rtems/system.h>
+#include <rtems/posix/rwlock.h>
+
 /*
  *  RWLock Attributes Set Process Shared
  */
@@ -32,7 +35,8 @@ int pthread_rwlockattr_setpshared(
   switch ( pshared ) {
     case PTHREAD_PROCESS_SHARED:
     case PTHREAD_PROCESS_PRIVATE:
-      attr->process_shared = pshared;
+      attr->process_shared = pshared |
+        (attr->process_shared & POSIX_RWLOCK_ATTR_BIG_READER);
       return 0;
 
     default:
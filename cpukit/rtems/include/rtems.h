@@ -52,6 +52,7 @@ extern "C" {
 #include <rtems/rtems/options.h>
 #include <rtems/rtems/tasks.h>
 #include <rtems/rtems/intr.h>
+#include <rtems/rtems/intrwork.h>
 #include <rtems/rtems/barrier.h>
 #include <rtems/rtems/cache.h>
 #include <rtems/rtems/clock.h>
@@ -74,6 +75,7 @@ extern "C" {
 #endif
 #if defined(RTEMS_SMP)
 #include <rtems/rtems/smp.h>
+#include <rtems/rtems/taskpool.h>
 #endif
 
 
@@ -132,6 +132,22 @@ typedef uint32_t   rtems_attribute;
  */
 #define RTEMS_PRIORITY_CEILING        0x00000080
 
+/**
+ *  This attribute constant indicates that the Classic API Semaphore
+ *  instance created will block immediately if it is not available.
+ */
+#define RTEMS_NO_ADAPTIVE             0x00000000
+
+/**
+ *  This attribute constant indicates that the Classic API Semaphore
+ *  instance created will spin for a bounded time before it blocks if its
+ *  holder executes on another processor.  This has only an effect on SMP
+ *  configurations.
+ *
+ *  @note The semaphore instance must be a binary semaphore.
+ */
+#define RTEMS_ADAPTIVE                0x00000100
+
 /******************** RTEMS Barrier Specific Attributes ********************/
 
 /**
@@ -146,6 +162,24 @@ typedef uint32_t   rtems_attribute;
  */
 #define RTEMS_BARRIER_MANUAL_RELEASE    0x00000000
 
+/******************* RTEMS Partition Specific Attributes *******************/
+
+/**
+ *  This attribute constant indicates that the Classic API Partition
+ *  instance created will manage its free buffers in one chain.
+ */
+#define RTEMS_PARTITION_NO_PER_CPU_CACHE 0x00000000
+
+/**
+ *  This attribute constant indicates that the Classic API Partition
+ *  instance created will manage its free buffers in a lock free stack
+ *  with a small buffer cache per processor in front of it.
+ *
+ *  @note The partition instance must be local and have less than 65536
+ *        buffers.
+ */
+#define RTEMS_PARTITION_PER_CPU_CACHE    0x00000200
+
 /**************** RTEMS Internal Task Specific Attributes ****************/
 
 /**
@@ -67,6 +67,11 @@ typedef enum {
 typedef Watchdog_Nanoseconds_since_last_tick_routine
   rtems_nanoseconds_extension_routine;
 
+/**
+ *  Type for the free running counter read BSP routine.
+ */
+typedef TOD_Counter_read_routine rtems_clock_counter_routine;
+
 /**
  *  @brief Obtain Current Time of Day
  *
@@ -195,6 +200,43 @@ rtems_status_code rtems_clock_set(
  */
 rtems_status_code rtems_clock_tick( void );
 
+/**
+ *  @brief Announce Several Clock Ticks
+ *
+ *  This routine implements the rtems_clock_tick_announce directive.  It
+ *  informs RTEMS that @a ticks clock ticks occurred since the last
+ *  announced tick.  The time of day, the uptime and the watchdogs are
+ *  advanced in one step and all expired timeouts and delays fire.  It is
+ *  used by clock drivers which suppress the periodic tick while the
+ *  system is idle.
+ *
+ *  @param[in] ticks is the number of clock ticks to announce
+ *
+ *  @return This method returns RTEMS_SUCCESSFUL if there was not an
+ *          error.  Otherwise, a status code is returned indicating the
+ *          source of the error.
+ */
+rtems_status_code rtems_clock_tick_announce(
+  rtems_interval ticks
+);
+
+/**
+ *  @brief Obtain Ticks Until the Next Event
+ *
+ *  This routine implements the rtems_clock_get_ticks_until_next_event
+ *  directive.  It returns the number of clock ticks until the next
+ *  timeout, delay or time of day watchdog expires.  A clock driver may
+ *  suppress the periodic tick for this number of ticks minus one while
+ *  the system is idle.
+ *
+ *  @return This method returns the number of the tick at which the next
+ *          event is due, e.g. one for the next tick.  It returns
+ *          WATCHDOG_MAXIMUM_INTERVAL if no event is pending.
+ *
+ *  @note This directive must be called with interrupts disabled.
+ */
+rtems_interval rtems_clock_get_ticks_until_next_event( void );
+
 /**
  *  @brief Set the BSP specific Nanoseconds Extension
  *
@@ -211,6 +253,32 @@ rtems_status_code rtems_clock_set_nanoseconds_extension(
   rtems_nanoseconds_extension_routine routine
 );
 
+/**
+ *  @brief Set the BSP specific Free Running Counter
+ *
+ *  This directive sets the BSP provided free running counter.  The time
+ *  since the last tick is then computed from the counter value at the
+ *  last tick instead of the nanoseconds extension.  The counter must
+ *  increment with @a frequency Hz, wrap around at @a mask + 1 and must
+ *  not wrap around within a clock tick.  It must run synchronously with
+ *  the clock tick, since the counter value at the last tick advances by
+ *  the nominal counter increments per tick.  It should be set before the
+ *  first clock tick.
+ *
+ *  @param[in] routine is a pointer to the counter read routine
+ *  @param[in] frequency is the counter frequency in Hz
+ *  @param[in] mask is the mask of the valid counter bits
+ *
+ *  @return This method returns RTEMS_SUCCESSFUL if there was not an
+ *          error.  Otherwise, a status code is returned indicating the
+ *          source of the error.
+ */
+rtems_status_code rtems_clock_set_counter(
+  rtems_clock_counter_routine routine,
+  uint32_t                    frequency,
+  uint32_t                    mask
+);
+
 /**
  *  @brief Obtain the System Uptime
  *
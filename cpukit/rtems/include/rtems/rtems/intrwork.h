@@ -0,0 +1,263 @@
+/**
+ * @file rtems/rtems/intrwork.h
+ *
+ *  This include file contains all the constants and structures associated
+ *  with the Interrupt Work Manager.  It defers work submitted by interrupt
+ *  service routines to a server task on each processor.
+ *
+ *  Directives provided are:
+ *
+ *    - initiate the interrupt work servers
+ *    - initialize an interrupt work item
+ *    - submit an interrupt work item
+ */
+
+/*  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef _RTEMS_RTEMS_INTRWORK_H
+#define _RTEMS_RTEMS_INTRWORK_H
+
+#ifndef RTEMS_INTRWORK_EXTERN
+#define RTEMS_INTRWORK_EXTERN extern
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <rtems/rtems/types.h>
+#include <rtems/rtems/attr.h>
+#include <rtems/rtems/event.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/tasks.h>
+#include <rtems/score/chain.h>
+#include <rtems/score/isr.h>
+#if defined(RTEMS_SMP)
+#include <rtems/score/smplock.h>
+#endif
+
+/**
+ *  @defgroup ClassicIntrWork Interrupt Work
+ *
+ *  @ingroup ClassicRTEMS
+ *
+ *  This encapsulates functionality related to the Classic API Interrupt
+ *  Work Manager.
+ *
+ *  An interrupt service routine submits a work item to the queue of the
+ *  current processor and returns.  The server task of this processor
+ *  executes the queued work items in a batch with interrupts enabled.  A
+ *  work item which is already queued is not queued again, instead the
+ *  submissions are counted and passed to the work routine.  So an
+ *  interrupt storm results in one work routine call and at most one server
+ *  wake up per batch.
+ *
+ *  The work items are provided by the application, so that the
+ *  submission of a work item needs no memory allocation.
+ */
+/**@{*/
+
+/**
+ *  This is the event used to wake up the servers.
+ */
+#define RTEMS_INTERRUPT_WORK_EVENT RTEMS_EVENT_31
+
+/**
+ *  This type defines the prototype of a work routine.  The @a count
+ *  parameter is the number of submissions of the work item since its last
+ *  execution.
+ */
+typedef void ( *rtems_interrupt_work_routine )(
+  void     *arg,
+  uint32_t  count
+);
+
+/**
+ *  This type defines the control block of a work item.  It must not be
+ *  modified while it is queued.
+ */
+typedef struct {
+  /** This is the node on the work queue of a processor. */
+  Chain_Node                    Node;
+
+  /** This is the routine of the work item. */
+  rtems_interrupt_work_routine  routine;
+
+  /** This is the argument of the routine. */
+  void                         *arg;
+
+  /**
+   *  This is the number of submissions since the last execution.  The work
+   *  item is queued if and only if it is not zero.  It is only changed by
+   *  compare and swap, since a work item may be submitted on one processor
+   *  while it is queued on another.
+   */
+  volatile uint32_t             count;
+} rtems_interrupt_work;
+
+/**
+ *  This type defines the work queue and server of a processor.
+ */
+typedef struct {
+#if defined(RTEMS_SMP)
+  /** This lock protects the work queue. */
+  SMP_lock_spinlock_simple_Control  Lock;
+#endif
+
+  /** This is the chain of queued work items. */
+  Chain_Control                     Work;
+
+  /** This is the identifier of the server. */
+  rtems_id                          server;
+
+  /** This indicates that the server waits for the wake up event. */
+  bool                              waiting;
+} Interrupt_work_Queue;
+
+/**
+ *  This type defines the control block of the interrupt work servers.
+ */
+typedef struct {
+  /** This is the array of work queues with one queue per processor. */
+  Interrupt_work_Queue  *queues;
+
+  /** This is the number of processors and servers. */
+  uint32_t               queue_count;
+
+  /**
+   *  This is the number of clock ticks a server waits after its wake up
+   *  to collect more work items for the batch.
+   */
+  rtems_interval         coalesce_interval;
+} Interrupt_work_Control;
+
+/**
+ *  This is the control block of the interrupt work servers.  It is NULL
+ *  until the servers are initiated.
+ */
+RTEMS_INTRWORK_EXTERN Interrupt_work_Control *volatile _Interrupt_work_Server;
+
+/**
+ *  @brief rtems_interrupt_work_initiate_server
+ *
+ *  This routine creates and starts one server task per processor.  The
+ *  servers have the priority @a priority, the stack size @a stack_size and
+ *  the attributes @a attribute_set.  They must be accounted for in the
+ *  maximum number of tasks.  A server which was woken up waits
+ *  @a coalesce_interval clock ticks before it executes the queued work
+ *  items, so that more work items are executed in one batch.  With the
+ *  Priority SMP Scheduler, server N is moved to scheduler cluster N if this
+ *  cluster exists.
+ *
+ *  @param[in] priority is the priority of the servers.
+ *  @param[in] stack_size is the stack size of the servers.
+ *  @param[in] attribute_set is the attribute set of the servers.
+ *  @param[in] coalesce_interval is the number of clock ticks to collect
+ *  work items after a wake up or zero.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INCORRECT_STATE The servers are already initiated.
+ *  @retval RTEMS_UNSATISFIED Not enough memory for the work queues.
+ *  @retval other The status of rtems_task_create() or rtems_task_start().
+ */
+rtems_status_code rtems_interrupt_work_initiate_server(
+  rtems_task_priority priority,
+  size_t              stack_size,
+  rtems_attribute     attribute_set,
+  rtems_interval      coalesce_interval
+);
+
+/**
+ *  @brief rtems_interrupt_work_initialize
+ *
+ *  This routine initializes the work item @a work which executes
+ *  @a routine with the argument @a arg.
+ *
+ *  @param[in] work is the work item.
+ *  @param[in] routine is the work routine.
+ *  @param[in] arg is the argument of the work routine.
+ */
+void rtems_interrupt_work_initialize(
+  rtems_interrupt_work         *work,
+  rtems_interrupt_work_routine  routine,
+  void                         *arg
+);
+
+/**
+ *  @brief rtems_interrupt_work_submit
+ *
+ *  This routine submits the work item @a work.  If the work item is not
+ *  queued, then it is appended to the queue of the current processor and
+ *  the server of this processor is woken up if necessary.  Otherwise only
+ *  the submission is counted.  This routine may be called from an
+ *  interrupt.
+ *
+ *  @param[in] work is the work item.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_ADDRESS The @a work pointer is NULL.
+ *  @retval RTEMS_INCORRECT_STATE The servers are not initiated.
+ */
+rtems_status_code rtems_interrupt_work_submit(
+  rtems_interrupt_work *work
+);
+
+/**
+ *  @brief _Interrupt_work_Acquire
+ *
+ *  This routine disables interrupts and locks the work queue @a queue.
+ *
+ *  @param[in] queue is the work queue.
+ *
+ *  @return The previous interrupt level.
+ */
+RTEMS_INLINE_ROUTINE ISR_Level _Interrupt_work_Acquire(
+  Interrupt_work_Queue *queue
+)
+{
+  ISR_Level level;
+
+#if defined(RTEMS_SMP)
+  level = _SMP_lock_spinlock_simple_Obtain( &queue->Lock );
+#else
+  _ISR_Disable( level );
+#endif
+
+  return level;
+}
+
+/**
+ *  @brief _Interrupt_work_Release
+ *
+ *  This routine unlocks the work queue @a queue and restores the
+ *  interrupt level @a level.
+ *
+ *  @param[in] queue is the work queue.
+ *  @param[in] level is the interrupt level to restore.
+ */
+RTEMS_INLINE_ROUTINE void _Interrupt_work_Release(
+  Interrupt_work_Queue *queue,
+  ISR_Level             level
+)
+{
+#if defined(RTEMS_SMP)
+  _SMP_lock_spinlock_simple_Release( &queue->Lock, level );
+#else
+  _ISR_Enable( level );
+#endif
+}
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
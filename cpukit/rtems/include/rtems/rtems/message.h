@@ -14,10 +14,11 @@
  *     - put a message at the front of a queue
  *     - broadcast N messages to a queue
  *     - receive message from a queue
+ *     - get, send, receive and return a message buffer of a queue
  *     - flush all messages on a queue
  */
 
-/*  COPYRIGHT (c) 1989-2008.
+/*  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -216,6 +217,69 @@ rtems_status_code rtems_message_queue_receive(
   rtems_interval  timeout
 );
 
+/**
+ *  @brief rtems_message_queue_get_buffer
+ *
+ *  This routine implements the rtems_message_queue_get_buffer directive.
+ *  This directive obtains a free message buffer of the message queue
+ *  indicated by ID.  The calling task may fill in a message of up to the
+ *  maximum message size and send it with rtems_message_queue_send_buffer
+ *  without a copy of the message.  The message buffer must be sent or
+ *  returned with rtems_message_queue_return_buffer.
+ */
+rtems_status_code rtems_message_queue_get_buffer(
+  rtems_id   id,
+  void     **buffer
+);
+
+/**
+ *  @brief rtems_message_queue_send_buffer
+ *
+ *  This routine implements the rtems_message_queue_send_buffer directive.
+ *  This directive sends a message buffer obtained by
+ *  rtems_message_queue_get_buffer to the message queue indicated by ID.
+ *  The message is not copied if no task is waiting or if the first waiting
+ *  task receives by reference.  The calling task must not access the
+ *  message buffer after a successful send.
+ */
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+);
+
+/**
+ *  @brief rtems_message_queue_receive_buffer
+ *
+ *  This routine implements the rtems_message_queue_receive_buffer
+ *  directive.  This directive has the same behavior as
+ *  rtems_message_queue_receive except that the message is not copied.
+ *  The address of the message buffer is returned in BUFFER.  The message
+ *  buffer must be returned with rtems_message_queue_return_buffer.
+ */
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id         id,
+  void           **buffer,
+  size_t          *size,
+  rtems_option     option_set,
+  rtems_interval   timeout
+);
+
+/**
+ *  @brief rtems_message_queue_return_buffer
+ *
+ *  This routine implements the rtems_message_queue_return_buffer
+ *  directive.  This directive returns a message buffer obtained by
+ *  rtems_message_queue_get_buffer or rtems_message_queue_receive_buffer
+ *  to the message queue indicated by ID.  A message buffer which is not
+ *  held by the application, e.g. one returned twice, is rejected with
+ *  RTEMS_INVALID_ADDRESS.
+ */
+rtems_status_code rtems_message_queue_return_buffer(
+  rtems_id  id,
+  void     *buffer
+);
+
 /**
  *  @brief rtems_message_queue_flush
  *
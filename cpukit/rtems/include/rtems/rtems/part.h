@@ -13,9 +13,12 @@
  *     - delete a partition
  *     - get a buffer from a partition
  *     - return a buffer to a partition
+ *     - get a handle of a partition
+ *     - get a buffer from a partition by handle
+ *     - return a buffer to a partition by handle
  */
 
-/*  COPYRIGHT (c) 1989-2008.
+/*  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -57,6 +60,50 @@ extern "C" {
  */
 /**@{*/
 
+/**
+ *  This is the maximum number of free buffers in the cache of one
+ *  processor.  A processor moves half of this number of buffers at once
+ *  between its cache and the free stack of the partition.  An allocation
+ *  fails if the cache of the current processor and the free stack are
+ *  empty, even if the caches of other processors hold free buffers.
+ */
+#define PARTITION_PER_CPU_CACHE_SIZE 8
+
+/**
+ *  This is the number of bits of the free stack head which hold the
+ *  index of the top buffer plus one.  The remaining 16 bits hold a tag
+ *  which changes with every push and pop, so that a compare and swap
+ *  which read an outdated head fails.  A stale head is only accepted if
+ *  the other processors perform a multiple of 65536 stack operations
+ *  while one processor executes the few instructions between the read
+ *  of the head and the compare and swap with interrupts disabled.
+ */
+#define PARTITION_FREE_STACK_INDEX_BITS 16
+
+/**
+ *  This mask selects the index bits of the free stack head.
+ */
+#define PARTITION_FREE_STACK_INDEX_MASK \
+  ((1U << PARTITION_FREE_STACK_INDEX_BITS) - 1)
+
+/**
+ *  This value of the number of used blocks marks a deleted partition.
+ *  The number of used blocks cannot reach this value since each buffer
+ *  occupies at least four bytes.
+ */
+#define PARTITION_USED_BLOCKS_DELETED 0xffffffffU
+
+/**
+ *  The following defines the buffer cache of one processor.  It is only
+ *  accessed by its processor with interrupts disabled.
+ */
+typedef struct {
+  /** This field is the number of buffers in the cache. */
+  uint32_t            count;
+  /** This field is the stack of cached buffers. */
+  void               *buffers[ PARTITION_PER_CPU_CACHE_SIZE ];
+}   Partition_Per_CPU_cache;
+
 /**
  *  The following defines the control block used to manage each partition.
  */
@@ -71,12 +118,51 @@ typedef struct {
   uint32_t            buffer_size;
   /** This field is the attribute set provided at create time. */
   rtems_attribute     attribute_set;
-  /** This field is the of allocated buffers. */
-  uint32_t            number_of_used_blocks;
+  /**
+   *  This field is the number of allocated buffers.  It is changed with
+   *  compare and swap operations since the handle directives update it
+   *  with thread dispatching enabled.
+   */
+  volatile uint32_t   number_of_used_blocks;
+  /**
+   *  This field changes each time the partition is deleted, so that a
+   *  handle of a deleted partition is not valid for a partition which
+   *  later reuses this control block.
+   */
+  uint32_t            generation;
   /** This field is the chain used to manage unallocated buffers. */
   Chain_Control       Memory;
+  /**
+   *  This field is the head of the lock free stack of unallocated buffers
+   *  if the partition has per processor caches.  The first word of a
+   *  buffer on the stack holds the index plus one of the next buffer.
+   */
+  volatile uint32_t   free_stack;
+  /**
+   *  This field is the array of per processor caches or NULL if the
+   *  partition has no per processor caches.
+   */
+  Partition_Per_CPU_cache *caches;
+  /** This field is the number of per processor caches. */
+  uint32_t            cache_count;
 }   Partition_Control;
 
+/**
+ *  The following defines the handle of a local partition.  A handle
+ *  refers directly to the partition control block.  The handle
+ *  directives return RTEMS_INVALID_ID for a handle of a deleted
+ *  partition.  The control block must still be part of the object
+ *  information, so the handle of a deleted partition must not be used
+ *  if the number of partitions is unlimited, since then the control
+ *  block may be freed.
+ */
+typedef struct {
+  /** This field is the partition control block. */
+  Partition_Control  *partition;
+  /** This field is the generation of the partition. */
+  uint32_t            generation;
+}   rtems_partition_handle;
+
 /**
  *  The following defines the information control block used to
  *  manage this class of objects.
@@ -98,8 +184,8 @@ void _Partition_Manager_initialization(void);
  *  the partition is of length bytes and starts at starting_address.
  *  The memory area will be divided into as many buffers of
  *  buffer_size bytes as possible.   The attribute_set determines if
- *  the partition is global or local.  It returns the id of the
- *  created partition in ID.
+ *  the partition is global or local and if it has per processor buffer
+ *  caches.  It returns the id of the created partition in ID.
  */
 rtems_status_code rtems_partition_create(
   rtems_name       name,
@@ -161,6 +247,77 @@ rtems_status_code rtems_partition_return_buffer(
   void     *buffer
 );
 
+/**
+ *  @brief rtems_partition_get_handle
+ *
+ *  This routine implements the rtems_partition_get_handle directive.  It
+ *  returns the handle of the local partition associated with ID in
+ *  handle.  The handle directives skip the identifier lookup.
+ */
+rtems_status_code rtems_partition_get_handle(
+  rtems_id                id,
+  rtems_partition_handle *handle
+);
+
+/**
+ *  @brief rtems_partition_get_buffer_by_handle
+ *
+ *  This routine implements the rtems_partition_get_buffer_by_handle
+ *  directive.  It attempts to allocate a buffer from the partition
+ *  associated with handle.  If a buffer is allocated, its address is
+ *  returned in buffer.
+ */
+rtems_status_code rtems_partition_get_buffer_by_handle(
+  rtems_partition_handle   handle,
+  void                   **buffer
+);
+
+/**
+ *  @brief rtems_partition_return_buffer_by_handle
+ *
+ *  This routine implements the rtems_partition_return_buffer_by_handle
+ *  directive.  It frees the buffer to the partition associated with
+ *  handle.  The buffer must have been previously allocated from the same
+ *  partition.
+ */
+rtems_status_code rtems_partition_return_buffer_by_handle(
+  rtems_partition_handle  handle,
+  void                   *buffer
+);
+
+/**
+ *  @brief _Partition_Cache_refill
+ *
+ *  This routine moves up to half of the cache size of buffers from the
+ *  free stack of the_partition to the empty cache.  It is called with
+ *  interrupts disabled.
+ */
+void _Partition_Cache_refill(
+  Partition_Control       *the_partition,
+  Partition_Per_CPU_cache *cache
+);
+
+/**
+ *  @brief _Partition_Cache_flush
+ *
+ *  This routine moves count buffers from the cache to the free stack of
+ *  the_partition.  It is called with interrupts disabled.
+ */
+void _Partition_Cache_flush(
+  Partition_Control       *the_partition,
+  Partition_Per_CPU_cache *cache,
+  uint32_t                 count
+);
+
+/**
+ *  @brief _Partition_Get_number_of_used_blocks
+ *
+ *  This routine returns the number of allocated buffers of the_partition.
+ */
+uint32_t _Partition_Get_number_of_used_blocks(
+  Partition_Control *the_partition
+);
+
 #ifndef __RTEMS_APPLICATION__
 #include <rtems/rtems/part.inl>
 #endif
@@ -23,6 +23,8 @@
 extern "C" {
 #endif
 
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/types.h>
 #include <rtems/score/smp.h>
 
 /**
@@ -70,6 +72,50 @@ extern uint32_t rtems_configuration_smp_maximum_processors;
 #define rtems_smp_get_current_processor() \
     bsp_smp_processor_id()
 
+/**
+ *  @brief Set Scheduler Cluster of a Task
+ *
+ *  This directive moves the task with identifier @a id to the scheduler
+ *  cluster with index @a cluster.  The task executes afterwards only on
+ *  the cores of this cluster.  Core N belongs to cluster N modulo the
+ *  cluster count.  This directive is only available with the Priority SMP
+ *  Scheduler.
+ *
+ *  @param[in] id is the task identifier, zero indicates the calling task.
+ *  @param[in] cluster is the index of the new cluster.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_ID Invalid task identifier.
+ *  @retval RTEMS_INVALID_NUMBER Invalid cluster index.
+ *  @retval RTEMS_NOT_CONFIGURED The Priority SMP Scheduler is not
+ *  configured.
+ */
+rtems_status_code rtems_task_set_scheduler_cluster(
+  rtems_id id,
+  uint32_t cluster
+);
+
+/**
+ *  @brief Get Scheduler Cluster of a Task
+ *
+ *  This directive returns the index of the scheduler cluster of the task
+ *  with identifier @a id.  This directive is only available with the
+ *  Priority SMP Scheduler.
+ *
+ *  @param[in] id is the task identifier, zero indicates the calling task.
+ *  @param[out] cluster is the index of the cluster.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_ADDRESS The @a cluster pointer is NULL.
+ *  @retval RTEMS_INVALID_ID Invalid task identifier.
+ *  @retval RTEMS_NOT_CONFIGURED The Priority SMP Scheduler is not
+ *  configured.
+ */
+rtems_status_code rtems_task_get_scheduler_cluster(
+  rtems_id  id,
+  uint32_t *cluster
+);
+
 /**@}*/
 
 #ifdef __cplusplus
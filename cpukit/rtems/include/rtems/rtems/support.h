@@ -74,6 +74,21 @@ bool rtems_workspace_get_information(
   Heap_Information_block  *the_info
 );
 
+/**
+ * @brief Gets workspace slab cache information.
+ *
+ * Returns information about the workspace slab cache with index @a index in
+ * @a the_info.  The slab caches are numbered consecutively starting with
+ * zero.
+ *
+ * Returns @c true if successful, and @a false if @a the_info is NULL or no
+ * slab cache with this @a index exists.
+ */
+bool rtems_workspace_get_slab_info(
+  uint32_t                    index,
+  Workspace_Slab_information *the_info
+);
+
 /**
  * @brief Allocates memory from the workspace.
  *
@@ -0,0 +1,296 @@
+/**
+ * @file rtems/rtems/taskpool.h
+ *
+ *  This include file contains all the constants and structures associated
+ *  with the Task Pool Manager.  A task pool executes short jobs on one
+ *  worker task per processor.
+ *
+ *  Directives provided are:
+ *
+ *    - create a task pool
+ *    - delete a task pool
+ *    - initialize a job group
+ *    - submit a job
+ *    - wait for the jobs of a group
+ */
+
+/*  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef _RTEMS_RTEMS_TASKPOOL_H
+#define _RTEMS_RTEMS_TASKPOOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <rtems/rtems/types.h>
+#include <rtems/rtems/attr.h>
+#include <rtems/rtems/event.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/tasks.h>
+#include <rtems/score/chain.h>
+#include <rtems/score/smplock.h>
+
+/**
+ *  @defgroup ClassicTaskPool Task Pools
+ *
+ *  @ingroup ClassicRTEMS
+ *
+ *  This encapsulates functionality related to the Classic API Task Pool
+ *  Manager.
+ *
+ *  Each processor has a job queue.  A job is submitted to the queue of the
+ *  current processor.  A worker takes the most recently submitted job of
+ *  the queue of its processor first.  If this queue is empty, then it
+ *  steals the oldest job of the queue of another processor.  A task which
+ *  waits for a job group executes queued jobs until the group is complete.
+ *
+ *  The jobs and groups are provided by the application, so that the
+ *  submission of a job needs no memory allocation and no message
+ *  queue operation.
+ */
+/**@{*/
+
+/**
+ *  This is the event used to wake up the workers and the tasks waiting for
+ *  a job group.
+ */
+#define RTEMS_TASK_POOL_EVENT RTEMS_EVENT_31
+
+/**
+ *  This type defines the prototype of a job routine.
+ */
+typedef void ( *rtems_task_pool_routine )( void *arg );
+
+/**
+ *  This type defines the control block of a job group.  A task may wait
+ *  until all jobs of a group are complete.
+ */
+typedef struct {
+  /** This lock protects the group. */
+  SMP_lock_spinlock_simple_Control  Lock;
+
+  /** This is the number of submitted jobs which are not complete. */
+  uint32_t                          pending;
+
+  /** This is the identifier of the waiting task or zero. */
+  rtems_id                          waiter;
+} rtems_task_pool_group;
+
+/**
+ *  This type defines the control block of a job.  It must not be modified
+ *  until the job is complete.
+ */
+typedef struct {
+  /** This is the node on the job queue of a processor. */
+  Chain_Node                        Node;
+
+  /** This is the routine of the job. */
+  rtems_task_pool_routine           routine;
+
+  /** This is the argument of the routine. */
+  void                             *arg;
+
+  /** This is the group of the job or NULL. */
+  rtems_task_pool_group            *group;
+} rtems_task_pool_job;
+
+/**
+ *  This type defines the job queue of a processor.
+ */
+typedef struct {
+  /** This lock protects the job queue. */
+  SMP_lock_spinlock_simple_Control  Lock;
+
+  /** This is the chain of queued jobs. */
+  Chain_Control                     Jobs;
+} rtems_task_pool_queue;
+
+/**
+ *  This type defines the control block of a task pool.
+ */
+typedef struct {
+  /** This is the array of job queues with one queue per processor. */
+  rtems_task_pool_queue            *queues;
+
+  /** This is the array of worker identifiers. */
+  rtems_id                         *workers;
+
+  /** This is the number of processors and workers. */
+  uint32_t                          worker_count;
+
+  /** This lock protects the idle workers. */
+  SMP_lock_spinlock_simple_Control  Lock;
+
+  /** This is the stack of the identifiers of the idle workers. */
+  rtems_id                         *idle;
+
+  /** This is the number of idle workers. */
+  volatile uint32_t                 idle_count;
+
+  /** This is the group which waits for the termination of the workers. */
+  rtems_task_pool_group            *terminate;
+} rtems_task_pool_control;
+
+/**
+ *  This type defines the handle of a task pool.
+ */
+typedef rtems_task_pool_control *rtems_task_pool;
+
+/**
+ *  @brief rtems_task_pool_create
+ *
+ *  This routine creates a task pool with one worker task per processor.
+ *  The workers have the name @a name, the priority @a priority, the stack
+ *  size @a stack_size and the attributes @a attribute_set.  The workers
+ *  must be accounted for in the maximum number of tasks.  With the
+ *  Priority SMP Scheduler, worker N is moved to scheduler cluster N if
+ *  this cluster exists.
+ *
+ *  @param[in] name is the name of the workers.
+ *  @param[in] priority is the priority of the workers.
+ *  @param[in] stack_size is the stack size of the workers.
+ *  @param[in] attribute_set is the attribute set of the workers.
+ *  @param[out] pool is the handle of the new task pool.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_ADDRESS The @a pool pointer is NULL.
+ *  @retval RTEMS_UNSATISFIED Not enough memory for the task pool.
+ *  @retval other The status of rtems_task_create() or rtems_task_start().
+ */
+rtems_status_code rtems_task_pool_create(
+  rtems_name           name,
+  rtems_task_priority  priority,
+  size_t               stack_size,
+  rtems_attribute      attribute_set,
+  rtems_task_pool     *pool
+);
+
+/**
+ *  @brief rtems_task_pool_delete
+ *
+ *  This routine terminates the workers of task pool @a pool and frees
+ *  the task pool.  No jobs may be queued or executing.
+ *
+ *  @param[in] pool is the task pool.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_ADDRESS The @a pool handle is NULL.
+ *  @retval RTEMS_RESOURCE_IN_USE Jobs are queued.
+ */
+rtems_status_code rtems_task_pool_delete(
+  rtems_task_pool pool
+);
+
+/**
+ *  @brief rtems_task_pool_group_initialize
+ *
+ *  This routine initializes the job group @a group.
+ *
+ *  @param[in] group is the job group.
+ */
+void rtems_task_pool_group_initialize(
+  rtems_task_pool_group *group
+);
+
+/**
+ *  @brief rtems_task_pool_submit
+ *
+ *  This routine submits the job @a job to the queue of the current
+ *  processor of task pool @a pool.  The job executes @a routine with the
+ *  argument @a arg.  If @a group is not NULL, then the job belongs to this
+ *  group.  An idle worker is woken up if necessary.  This routine may be
+ *  called from an interrupt.
+ *
+ *  @param[in] pool is the task pool.
+ *  @param[in] group is the job group or NULL.
+ *  @param[in] job is the job control block.
+ *  @param[in] routine is the job routine.
+ *  @param[in] arg is the argument of the job routine.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_ADDRESS The @a pool handle, the @a job pointer or
+ *  the @a routine pointer is NULL.
+ */
+rtems_status_code rtems_task_pool_submit(
+  rtems_task_pool          pool,
+  rtems_task_pool_group   *group,
+  rtems_task_pool_job     *job,
+  rtems_task_pool_routine  routine,
+  void                    *arg
+);
+
+/**
+ *  @brief rtems_task_pool_wait
+ *
+ *  This routine waits until all jobs of the job group @a group are
+ *  complete.  The calling task executes queued jobs of task pool @a pool
+ *  while it waits, so a job may submit jobs and wait for them.  The
+ *  calling task receives the RTEMS_TASK_POOL_EVENT event.
+ *
+ *  @param[in] pool is the task pool.
+ *  @param[in] group is the job group.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_ADDRESS The @a pool handle or the @a group pointer
+ *  is NULL.
+ */
+rtems_status_code rtems_task_pool_wait(
+  rtems_task_pool        pool,
+  rtems_task_pool_group *group
+);
+
+/**
+ *  @brief _Task_pool_Take
+ *
+ *  This routine removes a job from the queues of task pool @a pool.  The
+ *  queue of the current processor is tried first.
+ *
+ *  @param[in] pool is the task pool.
+ *  @param[in] locked is true if every queue must be inspected under its
+ *  lock.  Otherwise queues which look empty without the lock are skipped.
+ *
+ *  @return The job or NULL if all queues are empty.
+ */
+rtems_task_pool_job *_Task_pool_Take(
+  rtems_task_pool_control *pool,
+  bool                     locked
+);
+
+/**
+ *  @brief _Task_pool_Execute
+ *
+ *  This routine executes the job @a job and completes it in its group.
+ *
+ *  @param[in] job is the job.
+ */
+void _Task_pool_Execute(
+  rtems_task_pool_job *job
+);
+
+/**
+ *  @brief _Task_pool_Group_complete
+ *
+ *  This routine completes one job of the job group @a group and wakes up
+ *  the waiting task if the group is complete.
+ *
+ *  @param[in] group is the job group.
+ */
+void _Task_pool_Group_complete(
+  rtems_task_pool_group *group
+);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
@@ -56,6 +56,7 @@ extern "C" {
 #include <rtems/score/chain.h>
 #include <rtems/rtems/clock.h>
 #include <rtems/rtems/attr.h>
+#include <rtems/rtems/modes.h>
 
 /**
  *  @defgroup ClassicTimer Timers
@@ -121,6 +122,8 @@ typedef rtems_timer_service_routine ( *rtems_timer_service_routine_entry )(
                  void *
              );
 
+typedef struct Timer_server_Control Timer_server_Control;
+
 /**
  *  The following records define the control block used to manage
  *  each timer.
@@ -132,10 +135,12 @@ typedef struct {
   Watchdog_Control Ticker;
   /** This field indicates what type of timer this currently is. */
   Timer_Classes    the_class;
+  /** This field is the timer server which executes the task-based timer.
+   *  It is NULL if the default timer server executes the timer.
+   */
+  Timer_server_Control *server;
 }   Timer_Control;
 
-typedef struct Timer_server_Control Timer_server_Control;
-
 /**
  * @brief Method used to schedule the insertion of task based timers.
  */
@@ -152,9 +157,9 @@ typedef struct {
   Watchdog_Control System_watchdog;
 
   /**
-   * @brief Chain for watchdogs which will be triggered by the timer server.
+   * @brief Set of watchdogs which will be triggered by the timer server.
    */
-  Chain_Control Chain;
+  Watchdog_Header Header;
 
   /**
    * @brief Last known time snapshot of the timer server.
@@ -165,6 +170,13 @@ typedef struct {
 } Timer_server_Watchdogs;
 
 struct Timer_server_Control {
+  /**
+   * @brief Node on the chain of timer server instances.
+   *
+   * The default timer server is not on this chain.
+   */
+  Chain_Node Node;
+
   /**
    * @brief Timer server thread.
    */
@@ -190,7 +202,8 @@ struct Timer_server_Control {
    *
    * This pointer is not @c NULL whenever the interval and TOD chains are
    * processed.  After the processing this list will be checked and if
-   * necessary the processing will be restarted.  Processing of these chains
+   * necessary the processing will be restarted.  The timer server disables
+   * thread dispatching while it processes these chains, so the processing
    * can be only interrupted through interrupts.
    */
   Chain_Control *volatile insert_chain;
@@ -213,6 +226,39 @@ struct Timer_server_Control {
  */
 RTEMS_TIMER_EXTERN Timer_server_Control *volatile _Timer_server;
 
+/**
+ * @brief Chain of timer server instances.
+ *
+ * The timer server instances are created by rtems_timer_create_server().
+ */
+RTEMS_TIMER_EXTERN Chain_Control _Timer_server_Instances;
+
+/**
+ * @brief Initializes and starts a timer server.
+ *
+ * This routine creates the server task with the name @a name and
+ * initializes the timer server control block @a ts.  The server task
+ * is started afterwards.
+ *
+ * @param[in] ts is the timer server control block.
+ * @param[in] name is the name of the server task.
+ * @param[in] priority is the timer server priority.
+ * @param[in] stack_size is the stack size in bytes.
+ * @param[in] initial_modes is the initial mode of the server task.
+ * @param[in] attribute_set is the timer server attributes.
+ *
+ * @return This method returns RTEMS_SUCCESSFUL if successful and an
+ *         error code otherwise.
+ */
+rtems_status_code _Timer_server_Initialize(
+  Timer_server_Control *ts,
+  rtems_name            name,
+  uint32_t              priority,
+  uint32_t              stack_size,
+  rtems_mode            initial_modes,
+  rtems_attribute       attribute_set
+);
+
 /**
  *  The following defines the information control block used to manage
  *  this class of objects.
@@ -360,6 +406,43 @@ rtems_status_code rtems_timer_initiate_server(
   rtems_attribute      attribute_set
 );
 
+/**
+ *  @brief rtems_timer_create_server
+ *
+ *  This routine implements the rtems_timer_create_server directive.  It
+ *  creates and starts an additional server for task-based timers with
+ *  its own priority.  The server task is preemptible.  The identifier
+ *  of the server is the identifier of its task, so the task directives may be used to change the priority
+ *  or the processor affinity of the server.  Timers are bound to the
+ *  server with rtems_timer_set_server().  Timer servers cannot be deleted.
+ */
+rtems_status_code rtems_timer_create_server(
+  rtems_name           name,
+  uint32_t             priority,
+  uint32_t             stack_size,
+  rtems_attribute      attribute_set,
+  rtems_id            *id
+);
+
+/**
+ *  @brief rtems_timer_set_server
+ *
+ *  This routine implements the rtems_timer_set_server directive.  It
+ *  selects the server which executes the task-based timer ID.  The
+ *  default timer server is selected with RTEMS_TIMER_DEFAULT_SERVER.
+ *  The server of a scheduled task-based timer cannot be changed.
+ */
+rtems_status_code rtems_timer_set_server(
+  rtems_id   id,
+  rtems_id   server_id
+);
+
+/**
+ *  This is the identifier of the default timer server for
+ *  rtems_timer_set_server().
+ */
+#define RTEMS_TIMER_DEFAULT_SERVER ((rtems_id) 0)
+
 /**
  *  This is the default value for the priority of the Timer Server.
  *  When given this priority, a special high priority not accessible
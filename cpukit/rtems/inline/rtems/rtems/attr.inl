@@ -163,6 +163,19 @@ RTEMS_INLINE_ROUTINE bool _Attributes_Is_priority_ceiling(
    return ( attribute_set & RTEMS_PRIORITY_CEILING ) ? true : false;
 }
 
+/**
+ *  @brief Attributes_Is_adaptive
+ *
+ *  This function returns TRUE if the adaptive attribute
+ *  is enabled in the attribute_set and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Attributes_Is_adaptive(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_ADAPTIVE ) ? true : false;
+}
+
 /**
  *  @brief Attributes_Is_barrier_automatic
  *
@@ -176,6 +189,19 @@ RTEMS_INLINE_ROUTINE bool _Attributes_Is_barrier_automatic(
    return ( attribute_set & RTEMS_BARRIER_AUTOMATIC_RELEASE ) ? true : false;
 }
 
+/**
+ *  @brief Attributes_Is_partition_per_cpu_cache
+ *
+ *  This function returns TRUE if the partition per processor cache
+ *  attribute is enabled in the attribute_set and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Attributes_Is_partition_per_cpu_cache(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_PARTITION_PER_CPU_CACHE ) ? true : false;
+}
+
 /**
  *  @brief Attributes_Is_system_task
  *
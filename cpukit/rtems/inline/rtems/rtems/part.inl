@@ -5,7 +5,7 @@
  *  in the Partition Manager.
  */
 
-/*  COPYRIGHT (c) 1989-2008.
+/*  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -20,6 +20,10 @@
 #ifndef _RTEMS_RTEMS_PART_INL
 #define _RTEMS_RTEMS_PART_INL
 
+#include <rtems/score/atomic.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/percpu.h>
+
 /**
  *  @addtogroup ClassicPart
  *  @{
@@ -167,6 +171,252 @@ RTEMS_INLINE_ROUTINE bool _Partition_Is_null (
    return ( the_partition == NULL  );
 }
 
+/**
+ *  @brief Partition_Has_per_cpu_cache
+ *
+ *  This function returns TRUE if the_partition has per processor buffer
+ *  caches and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Partition_Has_per_cpu_cache (
+   Partition_Control *the_partition
+)
+{
+  return ( the_partition->caches != NULL );
+}
+
+/**
+ *  @brief Partition_Buffer_index
+ *
+ *  This function returns the index of the_buffer in the_partition.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Partition_Buffer_index (
+  Partition_Control *the_partition,
+  void              *the_buffer
+)
+{
+  return (uint32_t) _Addresses_Subtract(
+    the_buffer,
+    the_partition->starting_address
+  ) / the_partition->buffer_size;
+}
+
+/**
+ *  @brief Partition_Free_stack_push
+ *
+ *  This routine pushes the_buffer on the lock free stack of unallocated
+ *  buffers.  It must be called with interrupts disabled.
+ */
+RTEMS_INLINE_ROUTINE void _Partition_Free_stack_push (
+  Partition_Control *the_partition,
+  void              *the_buffer
+)
+{
+  uint32_t  top = _Partition_Buffer_index( the_partition, the_buffer ) + 1;
+  uint32_t  head;
+
+  do {
+    head = the_partition->free_stack;
+    *(volatile uint32_t *) the_buffer = head & PARTITION_FREE_STACK_INDEX_MASK;
+  } while ( !_Atomic_Compare_and_swap_uint32(
+    &the_partition->free_stack,
+    head,
+    ( ( head & ~PARTITION_FREE_STACK_INDEX_MASK )
+      + ( 1U << PARTITION_FREE_STACK_INDEX_BITS ) ) | top
+  ) );
+}
+
+/**
+ *  @brief Partition_Free_stack_pop
+ *
+ *  This function pops a buffer from the lock free stack of unallocated
+ *  buffers.  It returns NULL if the stack is empty.  It must be called
+ *  with interrupts disabled.
+ *
+ *  @note The link may be read from a buffer which another processor pops
+ *        and uses at the same time.  The compare and swap fails in this
+ *        case since the tag of the head changed.
+ */
+RTEMS_INLINE_ROUTINE void *_Partition_Free_stack_pop (
+  Partition_Control *the_partition
+)
+{
+  void     *the_buffer;
+  uint32_t  head;
+  uint32_t  next;
+
+  do {
+    head = the_partition->free_stack;
+    if ( ( head & PARTITION_FREE_STACK_INDEX_MASK ) == 0 )
+      return NULL;
+
+    the_buffer = _Addresses_Add_offset(
+      the_partition->starting_address,
+      ( ( head & PARTITION_FREE_STACK_INDEX_MASK ) - 1 )
+        * the_partition->buffer_size
+    );
+    next = *(volatile uint32_t *) the_buffer & PARTITION_FREE_STACK_INDEX_MASK;
+  } while ( !_Atomic_Compare_and_swap_uint32(
+    &the_partition->free_stack,
+    head,
+    ( ( head & ~PARTITION_FREE_STACK_INDEX_MASK )
+      + ( 1U << PARTITION_FREE_STACK_INDEX_BITS ) ) | next
+  ) );
+
+  return the_buffer;
+}
+
+/**
+ *  @brief Partition_Acquire_used_block
+ *
+ *  This function increments the number of used blocks of the_partition
+ *  unless the partition is deleted.  It returns FALSE if the partition is
+ *  deleted.  The partition cannot be deleted while the number of used
+ *  blocks is not zero, so an acquired block keeps the partition valid.
+ */
+RTEMS_INLINE_ROUTINE bool _Partition_Acquire_used_block (
+  Partition_Control *the_partition
+)
+{
+  uint32_t  used;
+
+  do {
+    used = the_partition->number_of_used_blocks;
+    if ( used == PARTITION_USED_BLOCKS_DELETED )
+      return false;
+  } while ( !_Atomic_Compare_and_swap_uint32(
+    &the_partition->number_of_used_blocks,
+    used,
+    used + 1
+  ) );
+
+  return true;
+}
+
+/**
+ *  @brief Partition_Release_used_block
+ *
+ *  This routine decrements the number of used blocks of the_partition.
+ */
+RTEMS_INLINE_ROUTINE void _Partition_Release_used_block (
+  Partition_Control *the_partition
+)
+{
+  uint32_t  used;
+
+  do {
+    used = the_partition->number_of_used_blocks;
+  } while ( !_Atomic_Compare_and_swap_uint32(
+    &the_partition->number_of_used_blocks,
+    used,
+    used - 1
+  ) );
+}
+
+/**
+ *  @brief Partition_Mark_deleted
+ *
+ *  This function marks the_partition as deleted if none of its buffers
+ *  are allocated.  It returns TRUE if the partition may be deleted and
+ *  FALSE otherwise.  It must be called with thread dispatching disabled.
+ */
+RTEMS_INLINE_ROUTINE bool _Partition_Mark_deleted (
+  Partition_Control *the_partition
+)
+{
+  return _Atomic_Compare_and_swap_uint32(
+    &the_partition->number_of_used_blocks,
+    0,
+    PARTITION_USED_BLOCKS_DELETED
+  );
+}
+
+/**
+ *  @brief Partition_Is_handle_valid
+ *
+ *  This function returns TRUE if handle refers to the current instance of
+ *  its partition and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Partition_Is_handle_valid (
+  rtems_partition_handle handle
+)
+{
+  return handle.partition->generation == handle.generation;
+}
+
+/**
+ *  @brief Partition_Get_cache
+ *
+ *  This function returns the buffer cache of the current processor.  It
+ *  must be called with interrupts disabled.
+ */
+RTEMS_INLINE_ROUTINE Partition_Per_CPU_cache *_Partition_Get_cache (
+  Partition_Control *the_partition
+)
+{
+#if defined(RTEMS_SMP)
+  return &the_partition->caches[ bsp_smp_processor_id() ];
+#else
+  return &the_partition->caches[ 0 ];
+#endif
+}
+
+/**
+ *  @brief Partition_Cache_allocate_buffer
+ *
+ *  This function allocates a buffer from the cache of the current
+ *  processor and refills the cache from the free stack if it is empty.
+ *  It returns NULL if no buffer is available.  It needs neither thread
+ *  dispatching disabled nor a lock shared with other processors.
+ */
+RTEMS_INLINE_ROUTINE void *_Partition_Cache_allocate_buffer (
+  Partition_Control *the_partition
+)
+{
+  Partition_Per_CPU_cache *cache;
+  void                    *the_buffer = NULL;
+  ISR_Level                level;
+
+  _ISR_Disable( level );
+    cache = _Partition_Get_cache( the_partition );
+
+    if ( cache->count == 0 )
+      _Partition_Cache_refill( the_partition, cache );
+
+    if ( cache->count > 0 )
+      the_buffer = cache->buffers[ --cache->count ];
+  _ISR_Enable( level );
+
+  return the_buffer;
+}
+
+/**
+ *  @brief Partition_Cache_free_buffer
+ *
+ *  This routine frees the_buffer to the cache of the current processor
+ *  and flushes half of the cache to the free stack if it is full.
+ */
+RTEMS_INLINE_ROUTINE void _Partition_Cache_free_buffer (
+  Partition_Control *the_partition,
+  void              *the_buffer
+)
+{
+  Partition_Per_CPU_cache *cache;
+  ISR_Level                level;
+
+  _ISR_Disable( level );
+    cache = _Partition_Get_cache( the_partition );
+
+    if ( cache->count == PARTITION_PER_CPU_CACHE_SIZE )
+      _Partition_Cache_flush(
+        the_partition,
+        cache,
+        PARTITION_PER_CPU_CACHE_SIZE / 2
+      );
+
+    cache->buffers[ cache->count++ ] = the_buffer;
+  _ISR_Enable( level );
+}
+
 /**@}*/
 
 #endif
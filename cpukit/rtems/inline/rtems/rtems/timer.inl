@@ -119,6 +119,50 @@ RTEMS_INLINE_ROUTINE bool _Timer_Is_null (
   return ( the_timer == NULL );
 }
 
+/**
+ *  @brief Timer_Get_server
+ *
+ *  This function returns the timer server which executes the task-based
+ *  timer THE_TIMER.  It returns NULL if this is the default timer server
+ *  and it is not initiated.
+ */
+RTEMS_INLINE_ROUTINE Timer_server_Control *_Timer_Get_server (
+  const Timer_Control *the_timer
+)
+{
+  if ( the_timer->server != NULL )
+    return the_timer->server;
+
+  return _Timer_server;
+}
+
+/**
+ *  @brief Timer_Is_any_server_initiated
+ *
+ *  This function returns TRUE if the default timer server is initiated
+ *  or a timer server instance exists, and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Timer_Is_any_server_initiated( void )
+{
+  return _Timer_server != NULL || !_Chain_Is_empty( &_Timer_server_Instances );
+}
+
+/**
+ *  @brief Timer_Is_queued
+ *
+ *  This function returns TRUE if the task-based timer THE_TIMER waits on
+ *  the insert chain of a timer server, and FALSE otherwise.  The watchdog
+ *  of a queued timer is in the WATCHDOG_BEING_INSERTED state until the
+ *  timer server inserts it, or in the WATCHDOG_INACTIVE state if it was
+ *  canceled in the meantime.
+ */
+RTEMS_INLINE_ROUTINE bool _Timer_Is_queued (
+  const Timer_Control *the_timer
+)
+{
+  return !_Chain_Is_node_off_chain( &the_timer->Object.Node );
+}
+
 /**@}*/
 
 #endif
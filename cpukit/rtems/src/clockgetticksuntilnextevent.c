@@ -0,0 +1,55 @@
+/*
+ *  Clock Manager - Get Ticks Until the Next Event
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/config.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/clock.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/tod.h>
+#include <rtems/score/watchdog.h>
+
+/*
+ *  rtems_clock_get_ticks_until_next_event
+ *
+ *  This directive returns the number of ticks until the first watchdog
+ *  of the ticks set expires.  If the seconds set is not empty, the next
+ *  second boundary is an event as well, since the seconds watchdogs are
+ *  only evaluated at second boundaries.
+ *
+ *  Input parameters:  NONE
+ *
+ *  Output parameters:
+ *    returns - number of ticks until the next event
+ */
+
+rtems_interval rtems_clock_get_ticks_until_next_event( void )
+{
+  Watchdog_Interval ticks = WATCHDOG_MAXIMUM_INTERVAL;
+
+  if ( !_Watchdog_Is_empty( &_Watchdog_Ticks_header ) )
+    ticks = _Watchdog_First_interval( &_Watchdog_Ticks_header );
+
+  if ( !_Watchdog_Is_empty( &_Watchdog_Seconds_header ) ) {
+    Watchdog_Interval second = _TOD_Ticks_until_next_second(
+      rtems_configuration_get_nanoseconds_per_tick()
+    );
+
+    if ( second < ticks )
+      ticks = second;
+  }
+
+  return ticks;
+}
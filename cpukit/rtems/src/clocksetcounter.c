@@ -0,0 +1,49 @@
+/*
+ *  Clock Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/clock.h>
+#include <rtems/score/tod.h>
+
+/*
+ *  rtems_clock_set_counter
+ *
+ *  This directive sets the BSP provided free running counter.
+ *
+ *  Input parameters:
+ *    routine   - pointer to the counter read routine
+ *    frequency - counter frequency in Hz
+ *    mask      - mask of the valid counter bits
+ *
+ *  Output parameters:
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code        - if unsuccessful
+ */
+rtems_status_code rtems_clock_set_counter(
+  rtems_clock_counter_routine routine,
+  uint32_t                    frequency,
+  uint32_t                    mask
+)
+{
+  if ( !routine )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( frequency == 0 || mask == 0 )
+    return RTEMS_INVALID_NUMBER;
+
+  _TOD_Set_counter( routine, frequency, mask );
+  return RTEMS_SUCCESSFUL;
+}
@@ -0,0 +1,62 @@
+/*
+ *  Clock Manager - Announce Several Clock Ticks
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/clock.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/tod.h>
+#include <rtems/score/watchdog.h>
+
+/*
+ *  rtems_clock_tick_announce
+ *
+ *  This directive notifies the executive that several ticks have
+ *  occurred since the last announced tick.  The ticks watchdog set is
+ *  advanced without firing and then tickled once, so that the watchdogs
+ *  which expired during the skipped ticks fire in a single pass.  The
+ *  timeslice of the executing thread is charged one tick.
+ *
+ *  Input parameters:
+ *    ticks - number of ticks to announce
+ *
+ *  Output parameters:
+ *    RTEMS_SUCCESSFUL - if successful
+ *    RTEMS_INVALID_NUMBER - if ticks is zero
+ */
+
+rtems_status_code rtems_clock_tick_announce(
+  rtems_interval ticks
+)
+{
+  if ( ticks == 0 )
+    return RTEMS_INVALID_NUMBER;
+
+  _TOD_Announce_ticks( ticks );
+
+  if ( ticks > 1 )
+    _Watchdog_Advance( &_Watchdog_Ticks_header, ticks - 1 );
+
+  _Watchdog_Tickle_ticks();
+
+  _Scheduler_Tick();
+
+  if ( _Thread_Is_context_switch_necessary() &&
+       _Thread_Is_dispatching_enabled() )
+    _Thread_Dispatch();
+
+  return RTEMS_SUCCESSFUL;
+}
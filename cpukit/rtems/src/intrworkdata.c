@@ -0,0 +1,20 @@
+/*
+ *  Interrupt Work Manager -- Instantiate Data
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+/* instantiate RTEMS interrupt work data */
+#define RTEMS_INTRWORK_EXTERN
+
+#include <rtems/system.h>
+#include <rtems/rtems/intrwork.h>
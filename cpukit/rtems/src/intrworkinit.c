@@ -0,0 +1,40 @@
+/*
+ *  Interrupt Work Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/intrwork.h>
+
+/*
+ *  rtems_interrupt_work_initialize
+ *
+ *  This directive initializes a work item which is not queued.
+ *
+ *  Input parameters:
+ *    work    - pointer to the work item
+ *    routine - work routine
+ *    arg     - work routine argument
+ */
+
+void rtems_interrupt_work_initialize(
+  rtems_interrupt_work         *work,
+  rtems_interrupt_work_routine  routine,
+  void                         *arg
+)
+{
+  _Chain_Set_off_chain( &work->Node );
+  work->routine = routine;
+  work->arg = arg;
+  work->count = 0;
+}
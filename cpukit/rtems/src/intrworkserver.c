@@ -0,0 +1,225 @@
+/*
+ *  Interrupt Work Manager - rtems_interrupt_work_initiate_server directive
+ *  along with the Interrupt Work Server Body
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/event.h>
+#include <rtems/rtems/intrwork.h>
+#include <rtems/rtems/tasks.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/object.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/watchdog.h>
+#include <rtems/score/wkspace.h>
+#if defined(RTEMS_SMP)
+#include <rtems/rtems/smp.h>
+#include <rtems/score/smp.h>
+#endif
+
+static Interrupt_work_Control _Interrupt_work_Default;
+
+/*
+ *  _Interrupt_work_Execute
+ *
+ *  This routine executes the work items queued at the time of each
+ *  dequeue.  A work item is taken off the queue before its count is reset,
+ *  so a submission after the reset queues it again and is not lost.
+ */
+
+static void _Interrupt_work_Execute(
+  Interrupt_work_Queue *queue
+)
+{
+  while ( true ) {
+    rtems_interrupt_work *work;
+    ISR_Level             level;
+    uint32_t              count;
+
+    level = _Interrupt_work_Acquire( queue );
+      work = (rtems_interrupt_work *)
+        _Chain_Get_unprotected( &queue->Work );
+    _Interrupt_work_Release( queue, level );
+
+    if ( work == NULL )
+      break;
+
+    do {
+      count = work->count;
+    } while ( !_Atomic_Compare_and_swap_uint32( &work->count, count, 0 ) );
+
+    ( *work->routine )( work->arg, count );
+  }
+}
+
+static rtems_task _Interrupt_work_Server_body(
+  rtems_task_argument argument
+)
+{
+  Interrupt_work_Queue *queue = (Interrupt_work_Queue *) argument;
+  rtems_interval        coalesce_interval =
+    _Interrupt_work_Default.coalesce_interval;
+
+  while ( true ) {
+    rtems_event_set events;
+    ISR_Level       level;
+    bool            wait;
+
+    level = _Interrupt_work_Acquire( queue );
+      wait = _Chain_Is_empty( &queue->Work );
+      queue->waiting = wait;
+    _Interrupt_work_Release( queue, level );
+
+    if ( wait ) {
+      (void) rtems_event_receive(
+        RTEMS_INTERRUPT_WORK_EVENT,
+        RTEMS_EVENT_ALL | RTEMS_WAIT,
+        WATCHDOG_NO_TIMEOUT,
+        &events
+      );
+
+      /* Let the interrupt storm fill the batch */
+      if ( coalesce_interval != 0 )
+        (void) rtems_task_wake_after( coalesce_interval );
+    }
+
+    _Interrupt_work_Execute( queue );
+  }
+}
+
+/*
+ *  rtems_interrupt_work_initiate_server
+ *
+ *  This directive creates and starts one interrupt work server per
+ *  processor.
+ *
+ *  Input parameters:
+ *    priority          - priority of the servers
+ *    stack_size        - stack size of the servers
+ *    attribute_set     - attributes of the servers
+ *    coalesce_interval - ticks to collect work items after a wake up
+ *
+ *  Output parameters:
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_interrupt_work_initiate_server(
+  rtems_task_priority priority,
+  size_t              stack_size,
+  rtems_attribute     attribute_set,
+  rtems_interval      coalesce_interval
+)
+{
+  Interrupt_work_Control *control = &_Interrupt_work_Default;
+  rtems_status_code       status = RTEMS_SUCCESSFUL;
+  static bool             initialized = false;
+  bool                    tmpInitialized;
+  uint32_t                count;
+  uint32_t                index;
+
+  /*
+   *  Just to make sure this is only called once.
+   */
+  _Thread_Disable_dispatch();
+    tmpInitialized = initialized;
+    initialized = true;
+  _Thread_Enable_dispatch();
+
+  if ( tmpInitialized )
+    return RTEMS_INCORRECT_STATE;
+
+  #if defined(RTEMS_SMP)
+    count = rtems_smp_get_number_of_processors();
+  #else
+    count = 1;
+  #endif
+
+  _Thread_Disable_dispatch();
+    control->queues = _Workspace_Allocate( count * sizeof( *control->queues ) );
+  _Thread_Enable_dispatch();
+
+  if ( control->queues == NULL ) {
+    initialized = false;
+    return RTEMS_UNSATISFIED;
+  }
+
+  control->queue_count = count;
+  control->coalesce_interval = coalesce_interval;
+
+  for ( index = 0 ; index < count ; ++index ) {
+    Interrupt_work_Queue *queue = &control->queues[ index ];
+
+    #if defined(RTEMS_SMP)
+      _SMP_lock_spinlock_simple_Initialize( &queue->Lock );
+    #endif
+    _Chain_Initialize_empty( &queue->Work );
+    queue->server = 0;
+    queue->waiting = false;
+  }
+
+  for ( index = 0 ; index < count ; ++index ) {
+    Interrupt_work_Queue *queue = &control->queues[ index ];
+    rtems_id              id;
+
+    status = rtems_task_create(
+      _Objects_Build_name('I','W','R','K'),
+      priority,
+      stack_size,
+      RTEMS_DEFAULT_MODES,
+      attribute_set,
+      &id
+    );
+    if ( status != RTEMS_SUCCESSFUL )
+      break;
+
+    #if defined(RTEMS_SMP)
+      /* Keep the server close to its queue if clusters are available */
+      (void) rtems_task_set_scheduler_cluster( id, index );
+    #endif
+
+    status = rtems_task_start(
+      id,
+      _Interrupt_work_Server_body,
+      (rtems_task_argument) queue
+    );
+    if ( status != RTEMS_SUCCESSFUL ) {
+      (void) rtems_task_delete( id );
+      break;
+    }
+
+    queue->server = id;
+  }
+
+  if ( status != RTEMS_SUCCESSFUL ) {
+    /* The servers started so far wait for work which never comes */
+    while ( index-- > 0 )
+      (void) rtems_task_delete( control->queues[ index ].server );
+
+    _Thread_Disable_dispatch();
+      _Workspace_Free( control->queues );
+    _Thread_Enable_dispatch();
+
+    initialized = false;
+    return status;
+  }
+
+  /*
+   *  The interrupt work servers are now available.
+   */
+  _Interrupt_work_Server = control;
+
+  return RTEMS_SUCCESSFUL;
+}
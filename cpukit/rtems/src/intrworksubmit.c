@@ -0,0 +1,85 @@
+/*
+ *  Interrupt Work Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/event.h>
+#include <rtems/rtems/intrwork.h>
+#include <rtems/score/atomic.h>
+#if defined(RTEMS_SMP)
+#include <rtems/score/smp.h>
+#endif
+
+/*
+ *  rtems_interrupt_work_submit
+ *
+ *  This directive counts a submission of a work item.  The first
+ *  submission queues the work item on the current processor and wakes up
+ *  the server of this processor if it waits.
+ *
+ *  Input parameters:
+ *    work - pointer to the work item
+ *
+ *  Output parameters:
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_interrupt_work_submit(
+  rtems_interrupt_work *work
+)
+{
+  Interrupt_work_Control *control = _Interrupt_work_Server;
+  Interrupt_work_Queue   *queue;
+  ISR_Level               level;
+  uint32_t                count;
+  rtems_id                server = 0;
+
+  if ( !work )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( control == NULL )
+    return RTEMS_INCORRECT_STATE;
+
+  #if defined(RTEMS_SMP)
+    queue = &control->queues[ bsp_smp_processor_id() ];
+  #else
+    queue = &control->queues[ 0 ];
+  #endif
+
+  level = _Interrupt_work_Acquire( queue );
+    do {
+      count = work->count;
+    } while ( !_Atomic_Compare_and_swap_uint32( &work->count, count, count + 1 ) );
+
+    /*
+     *  Only the submission which finds the work item idle queues it.  The
+     *  later submissions are executed with it.
+     */
+    if ( count == 0 ) {
+      _Chain_Append_unprotected( &queue->Work, &work->Node );
+
+      if ( queue->waiting ) {
+        queue->waiting = false;
+        server = queue->server;
+      }
+    }
+  _Interrupt_work_Release( queue, level );
+
+  if ( server != 0 )
+    (void) rtems_event_send( server, RTEMS_INTERRUPT_WORK_EVENT );
+
+  return RTEMS_SUCCESSFUL;
+}
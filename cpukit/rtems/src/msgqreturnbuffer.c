@@ -0,0 +1,93 @@
+/*
+ *  Message Queue Manager - rtems_message_queue_return_buffer
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/sysstate.h>
+#include <rtems/score/chain.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/coremsg.h>
+#include <rtems/score/object.h>
+#include <rtems/score/states.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/wkspace.h>
+#if defined(RTEMS_MULTIPROCESSING)
+#include <rtems/score/mpci.h>
+#endif
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/attr.h>
+#include <rtems/rtems/message.h>
+#include <rtems/rtems/options.h>
+#include <rtems/rtems/support.h>
+
+/*
+ *  rtems_message_queue_return_buffer
+ *
+ *  This routine implements the directive rtems_message_queue_return_buffer.
+ *  It returns a message buffer obtained by rtems_message_queue_get_buffer
+ *  or rtems_message_queue_receive_buffer to the specified message queue.
+ *
+ *  Input parameters:
+ *    id     - pointer to message queue
+ *    buffer - address of message buffer
+ *
+ *  Output parameters:
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_message_queue_return_buffer(
+  rtems_id  id,
+  void     *buffer
+)
+{
+  register Message_queue_Control     *the_message_queue;
+  Objects_Locations                   location;
+  CORE_message_queue_Buffer_control  *the_message;
+
+  if ( !buffer )
+    return RTEMS_INVALID_ADDRESS;
+
+  the_message_queue = _Message_queue_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      the_message = _CORE_message_queue_Get_buffer_control(
+        &the_message_queue->message_queue,
+        buffer
+      );
+      if ( !the_message ) {
+        _Thread_Enable_dispatch();
+        return RTEMS_INVALID_ADDRESS;
+      }
+
+      _CORE_message_queue_Return_buffer(
+        &the_message_queue->message_queue,
+        the_message
+      );
+      _Thread_Enable_dispatch();
+      return RTEMS_SUCCESSFUL;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      _Thread_Dispatch();
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
@@ -0,0 +1,73 @@
+/*
+ *  Partition Manager -- Per Processor Buffer Caches
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/support.h>
+#include <rtems/score/address.h>
+#include <rtems/score/object.h>
+#include <rtems/rtems/part.h>
+#include <rtems/score/thread.h>
+
+/*
+ *  _Partition_Cache_refill
+ *
+ *  Only half of the cache is filled, so that a processor which alternates
+ *  between allocation and free does not move buffers back and forth.
+ */
+
+void _Partition_Cache_refill(
+  Partition_Control       *the_partition,
+  Partition_Per_CPU_cache *cache
+)
+{
+  while ( cache->count < PARTITION_PER_CPU_CACHE_SIZE / 2 ) {
+    void *the_buffer = _Partition_Free_stack_pop( the_partition );
+
+    if ( the_buffer == NULL )
+      break;
+
+    cache->buffers[ cache->count++ ] = the_buffer;
+  }
+}
+
+void _Partition_Cache_flush(
+  Partition_Control       *the_partition,
+  Partition_Per_CPU_cache *cache,
+  uint32_t                 count
+)
+{
+  while ( count-- > 0 && cache->count > 0 )
+    _Partition_Free_stack_push(
+      the_partition,
+      cache->buffers[ --cache->count ]
+    );
+}
+
+/*
+ *  _Partition_Get_number_of_used_blocks
+ *
+ *  The number of used blocks is maintained by the get and return
+ *  directives, so it is exact for partitions with and without caches.
+ */
+
+uint32_t _Partition_Get_number_of_used_blocks(
+  Partition_Control *the_partition
+)
+{
+  uint32_t  used = the_partition->number_of_used_blocks;
+
+  return ( used != PARTITION_USED_BLOCKS_DELETED ) ? used : 0;
+}
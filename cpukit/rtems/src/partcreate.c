@@ -2,7 +2,7 @@
  *  Partition Manager
  *
  *
- *  COPYRIGHT (c) 1989-1999.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -22,6 +22,54 @@
 #include <rtems/rtems/part.h>
 #include <rtems/score/thread.h>
 #include <rtems/score/sysstate.h>
+#include <rtems/score/wkspace.h>
+#if defined(RTEMS_SMP)
+#include <rtems/score/smp.h>
+#endif
+
+/*
+ *  _Partition_Initialize_per_cpu_cache
+ *
+ *  This routine allocates the per processor caches of the_partition and
+ *  pushes all buffers on its free stack.  The link of each buffer refers
+ *  to the buffer below it, so the stack is built without atomic
+ *  operations before the partition is visible.
+ */
+
+static bool _Partition_Initialize_per_cpu_cache(
+  Partition_Control *the_partition,
+  uint32_t           number_of_buffers
+)
+{
+  uint32_t count;
+  uint32_t index;
+
+  #if defined(RTEMS_SMP)
+    count = _SMP_Processor_count;
+  #else
+    count = 1;
+  #endif
+
+  the_partition->caches = _Workspace_Allocate(
+    count * sizeof( *the_partition->caches )
+  );
+  if ( the_partition->caches == NULL )
+    return false;
+
+  the_partition->cache_count = count;
+  for ( index = 0 ; index < count ; ++index )
+    the_partition->caches[ index ].count = 0;
+
+  for ( index = 0 ; index < number_of_buffers ; ++index ) {
+    *(uint32_t *) _Addresses_Add_offset(
+      the_partition->starting_address,
+      index * the_partition->buffer_size
+    ) = index;
+  }
+  the_partition->free_stack = number_of_buffers;
+
+  return true;
+}
 
 /*
  *  rtems_partition_create
@@ -53,6 +101,7 @@ rtems_status_code rtems_partition_create(
 )
 {
   register Partition_Control *the_partition;
+  uint32_t                    number_of_buffers;
 
   if ( !rtems_is_name_valid( name ) )
     return RTEMS_INVALID_NAME;
@@ -70,6 +119,20 @@ rtems_status_code rtems_partition_create(
   if ( !_Addresses_Is_aligned( starting_address ) )
      return RTEMS_INVALID_ADDRESS;
 
+  number_of_buffers = length / buffer_size;
+
+  if ( _Attributes_Is_partition_per_cpu_cache( attribute_set ) ) {
+#if defined(RTEMS_MULTIPROCESSING)
+    if ( _Attributes_Is_global( attribute_set ) )
+      return RTEMS_NOT_DEFINED;
+#endif
+
+    /* The free stack links are stored in the buffers */
+    if ( buffer_size < sizeof( uint32_t ) ||
+         number_of_buffers > PARTITION_FREE_STACK_INDEX_MASK )
+      return RTEMS_INVALID_SIZE;
+  }
+
 #if defined(RTEMS_MULTIPROCESSING)
   if ( _Attributes_Is_global( attribute_set ) &&
        !_System_state_Is_multiprocessing )
@@ -100,9 +163,23 @@ rtems_status_code rtems_partition_create(
   the_partition->buffer_size           = buffer_size;
   the_partition->attribute_set         = attribute_set;
   the_partition->number_of_used_blocks = 0;
-
-  _Chain_Initialize( &the_partition->Memory, starting_address,
-                        length / buffer_size, buffer_size );
+  the_partition->free_stack            = 0;
+  the_partition->caches                = NULL;
+  the_partition->cache_count           = 0;
+
+  if ( _Attributes_Is_partition_per_cpu_cache( attribute_set ) ) {
+    _Chain_Initialize_empty( &the_partition->Memory );
+
+    if ( !_Partition_Initialize_per_cpu_cache( the_partition,
+                                               number_of_buffers ) ) {
+      _Partition_Free( the_partition );
+      _Thread_Enable_dispatch();
+      return RTEMS_UNSATISFIED;
+    }
+  } else {
+    _Chain_Initialize( &the_partition->Memory, starting_address,
+                          number_of_buffers, buffer_size );
+  }
 
   _Objects_Open(
     &_Partition_Information,
@@ -22,13 +22,16 @@
 #include <rtems/rtems/part.h>
 #include <rtems/score/thread.h>
 #include <rtems/score/sysstate.h>
+#include <rtems/score/wkspace.h>
 
 /*
  *  rtems_partition_delete
  *
  *  This directive allows a thread to delete a partition specified by
  *  the partition identifier, provided that none of its buffers are
- *  still allocated.
+ *  still allocated.  The partition is marked as deleted in the same
+ *  atomic operation which checks the number of used blocks, so that the
+ *  handle directives cannot allocate a buffer concurrently.
  *
  *  Input parameters:
  *    id - partition id
@@ -49,8 +52,11 @@ rtems_status_code rtems_partition_delete(
   switch ( location ) {
 
     case OBJECTS_LOCAL:
-      if ( the_partition->number_of_used_blocks == 0 ) {
+      if ( _Partition_Mark_deleted( the_partition ) ) {
+        the_partition->generation += 1;
         _Objects_Close( &_Partition_Information, &the_partition->Object );
+        if ( _Partition_Has_per_cpu_cache( the_partition ) )
+          _Workspace_Free( the_partition->caches );
         _Partition_Free( the_partition );
 #if defined(RTEMS_MULTIPROCESSING)
         if ( _Attributes_Is_global( the_partition->attribute_set ) ) {
@@ -54,14 +54,20 @@ rtems_status_code rtems_partition_get_buffer(
   switch ( location ) {
 
     case OBJECTS_LOCAL:
-      the_buffer = _Partition_Allocate_buffer( the_partition );
+      the_buffer = NULL;
+      if ( _Partition_Acquire_used_block( the_partition ) ) {
+        if ( _Partition_Has_per_cpu_cache( the_partition ) )
+          the_buffer = _Partition_Cache_allocate_buffer( the_partition );
+        else
+          the_buffer = _Partition_Allocate_buffer( the_partition );
+        if ( !the_buffer )
+          _Partition_Release_used_block( the_partition );
+      }
+      _Thread_Enable_dispatch();
       if ( the_buffer ) {
-        the_partition->number_of_used_blocks += 1;
-        _Thread_Enable_dispatch();
         *buffer = the_buffer;
         return RTEMS_SUCCESSFUL;
       }
-      _Thread_Enable_dispatch();
       return RTEMS_UNSATISFIED;
 
 #if defined(RTEMS_MULTIPROCESSING)
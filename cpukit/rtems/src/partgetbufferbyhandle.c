@@ -0,0 +1,84 @@
+/*
+ *  Partition Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/support.h>
+#include <rtems/score/address.h>
+#include <rtems/score/object.h>
+#include <rtems/rtems/part.h>
+#include <rtems/score/thread.h>
+
+/*
+ *  rtems_partition_get_buffer_by_handle
+ *
+ *  This directive will obtain a buffer from a buffer partition without
+ *  an identifier lookup.  A partition with per processor caches is
+ *  accessed with thread dispatching enabled.  A handle of a deleted
+ *  partition is rejected.
+ *
+ *  Input parameters:
+ *    handle - partition handle
+ *    buffer - pointer to buffer address
+ *
+ *  Output parameters:
+ *    buffer           - pointer to buffer address filled in
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_partition_get_buffer_by_handle(
+  rtems_partition_handle   handle,
+  void                   **buffer
+)
+{
+  Partition_Control *the_partition = handle.partition;
+  void              *the_buffer;
+
+  if ( !buffer )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( _Partition_Is_null( the_partition ) )
+    return RTEMS_INVALID_ID;
+
+  /*
+   *  The used block keeps the partition from being deleted.  The handle
+   *  is checked afterwards, since the control block may belong to a new
+   *  partition if the partition of the handle was deleted.
+   */
+  if ( !_Partition_Acquire_used_block( the_partition ) )
+    return RTEMS_INVALID_ID;
+
+  if ( !_Partition_Is_handle_valid( handle ) ) {
+    _Partition_Release_used_block( the_partition );
+    return RTEMS_INVALID_ID;
+  }
+
+  if ( _Partition_Has_per_cpu_cache( the_partition ) ) {
+    the_buffer = _Partition_Cache_allocate_buffer( the_partition );
+  } else {
+    _Thread_Disable_dispatch();
+      the_buffer = _Partition_Allocate_buffer( the_partition );
+    _Thread_Enable_dispatch();
+  }
+
+  if ( !the_buffer ) {
+    _Partition_Release_used_block( the_partition );
+    return RTEMS_UNSATISFIED;
+  }
+
+  *buffer = the_buffer;
+  return RTEMS_SUCCESSFUL;
+}
@@ -0,0 +1,70 @@
+/*
+ *  Partition Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/support.h>
+#include <rtems/score/address.h>
+#include <rtems/score/object.h>
+#include <rtems/rtems/part.h>
+#include <rtems/score/thread.h>
+
+/*
+ *  rtems_partition_get_handle
+ *
+ *  This directive returns the handle of a local partition.
+ *
+ *  Input parameters:
+ *    id     - partition id
+ *    handle - pointer to partition handle
+ *
+ *  Output parameters:
+ *    handle           - partition handle filled in
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_partition_get_handle(
+  rtems_id                id,
+  rtems_partition_handle *handle
+)
+{
+  register Partition_Control *the_partition;
+  Objects_Locations           location;
+
+  if ( !handle )
+    return RTEMS_INVALID_ADDRESS;
+
+  the_partition = _Partition_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      handle->partition = the_partition;
+      handle->generation = the_partition->generation;
+      _Thread_Enable_dispatch();
+      return RTEMS_SUCCESSFUL;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      _Thread_Dispatch();
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
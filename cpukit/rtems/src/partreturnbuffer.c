@@ -51,8 +51,11 @@ rtems_status_code rtems_partition_return_buffer(
 
     case OBJECTS_LOCAL:
       if ( _Partition_Is_buffer_valid( buffer, the_partition ) ) {
-        _Partition_Free_buffer( the_partition, buffer );
-        the_partition->number_of_used_blocks -= 1;
+        if ( _Partition_Has_per_cpu_cache( the_partition ) )
+          _Partition_Cache_free_buffer( the_partition, buffer );
+        else
+          _Partition_Free_buffer( the_partition, buffer );
+        _Partition_Release_used_block( the_partition );
         _Thread_Enable_dispatch();
         return RTEMS_SUCCESSFUL;
       }
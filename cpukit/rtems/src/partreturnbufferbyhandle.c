@@ -0,0 +1,70 @@
+/*
+ *  Partition Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/support.h>
+#include <rtems/score/address.h>
+#include <rtems/score/object.h>
+#include <rtems/rtems/part.h>
+#include <rtems/score/thread.h>
+
+/*
+ *  rtems_partition_return_buffer_by_handle
+ *
+ *  This directive will return the given buffer to the specified
+ *  buffer partition without an identifier lookup.
+ *
+ *  Input parameters:
+ *    handle - partition handle
+ *    buffer - pointer to buffer address
+ *
+ *  Output parameters:
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_partition_return_buffer_by_handle(
+  rtems_partition_handle  handle,
+  void                   *buffer
+)
+{
+  Partition_Control *the_partition = handle.partition;
+
+  if ( _Partition_Is_null( the_partition ) )
+    return RTEMS_INVALID_ID;
+
+  /*
+   *  A partition with an allocated buffer cannot be deleted, so a valid
+   *  handle stays valid until the buffer is freed.
+   */
+  if ( !_Partition_Is_handle_valid( handle ) )
+    return RTEMS_INVALID_ID;
+
+  if ( !_Partition_Is_buffer_valid( buffer, the_partition ) )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( _Partition_Has_per_cpu_cache( the_partition ) ) {
+    _Partition_Cache_free_buffer( the_partition, buffer );
+  } else {
+    _Thread_Disable_dispatch();
+      _Partition_Free_buffer( the_partition, buffer );
+    _Thread_Enable_dispatch();
+  }
+
+  _Partition_Release_used_block( the_partition );
+
+  return RTEMS_SUCCESSFUL;
+}
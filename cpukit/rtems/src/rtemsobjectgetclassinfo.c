@@ -47,7 +47,7 @@ rtems_status_code rtems_object_get_class_information(
   info->maximum     = obj_info->maximum;
 
   for ( unallocated=0, i=1 ; i <= info->maximum ; i++ )
-    if ( !obj_info->local_table[i] )
+    if ( !_Objects_Get_local_object( obj_info, i ) )
       unallocated++;
 
   info->unallocated = unallocated;
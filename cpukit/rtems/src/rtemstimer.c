@@ -58,4 +58,10 @@ void _Timer_Manager_initialization(void)
    */
 
   _Timer_server = NULL;
+
+  /*
+   *  Initialize the chain of additional timer server instances.
+   */
+
+  _Chain_Initialize_empty( &_Timer_server_Instances );
 }
@@ -111,6 +111,10 @@ rtems_status_code rtems_semaphore_create(
        _Attributes_Is_priority_ceiling( attribute_set ) )
     return RTEMS_NOT_DEFINED;
 
+  if ( _Attributes_Is_counting_semaphore( attribute_set ) &&
+       _Attributes_Is_adaptive( attribute_set ) )
+    return RTEMS_NOT_DEFINED;
+
   if ( !_Attributes_Is_counting_semaphore( attribute_set ) && ( count > 1 ) )
     return RTEMS_INVALID_NUMBER;
 
@@ -170,6 +174,8 @@ rtems_status_code rtems_semaphore_create(
     else
       the_mutex_attr.discipline = CORE_MUTEX_DISCIPLINES_FIFO;
 
+    the_mutex_attr.adaptive = _Attributes_Is_adaptive( attribute_set );
+
     if ( _Attributes_Is_binary_semaphore( attribute_set ) ) {
       the_mutex_attr.priority_ceiling      = priority_ceiling;
       the_mutex_attr.lock_nesting_behavior = CORE_MUTEX_NESTING_ACQUIRES;
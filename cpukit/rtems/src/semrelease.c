@@ -72,14 +72,27 @@ rtems_status_code rtems_semaphore_release(
 {
   register Semaphore_Control *the_semaphore;
   Objects_Locations           location;
+  ISR_Level                   level;
   CORE_mutex_Status           mutex_status;
   CORE_semaphore_Status       semaphore_status;
 
-  the_semaphore = _Semaphore_Get( id, &location );
+  the_semaphore = _Semaphore_Get_interrupt_disable( id, &location, &level );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
       if ( !_Attributes_Is_counting_semaphore(the_semaphore->attribute_set) ) {
+        /*
+         *  If the mutex is held once by the executing task and no task
+         *  waits on it, then the thread dispatch disable lock is not needed.
+         */
+        if ( _CORE_mutex_Fast_surrender(
+                &the_semaphore->Core_control.mutex,
+                &level
+              ) )
+          return RTEMS_SUCCESSFUL;
+
+        _Thread_Disable_dispatch();
+        _ISR_Enable( level );
         mutex_status = _CORE_mutex_Surrender(
           &the_semaphore->Core_control.mutex,
           id,
@@ -87,16 +100,28 @@ rtems_status_code rtems_semaphore_release(
         );
         _Thread_Enable_dispatch();
         return _Semaphore_Translate_core_mutex_return_code( mutex_status );
-      } else {
+      }
+
+      /*
+       *  If no task waits on the counting semaphore, then the thread
+       *  dispatch disable lock is not needed.
+       */
+      if ( !_CORE_semaphore_Fast_surrender(
+              &the_semaphore->Core_control.semaphore,
+              &level,
+              &semaphore_status
+            ) ) {
+        _Thread_Disable_dispatch();
+        _ISR_Enable( level );
         semaphore_status = _CORE_semaphore_Surrender(
           &the_semaphore->Core_control.semaphore,
           id,
           MUTEX_MP_SUPPORT
         );
         _Thread_Enable_dispatch();
-        return
-          _Semaphore_Translate_core_semaphore_return_code( semaphore_status );
       }
+      return
+        _Semaphore_Translate_core_semaphore_return_code( semaphore_status );
 
 #if defined(RTEMS_MULTIPROCESSING)
     case OBJECTS_REMOTE:
@@ -0,0 +1,102 @@
+/*
+ *  Task Pool Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/event.h>
+#include <rtems/rtems/taskpool.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smplock.h>
+
+/*
+ *  _Task_pool_Take
+ *
+ *  The queue of the current processor is used like a stack since its most
+ *  recently submitted job likely finds its data in the cache.  The queues
+ *  of the other processors are used like FIFOs to steal the oldest jobs,
+ *  which are likely the largest ones in fork-join style programs.
+ *
+ *  A queue which looks empty without the lock may have a job appended by
+ *  another processor.  Callers which must not miss such a job use the
+ *  locked mode.
+ */
+
+rtems_task_pool_job *_Task_pool_Take(
+  rtems_task_pool_control *pool,
+  bool                     locked
+)
+{
+  uint32_t    count = pool->worker_count;
+  uint32_t    cpu = (uint32_t) bsp_smp_processor_id();
+  uint32_t    index;
+
+  for ( index = 0 ; index < count ; ++index ) {
+    rtems_task_pool_queue *queue = &pool->queues[ (cpu + index) % count ];
+    Chain_Node            *node;
+    ISR_Level              level;
+
+    /* Avoid the lock traffic on empty queues */
+    if ( !locked && _Chain_Is_empty( &queue->Jobs ) )
+      continue;
+
+    level = _SMP_lock_spinlock_simple_Obtain( &queue->Lock );
+      if ( _Chain_Is_empty( &queue->Jobs ) ) {
+        node = NULL;
+      } else if ( index == 0 ) {
+        node = _Chain_Last( &queue->Jobs );
+        _Chain_Extract_unprotected( node );
+      } else {
+        node = _Chain_Get_first_unprotected( &queue->Jobs );
+      }
+    _SMP_lock_spinlock_simple_Release( &queue->Lock, level );
+
+    if ( node != NULL )
+      return (rtems_task_pool_job *) node;
+  }
+
+  return NULL;
+}
+
+void _Task_pool_Group_complete(
+  rtems_task_pool_group *group
+)
+{
+  rtems_id  waiter = 0;
+  ISR_Level level;
+
+  level = _SMP_lock_spinlock_simple_Obtain( &group->Lock );
+    if ( --group->pending == 0 ) {
+      waiter = group->waiter;
+      group->waiter = 0;
+    }
+  _SMP_lock_spinlock_simple_Release( &group->Lock, level );
+
+  /* The group may be gone once the waiter returns */
+  if ( waiter != 0 )
+    (void) rtems_event_send( waiter, RTEMS_TASK_POOL_EVENT );
+}
+
+void _Task_pool_Execute(
+  rtems_task_pool_job *job
+)
+{
+  rtems_task_pool_group *group = job->group;
+
+  /* The job may be reused by the application once the routine returns */
+  ( *job->routine )( job->arg );
+
+  if ( group != NULL )
+    _Task_pool_Group_complete( group );
+}
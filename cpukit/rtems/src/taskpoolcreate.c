@@ -0,0 +1,195 @@
+/*
+ *  Task Pool Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/event.h>
+#include <rtems/rtems/smp.h>
+#include <rtems/rtems/taskpool.h>
+#include <rtems/rtems/tasks.h>
+#include <rtems/score/smplock.h>
+#include <rtems/score/watchdog.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/wkspace.h>
+
+static void _Task_pool_Set_busy(
+  rtems_task_pool_control *pool,
+  rtems_id                 self
+)
+{
+  ISR_Level level;
+  uint32_t  index;
+
+  level = _SMP_lock_spinlock_simple_Obtain( &pool->Lock );
+    for ( index = 0 ; index < pool->idle_count ; ++index ) {
+      if ( pool->idle[ index ] == self ) {
+        pool->idle[ index ] = pool->idle[ --pool->idle_count ];
+        break;
+      }
+    }
+  _SMP_lock_spinlock_simple_Release( &pool->Lock, level );
+}
+
+static rtems_task _Task_pool_Worker(
+  rtems_task_argument argument
+)
+{
+  rtems_task_pool_control *pool = (rtems_task_pool_control *) argument;
+  rtems_id                 self = rtems_task_self();
+
+  while ( true ) {
+    rtems_task_pool_job *job;
+    rtems_event_set      events;
+    ISR_Level            level;
+
+    job = _Task_pool_Take( pool, false );
+    if ( job != NULL ) {
+      _Task_pool_Execute( job );
+      continue;
+    }
+
+    if ( pool->terminate != NULL )
+      break;
+
+    level = _SMP_lock_spinlock_simple_Obtain( &pool->Lock );
+      pool->idle[ pool->idle_count++ ] = self;
+    _SMP_lock_spinlock_simple_Release( &pool->Lock, level );
+
+    /*
+     *  Look again since a job may be submitted before we were idle.  The
+     *  queue locks order this look after the append of a submitter which
+     *  did not see us idle.
+     */
+    job = _Task_pool_Take( pool, true );
+    if ( job == NULL ) {
+      (void) rtems_event_receive(
+        RTEMS_TASK_POOL_EVENT,
+        RTEMS_EVENT_ALL | RTEMS_WAIT,
+        WATCHDOG_NO_TIMEOUT,
+        &events
+      );
+    }
+
+    _Task_pool_Set_busy( pool, self );
+
+    if ( job != NULL )
+      _Task_pool_Execute( job );
+  }
+
+  /* The task pool may be freed after the group completion */
+  _Task_pool_Group_complete( pool->terminate );
+  (void) rtems_task_delete( RTEMS_SELF );
+}
+
+/*
+ *  rtems_task_pool_create
+ *
+ *  This directive creates a task pool with one worker task per processor.
+ *
+ *  Input parameters:
+ *    name          - user defined name of the workers
+ *    priority      - priority of the workers
+ *    stack_size    - stack size of the workers
+ *    attribute_set - attributes of the workers
+ *    pool          - pointer to the task pool handle
+ *
+ *  Output parameters:
+ *    pool             - task pool handle
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_task_pool_create(
+  rtems_name           name,
+  rtems_task_priority  priority,
+  size_t               stack_size,
+  rtems_attribute      attribute_set,
+  rtems_task_pool     *pool
+)
+{
+  rtems_task_pool_control *the_pool;
+  rtems_status_code        status = RTEMS_SUCCESSFUL;
+  uint32_t                 count;
+  uint32_t                 index;
+
+  if ( !pool )
+    return RTEMS_INVALID_ADDRESS;
+
+  count = rtems_smp_get_number_of_processors();
+
+  _Thread_Disable_dispatch();
+    the_pool = _Workspace_Allocate(
+      sizeof( *the_pool ) + count * (sizeof( *the_pool->queues )
+        + sizeof( *the_pool->workers ) + sizeof( *the_pool->idle ))
+    );
+  _Thread_Enable_dispatch();
+
+  if ( the_pool == NULL )
+    return RTEMS_UNSATISFIED;
+
+  the_pool->queues = (rtems_task_pool_queue *) ( the_pool + 1 );
+  the_pool->workers = (rtems_id *) ( the_pool->queues + count );
+  the_pool->idle = the_pool->workers + count;
+  the_pool->worker_count = count;
+  the_pool->idle_count = 0;
+  the_pool->terminate = NULL;
+  _SMP_lock_spinlock_simple_Initialize( &the_pool->Lock );
+
+  for ( index = 0 ; index < count ; ++index ) {
+    _SMP_lock_spinlock_simple_Initialize( &the_pool->queues[ index ].Lock );
+    _Chain_Initialize_empty( &the_pool->queues[ index ].Jobs );
+  }
+
+  for ( index = 0 ; index < count ; ++index ) {
+    rtems_id id;
+
+    status = rtems_task_create(
+      name,
+      priority,
+      stack_size,
+      RTEMS_DEFAULT_MODES,
+      attribute_set,
+      &id
+    );
+    if ( status != RTEMS_SUCCESSFUL )
+      break;
+
+    /* Keep the worker close to its queue if clusters are available */
+    (void) rtems_task_set_scheduler_cluster( id, index );
+
+    status = rtems_task_start(
+      id,
+      _Task_pool_Worker,
+      (rtems_task_argument) the_pool
+    );
+    if ( status != RTEMS_SUCCESSFUL ) {
+      (void) rtems_task_delete( id );
+      break;
+    }
+
+    the_pool->workers[ index ] = id;
+  }
+
+  if ( status != RTEMS_SUCCESSFUL ) {
+    /* Terminate the workers started so far */
+    the_pool->worker_count = index;
+    (void) rtems_task_pool_delete( the_pool );
+    return status;
+  }
+
+  *pool = the_pool;
+
+  return RTEMS_SUCCESSFUL;
+}
@@ -0,0 +1,69 @@
+/*
+ *  Task Pool Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/event.h>
+#include <rtems/rtems/taskpool.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/wkspace.h>
+
+/*
+ *  rtems_task_pool_delete
+ *
+ *  This directive terminates the workers and frees the task pool.
+ *
+ *  Input parameters:
+ *    pool - task pool handle
+ *
+ *  Output parameters:
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_task_pool_delete(
+  rtems_task_pool pool
+)
+{
+  rtems_task_pool_group terminate;
+  uint32_t              index;
+
+  if ( !pool )
+    return RTEMS_INVALID_ADDRESS;
+
+  for ( index = 0 ; index < pool->worker_count ; ++index ) {
+    if ( !_Chain_Is_empty( &pool->queues[ index ].Jobs ) )
+      return RTEMS_RESOURCE_IN_USE;
+  }
+
+  /*
+   *  Each worker completes one job of this group before it deletes
+   *  itself.
+   */
+  rtems_task_pool_group_initialize( &terminate );
+  terminate.pending = pool->worker_count;
+  pool->terminate = &terminate;
+
+  for ( index = 0 ; index < pool->worker_count ; ++index )
+    (void) rtems_event_send( pool->workers[ index ], RTEMS_TASK_POOL_EVENT );
+
+  (void) rtems_task_pool_wait( pool, &terminate );
+
+  _Thread_Disable_dispatch();
+    _Workspace_Free( pool );
+  _Thread_Enable_dispatch();
+
+  return RTEMS_SUCCESSFUL;
+}
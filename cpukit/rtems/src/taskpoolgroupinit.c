@@ -0,0 +1,36 @@
+/*
+ *  Task Pool Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/taskpool.h>
+#include <rtems/score/smplock.h>
+
+/*
+ *  rtems_task_pool_group_initialize
+ *
+ *  This directive initializes a job group without jobs.
+ *
+ *  Input parameters:
+ *    group - pointer to the job group
+ */
+
+void rtems_task_pool_group_initialize(
+  rtems_task_pool_group *group
+)
+{
+  _SMP_lock_spinlock_simple_Initialize( &group->Lock );
+  group->pending = 0;
+  group->waiter = 0;
+}
@@ -0,0 +1,88 @@
+/*
+ *  Task Pool Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/event.h>
+#include <rtems/rtems/taskpool.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smplock.h>
+
+/*
+ *  rtems_task_pool_submit
+ *
+ *  This directive queues a job on the current processor and wakes up an
+ *  idle worker.
+ *
+ *  Input parameters:
+ *    pool    - task pool handle
+ *    group   - pointer to the job group or NULL
+ *    job     - pointer to the job control block
+ *    routine - job routine
+ *    arg     - job routine argument
+ *
+ *  Output parameters:
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_task_pool_submit(
+  rtems_task_pool          pool,
+  rtems_task_pool_group   *group,
+  rtems_task_pool_job     *job,
+  rtems_task_pool_routine  routine,
+  void                    *arg
+)
+{
+  rtems_task_pool_queue *queue;
+  rtems_id               worker = 0;
+  ISR_Level              level;
+
+  if ( !pool || !job || !routine )
+    return RTEMS_INVALID_ADDRESS;
+
+  job->routine = routine;
+  job->arg = arg;
+  job->group = group;
+
+  if ( group != NULL ) {
+    level = _SMP_lock_spinlock_simple_Obtain( &group->Lock );
+      ++group->pending;
+    _SMP_lock_spinlock_simple_Release( &group->Lock, level );
+  }
+
+  queue = &pool->queues[ bsp_smp_processor_id() ];
+
+  level = _SMP_lock_spinlock_simple_Obtain( &queue->Lock );
+    _Chain_Append_unprotected( &queue->Jobs, &job->Node );
+  _SMP_lock_spinlock_simple_Release( &queue->Lock, level );
+
+  /*
+   *  A worker announces that it is idle under the pool lock before it looks
+   *  at the queues a last time under the queue locks.  We append under the
+   *  queue lock and check for idle workers under the pool lock, so either
+   *  the worker finds the job or we find the worker.  An unlocked check of
+   *  the idle count could read a stale value on SMP.
+   */
+  level = _SMP_lock_spinlock_simple_Obtain( &pool->Lock );
+    if ( pool->idle_count != 0 )
+      worker = pool->idle[ --pool->idle_count ];
+  _SMP_lock_spinlock_simple_Release( &pool->Lock, level );
+
+  if ( worker != 0 )
+    (void) rtems_event_send( worker, RTEMS_TASK_POOL_EVENT );
+
+  return RTEMS_SUCCESSFUL;
+}
@@ -0,0 +1,87 @@
+/*
+ *  Task Pool Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/event.h>
+#include <rtems/rtems/taskpool.h>
+#include <rtems/rtems/tasks.h>
+#include <rtems/score/smplock.h>
+#include <rtems/score/watchdog.h>
+
+/*
+ *  rtems_task_pool_wait
+ *
+ *  This directive executes queued jobs until the group is complete.  If
+ *  no job is queued, then the calling task blocks until the last job of
+ *  the group completes.
+ *
+ *  Input parameters:
+ *    pool  - task pool handle
+ *    group - pointer to the job group
+ *
+ *  Output parameters:
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_task_pool_wait(
+  rtems_task_pool        pool,
+  rtems_task_pool_group *group
+)
+{
+  rtems_id self = rtems_task_self();
+
+  if ( !pool || !group )
+    return RTEMS_INVALID_ADDRESS;
+
+  while ( true ) {
+    rtems_task_pool_job *job;
+    rtems_event_set      events;
+    bool                 complete;
+    ISR_Level            level;
+
+    if ( group->pending != 0 ) {
+      job = _Task_pool_Take( pool, false );
+      if ( job != NULL ) {
+        _Task_pool_Execute( job );
+        continue;
+      }
+    }
+
+    /*
+     *  The group may be gone once we return, so the completion must be
+     *  observed under the lock the last job releases.
+     */
+    level = _SMP_lock_spinlock_simple_Obtain( &group->Lock );
+      complete = group->pending == 0;
+      if ( !complete )
+        group->waiter = self;
+    _SMP_lock_spinlock_simple_Release( &group->Lock, level );
+
+    if ( complete )
+      break;
+
+    /* An event of a previous group only causes another iteration */
+    (void) rtems_event_receive(
+      RTEMS_TASK_POOL_EVENT,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      WATCHDOG_NO_TIMEOUT,
+      &events
+    );
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
@@ -0,0 +1,75 @@
+/*
+ *  RTEMS Task Manager
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/smp.h>
+#include <rtems/score/object.h>
+#include <rtems/score/schedulerprioritysmp.h>
+#include <rtems/score/thread.h>
+
+/*
+ *  rtems_task_set_scheduler_cluster
+ *
+ *  This directive moves the specified thread to another cluster of the
+ *  Priority SMP Scheduler.
+ *
+ *  Input parameters:
+ *    id      - thread id (0 indicates requesting thread)
+ *    cluster - index of the new cluster
+ *
+ *  Output parameters:
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_task_set_scheduler_cluster(
+  rtems_id id,
+  uint32_t cluster
+)
+{
+  Thread_Control    *the_thread;
+  Objects_Locations  location;
+  rtems_status_code  status;
+
+  if ( _Scheduler.Operations.initialize != _Scheduler_priority_smp_Initialize )
+    return RTEMS_NOT_CONFIGURED;
+
+  the_thread = _Thread_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      /* The idle threads must stay in the cluster of their core */
+      if ( _Objects_Get_API( the_thread->Object.id ) == OBJECTS_INTERNAL_API )
+        status = RTEMS_INVALID_ID;
+      else if ( !_Scheduler_priority_smp_Set_cluster( the_thread, cluster ) )
+        status = RTEMS_INVALID_NUMBER;
+      else
+        status = RTEMS_SUCCESSFUL;
+      _Thread_Enable_dispatch();
+      return status;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      _Thread_Dispatch();
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
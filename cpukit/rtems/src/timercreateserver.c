@@ -0,0 +1,94 @@
+/*
+ *  Timer Manager - rtems_timer_create_server directive
+ *
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/support.h>
+#include <rtems/rtems/tasks.h>
+#include <rtems/score/object.h>
+#include <rtems/score/thread.h>
+#include <rtems/rtems/timer.h>
+#include <rtems/score/wkspace.h>
+
+/*
+ *  rtems_timer_create_server
+ *
+ *  This directive creates and starts an additional server for task-based
+ *  timers.  Each server has its own task, its own interval and time of
+ *  day watchdog sets and fires all timers which expire at a wakeup in one
+ *  batch.  Unlike the default server the server task is preemptible, so
+ *  a slow timer service routine only delays the timers of its own server
+ *  and of servers with a lower priority.
+ *
+ *  Input parameters:
+ *    name          - server task name
+ *    priority      - server task priority
+ *    stack_size    - server task stack size in bytes
+ *    attribute_set - server task attributes
+ *    id            - pointer to server id
+ *
+ *  Output parameters:
+ *    id               - server id, this is the id of the server task
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_timer_create_server(
+  rtems_name           name,
+  uint32_t             priority,
+  uint32_t             stack_size,
+  rtems_attribute      attribute_set,
+  rtems_id            *id
+)
+{
+  Timer_server_Control *ts;
+  rtems_status_code     status;
+
+  if ( !rtems_is_name_valid( name ) )
+    return RTEMS_INVALID_NAME;
+
+  if ( !id )
+    return RTEMS_INVALID_ADDRESS;
+
+  _Thread_Disable_dispatch();
+    ts = _Workspace_Allocate( sizeof( *ts ) );
+  _Thread_Enable_dispatch();
+
+  if ( ts == NULL )
+    return RTEMS_TOO_MANY;
+
+  status = _Timer_server_Initialize(
+    ts,
+    name,
+    priority,
+    stack_size,
+    RTEMS_PREEMPT,
+    attribute_set
+  );
+  if ( status != RTEMS_SUCCESSFUL ) {
+    _Thread_Disable_dispatch();
+      _Workspace_Free( ts );
+    _Thread_Enable_dispatch();
+    return status;
+  }
+
+  _Thread_Disable_dispatch();
+    _Chain_Append_unprotected( &_Timer_server_Instances, &ts->Node );
+  _Thread_Enable_dispatch();
+
+  *id = ts->thread->Object.id;
+  return RTEMS_SUCCESSFUL;
+}
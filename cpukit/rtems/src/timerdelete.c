@@ -42,6 +42,7 @@ rtems_status_code rtems_timer_delete(
 {
   Timer_Control     *the_timer;
   Objects_Locations  location;
+  ISR_Level          level;
 
   the_timer = _Timer_Get( id, &location );
   switch ( location ) {
@@ -49,6 +50,18 @@ rtems_status_code rtems_timer_delete(
     case OBJECTS_LOCAL:
       _Objects_Close( &_Timer_Information, &the_timer->Object );
       (void) _Watchdog_Remove( &the_timer->Ticker );
+
+      /*
+       *  A timer queued for a timer server must leave the insert chain
+       *  before its node returns to the inactive chain.
+       */
+      _ISR_Disable( level );
+        if ( _Timer_Is_queued( the_timer ) ) {
+          _Chain_Extract_unprotected( &the_timer->Object.Node );
+          _Chain_Set_off_chain( &the_timer->Object.Node );
+        }
+      _ISR_Enable( level );
+
       _Timer_Free( the_timer );
       _Thread_Enable_dispatch();
       return RTEMS_SUCCESSFUL;
@@ -57,9 +57,9 @@ static void _Timer_server_Reset_interval_system_watchdog(
   _Timer_server_Stop_interval_system_watchdog( ts );
 
   _ISR_Disable( level );
-  if ( !_Chain_Is_empty( &ts->Interval_watchdogs.Chain ) ) {
+  if ( !_Watchdog_Is_empty( &ts->Interval_watchdogs.Header ) ) {
     Watchdog_Interval delta_interval =
-      _Watchdog_First( &ts->Interval_watchdogs.Chain )->delta_interval;
+      _Watchdog_First_interval( &ts->Interval_watchdogs.Header );
     _ISR_Enable( level );
 
     /*
@@ -90,9 +90,9 @@ static void _Timer_server_Reset_tod_system_watchdog(
   _Timer_server_Stop_tod_system_watchdog( ts );
 
   _ISR_Disable( level );
-  if ( !_Chain_Is_empty( &ts->TOD_watchdogs.Chain ) ) {
+  if ( !_Watchdog_Is_empty( &ts->TOD_watchdogs.Header ) ) {
     Watchdog_Interval delta_interval =
-      _Watchdog_First( &ts->TOD_watchdogs.Chain )->delta_interval;
+      _Watchdog_First_interval( &ts->TOD_watchdogs.Header );
     _ISR_Enable( level );
 
     /*
@@ -113,9 +113,9 @@ static void _Timer_server_Insert_timer(
 )
 {
   if ( timer->the_class == TIMER_INTERVAL_ON_TASK ) {
-    _Watchdog_Insert( &ts->Interval_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert( &ts->Interval_watchdogs.Header, &timer->Ticker );
   } else if ( timer->the_class == TIMER_TIME_OF_DAY_ON_TASK ) {
-    _Watchdog_Insert( &ts->TOD_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert( &ts->TOD_watchdogs.Header, &timer->Ticker );
   }
 }
 
@@ -124,8 +124,6 @@ static void _Timer_server_Insert_timer_and_make_snapshot(
   Timer_Control *timer
 )
 {
-  Watchdog_Control *first_watchdog;
-  Watchdog_Interval delta_interval;
   Watchdog_Interval last_snapshot;
   Watchdog_Interval snapshot;
   Watchdog_Interval delta;
@@ -135,9 +133,9 @@ static void _Timer_server_Insert_timer_and_make_snapshot(
    *  We have to update the time snapshots here, because otherwise we may have
    *  problems with the integer range of the delta values.  The time delta DT
    *  from the last snapshot to now may be arbitrarily long.  The last snapshot
-   *  is the reference point for the delta chain.  Thus if we do not update the
-   *  reference point we have to add DT to the initial delta of the watchdog
-   *  being inserted.  This could result in an integer overflow.
+   *  is the reference point for the watchdog set.  Thus if we do not update
+   *  the reference point we have to add DT to the initial delta of the
+   *  watchdog being inserted.  This could result in an integer overflow.
    */
 
   _Thread_Disable_dispatch();
@@ -145,31 +143,22 @@ static void _Timer_server_Insert_timer_and_make_snapshot(
   if ( timer->the_class == TIMER_INTERVAL_ON_TASK ) {
     /*
      *  We have to advance the last known ticks value of the server and update
-     *  the watchdog chain accordingly.
+     *  the watchdog set accordingly.
      */
     _ISR_Disable( level );
     snapshot = _Watchdog_Ticks_since_boot;
     last_snapshot = ts->Interval_watchdogs.last_snapshot;
-    if ( !_Chain_Is_empty( &ts->Interval_watchdogs.Chain ) ) {
-      first_watchdog = _Watchdog_First( &ts->Interval_watchdogs.Chain );
 
-      /*
-       *  We assume adequate unsigned arithmetic here.
-       */
-      delta = snapshot - last_snapshot;
+    /*
+     *  We assume adequate unsigned arithmetic here.
+     */
+    delta = snapshot - last_snapshot;
 
-      delta_interval = first_watchdog->delta_interval;
-      if (delta_interval > delta) {
-        delta_interval -= delta;
-      } else {
-        delta_interval = 0;
-      }
-      first_watchdog->delta_interval = delta_interval;
-    }
+    _Watchdog_Advance( &ts->Interval_watchdogs.Header, delta );
     ts->Interval_watchdogs.last_snapshot = snapshot;
     _ISR_Enable( level );
 
-    _Watchdog_Insert( &ts->Interval_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert( &ts->Interval_watchdogs.Header, &timer->Ticker );
 
     if ( !ts->active ) {
       _Timer_server_Reset_interval_system_watchdog( ts );
@@ -177,37 +166,28 @@ static void _Timer_server_Insert_timer_and_make_snapshot(
   } else if ( timer->the_class == TIMER_TIME_OF_DAY_ON_TASK ) {
     /*
      *  We have to advance the last known seconds value of the server and update
-     *  the watchdog chain accordingly.
+     *  the watchdog set accordingly.
      */
     _ISR_Disable( level );
     snapshot = (Watchdog_Interval) _TOD_Seconds_since_epoch();
     last_snapshot = ts->TOD_watchdogs.last_snapshot;
-    if ( !_Chain_Is_empty( &ts->TOD_watchdogs.Chain ) ) {
-      first_watchdog = _Watchdog_First( &ts->TOD_watchdogs.Chain );
-      delta_interval = first_watchdog->delta_interval;
-      if ( snapshot > last_snapshot ) {
-        /*
-         *  We advanced in time.
-         */
-        delta = snapshot - last_snapshot;
-        if (delta_interval > delta) {
-          delta_interval -= delta;
-        } else {
-          delta_interval = 0;
-        }
-      } else {
-        /*
-         *  Someone put us in the past.
-         */
-        delta = last_snapshot - snapshot;
-        delta_interval += delta;
-      }
-      first_watchdog->delta_interval = delta_interval;
+    if ( snapshot > last_snapshot ) {
+      /*
+       *  We advanced in time.
+       */
+      delta = snapshot - last_snapshot;
+      _Watchdog_Advance( &ts->TOD_watchdogs.Header, delta );
+    } else {
+      /*
+       *  Someone put us in the past.
+       */
+      delta = last_snapshot - snapshot;
+      _Watchdog_Adjust( &ts->TOD_watchdogs.Header, WATCHDOG_BACKWARD, delta );
     }
     ts->TOD_watchdogs.last_snapshot = snapshot;
     _ISR_Enable( level );
 
-    _Watchdog_Insert( &ts->TOD_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert( &ts->TOD_watchdogs.Header, &timer->Ticker );
 
     if ( !ts->active ) {
       _Timer_server_Reset_tod_system_watchdog( ts );
@@ -222,17 +202,31 @@ static void _Timer_server_Schedule_operation_method(
   Timer_Control *timer
 )
 {
-  if ( ts->insert_chain == NULL ) {
+  ISR_Level level;
+
+  _ISR_Disable( level );
+  if ( _Timer_Is_queued( timer ) ) {
+    /*
+     *  The timer waits already on the insert chain.  The timer server will
+     *  insert it with the values set by our caller.
+     */
+    timer->Ticker.state = WATCHDOG_BEING_INSERTED;
+    _ISR_Enable( level );
+  } else if ( ts->insert_chain == NULL ) {
+    _ISR_Enable( level );
     _Timer_server_Insert_timer_and_make_snapshot( ts, timer );
   } else {
     /*
      *  We interrupted a critical section of the timer server.  The timer
-     *  server is not preemptible, so we must be in interrupt context here.  No
-     *  thread dispatch will happen until the timer server finishes its
-     *  critical section.  We have to use the protected chain methods because
-     *  we may be interrupted by a higher priority interrupt.
+     *  server disables thread dispatching in its critical section, so we
+     *  must be in interrupt context here.  No thread dispatch will happen
+     *  until the timer server finishes its critical section.  Interrupts
+     *  are disabled, since we may be interrupted by a higher priority
+     *  interrupt.
      */
-    _Chain_Append( ts->insert_chain, &timer->Object.Node );
+    timer->Ticker.state = WATCHDOG_BEING_INSERTED;
+    _Chain_Append_unprotected( ts->insert_chain, &timer->Object.Node );
+    _ISR_Enable( level );
   }
 }
 
@@ -250,7 +244,7 @@ static void _Timer_server_Process_interval_watchdogs(
 
   watchdogs->last_snapshot = snapshot;
 
-  _Watchdog_Adjust_to_chain( &watchdogs->Chain, delta, fire_chain );
+  _Watchdog_Adjust_to_chain( &watchdogs->Header, delta, fire_chain );
 }
 
 static void _Timer_server_Process_tod_watchdogs(
@@ -265,7 +259,7 @@ static void _Timer_server_Process_tod_watchdogs(
   /*
    *  Process the seconds chain.  Start by checking that the Time
    *  of Day (TOD) has not been set backwards.  If it has then
-   *  we want to adjust the watchdogs->Chain to indicate this.
+   *  we want to adjust the watchdogs->Header to indicate this.
    */
   if ( snapshot > last_snapshot ) {
     /*
@@ -273,7 +267,7 @@ static void _Timer_server_Process_tod_watchdogs(
      *  TOD has been set forward.
      */
     delta = snapshot - last_snapshot;
-    _Watchdog_Adjust_to_chain( &watchdogs->Chain, delta, fire_chain );
+    _Watchdog_Adjust_to_chain( &watchdogs->Header, delta, fire_chain );
 
   } else if ( snapshot < last_snapshot ) {
      /*
@@ -281,7 +275,7 @@ static void _Timer_server_Process_tod_watchdogs(
       *  TOD has been set backwards.
       */
      delta = last_snapshot - snapshot;
-     _Watchdog_Adjust( &watchdogs->Chain, WATCHDOG_BACKWARD, delta );
+     _Watchdog_Adjust( &watchdogs->Header, WATCHDOG_BACKWARD, delta );
   }
 
   watchdogs->last_snapshot = snapshot;
@@ -290,13 +284,32 @@ static void _Timer_server_Process_tod_watchdogs(
 static void _Timer_server_Process_insertions( Timer_server_Control *ts )
 {
   while ( true ) {
-    Timer_Control *timer = (Timer_Control *) _Chain_Get( ts->insert_chain );
+    Timer_Control *timer;
+    bool insert = false;
+    ISR_Level level;
+
+    _ISR_Disable( level );
+    timer = (Timer_Control *) _Chain_Get_unprotected( ts->insert_chain );
+    if ( timer != NULL ) {
+      _Chain_Set_off_chain( &timer->Object.Node );
+
+      /*
+       *  The timer may have been canceled while it was queued.
+       */
+      if ( timer->Ticker.state == WATCHDOG_BEING_INSERTED ) {
+        timer->Ticker.state = WATCHDOG_INACTIVE;
+        insert = true;
+      }
+    }
+    _ISR_Enable( level );
 
     if ( timer == NULL ) {
       break;
     }
 
-    _Timer_server_Insert_timer( ts, timer );
+    if ( insert ) {
+      _Timer_server_Insert_timer( ts, timer );
+    }
   }
 }
 
@@ -366,7 +379,17 @@ static rtems_task _Timer_server_Body(
   _Chain_Initialize_empty( &fire_chain );
 
   while ( true ) {
-    _Timer_server_Get_watchdogs_that_fire_now( ts, &insert_chain, &fire_chain );
+    /*
+     *  The server task of a timer server instance is preemptible, so a
+     *  thread must not see the insert chain.
+     */
+    _Thread_Disable_dispatch();
+      _Timer_server_Get_watchdogs_that_fire_now(
+        ts,
+        &insert_chain,
+        &fire_chain
+      );
+    _Thread_Enable_dispatch();
 
     if ( !_Chain_Is_empty( &fire_chain ) ) {
       /*
@@ -424,30 +447,33 @@ static rtems_task _Timer_server_Body(
 }
 
 /**
- *  @brief rtems_timer_initiate_server
+ *  @brief _Timer_server_Initialize
  *
- *  This directive creates and starts the server for task-based timers.
- *  It must be invoked before any task-based timers can be initiated.
+ *  This routine creates the server task, initializes the timer server
+ *  control block and starts the server.
  *
+ *  @param[in] ts is the timer server control block
+ *  @param[in] name is the name of the server task
  *  @param[in] priority is the timer server priority
  *  @param[in] stack_size is the stack size in bytes
+ *  @param[in] initial_modes is the initial mode of the server task
  *  @param[in] attribute_set is the timer server attributes
  *
  *  @return This method returns RTEMS_SUCCESSFUL if successful and an
  *          error code otherwise.
  */
-rtems_status_code rtems_timer_initiate_server(
-  uint32_t             priority,
-  uint32_t             stack_size,
-  rtems_attribute      attribute_set
+rtems_status_code _Timer_server_Initialize(
+  Timer_server_Control *ts,
+  rtems_name            name,
+  uint32_t              priority,
+  uint32_t              stack_size,
+  rtems_mode            initial_modes,
+  rtems_attribute       attribute_set
 )
 {
   rtems_id              id;
   rtems_status_code     status;
   rtems_task_priority   _priority;
-  static bool           initialized = false;
-  bool                  tmpInitialized;
-  Timer_server_Control *ts = &_Timer_server_Default;
 
   /*
    *  Make sure the requested priority is valid.  The if is
@@ -462,22 +488,11 @@ rtems_status_code rtems_timer_initiate_server(
   }
 
   /*
-   *  Just to make sure this is only called once.
-   */
-  _Thread_Disable_dispatch();
-    tmpInitialized  = initialized;
-    initialized = true;
-  _Thread_Enable_dispatch();
-
-  if ( tmpInitialized )
-    return RTEMS_INCORRECT_STATE;
-
-  /*
-   *  Create the Timer Server with the name the name of "TIME".  The attribute
-   *  RTEMS_SYSTEM_TASK allows us to set a priority to 0 which will makes it
-   *  higher than any other task in the system.  It can be viewed as a low
-   *  priority interrupt.  It is also always NO_PREEMPT so it looks like
-   *  an interrupt to other tasks.
+   *  Create the Timer Server.  The attribute RTEMS_SYSTEM_TASK allows us
+   *  to set a priority to 0 which will makes it higher than any other
+   *  task in the system.  It can be viewed as a low priority interrupt.
+   *  The default server is NO_PREEMPT so it looks like an interrupt to
+   *  other tasks.
    *
    *  We allow the user to override the default priority because the Timer
    *  Server can invoke TSRs which must adhere to language run-time or
@@ -487,17 +502,16 @@ rtems_status_code rtems_timer_initiate_server(
    *  GNAT run-time is violated.
    */
   status = rtems_task_create(
-    _Objects_Build_name('T','I','M','E'),           /* "TIME" */
+    name,
     _priority,            /* create with priority 1 since 0 is illegal */
     stack_size,           /* let user specify stack size */
-    RTEMS_NO_PREEMPT,     /* no preempt is like an interrupt */
+    initial_modes,        /* no preempt is like an interrupt */
                           /* user may want floating point but we need */
                           /*   system task specified for 0 priority */
     attribute_set | RTEMS_SYSTEM_TASK,
     &id                   /* get the id back */
   );
   if (status) {
-    initialized = false;
     return status;
   }
 
@@ -518,8 +532,8 @@ rtems_status_code rtems_timer_initiate_server(
   /*
    *  Initialize the timer lists that the server will manage.
    */
-  _Chain_Initialize_empty( &ts->Interval_watchdogs.Chain );
-  _Chain_Initialize_empty( &ts->TOD_watchdogs.Chain );
+  _Watchdog_Header_initialize( &ts->Interval_watchdogs.Header );
+  _Watchdog_Header_initialize( &ts->TOD_watchdogs.Header );
 
   /*
    *  Initialize the timers that will be used to control when the
@@ -550,11 +564,6 @@ rtems_status_code rtems_timer_initiate_server(
   ts->insert_chain = NULL;
   ts->active = false;
 
-  /*
-   * The default timer server is now available.
-   */
-  _Timer_server = ts;
-
   /*
    *  Start the timer server
    */
@@ -564,18 +573,80 @@ rtems_status_code rtems_timer_initiate_server(
     (rtems_task_argument) ts
   );
 
-  #if defined(RTEMS_DEBUG)
-    /*
-     *  One would expect a call to rtems_task_delete() here to clean up
-     *  but there is actually no way (in normal circumstances) that the
-     *  start can fail.  The id and starting address are known to be
-     *  be good.  If this service fails, something is weirdly wrong on the
-     *  target such as a stray write in an ISR or incorrect memory layout.
-     */
-    if (status) {
-      initialized = false;
-    }
-  #endif
+  /*
+   *  One would expect a call to rtems_task_delete() here to clean up
+   *  but there is actually no way (in normal circumstances) that the
+   *  start can fail.  The id and starting address are known to be
+   *  be good.  If this service fails, something is weirdly wrong on the
+   *  target such as a stray write in an ISR or incorrect memory layout.
+   */
 
   return status;
 }
+
+/**
+ *  @brief rtems_timer_initiate_server
+ *
+ *  This directive creates and starts the server for task-based timers.
+ *  It must be invoked before any task-based timers can be initiated.
+ *
+ *  @param[in] priority is the timer server priority
+ *  @param[in] stack_size is the stack size in bytes
+ *  @param[in] attribute_set is the timer server attributes
+ *
+ *  @return This method returns RTEMS_SUCCESSFUL if successful and an
+ *          error code otherwise.
+ */
+rtems_status_code rtems_timer_initiate_server(
+  uint32_t             priority,
+  uint32_t             stack_size,
+  rtems_attribute      attribute_set
+)
+{
+  rtems_status_code     status;
+  static bool           initialized = false;
+  bool                  tmpInitialized;
+  Timer_server_Control *ts = &_Timer_server_Default;
+
+  /*
+   *  Make sure the requested priority is valid before we claim the
+   *  default timer server.
+   */
+  if ( !_RTEMS_tasks_Priority_is_valid( priority ) &&
+       priority != RTEMS_TIMER_SERVER_DEFAULT_PRIORITY )
+    return RTEMS_INVALID_PRIORITY;
+
+  /*
+   *  Just to make sure this is only called once.
+   */
+  _Thread_Disable_dispatch();
+    tmpInitialized  = initialized;
+    initialized = true;
+  _Thread_Enable_dispatch();
+
+  if ( tmpInitialized )
+    return RTEMS_INCORRECT_STATE;
+
+  /*
+   *  Create the Timer Server with the name the name of "TIME".
+   */
+  status = _Timer_server_Initialize(
+    ts,
+    _Objects_Build_name('T','I','M','E'),           /* "TIME" */
+    priority,
+    stack_size,
+    RTEMS_NO_PREEMPT,
+    attribute_set
+  );
+  if (status) {
+    initialized = false;
+    return status;
+  }
+
+  /*
+   * The default timer server is now available.
+   */
+  _Timer_server = ts;
+
+  return RTEMS_SUCCESSFUL;
+}
@@ -50,9 +50,9 @@ rtems_status_code rtems_timer_server_fire_after(
   Timer_Control        *the_timer;
   Objects_Locations     location;
   ISR_Level             level;
-  Timer_server_Control *timer_server = _Timer_server;
+  Timer_server_Control *timer_server;
 
-  if ( !timer_server )
+  if ( !_Timer_Is_any_server_initiated() )
     return RTEMS_INCORRECT_STATE;
 
   if ( !routine )
@@ -65,6 +65,12 @@ rtems_status_code rtems_timer_server_fire_after(
   switch ( location ) {
 
     case OBJECTS_LOCAL:
+      timer_server = _Timer_Get_server( the_timer );
+      if ( !timer_server ) {
+        _Thread_Enable_dispatch();
+        return RTEMS_INCORRECT_STATE;
+      }
+
       (void) _Watchdog_Remove( &the_timer->Ticker );
 
       _ISR_Disable( level );
@@ -50,9 +50,9 @@ rtems_status_code rtems_timer_server_fire_when(
   Timer_Control        *the_timer;
   Objects_Locations     location;
   rtems_interval        seconds;
-  Timer_server_Control *timer_server = _Timer_server;
+  Timer_server_Control *timer_server;
 
-  if ( !timer_server )
+  if ( !_Timer_Is_any_server_initiated() )
     return RTEMS_INCORRECT_STATE;
 
   if ( !_TOD.is_set )
@@ -72,6 +72,12 @@ rtems_status_code rtems_timer_server_fire_when(
   switch ( location ) {
 
     case OBJECTS_LOCAL:
+      timer_server = _Timer_Get_server( the_timer );
+      if ( !timer_server ) {
+        _Thread_Enable_dispatch();
+        return RTEMS_INCORRECT_STATE;
+      }
+
       (void) _Watchdog_Remove( &the_timer->Ticker );
       the_timer->the_class = TIMER_TIME_OF_DAY_ON_TASK;
       _Watchdog_Initialize( &the_timer->Ticker, routine, id, user_data );
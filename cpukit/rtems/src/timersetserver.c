@@ -0,0 +1,111 @@
+/*
+ *  Timer Manager - rtems_timer_set_server directive
+ *
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/support.h>
+#include <rtems/score/object.h>
+#include <rtems/score/thread.h>
+#include <rtems/rtems/timer.h>
+#include <rtems/score/watchdog.h>
+
+/*
+ *  _Timer_server_Find
+ *
+ *  This routine returns the timer server instance with the id SERVER_ID
+ *  or NULL if no such instance exists.  Thread dispatching must be
+ *  disabled.
+ */
+
+static Timer_server_Control *_Timer_server_Find(
+  rtems_id server_id
+)
+{
+  Chain_Node *node;
+
+  for ( node = _Chain_First( &_Timer_server_Instances ) ;
+        !_Chain_Is_tail( &_Timer_server_Instances, node ) ;
+        node = _Chain_Next( node ) ) {
+    Timer_server_Control *ts = (Timer_server_Control *) node;
+
+    if ( ts->thread->Object.id == server_id )
+      return ts;
+  }
+
+  return NULL;
+}
+
+/*
+ *  rtems_timer_set_server
+ *
+ *  This directive selects the server which executes the task-based
+ *  timer.
+ *
+ *  Input parameters:
+ *    id        - timer id
+ *    server_id - server id or RTEMS_TIMER_DEFAULT_SERVER
+ *
+ *  Output parameters:
+ *    RTEMS_SUCCESSFUL - if successful
+ *    error code       - if unsuccessful
+ */
+
+rtems_status_code rtems_timer_set_server(
+  rtems_id   id,
+  rtems_id   server_id
+)
+{
+  Timer_Control        *the_timer;
+  Objects_Locations     location;
+  Timer_server_Control *ts = NULL;
+
+  the_timer = _Timer_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      if ( server_id != RTEMS_TIMER_DEFAULT_SERVER ) {
+        ts = _Timer_server_Find( server_id );
+        if ( ts == NULL ) {
+          _Thread_Enable_dispatch();
+          return RTEMS_INVALID_ID;
+        }
+      }
+
+      /*
+       *  A canceled timer may still wait on the insert chain of its
+       *  server.
+       */
+      if ( _Timer_Is_queued( the_timer ) ||
+           ( the_timer->Ticker.state != WATCHDOG_INACTIVE &&
+             ( the_timer->the_class == TIMER_INTERVAL_ON_TASK ||
+               the_timer->the_class == TIMER_TIME_OF_DAY_ON_TASK ) ) ) {
+        _Thread_Enable_dispatch();
+        return RTEMS_RESOURCE_IN_USE;
+      }
+
+      the_timer->server = ts;
+      _Thread_Enable_dispatch();
+      return RTEMS_SUCCESSFUL;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:            /* should never return this */
+#endif
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
@@ -16,6 +16,7 @@
 #include <rtems/system.h>
 #include <rtems/score/wkspace.h>
 #include <rtems/score/protectedheap.h>
+#include <rtems/score/thread.h>
 #include <rtems/score/interr.h>
 #include <rtems/config.h>
 #include <rtems/rtems/support.h>
@@ -32,6 +33,23 @@ bool rtems_workspace_get_information(
   return _Protected_heap_Get_information( &_Workspace_Area, the_info );
 }
 
+bool rtems_workspace_get_slab_info(
+  uint32_t                    index,
+  Workspace_Slab_information *the_info
+)
+{
+  bool ok;
+
+  if ( !the_info )
+    return false;
+
+  _Thread_Disable_dispatch();
+    ok = _Workspace_Slab_Get_information( index, the_info );
+  _Thread_Enable_dispatch();
+
+  return ok;
+}
+
 /*
  *  _Workspace_Allocate
  */
@@ -184,6 +184,14 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
       #error "CONFIGURE_SMP_MAXIMUM_PROCESSORS not specified for SMP Application"
     #endif
   #endif
+
+  /*
+   *  This is the maximum time in nanoseconds a thread spins on an adaptive
+   *  mutex before it blocks.
+   */
+  #if !defined(CONFIGURE_SMP_MUTEX_SPIN_NANOSECONDS)
+    #define CONFIGURE_SMP_MUTEX_SPIN_NANOSECONDS 10000
+  #endif
 #endif
 
 /*
@@ -538,6 +546,15 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
   #define CONFIGURE_STACK_CHECKER_EXTENSION 0
 #endif
 
+/**
+ *  This configures the user extension object of the malloc per task cache.
+ */
+#if defined(RTEMS_NEWLIB) && defined(CONFIGURE_MALLOC_TASK_CACHE)
+  #define CONFIGURE_MALLOC_CACHE_EXTENSION 1
+#else
+  #define CONFIGURE_MALLOC_CACHE_EXTENSION 0
+#endif
+
 /**
  *  @brief Maximum Priority configuration
  *
@@ -581,6 +598,7 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
  *  CONFIGURE_SCHEDULER_PRIORITY   - Deterministic Priority Scheduler
  *  CONFIGURE_SCHEDULER_SIMPLE     - Light-weight Priority Scheduler
  *  CONFIGURE_SCHEDULER_SIMPLE_SMP - Simple SMP Priority Scheduler
+ *  CONFIGURE_SCHEDULER_PRIORITY_SMP - Deterministic SMP Priority Scheduler
  *  CONFIGURE_SCHEDULER_EDF        - EDF Scheduler
  *  CONFIGURE_SCHEDULER_CBS        - CBS Scheduler
  * 
@@ -602,6 +620,7 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
 
 #if !defined(RTEMS_SMP)
   #undef CONFIGURE_SCHEDULER_SIMPLE_SMP
+  #undef CONFIGURE_SCHEDULER_PRIORITY_SMP
 #endif
 
 /* If no scheduler is specified, the priority scheduler is default. */
@@ -609,6 +628,7 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
     !defined(CONFIGURE_SCHEDULER_PRIORITY) && \
     !defined(CONFIGURE_SCHEDULER_SIMPLE) && \
     !defined(CONFIGURE_SCHEDULER_SIMPLE_SMP) && \
+    !defined(CONFIGURE_SCHEDULER_PRIORITY_SMP) && \
     !defined(CONFIGURE_SCHEDULER_EDF) && \
     !defined(CONFIGURE_SCHEDULER_CBS)
   #if defined(RTEMS_SMP) && defined(CONFIGURE_SMP_APPLICATION)
@@ -670,6 +690,39 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
   #define CONFIGURE_MEMORY_PER_TASK_FOR_SCHEDULER (0)
 #endif
 
+/*
+ * If the Priority SMP Scheduler is selected, then configure for it.
+ */
+#if defined(CONFIGURE_SCHEDULER_PRIORITY_SMP)
+  #include <rtems/score/schedulerprioritysmp.h>
+  #define CONFIGURE_SCHEDULER_ENTRY_POINTS SCHEDULER_PRIORITY_SMP_ENTRY_POINTS
+
+  /**
+   * The cores are partitioned into this number of clusters.  One cluster
+   * yields global scheduling.
+   */
+  #ifndef CONFIGURE_SCHEDULER_PRIORITY_SMP_CLUSTERS
+    #define CONFIGURE_SCHEDULER_PRIORITY_SMP_CLUSTERS 1
+  #endif
+
+  /**
+   * Define the memory used by the Priority SMP Scheduler
+   */
+  #define CONFIGURE_MEMORY_FOR_SCHEDULER ( \
+    _Configure_From_workspace( sizeof(Scheduler_priority_smp_Control) ) + \
+    _Configure_From_workspace( CONFIGURE_SCHEDULER_PRIORITY_SMP_CLUSTERS * \
+      sizeof(Scheduler_priority_smp_Cluster) ) + \
+    CONFIGURE_SCHEDULER_PRIORITY_SMP_CLUSTERS * _Configure_From_workspace( \
+      ((CONFIGURE_MAXIMUM_PRIORITY+1) * sizeof(Chain_Control)) ) + \
+    _Configure_From_workspace( CONFIGURE_SMP_MAXIMUM_PROCESSORS * \
+      sizeof(Thread_Control *) ) + \
+    _Configure_From_workspace( CONFIGURE_SMP_MAXIMUM_PROCESSORS * \
+      sizeof(bool) ) \
+  )
+  #define CONFIGURE_MEMORY_PER_TASK_FOR_SCHEDULER ( \
+    _Configure_From_workspace(sizeof(Scheduler_priority_smp_Per_thread)) )
+#endif
+
 /*
  * If the EDF Scheduler is selected, then configure for it.
  */
@@ -739,6 +792,35 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
   #error "CONFIGURE_ERROR: You did not override the IDLE task body."
 #endif
 
+/**
+ *  @brief Tickless idle configuration
+ *
+ *  If CONFIGURE_TICKLESS_IDLE is defined, the IDLE thread body of the
+ *  clock driver replaces the periodic clock tick with a one-shot interrupt
+ *  at the next timeout while the system is idle.  BSPs with a clock driver
+ *  which supports this define BSP_FEATURE_TICKLESS_IDLE.  It allows a fine clock tick without paying
+ *  for the tick interrupts while the system is idle.
+ */
+#if defined(CONFIGURE_TICKLESS_IDLE)
+  #if defined(RTEMS_SMP)
+    #error "CONFIGURE_ERROR: Tickless idle is not supported on SMP."
+  #endif
+  #if !defined(BSP_FEATURE_TICKLESS_IDLE)
+    #error "CONFIGURE_ERROR: The BSP does not support tickless idle."
+  #endif
+  #if !defined(CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER)
+    #error "CONFIGURE_ERROR: Tickless idle needs the clock driver."
+  #endif
+  #if defined(CONFIGURE_IDLE_TASK_BODY)
+    #error "CONFIGURE_ERROR: Tickless idle overrides the IDLE task body."
+  #endif
+
+  #ifdef CONFIGURE_INIT
+    void *Clock_driver_tickless_idle_body(uintptr_t ignored);
+  #endif
+  #define CONFIGURE_IDLE_TASK_BODY Clock_driver_tickless_idle_body
+#endif
+
 /**
  *  @brief Idle task body configuration
  *
@@ -820,6 +902,62 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
      _Configure_From_workspace( CONFIGURE_INTERRUPT_STACK_SIZE )
 #endif
 
+/**
+ *  Configure the task stack pool.  It keeps freed task stacks in size
+ *  classes for reuse and may allocate stacks during system initialization.
+ *  Each size class is an initializer of the form
+ *  { stack_size, initial_count, maximum_free_count } and the size classes
+ *  must be sorted by increasing stack size.  The memory for the initial
+ *  stacks and for the rounding up to the size class must be accounted for
+ *  with CONFIGURE_EXTRA_TASK_STACKS.
+ */
+#ifdef CONFIGURE_TASK_STACK_POOL
+  #if defined(CONFIGURE_TASK_STACK_ALLOCATOR_INIT) \
+    || defined(CONFIGURE_TASK_STACK_ALLOCATOR) \
+    || defined(CONFIGURE_TASK_STACK_DEALLOCATOR)
+    #error "CONFIGURE_TASK_STACK_POOL cannot be used with a task stack allocator"
+  #endif
+
+  #include <rtems/score/stackpool.h>
+
+  #define CONFIGURE_TASK_STACK_ALLOCATOR_INIT _Stack_pool_Initialize
+  #define CONFIGURE_TASK_STACK_ALLOCATOR _Stack_pool_Allocate
+  #define CONFIGURE_TASK_STACK_DEALLOCATOR _Stack_pool_Free
+
+  #ifndef CONFIGURE_TASK_STACK_FROM_ALLOCATOR
+    #define CONFIGURE_TASK_STACK_FROM_ALLOCATOR(_stack_size) \
+      _Configure_From_workspace(STACK_POOL_HEADER_SIZE + (_stack_size))
+  #endif
+
+  #ifndef CONFIGURE_TASK_STACK_POOL_CLASSES
+    #define CONFIGURE_TASK_STACK_POOL_CLASSES \
+      { CONFIGURE_MINIMUM_TASK_STACK_SIZE, 0, 4 }, \
+      { 2 * CONFIGURE_MINIMUM_TASK_STACK_SIZE, 0, 4 }, \
+      { 4 * CONFIGURE_MINIMUM_TASK_STACK_SIZE, 0, 4 }
+  #endif
+
+  #define CONFIGURE_TASK_STACK_POOL_CLASS_COUNT \
+    (sizeof(_Stack_pool_Class_table) / sizeof(_Stack_pool_Class_table[0]))
+
+  #define CONFIGURE_MEMORY_FOR_TASK_STACK_POOL \
+    _Configure_From_workspace( \
+      CONFIGURE_TASK_STACK_POOL_CLASS_COUNT * sizeof(Workspace_Slab) \
+    )
+
+  #ifdef CONFIGURE_INIT
+    static const Stack_pool_Class_configuration _Stack_pool_Class_table[] = {
+      CONFIGURE_TASK_STACK_POOL_CLASSES
+    };
+
+    const Stack_pool_Configuration _Stack_pool_Configuration = {
+      _Stack_pool_Class_table,
+      CONFIGURE_TASK_STACK_POOL_CLASS_COUNT
+    };
+  #endif
+#else
+  #define CONFIGURE_MEMORY_FOR_TASK_STACK_POOL 0
+#endif
+
 /**
  *  Configure the very much optional task stack allocator initialization
  */
@@ -894,6 +1032,19 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
     #endif
 #endif
 
+#ifdef CONFIGURE_INIT
+  /**
+   *  This configures the per task cache for small allocations of the
+   *  malloc family.  By default the cache is disabled.
+   */
+  rtems_malloc_cache_functions_t *rtems_malloc_cache_helpers =
+    #ifndef CONFIGURE_MALLOC_TASK_CACHE
+      NULL;
+    #else
+      &rtems_malloc_cache_helpers_table;
+    #endif
+#endif
+
 #ifdef CONFIGURE_INIT
   /**
    *  This configures the sbrk() support for the malloc family.
@@ -952,19 +1103,48 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
 #define _Configure_Max_Objects(_max) \
   rtems_resource_maximum_per_allocation(_max)
 
+/**
+ *  This macro accounts for the name hash index of a set of configured
+ *  objects.  The number of hash buckets and next links is the power of two
+ *  at or above the number of table entries.
+ */
+#ifdef CONFIGURE_OBJECT_NAME_HASH
+  #define _Configure_Object_name_hash_RAM(_number) \
+    _Configure_From_workspace( \
+      4 * (_Configure_Max_Objects(_number) + 1) * sizeof(Objects_Maximum) \
+    )
+#else
+  #define _Configure_Object_name_hash_RAM(_number) 0
+#endif
+
+/**
+ *  This macro accounts for the local table and object block table of a set
+ *  of configured objects.  A class of fixed size has one page of each kind.
+ *  The page directories of an auto-extend class cover the whole index range
+ *  and its pages have at least OBJECTS_LOCAL_TABLE_PAGE_MINIMUM entries.
+ */
+#define _Configure_Object_table_RAM(_number) \
+  ( ((_number) & RTEMS_UNLIMITED_OBJECTS) ? \
+    ( (2 * (OBJECTS_ID_FINAL_INDEX / OBJECTS_LOCAL_TABLE_PAGE_MINIMUM + 1) + \
+       2 * (_Configure_Max_Objects(_number) + \
+         OBJECTS_LOCAL_TABLE_PAGE_MINIMUM)) * sizeof(void *) + \
+      (4 * OBJECTS_LOCAL_TABLE_PAGE_MINIMUM / \
+         (_Configure_Max_Objects(_number) + 1) + 2) * sizeof(Objects_Block) \
+    ) : \
+    ( (_Configure_Max_Objects(_number) + 3) * sizeof(void *) + \
+      sizeof(Objects_Block) ) )
+
 /**
  *  This macro accounts for how memory for a set of configured objects is
  *  allocated from the Executive Workspace.
  *
  *  NOTE: It does NOT attempt to address the more complex case of unlimited
- *        objects.
+ *        objects beyond the first allocation.
  */
 #define _Configure_Object_RAM(_number, _size) \
   ( _Configure_From_workspace(_Configure_Max_Objects(_number) * (_size)) + \
-    _Configure_From_workspace( \
-      ((_Configure_Max_Objects(_number) + 1) * sizeof(Objects_Control *)) + \
-      (sizeof(void *) + sizeof(uint32_t) + sizeof(Objects_Name *)) \
-    ) \
+    _Configure_From_workspace(_Configure_Object_table_RAM(_number)) + \
+    _Configure_Object_name_hash_RAM(_number) \
   )
 
 /*
@@ -1518,6 +1698,18 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
       _Configure_Object_RAM(_timers, sizeof(Timer_Control) )
   #endif
 
+  /**
+   *  This configures the number of timer servers created by
+   *  rtems_timer_create_server().  The server tasks are accounted for in
+   *  the maximum number of tasks.
+   */
+  #ifndef CONFIGURE_MAXIMUM_TIMER_SERVERS
+    #define CONFIGURE_MAXIMUM_TIMER_SERVERS 0
+  #endif
+
+  #define CONFIGURE_MEMORY_FOR_TIMER_SERVERS(_servers) \
+    ((_servers) * _Configure_From_workspace(sizeof(Timer_server_Control)))
+
   #ifndef CONFIGURE_MAXIMUM_SEMAPHORES
     #define CONFIGURE_MAXIMUM_SEMAPHORES                 0
   #endif
@@ -1551,7 +1743,10 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
     #define CONFIGURE_MEMORY_FOR_PARTITIONS(_partitions) 0
   #else
     #define CONFIGURE_MEMORY_FOR_PARTITIONS(_partitions) \
-      _Configure_Object_RAM(_partitions, sizeof(Partition_Control) )
+      ( _Configure_Object_RAM(_partitions, sizeof(Partition_Control) ) + \
+        _Configure_Max_Objects(_partitions) * _Configure_From_workspace( \
+          CONFIGURE_SMP_MAXIMUM_PROCESSORS * \
+            sizeof(Partition_Per_CPU_cache) ) )
   #endif
 
   #ifndef CONFIGURE_MAXIMUM_REGIONS
@@ -1592,14 +1787,25 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
       _Configure_Object_RAM(_barriers, sizeof(Barrier_Control) )
   #endif
 
-  #ifndef CONFIGURE_MAXIMUM_USER_EXTENSIONS
-    #define CONFIGURE_MAXIMUM_USER_EXTENSIONS                 0
+  #if !defined(CONFIGURE_MAXIMUM_USER_EXTENSIONS) && \
+      !CONFIGURE_MALLOC_CACHE_EXTENSION
     #define CONFIGURE_MEMORY_FOR_USER_EXTENSIONS(_extensions) 0
   #else
     #define CONFIGURE_MEMORY_FOR_USER_EXTENSIONS(_extensions) \
       _Configure_Object_RAM(_extensions, sizeof(Extension_Control) )
   #endif
 
+  #ifndef CONFIGURE_MAXIMUM_USER_EXTENSIONS
+    #define CONFIGURE_MAXIMUM_USER_EXTENSIONS                 0
+  #endif
+
+  /**
+   *  This is the number of user extension objects including the one used by
+   *  the malloc per task cache.
+   */
+  #define CONFIGURE_EXTENSIONS \
+    (CONFIGURE_MAXIMUM_USER_EXTENSIONS + CONFIGURE_MALLOC_CACHE_EXTENSION)
+
   #ifndef CONFIGURE_MICROSECONDS_PER_TICK
     #define CONFIGURE_MICROSECONDS_PER_TICK \
             RTEMS_MILLISECONDS_TO_MICROSECONDS(10)
@@ -1704,9 +1910,38 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
     #define CONFIGURE_MAXIMUM_POSIX_KEYS           0
     #define CONFIGURE_MEMORY_FOR_POSIX_KEYS(_keys) 0
   #else
+    /*
+     *  The key values are stored by the threads on demand.  Each thread
+     *  which sets a non-NULL value needs a value store.  By default, this
+     *  accounts for a value store of every task and thread.
+     */
+    #ifndef CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_STORES
+      #define CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_STORES \
+        (_Configure_Max_Objects(CONFIGURE_TASKS) + \
+          _Configure_Max_Objects(CONFIGURE_MAXIMUM_POSIX_THREADS) + \
+          _Configure_Max_Objects(CONFIGURE_MAXIMUM_ADA_TASKS) + \
+          _Configure_Max_Objects(CONFIGURE_MAXIMUM_GOROUTINES))
+    #endif
+
+    /*
+     *  A value store holds the values of three quarters of
+     *  POSIX_KEYS_INLINE_VALUES keys inline.  For more keys, its table has
+     *  less than 8/3 entries per key.  The table it replaces is freed after
+     *  the larger one is allocated, so this accounts for four entries per
+     *  key.
+     */
+    #define _Configure_POSIX_Key_value_table_entries(_keys) \
+      (4 * _Configure_Max_Objects(_keys) > 3 * POSIX_KEYS_INLINE_VALUES ? \
+        4 * _Configure_Max_Objects(_keys) : 0)
+
     #define CONFIGURE_MEMORY_FOR_POSIX_KEYS(_keys) \
       (_Configure_Object_RAM(_keys, sizeof(POSIX_Keys_Control) ) \
-        + (_keys) * 3 * _Configure_From_workspace(sizeof(void *) * 2))
+        + CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_STORES * \
+          (_Configure_From_workspace(sizeof(POSIX_Keys_Thread_values)) + \
+            (_Configure_POSIX_Key_value_table_entries(_keys) != 0 ? \
+              _Configure_From_workspace( \
+                _Configure_POSIX_Key_value_table_entries(_keys) * \
+                  sizeof(POSIX_Keys_Value)) : 0)))
   #endif
 
   #ifndef CONFIGURE_MAXIMUM_POSIX_TIMERS
@@ -1776,8 +2011,19 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
     #define CONFIGURE_MAXIMUM_POSIX_RWLOCKS              0
     #define CONFIGURE_MEMORY_FOR_POSIX_RWLOCKS(_rwlocks) 0
   #else
-    #define CONFIGURE_MEMORY_FOR_POSIX_RWLOCKS(_rwlocks) \
-      _Configure_Object_RAM(_rwlocks, sizeof(POSIX_RWLock_Control) )
+    #if defined(RTEMS_SMP)
+      /*
+       *  Each big reader RWLock has a reader counter per processor.
+       */
+      #define CONFIGURE_MEMORY_FOR_POSIX_RWLOCKS(_rwlocks) \
+        ( _Configure_Object_RAM(_rwlocks, sizeof(POSIX_RWLock_Control) ) + \
+          _Configure_Max_Objects(_rwlocks) * _Configure_From_workspace( \
+            CONFIGURE_SMP_MAXIMUM_PROCESSORS * \
+              sizeof(CORE_RWLock_Per_CPU_readers) ) )
+    #else
+      #define CONFIGURE_MEMORY_FOR_POSIX_RWLOCKS(_rwlocks) \
+        _Configure_Object_RAM(_rwlocks, sizeof(POSIX_RWLock_Control) )
+    #endif
   #endif
 
   #ifdef CONFIGURE_POSIX_INIT_THREAD_TABLE
@@ -1975,7 +2221,7 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
               + CONFIGURE_MEMORY_PER_TASK_FOR_POSIX_API \
               + CONFIGURE_MEMORY_PER_TASK_FOR_SCHEDULER \
               + _Configure_From_workspace( \
-                (CONFIGURE_MAXIMUM_USER_EXTENSIONS + 1) * sizeof(void *) \
+                (CONFIGURE_EXTENSIONS + 1) * sizeof(void *) \
               ) \
           ) \
       + _Configure_Max_Objects(_number_FP_tasks) \
@@ -2103,13 +2349,16 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
 
 /**
  *  This macro reserves the memory required by the statically configured
- *  user extensions.
+ *  user extensions and by the user extension dispatch tables.
  */
 #define CONFIGURE_MEMORY_FOR_STATIC_EXTENSIONS \
      ((CONFIGURE_NEWLIB_EXTENSION * \
         _Configure_From_workspace( sizeof(User_extensions_Control))) + \
       (CONFIGURE_STACK_CHECKER_EXTENSION * \
-        _Configure_From_workspace( sizeof(User_extensions_Control))) \
+        _Configure_From_workspace( sizeof(User_extensions_Control))) + \
+      _Configure_From_workspace( USER_EXTENSIONS_DISPATCH_STORAGE_SIZE( \
+        CONFIGURE_NUMBER_OF_INITIAL_EXTENSIONS + USER_EXTENSIONS_API_SETS + \
+          _Configure_Max_Objects(CONFIGURE_EXTENSIONS))) \
      )
 
 /**
@@ -2121,6 +2370,7 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
     CONFIGURE_GOROUTINES_TASK_VARIABLES) + \
    CONFIGURE_MEMORY_FOR_TIMERS(CONFIGURE_MAXIMUM_TIMERS + \
     CONFIGURE_TIMER_FOR_SHARED_MEMORY_DRIVER ) + \
+   CONFIGURE_MEMORY_FOR_TIMER_SERVERS(CONFIGURE_MAXIMUM_TIMER_SERVERS) + \
    CONFIGURE_MEMORY_FOR_SEMAPHORES(CONFIGURE_SEMAPHORES) + \
    CONFIGURE_MEMORY_FOR_MESSAGE_QUEUES(CONFIGURE_MAXIMUM_MESSAGE_QUEUES) + \
    CONFIGURE_MEMORY_FOR_PARTITIONS(CONFIGURE_MAXIMUM_PARTITIONS) + \
@@ -2128,13 +2378,27 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
    CONFIGURE_MEMORY_FOR_PORTS(CONFIGURE_MAXIMUM_PORTS) + \
    CONFIGURE_MEMORY_FOR_PERIODS(CONFIGURE_MAXIMUM_PERIODS) + \
    CONFIGURE_MEMORY_FOR_BARRIERS(CONFIGURE_BARRIERS) + \
-   CONFIGURE_MEMORY_FOR_USER_EXTENSIONS(CONFIGURE_MAXIMUM_USER_EXTENSIONS) \
+   CONFIGURE_MEMORY_FOR_USER_EXTENSIONS(CONFIGURE_EXTENSIONS) \
   )
 
 #if defined(RTEMS_SMP)
+  #ifndef CONFIGURE_MAXIMUM_TASK_POOLS
+    #define CONFIGURE_MAXIMUM_TASK_POOLS 0
+  #endif
+
+  /**
+   *  This macro calculates the memory required for task pools.  The
+   *  workers are accounted for in the maximum number of tasks.
+   */
+  #define CONFIGURE_MEMORY_FOR_TASK_POOLS(_pools) \
+    ((_pools) * _Configure_From_workspace( \
+      sizeof(rtems_task_pool_control) + CONFIGURE_SMP_MAXIMUM_PROCESSORS * \
+        (sizeof(rtems_task_pool_queue) + 2 * sizeof(rtems_id)) ))
+
   #define CONFIGURE_MEMORY_FOR_SMP \
      (CONFIGURE_SMP_MAXIMUM_PROCESSORS * \
-      _Configure_From_workspace( CONFIGURE_INTERRUPT_STACK_SIZE ) \
+      _Configure_From_workspace( CONFIGURE_INTERRUPT_STACK_SIZE ) + \
+      CONFIGURE_MEMORY_FOR_TASK_POOLS(CONFIGURE_MAXIMUM_TASK_POOLS) \
      )
 #else
   #define CONFIGURE_MEMORY_FOR_SMP 0
@@ -2153,6 +2417,7 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
    CONFIGURE_MEMORY_FOR_STATIC_EXTENSIONS + \
    CONFIGURE_MEMORY_FOR_MP + \
    CONFIGURE_MEMORY_FOR_SMP + \
+   CONFIGURE_MEMORY_FOR_TASK_STACK_POOL + \
    CONFIGURE_MESSAGE_BUFFER_MEMORY + \
    (CONFIGURE_MEMORY_OVERHEAD * 1024) \
 ) & ~0x7)
@@ -2321,7 +2586,7 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
     NULL,                                     /* filled in by BSP */
     CONFIGURE_EXECUTIVE_RAM_SIZE,             /* required RTEMS workspace */
     CONFIGURE_STACK_SPACE_SIZE,               /* required stack space */
-    CONFIGURE_MAXIMUM_USER_EXTENSIONS,        /* maximum dynamic extensions */
+    CONFIGURE_EXTENSIONS,                     /* maximum dynamic extensions */
     CONFIGURE_MICROSECONDS_PER_TICK,          /* microseconds per clock tick */
     1000 * CONFIGURE_MICROSECONDS_PER_TICK,   /* nanoseconds per clock tick */
     CONFIGURE_TICKS_PER_TIMESLICE,            /* ticks per timeslice quantum */
@@ -2344,6 +2609,30 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
     #else
       false,
     #endif
+    #ifdef CONFIGURE_WORKSPACE_SEGREGATED_FIT /* true for constant time
+                                                 workspace allocator */
+      true,
+    #else
+      false,
+    #endif
+    #ifdef CONFIGURE_MALLOC_SEGREGATED_FIT    /* true for constant time
+                                                 malloc allocator */
+      true,
+    #else
+      false,
+    #endif
+    #ifdef CONFIGURE_WORKSPACE_SLAB           /* true to keep freed
+                                                 workspace slab objects */
+      true,
+    #else
+      false,
+    #endif
+    #ifdef CONFIGURE_OBJECT_NAME_HASH         /* true for constant time
+                                                 object name lookups */
+      true,
+    #else
+      false,
+    #endif
     CONFIGURE_MAXIMUM_DRIVERS,                /* maximum device drivers */
     CONFIGURE_NUMBER_OF_DRIVERS,              /* static device drivers */
     Device_drivers,                           /* pointer to driver table */
@@ -2365,6 +2654,8 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
   #if defined(CONFIGURE_INIT)
     uint32_t rtems_configuration_smp_maximum_processors = \
         CONFIGURE_SMP_MAXIMUM_PROCESSORS;
+    uint32_t rtems_configuration_smp_mutex_spin_nanoseconds = \
+        CONFIGURE_SMP_MUTEX_SPIN_NANOSECONDS;
   #else
     extern uint32_t rtems_configuration_smp_maximum_processors;
   #endif
@@ -2376,6 +2667,20 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
    Per_CPU_Control *_Per_CPU_Information_p[CONFIGURE_SMP_MAXIMUM_PROCESSORS];
  #endif
 
+  /**
+   *  Instantiate the cluster count of the Priority SMP Scheduler for every
+   *  scheduler.  The task pools and the interrupt work servers use
+   *  rtems_task_set_scheduler_cluster() which references it.
+   */
+  #ifndef CONFIGURE_SCHEDULER_PRIORITY_SMP_CLUSTERS
+    #define CONFIGURE_SCHEDULER_PRIORITY_SMP_CLUSTERS 1
+  #endif
+
+  #if defined(CONFIGURE_INIT)
+    uint32_t _Scheduler_priority_smp_Maximum_clusters =
+      CONFIGURE_SCHEDULER_PRIORITY_SMP_CLUSTERS;
+  #endif
+
 #endif
 
 /*
@@ -2513,7 +2818,7 @@ rtems_fs_init_functions_t    rtems_fs_init_helper =
     CONFIGURE_MEMORY_FOR_PORTS(CONFIGURE_MAXIMUM_PORTS),
     CONFIGURE_MEMORY_FOR_PERIODS(CONFIGURE_MAXIMUM_PERIODS),
     CONFIGURE_MEMORY_FOR_BARRIERS(CONFIGURE_BARRIERS),
-    CONFIGURE_MEMORY_FOR_USER_EXTENSIONS(CONFIGURE_MAXIMUM_USER_EXTENSIONS),
+    CONFIGURE_MEMORY_FOR_USER_EXTENSIONS(CONFIGURE_EXTENSIONS),
 
 #ifdef RTEMS_POSIX_API
     /* POSIX API Pieces */
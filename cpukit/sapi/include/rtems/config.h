@@ -213,6 +213,42 @@ typedef struct {
    */
   bool                           stack_allocator_avoids_work_space;
 
+  /**
+   * @brief Specifies if the RTEMS Workspace uses the two-level segregated fit
+   * allocator.
+   *
+   * If this element is @a true, then the RTEMS Workspace heap has constant
+   * time allocate and free operations, otherwise it uses the first fit
+   * allocator.
+   */
+  bool                           work_space_segregated_fit;
+
+  /**
+   * @brief Specifies if the C Program Heap uses the two-level segregated fit
+   * allocator.
+   *
+   * This element is only used for separate work areas.
+   */
+  bool                           malloc_segregated_fit;
+
+  /**
+   * @brief Specifies if the RTEMS Workspace slab caches keep freed objects.
+   *
+   * If this element is @a true, then objects freed to a workspace slab cache
+   * are kept for reuse by later allocations of the same size, otherwise they
+   * are returned to the RTEMS Workspace.
+   */
+  bool                           work_space_slab;
+
+  /**
+   * @brief Specifies if the object classes have a name hash index.
+   *
+   * If this element is @a true, then the local objects of each object class
+   * are indexed by name, so that the name to identifier lookups need
+   * constant time, otherwise the lookups search the local object table.
+   */
+  bool                           object_name_hash;
+
   uint32_t                       maximum_drivers;
   uint32_t                       number_of_device_drivers;
   rtems_driver_address_table    *Device_driver_table;
@@ -260,6 +296,18 @@ extern rtems_configuration_table  Configuration;
 #define rtems_configuration_get_stack_allocator_avoids_work_space() \
         (Configuration.stack_allocator_avoids_work_space)
 
+#define rtems_configuration_get_work_space_segregated_fit() \
+        (Configuration.work_space_segregated_fit)
+
+#define rtems_configuration_get_malloc_segregated_fit() \
+        (Configuration.malloc_segregated_fit)
+
+#define rtems_configuration_get_work_space_slab() \
+        (Configuration.work_space_slab)
+
+#define rtems_configuration_get_object_name_hash() \
+        (Configuration.object_name_hash)
+
 #define rtems_configuration_get_stack_space_size() \
         (Configuration.stack_space_size)
 
@@ -21,6 +21,7 @@
 
 #include <rtems/system.h>
 #include <rtems/rtems/support.h>
+#include <rtems/score/apimutex.h>
 #include <rtems/score/object.h>
 #include <rtems/score/thread.h>
 #include <rtems/extension.h>
@@ -39,16 +40,30 @@ rtems_status_code rtems_extension_create(
   if ( !rtems_is_name_valid( name ) )
     return RTEMS_INVALID_NAME;
 
+  /*
+   *  The allocator mutex serializes the compilation of the user extension
+   *  dispatch table with the thread create and delete extensions.
+   */
+  _RTEMS_Lock_allocator();
   _Thread_Disable_dispatch();         /* to prevent deletion */
 
   the_extension = _Extension_Allocate();
 
   if ( !the_extension ) {
     _Thread_Enable_dispatch();
+    _RTEMS_Unlock_allocator();
     return RTEMS_TOO_MANY;
   }
 
-  _User_extensions_Add_set_with_table( &the_extension->Extension, extension_table );
+  if ( !_User_extensions_Add_set_with_table(
+         &the_extension->Extension,
+         extension_table
+       ) ) {
+    _Extension_Free( the_extension );
+    _Thread_Enable_dispatch();
+    _RTEMS_Unlock_allocator();
+    return RTEMS_TOO_MANY;
+  }
 
   _Objects_Open(
     &_Extension_Information,
@@ -58,5 +73,6 @@ rtems_status_code rtems_extension_create(
 
   *id = the_extension->Object.id;
   _Thread_Enable_dispatch();
+  _RTEMS_Unlock_allocator();
   return RTEMS_SUCCESSFUL;
 }
@@ -21,6 +21,7 @@
 
 #include <rtems/system.h>
 #include <rtems/rtems/support.h>
+#include <rtems/score/apimutex.h>
 #include <rtems/score/object.h>
 #include <rtems/score/thread.h>
 #include <rtems/extension.h>
@@ -32,6 +33,12 @@ rtems_status_code rtems_extension_delete(
   Extension_Control   *the_extension;
   Objects_Locations    location;
 
+  /*
+   *  The allocator mutex serializes the compilation of the user extension
+   *  dispatch table with the thread create and delete extensions.
+   */
+  _RTEMS_Lock_allocator();
+
   the_extension = _Extension_Get( id, &location );
   switch ( location ) {
     case OBJECTS_LOCAL:
@@ -39,6 +46,7 @@ rtems_status_code rtems_extension_delete(
       _Objects_Close( &_Extension_Information, &the_extension->Object );
       _Extension_Free( the_extension );
       _Thread_Enable_dispatch();
+      _RTEMS_Unlock_allocator();
       return RTEMS_SUCCESSFUL;
 
 #if defined(RTEMS_MULTIPROCESSING)
@@ -48,5 +56,6 @@ rtems_status_code rtems_extension_delete(
       break;
   }
 
+  _RTEMS_Unlock_allocator();
   return RTEMS_INVALID_ID;
 }
@@ -459,6 +459,20 @@ uint32_t   _CPU_ISR_Get_level( void );
         "1" (_value) : \
         "cc"); \
     } while (0)
+
+  #define SMP_CPU_COMPARE_AND_SWAP( _address, _expected, _desired, _previous ) \
+    do { \
+      asm volatile("lock; cmpxchgl %2, %1" : \
+        "=a" (_previous), "+m" (*_address) : \
+        "r" (_desired), "0" (_expected) : \
+        "cc", "memory"); \
+    } while (0)
+
+  /* a locked instruction orders all loads and stores */
+  #define SMP_CPU_MEMORY_BARRIER() \
+    do { \
+      asm volatile("lock; addl $0, 0(%%esp)" : : : "cc", "memory"); \
+    } while (0)
 #endif
 
 #define _CPU_Context_Fp_start( _base, _offset ) \
@@ -1195,6 +1195,38 @@ void _CPU_Context_restore(
       ); \
       _previous = _val; \
     } while (0)
+
+  /**
+   * Macro to compare and swap memory and bypass the cache.
+   *
+   * @note address space 1 is uncacheable
+   */
+  #define SMP_CPU_COMPARE_AND_SWAP( _address, _expected, _desired, _previous ) \
+    do { \
+      register unsigned int _val = _desired; \
+      asm volatile( \
+        "casa [%2] %3, %4, %0" : \
+        "=r" (_val) : \
+        "0" (_val), \
+        "r" (_address), \
+        "i" (1), \
+        "r" (_expected) : \
+        "memory" \
+      ); \
+      _previous = _val; \
+    } while (0)
+
+  /**
+   * Macro to order all memory accesses of this processor.
+   *
+   * @note The SPARC V8 processors with SMP support use the total store
+   * order.  An atomic load-store to the unused space below the stack
+   * pointer also orders the stores before it with the loads after it.
+   */
+  #define SMP_CPU_MEMORY_BARRIER() \
+    do { \
+      asm volatile( "ldstub [%%sp - 1], %%g0" : : : "memory" ); \
+    } while (0)
 #endif
 
 /**
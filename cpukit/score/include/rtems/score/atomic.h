@@ -0,0 +1,103 @@
+/**
+ *  @file  rtems/score/atomic.h
+ *
+ *  This include file defines the atomic operations used by the lock
+ *  free fast paths of the SuperCore.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_ATOMIC_H
+#define _RTEMS_SCORE_ATOMIC_H
+
+#include <rtems/score/cpu.h>
+
+/**
+ *  @defgroup ScoreAtomic Atomic Operations
+ *
+ *  @ingroup Score
+ *
+ *  The atomic operations must be used with interrupts disabled on the
+ *  current processor.  On uniprocessor configurations the disabled
+ *  interrupts make the operations atomic, so they reduce to plain loads
+ *  and stores.  On SMP configurations they use the compare and swap
+ *  instruction of the processor.
+ */
+/**@{*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  @brief Compare and Swap
+ *
+ *  This routine stores @a desired at @a address if the value at
+ *  @a address is equal to @a expected.  The comparison and the store are
+ *  one atomic operation.
+ *
+ *  @param[in] address is the address of the value.
+ *  @param[in] expected is the expected value.
+ *  @param[in] desired is the new value.
+ *
+ *  @return This method returns true if the value was equal to @a expected
+ *          and is now @a desired, and false otherwise.
+ *
+ *  @note Interrupts must be disabled on the current processor.
+ */
+RTEMS_INLINE_ROUTINE bool _Atomic_Compare_and_swap_uint32(
+  volatile uint32_t *address,
+  uint32_t           expected,
+  uint32_t           desired
+)
+{
+#if defined(RTEMS_SMP)
+  uint32_t previous;
+
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  SMP_CPU_COMPARE_AND_SWAP( address, expected, desired, previous );
+  RTEMS_COMPILER_MEMORY_BARRIER();
+
+  return previous == expected;
+#else
+  if ( *address != expected )
+    return false;
+
+  *address = desired;
+
+  return true;
+#endif
+}
+
+/**
+ *  @brief Memory Fence
+ *
+ *  This routine ensures that other processors observe the loads and
+ *  stores before it before the loads and stores after it.  On
+ *  uniprocessor configurations it only prevents the compiler from moving
+ *  memory accesses across it.
+ */
+RTEMS_INLINE_ROUTINE void _Atomic_Fence( void )
+{
+#if defined(RTEMS_SMP)
+  SMP_CPU_MEMORY_BARRIER();
+#else
+  RTEMS_COMPILER_MEMORY_BARRIER();
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/**@}*/
+
+#endif
+/* end of include file */
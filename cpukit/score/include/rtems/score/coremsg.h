@@ -6,7 +6,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2009.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -136,6 +136,24 @@ typedef enum {
  */
 #define  CORE_MESSAGE_QUEUE_URGENT_REQUEST INT_MIN
 
+/**
+ *  @brief Receive by Copy
+ *
+ *  A thread waiting to receive a message stores this value in its
+ *  Wait.option field if the message is copied into a buffer provided by
+ *  the thread.
+ */
+#define CORE_MESSAGE_QUEUE_RECEIVE_BY_COPY      0
+
+/**
+ *  @brief Receive by Reference
+ *
+ *  A thread waiting to receive a message stores this value in its
+ *  Wait.option field if it receives a message buffer of the message queue.
+ *  The thread must return the message buffer to the message queue.
+ */
+#define CORE_MESSAGE_QUEUE_RECEIVE_BY_REFERENCE 1
+
 /**
  *  @brief Message Insertion Operation Types
  *
@@ -241,6 +259,11 @@ typedef struct {
    *  as part of destroying it.
    */
   CORE_message_queue_Buffer         *message_buffers;
+  /** This is the size in bytes of a message buffer including the message
+   *  buffer control.  It is used to validate message buffers returned by
+   *  the application.
+   */
+  size_t                             message_buffer_size;
   #if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
     /** This is the routine invoked when the message queue transitions
      *  from zero (0) messages pending to one (1) message pending.
@@ -435,6 +458,108 @@ void _CORE_message_queue_Seize(
   Watchdog_Interval                timeout
 );
 
+/**
+ *  @brief Submit a Message Buffer to the Message Queue
+ *
+ *  This routine submits a message buffer obtained by
+ *  _CORE_message_queue_Allocate_message_buffer() without a copy of the
+ *  message.  A thread waiting to receive by reference gets the message
+ *  buffer, a thread waiting to receive by copy gets a copy of the message.
+ *  Otherwise the message buffer is queued as a pending message.  This
+ *  routine never blocks.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] the_message is the message buffer filled in by the caller
+ *  @param[in] size is the size of the message
+ *  @param[in] id is the RTEMS object Id associated with this message queue.
+ *         It is used when unblocking a remote thread.
+ *  @param[in] api_message_queue_mp_support is the routine to invoke if
+ *         a thread that is unblocked is actually a remote thread.
+ *  @param[in] submit_type determines whether the message is prepended,
+ *         appended, or enqueued in priority order.
+ *
+ *  @return indication of the successful completion or reason for failure.
+ *          The caller still owns the message buffer in case of a failure.
+ */
+CORE_message_queue_Status _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control                *the_message_queue,
+  CORE_message_queue_Buffer_control         *the_message,
+  size_t                                     size,
+  Objects_Id                                 id,
+  CORE_message_queue_API_mp_support_callout  api_message_queue_mp_support,
+  CORE_message_queue_Submit_types            submit_type
+);
+
+/**
+ *  @brief Seize a Message Buffer from the Message Queue
+ *
+ *  This kernel routine dequeues a message and hands its message buffer to
+ *  the caller without a copy of the message.  The caller must return the
+ *  message buffer with _CORE_message_queue_Return_buffer().  The thread
+ *  will be blocked if wait is true, otherwise an error will be given to the
+ *  thread if no messages are available.
+ *
+ *  If a sender with a copy of the message finds no free message buffer for
+ *  a thread waiting to receive by reference, then the send fails with the
+ *  CORE_MESSAGE_QUEUE_STATUS_TOO_MANY status and the thread keeps waiting.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] id is the RTEMS object Id associated with this message queue.
+ *         It is used when unblocking a remote thread.
+ *  @param[out] buffer_p will contain the address of the message
+ *  @param[out] size_p will contain the size of the message
+ *  @param[in] wait indicates whether the calling thread is willing to block
+ *         if the message queue is empty.
+ *  @param[in] timeout is the maximum number of clock ticks that the calling
+ *         thread is willing to block if the message queue is empty.
+ *
+ *  @note Returns message priority via return are in TCB.
+ */
+void _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control      *the_message_queue,
+  Objects_Id                       id,
+  void                           **buffer_p,
+  size_t                          *size_p,
+  bool                             wait,
+  Watchdog_Interval                timeout
+);
+
+/**
+ *  @brief Get the Control of a Message Buffer
+ *
+ *  This function returns the message buffer control of the message
+ *  @a buffer if it is a message buffer of @a the_message_queue held by the
+ *  application.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] buffer is the address of the message
+ *
+ *  @return The message buffer control or NULL if @a buffer is not a message
+ *          buffer of the message queue or if it is not held by the
+ *          application, e.g. since it was already returned or sent.
+ */
+CORE_message_queue_Buffer_control *_CORE_message_queue_Get_buffer_control(
+  CORE_message_queue_Control *the_message_queue,
+  void                       *buffer
+);
+
+/**
+ *  @brief Return a Message Buffer to the Message Queue
+ *
+ *  This routine returns a message buffer obtained by
+ *  _CORE_message_queue_Allocate_message_buffer() or
+ *  _CORE_message_queue_Seize_buffer().  If a thread waits to send a
+ *  message, then its message is placed in the message buffer.  Otherwise
+ *  the message buffer is freed.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] the_message is the message buffer
+ */
+void _CORE_message_queue_Return_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message
+);
+
 /**
  *  This kernel routine inserts the specified message into the
  *  message queue.  It is assumed that the message has been filled
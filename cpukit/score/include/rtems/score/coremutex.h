@@ -8,7 +8,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2011.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -40,6 +40,7 @@ extern "C" {
 #include <rtems/score/watchdog.h>
 #include <rtems/score/interr.h>
 #include <rtems/score/sysstate.h>
+#include <rtems/score/atomic.h>
 
 /**
  *  @brief MP Support Callback Prototype
@@ -171,6 +172,12 @@ typedef enum {
  */
 #define CORE_MUTEX_LOCKED   0
 
+/**
+ *  This is the value of a mutex when it is locked and threads may wait
+ *  for it.  The holder must use the thread queue to release the mutex.
+ */
+#define CORE_MUTEX_CONTENDED 2
+
 /**
  *  @brief Core Mutex Attributes
  *
@@ -194,6 +201,11 @@ typedef struct {
    *  is selected.
    */
   Priority_Control             priority_ceiling;
+  /** When this field is true, then a thread which finds the mutex locked
+   *  by a thread executing on another processor spins for a bounded time
+   *  before it blocks.  This has only an effect on SMP configurations.
+   */
+  bool                         adaptive;
 }   CORE_mutex_Attributes;
 
 #ifdef __RTEMS_STRICT_ORDER_MUTEX__
@@ -229,7 +241,10 @@ typedef struct {
    *  behavior.
    */
   CORE_mutex_Attributes   Attributes;
-  /** This element contains the current state of the mutex.
+  /** This element contains the current state of the mutex.  It is
+   *  changed with _Atomic_Compare_and_swap_uint32(), so that an
+   *  uncontended obtain or release of a mutex without priority
+   *  inheritance or ceiling does not need the thread dispatch disable lock.
    */
   uint32_t                lock;
   /** This element contains the number of times the mutex has been acquired
@@ -338,6 +353,51 @@ void _CORE_mutex_Seize_interrupt_blocking(
 );
 
 
+#if defined(RTEMS_SMP)
+/**
+ *  @brief Adaptive Mutex Spin Time
+ *
+ *  This variable is the maximum time in nanoseconds a thread polls an
+ *  adaptive mutex while its holder executes on another processor.
+ *  Afterwards the thread blocks.  It is set by the configuration.
+ */
+extern uint32_t rtems_configuration_smp_mutex_spin_nanoseconds;
+
+/**
+ *  @brief Spin on Mutex before Blocking
+ *
+ *  This routine polls the adaptive mutex @a the_mutex while its holder
+ *  executes on another processor.  Interrupts are enabled between the
+ *  polls.  The poll time is limited by
+ *  rtems_configuration_smp_mutex_spin_nanoseconds.
+ *
+ *  @param[in] the_mutex is the mutex to attempt to lock
+ *  @param[in] level_p is the interrupt level holder
+ *
+ *  @retval true The trylock was successful or resolved the obtain
+ *          operation.  Interrupts are enabled.
+ *  @retval false The caller must block.  Interrupts are disabled.
+ *
+ *  @note Interrupts must be disabled on entry.
+ */
+bool _CORE_mutex_Seize_spin(
+  CORE_mutex_Control  *the_mutex,
+  ISR_Level           *level_p
+);
+
+/**
+ *  This macro returns true if the mutex was obtained by spinning on it.
+ *
+ *  @param[in] _the_mutex is the mutex to attempt to lock
+ *  @param[in] _level_p is the interrupt level holder
+ */
+  #define _CORE_mutex_Spin_for_seize( _the_mutex, _level_p ) \
+      ((_the_mutex)->Attributes.adaptive \
+        && _CORE_mutex_Seize_spin( _the_mutex, _level_p ))
+#else
+  #define _CORE_mutex_Spin_for_seize( _the_mutex, _level_p ) 0
+#endif
+
 /**
  *  @brief Sieze Interrupt Wrapper
  *
@@ -380,8 +440,11 @@ void _CORE_mutex_Seize_interrupt_blocking(
  *      return an error
  *  * If mutex is available without any contention or blocking
  *      obtain it with interrupts disabled and returned
+ *  * If the mutex is adaptive and its holder executes on another processor
+ *      spin for a bounded time
  *  * If the caller is willing to wait
- *      then they are blocked.
+ *      mark the mutex as contended and block the caller.  The mutex
+ *      may be released in the meantime, then it is obtained instead.
  */
 #define _CORE_mutex_Seize_body( \
   _the_mutex, _id, _wait, _timeout, _level ) \
@@ -398,13 +461,17 @@ void _CORE_mutex_Seize_interrupt_blocking(
         _ISR_Enable( _level ); \
         _Thread_Executing->Wait.return_code = \
           CORE_MUTEX_STATUS_UNSATISFIED_NOWAIT; \
-      } else { \
-        _Thread_queue_Enter_critical_section( &(_the_mutex)->Wait_queue ); \
-        _Thread_Executing->Wait.queue = &(_the_mutex)->Wait_queue; \
-        _Thread_Executing->Wait.id    = _id; \
+      } else if ( !_CORE_mutex_Spin_for_seize( _the_mutex, &(_level) ) ) { \
         _Thread_Disable_dispatch(); \
-        _ISR_Enable( _level ); \
-       _CORE_mutex_Seize_interrupt_blocking( _the_mutex, _timeout ); \
+        if ( _CORE_mutex_Set_contended( _the_mutex, &(_level) ) ) { \
+          _Thread_queue_Enter_critical_section( &(_the_mutex)->Wait_queue ); \
+          _Thread_Executing->Wait.queue = &(_the_mutex)->Wait_queue; \
+          _Thread_Executing->Wait.id    = _id; \
+          _ISR_Enable( _level ); \
+          _CORE_mutex_Seize_interrupt_blocking( _the_mutex, _timeout ); \
+        } else { \
+          _Thread_Enable_dispatch(); \
+        } \
       } \
     } \
   } while (0)
@@ -36,6 +36,13 @@ extern "C" {
 #include <rtems/score/priority.h>
 #include <rtems/score/watchdog.h>
 
+/**
+ *  This is the distance in bytes between the reader counters of two
+ *  processors of a big reader RWLock.  The counters do not share a cache
+ *  line if this is at least the cache line size of the processor.
+ */
+#define CORE_RWLOCK_PER_CPU_READERS_SIZE 64
+
 /**
  *  The following type defines the callout which the API provides
  *  to support global/multiprocessor operations on RWLocks.
@@ -101,8 +108,28 @@ typedef struct {
   /** This field indicates XXX.
    */
   int XXX;
+  /** This field is true if the readers are counted per processor.  A
+   *  reader of a big reader RWLock changes only the counter of its
+   *  processor, and a writer waits until the counters of all processors
+   *  drain.  This is effective only on SMP configurations.
+   */
+  bool big_reader;
 }   CORE_RWLock_Attributes;
 
+/**
+ *  The following defines the reader counter of one processor for a big
+ *  reader RWLock.  A reader which migrates to another processor releases
+ *  the RWLock on the counter of the new processor, so only the sum of all
+ *  counters is meaningful.
+ */
+typedef struct {
+  /** This is the number of readers counted on this processor. */
+  volatile uint32_t  readers;
+  /** This separates the counters of the processors. */
+  uint8_t            reserved[ CORE_RWLOCK_PER_CPU_READERS_SIZE -
+                               sizeof( uint32_t ) ];
+}   CORE_RWLock_Per_CPU_readers;
+
 /**
  *  The following defines the control block used to manage each
  *  RWLock.
@@ -122,15 +149,31 @@ typedef struct {
   /** This element contains the current number of thread waiting for this
    *  RWLock to be released. */
   uint32_t                 number_of_readers;
+#if defined(RTEMS_SMP)
+  /** This element is true if a reader may obtain a big reader RWLock
+   *  without the thread dispatch disable lock.  It is false while a writer
+   *  holds or waits for the RWLock.
+   */
+  volatile uint32_t             readers_may_proceed;
+  /** This element points to the reader counters of a big reader RWLock
+   *  and is NULL otherwise.
+   */
+  CORE_RWLock_Per_CPU_readers  *per_cpu_readers;
+#endif
 }   CORE_RWLock_Control;
 
 /**
  *  This routine initializes the RWLock based on the parameters passed.
+ *  The reader counters of a big reader RWLock are allocated from the
+ *  workspace.
  *
  *  @param[in] the_rwlock is the RWLock to initialize
  *  @param[in] the_rwlock_attributes define the behavior of this instance
+ *
+ *  @return This method returns true if the RWLock was initialized
+ *          successfully, and false otherwise.
  */
-void _CORE_RWLock_Initialize(
+bool _CORE_RWLock_Initialize(
   CORE_RWLock_Control       *the_rwlock,
   CORE_RWLock_Attributes    *the_rwlock_attributes
 );
@@ -189,6 +232,44 @@ CORE_RWLock_Status _CORE_RWLock_Release(
   CORE_RWLock_Control                *the_rwlock
 );
 
+/**
+ *  This routine frees the resources of a RWLock which is deleted.
+ *
+ *  @param[in] the_rwlock is the RWLock to close
+ */
+void _CORE_RWLock_Close(
+  CORE_RWLock_Control                *the_rwlock
+);
+
+#if defined(RTEMS_SMP)
+/**
+ *  This routine hands a big reader RWLock over to the threads waiting
+ *  for it.  The first waiting writer obtains the RWLock once the reader
+ *  counters drain.  The waiting readers in front of it obtain the RWLock
+ *  immediately.  If no thread waits, then the readers may proceed without
+ *  the thread dispatch disable lock again.
+ *
+ *  @param[in] the_rwlock is the RWLock to hand over
+ *
+ *  @note This routine must be called with thread dispatching disabled.
+ */
+void _CORE_RWLock_Big_reader_Grant(
+  CORE_RWLock_Control                *the_rwlock
+);
+
+/**
+ *  This routine returns the sum of the reader counters of all processors
+ *  for a big reader RWLock.
+ *
+ *  @param[in] the_rwlock is the RWLock to check
+ *
+ *  @return This method returns the number of readers.
+ */
+uint32_t _CORE_RWLock_Big_reader_Count(
+  CORE_RWLock_Control                *the_rwlock
+);
+#endif
+
 /**
  *  This routine assists in the deletion of a RWLock by flushing the
  *  associated wait queue.
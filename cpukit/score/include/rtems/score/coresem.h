@@ -8,7 +8,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2008.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -33,6 +33,7 @@
 #include <rtems/score/threadq.h>
 #include <rtems/score/priority.h>
 #include <rtems/score/watchdog.h>
+#include <rtems/score/atomic.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -122,8 +123,17 @@ typedef struct {
    *  behavior.
    */
   CORE_semaphore_Attributes   Attributes;
-  /** This element contains the current count of this semaphore. */
+  /** This element contains the current count of this semaphore.  It is
+   *  changed with _Atomic_Compare_and_swap_uint32(), so that a unit is
+   *  obtained without the thread queue lock if the count is not zero.
+   */
   uint32_t                    count;
+  /** This field is true if threads may wait on this semaphore.  It is set
+   *  if a thread blocks on the semaphore and cleared by a surrender which
+   *  finds no waiting thread.  While it is false, surrender operations need
+   *  only the thread queue lock and not the thread dispatch disable lock.
+   */
+  bool                        may_have_waiters;
 }   CORE_semaphore_Control;
 
 /**
@@ -33,6 +33,18 @@ extern "C" {
 
 #include <rtems/score/thread.h>
 #include <rtems/score/priority.h>
+#if defined(RTEMS_SMP)
+  #include <rtems/score/smplock.h>
+#endif
+
+#if defined(SMP_LOCK_FIFO)
+  /**
+   *  This indicates that waiting threads obtain the spinlock in FIFO order.
+   *  A waiting thread draws a ticket and spins on it with thread dispatching
+   *  enabled, so it keeps its place in the queue if it is preempted.
+   */
+  #define CORE_SPINLOCK_FIFO
+#endif
 
 /**
  *  Core Spinlock handler return statuses.
@@ -107,6 +119,12 @@ typedef struct {
    *  not be the thread which acquired it.
    */
   volatile Objects_Id   holder;
+
+  #if defined(CORE_SPINLOCK_FIFO)
+    /** This field is the ticket lock which queues the waiting threads.
+     */
+    SMP_lock_ticket_Control Ticket;
+  #endif
 }   CORE_spinlock_Control;
 
 /**
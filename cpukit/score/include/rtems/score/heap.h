@@ -42,6 +42,13 @@ extern "C" {
  * information for both allocated and free blocks is contained in the heap
  * area.  A heap control structure contains control information for the heap.
  *
+ * Optionally a heap may use the two-level segregated fit method (see
+ * _Heap_Initialize_segregated_fit()).  In this case the free blocks are
+ * distributed to free lists of size classes and a bitmap index of the
+ * non-empty free lists is maintained.  This yields allocate and free
+ * operations with a constant time bound independent of the heap
+ * fragmentation.  The block layout is the same for both methods.
+ *
  * The alignment routines could be made faster should we require only powers of
  * two to be supported for page size, alignment and boundary arguments.  The
  * minimum alignment requirement for pages is currently CPU_ALIGNMENT and this
@@ -333,6 +340,68 @@ typedef struct {
   uint32_t resizes;
 } Heap_Statistics;
 
+/**
+ * @brief Log2 of the count of second level size classes for each first level
+ * size class of the two-level segregated fit index.
+ */
+#define HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2 2
+
+/**
+ * @brief Count of second level size classes for each first level size class.
+ */
+#define HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT \
+  (1U << HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2)
+
+/**
+ * @brief Maximum count of first level size classes.
+ *
+ * This value is limited by the bit count of the first level bitmap.
+ */
+#define HEAP_SEGREGATED_FIT_FIRST_LEVEL_MAXIMUM 32
+
+/**
+ * @brief Index of the free blocks for the two-level segregated fit method.
+ *
+ * The first level size class of a free block is the position of the most
+ * significant bit of its size.  Each first level size class is linearly
+ * subdivided into @ref HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT second level
+ * size classes.  Each size class has a free list.  The bitmaps indicate the
+ * non-empty free lists.  Free blocks larger than the range of the last size
+ * class are kept in the free list of the last size class.
+ *
+ * The index is placed at the begin of the heap area by
+ * _Heap_Initialize_segregated_fit().
+ */
+typedef struct {
+  /**
+   * @brief A set bit indicates a non-empty second level bitmap.
+   */
+  uint32_t first_level_bitmap;
+
+  /**
+   * @brief Most significant bit position of the smallest block size.
+   */
+  uint32_t first_level_offset;
+
+  /**
+   * @brief Count of first level size classes.
+   */
+  uint32_t first_level_count;
+
+  /**
+   * @brief A set bit indicates a non-empty free list.
+   */
+  uint32_t second_level_bitmap [HEAP_SEGREGATED_FIT_FIRST_LEVEL_MAXIMUM];
+
+  /**
+   * @brief Free list heads of the size classes.
+   *
+   * This array contains @a first_level_count times
+   * @ref HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT elements.
+   */
+  Heap_Block free_lists [1];
+} Heap_Segregated_fit;
+
 /**
  * @brief Control block used to manage a heap.
  */
@@ -345,6 +414,14 @@ struct Heap_Control {
   Heap_Block *first_block;
   Heap_Block *last_block;
   Heap_Statistics stats;
+
+  /**
+   * @brief Free block index in case the two-level segregated fit method is
+   * used, otherwise @c NULL.
+   *
+   * In case this index is used, the free list @a free_list is empty.
+   */
+  Heap_Segregated_fit *segregated_fit;
   #ifdef HEAP_PROTECTION
     Heap_Protection Protection;
   #endif
@@ -427,6 +504,26 @@ uintptr_t _Heap_Initialize(
   uintptr_t page_size
 );
 
+/**
+ * @brief Initializes the heap control block @a heap to manage the area
+ * starting at @a area_begin of size @a area_size bytes with the two-level
+ * segregated fit method.
+ *
+ * The free block index is placed at the begin of the area and the remaining
+ * area is initialized with _Heap_Initialize().  All heap operations are
+ * available for this heap.  Allocations and deallocations have a constant
+ * time bound.  Allocations with an alignment greater than the page size or a
+ * boundary may fall back to a search of the free lists.
+ *
+ * Returns the maximum memory available, or zero in case of failure.
+ */
+uintptr_t _Heap_Initialize_segregated_fit(
+  Heap_Control *heap,
+  void *area_begin,
+  uintptr_t area_size,
+  uintptr_t page_size
+);
+
 /**
  * @brief Extends the memory available for the heap @a heap using the memory
  * area starting at @a area_begin of size @a area_size bytes.
@@ -72,7 +72,8 @@ typedef enum {
   INTERNAL_ERROR_UNLIMITED_AND_MAXIMUM_IS_0,
   INTERNAL_ERROR_SHUTDOWN_WHEN_NOT_UP,
   INTERNAL_ERROR_GXX_KEY_ADD_FAILED,
-  INTERNAL_ERROR_GXX_MUTEX_INIT_FAILED
+  INTERNAL_ERROR_GXX_MUTEX_INIT_FAILED,
+  INTERNAL_ERROR_OUT_OF_SMP_LOCK_NODES
 } Internal_errors_Core_list;
 
 typedef uint32_t Internal_errors_t;
@@ -7,7 +7,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2011.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -313,6 +313,24 @@ typedef struct {
   Objects_Name   name;
 } Objects_Control;
 
+/**
+ *  This is the minimum number of entries of a local table page of an object
+ *  class with auto-extend enabled.  Together with the index range of object
+ *  Ids it determines the length of the local table page directory.
+ */
+#define OBJECTS_LOCAL_TABLE_PAGE_MINIMUM 256
+
+/**
+ *  The following defines the control block of a set of objects allocated
+ *  at once when the object information is extended.
+ */
+typedef struct {
+  /** This is the memory area of the objects or NULL if released. */
+  void             *objects;
+  /** This is the number of objects of this block on the Inactive list. */
+  uint32_t          inactive;
+} Objects_Block;
+
 /**
  *  The following defines the structure for the information used to
  *  manage each class of objects.
@@ -334,22 +352,47 @@ typedef struct {
   Objects_Maximum   allocation_size;
   /** This is the size in bytes of each object instance. */
   size_t            size;
-  /** This points to the table of local objects. */
-  Objects_Control **local_table;
+  /**
+   *  This is the directory of the local object table pages.  The object
+   *  with index i is in page (i >> local_table_shift) at the offset
+   *  (i & local_table_mask).  Pages are added on extension but never moved.
+   */
+  Objects_Control ***local_table;
+  /** This is the base two logarithm of the local table page size. */
+  uint32_t          local_table_shift;
+  /** This is the mask of the offset within a local table page. */
+  uint32_t          local_table_mask;
   /** This is the chain of inactive control blocks. */
   Chain_Control     Inactive;
   /** This is the number of objects on the Inactive list. */
   Objects_Maximum   inactive;
-  /** This is the number of inactive objects per block. */
-  uint32_t         *inactive_per_block;
-  /** This is a table to the chain of inactive object memory blocks. */
-  void            **object_blocks;
+  /**
+   *  This is the directory of the object block table pages.  It is indexed
+   *  like the local table with object_blocks_shift and object_blocks_mask.
+   */
+  Objects_Block   **object_blocks;
+  /** This is the base two logarithm of the object block table page size. */
+  uint32_t          object_blocks_shift;
+  /** This is the mask of the offset within an object block table page. */
+  uint32_t          object_blocks_mask;
+  /** This is the number of object blocks released by a shrink. */
+  uint32_t          released_blocks;
   #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
     /** This is true if names are strings. */
     bool              is_string;
   #endif
   /** This is the maximum length of names. */
   uint16_t          name_length;
+  /** This is the bucket index mask of the name hash index. */
+  uint32_t          name_hash_mask;
+  /**
+   *  This is the table of the first object index of each name hash bucket or
+   *  NULL if the object class has no name hash index.  An index of zero
+   *  terminates a bucket.
+   */
+  Objects_Maximum  *name_hash_buckets;
+  /** This is the table of the next object index in a name hash bucket. */
+  Objects_Maximum  *name_hash_next;
   /** This is this object class' method called when extracting a thread. */
   Objects_Thread_queue_Extract_callout extract;
   #if defined(RTEMS_MULTIPROCESSING)
@@ -811,6 +854,47 @@ void _Objects_Namespace_remove(
   Objects_Control      *the_object
 );
 
+/**
+ *  This function adds the_object to the name hash index of the object
+ *  class.  Objects without a name are not added.  The objects of a hash
+ *  bucket are kept in index order, so that a lookup finds the same object
+ *  as a search of the local table.
+ *
+ *  @param[in] information points to an Object Information Table
+ *  @param[in] the_object is a pointer to an open object
+ */
+void _Objects_Name_hash_insert(
+  Objects_Information  *information,
+  Objects_Control      *the_object
+);
+
+/**
+ *  This function removes the_object from the name hash index of the object
+ *  class.  Nothing happens if the_object is not in the index.
+ *
+ *  @param[in] information points to an Object Information Table
+ *  @param[in] the_object is a pointer to an object
+ */
+void _Objects_Name_hash_remove(
+  Objects_Information  *information,
+  Objects_Control      *the_object
+);
+
+/**
+ *  This function builds the name hash index of the object class in the
+ *  buckets table @a buckets from the open objects of the local table and
+ *  installs it.  The name hash mask and next table must be set and the
+ *  current name hash buckets table must be NULL.  Until the index is
+ *  installed, lookups search the local table.
+ *
+ *  @param[in] information points to an Object Information Table
+ *  @param[in] buckets is the new name hash buckets table
+ */
+void _Objects_Name_hash_rebuild(
+  Objects_Information  *information,
+  Objects_Maximum      *buckets
+);
+
 /**
  *  This function removes the_object control pointer and object name
  *  in the Local Pointer and Local Name Tables.
@@ -147,15 +147,30 @@ typedef struct {
 
   /** This is the time of the last context switch on this CPU. */
   Timestamp_Control time_of_last_context_switch;
+
+  #if defined(RTEMS_SMP) && defined(__RTEMS_SMP_LOCK_MCS__)
+    /** These are the queue nodes for the MCS locks of this CPU. */
+    SMP_lock_MCS_node smp_lock_nodes[ SMP_LOCK_MCS_NODE_COUNT ];
+
+    /** This is the bit set of the queue nodes in use. */
+    uint32_t          smp_lock_nodes_used;
+  #endif
 } Per_CPU_Control;
 #endif
 
 #ifdef ASM
 #if defined(RTEMS_SMP)
+  #if defined(__RTEMS_SMP_LOCK_TICKET__)
+    #define PER_CPU_LOCK_SIZE  (3 * 4)
+  #elif defined(__RTEMS_SMP_LOCK_MCS__)
+    #define PER_CPU_LOCK_SIZE  (2 * __RTEMS_SIZEOF_VOID_P__)
+  #else
+    #define PER_CPU_LOCK_SIZE  __RTEMS_SIZEOF_VOID_P__
+  #endif
   #define PER_CPU_LOCK     0
-  #define PER_CPU_STATE    (1 * __RTEMS_SIZEOF_VOID_P__)
-  #define PER_CPU_MESSAGE  (2 * __RTEMS_SIZEOF_VOID_P__)
-  #define PER_CPU_END_SMP  (3 * __RTEMS_SIZEOF_VOID_P__)
+  #define PER_CPU_STATE    PER_CPU_LOCK_SIZE
+  #define PER_CPU_MESSAGE  (PER_CPU_LOCK_SIZE + (1 * __RTEMS_SIZEOF_VOID_P__))
+  #define PER_CPU_END_SMP  (PER_CPU_LOCK_SIZE + (2 * __RTEMS_SIZEOF_VOID_P__))
 #else
   #define PER_CPU_END_SMP  0
 #endif
@@ -50,6 +50,24 @@ RTEMS_INLINE_ROUTINE uintptr_t _Protected_heap_Initialize(
   return _Heap_Initialize( heap, area_begin, area_size, page_size );
 }
 
+/**
+ * @brief See _Heap_Initialize_segregated_fit().
+ */
+RTEMS_INLINE_ROUTINE uintptr_t _Protected_heap_Initialize_segregated_fit(
+  Heap_Control *heap,
+  void *area_begin,
+  uintptr_t area_size,
+  uintptr_t page_size
+)
+{
+  return _Heap_Initialize_segregated_fit(
+    heap,
+    area_begin,
+    area_size,
+    page_size
+  );
+}
+
 /**
  * @brief See _Heap_Extend().
  *
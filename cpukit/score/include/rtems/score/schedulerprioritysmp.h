@@ -0,0 +1,300 @@
+/**
+ *  @file  rtems/score/schedulerprioritysmp.h
+ *
+ *  This include file contains all the constants and structures associated
+ *  with the manipulation of threads on the ready queues of the priority
+ *  SMP scheduler.  This implementation is SMP-aware and schedules across
+ *  multiple cores.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERPRIORITY_SMP_H
+#define _RTEMS_SCORE_SCHEDULERPRIORITY_SMP_H
+
+/**
+ *  @addtogroup ScoreScheduler
+ *
+ *  The Priority SMP Scheduler partitions the cores into clusters.  Each
+ *  cluster has a ready queue with a priority bit map and one FIFO per
+ *  priority like the Deterministic Priority Scheduler.  A thread belongs
+ *  to exactly one cluster and the highest priority ready threads of a
+ *  cluster execute on the cores of this cluster.  With one cluster the
+ *  scheduling is global and with one cluster per core it is partitioned.
+ *
+ *  Core N belongs to cluster N modulo the cluster count.  New threads are
+ *  assigned to the clusters in a round-robin fashion.  The idle threads
+ *  are created first and in core order, so each idle thread belongs to
+ *  the cluster of its core.
+ *
+ *  The cost of a scheduling decision depends on the number of cores of a
+ *  cluster and not on the number of ready threads.
+ */
+/**@{*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <rtems/score/chain.h>
+#include <rtems/score/priority.h>
+#include <rtems/score/prioritybitmap.h>
+#include <rtems/score/scheduler.h>
+#include <rtems/score/schedulerpriority.h>
+
+/**
+ *  Entry points for the Priority SMP Scheduler.
+ */
+#define SCHEDULER_PRIORITY_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_priority_smp_Initialize,    /* initialize entry point */ \
+    _Scheduler_priority_smp_Schedule,      /* schedule entry point */ \
+    _Scheduler_priority_smp_Yield,         /* yield entry point */ \
+    _Scheduler_priority_smp_Block,         /* block entry point */ \
+    _Scheduler_priority_smp_Unblock,       /* unblock entry point */ \
+    _Scheduler_priority_smp_Allocate,      /* allocate entry point */ \
+    _Scheduler_priority_Free,              /* free entry point */ \
+    _Scheduler_priority_smp_Update,        /* update entry point */ \
+    _Scheduler_priority_smp_Enqueue,       /* enqueue entry point */ \
+    _Scheduler_priority_smp_Enqueue_first, /* enqueue_first entry point */ \
+    _Scheduler_priority_smp_Extract,       /* extract entry point */ \
+    _Scheduler_priority_Priority_compare,  /* compares two priorities */ \
+    _Scheduler_priority_Release_job,       /* new period of task */ \
+    _Scheduler_priority_smp_Tick           /* tick entry point */ \
+  }
+
+/**
+ *  This structure defines the ready queue of a cluster.
+ */
+typedef struct {
+  /** This is the major bit map of the ready priorities. */
+  Priority_bit_map_Control  major;
+
+  /** These are the minor bit maps of the ready priorities. */
+  Priority_bit_map_Control  minor[ 16 ];
+
+  /** This is the array of FIFOs with one FIFO per priority. */
+  Chain_Control            *ready;
+} Scheduler_priority_smp_Cluster;
+
+/**
+ *  This structure is the scheduler specific data of the Priority SMP
+ *  Scheduler.
+ */
+typedef struct {
+  /** This is the array of clusters. */
+  Scheduler_priority_smp_Cluster  *clusters;
+
+  /**
+   *  This is the scratch area of the schedule operation for the threads
+   *  which wait for a core.  It has one entry per configured core.
+   */
+  Thread_Control                 **pending;
+
+  /**
+   *  This is the scratch area of the schedule operation which indicates
+   *  that the heir of a core is determined.  It has one entry per
+   *  configured core.
+   */
+  bool                            *assigned;
+} Scheduler_priority_smp_Control;
+
+/**
+ *  Per-thread data related to the Priority SMP Scheduler.
+ */
+typedef struct {
+  /** This field points to the FIFO of the thread priority. */
+  Chain_Control                  *ready_chain;
+
+  /** This field contains the bit map information of the thread priority. */
+  Priority_bit_map_Information    Priority_map;
+
+  /** This field points to the cluster of the thread. */
+  Scheduler_priority_smp_Cluster *cluster;
+
+  /** This field is the index of the cluster of the thread. */
+  uint32_t                        cluster_index;
+} Scheduler_priority_smp_Per_thread;
+
+/**
+ *  This is the configured maximum number of clusters.  The actual number
+ *  of clusters is limited by the number of cores.  It is defined by
+ *  <rtems/confdefs.h> in every SMP configuration regardless of the
+ *  selected scheduler.
+ */
+extern uint32_t _Scheduler_priority_smp_Maximum_clusters;
+
+/**
+ *  @brief Scheduler Priority SMP Initialize
+ *
+ *  This routine allocates the clusters and their ready queues.
+ */
+void _Scheduler_priority_smp_Initialize( void );
+
+/**
+ *  @brief Scheduler Priority SMP Schedule
+ *
+ *  This routine determines the heir of each core.  The heirs of a
+ *  cluster are the highest priority ready threads of this cluster.  A
+ *  thread stays on its core if possible.  Non-preemptible threads are not
+ *  replaced.
+ */
+void _Scheduler_priority_smp_Schedule( void );
+
+/**
+ *  @brief Scheduler Priority SMP Yield
+ *
+ *  This routine moves the executing thread to the end of its FIFO and
+ *  schedules.
+ */
+void _Scheduler_priority_smp_Yield( void );
+
+/**
+ *  @brief Scheduler Priority SMP Block
+ *
+ *  This routine removes @a the_thread from its ready queue and schedules.
+ *
+ *  @param[in] the_thread is the thread that is blocked.
+ */
+void _Scheduler_priority_smp_Block(
+  Thread_Control *the_thread
+);
+
+/**
+ *  @brief Scheduler Priority SMP Unblock
+ *
+ *  This routine adds @a the_thread to its ready queue and schedules.
+ *
+ *  @param[in] the_thread is the thread that is unblocked.
+ */
+void _Scheduler_priority_smp_Unblock(
+  Thread_Control *the_thread
+);
+
+/**
+ *  @brief Scheduler Priority SMP Allocate
+ *
+ *  This routine allocates the scheduler data of @a the_thread and assigns
+ *  it to the next cluster.
+ *
+ *  @param[in] the_thread is the thread the scheduler is allocating
+ *             management memory for.
+ */
+void *_Scheduler_priority_smp_Allocate(
+  Thread_Control *the_thread
+);
+
+/**
+ *  @brief Scheduler Priority SMP Update
+ *
+ *  This routine updates the ready queue information of @a the_thread for
+ *  its current priority and cluster.
+ *
+ *  @param[in] the_thread is the thread to update.
+ */
+void _Scheduler_priority_smp_Update(
+  Thread_Control *the_thread
+);
+
+/**
+ *  @brief Scheduler Priority SMP Enqueue
+ *
+ *  This routine appends @a the_thread to the FIFO of its priority.
+ *
+ *  @param[in] the_thread is the thread to enqueue.
+ */
+void _Scheduler_priority_smp_Enqueue(
+  Thread_Control *the_thread
+);
+
+/**
+ *  @brief Scheduler Priority SMP Enqueue First
+ *
+ *  This routine prepends @a the_thread to the FIFO of its priority.
+ *
+ *  @param[in] the_thread is the thread to enqueue.
+ */
+void _Scheduler_priority_smp_Enqueue_first(
+  Thread_Control *the_thread
+);
+
+/**
+ *  @brief Scheduler Priority SMP Extract
+ *
+ *  This routine removes @a the_thread from its ready queue.
+ *
+ *  @param[in] the_thread is the thread to extract.
+ */
+void _Scheduler_priority_smp_Extract(
+  Thread_Control *the_thread
+);
+
+/**
+ *  @brief Scheduler Priority SMP Requeue
+ *
+ *  This routine moves @a the_thread to the end of the FIFO of its
+ *  priority.
+ *
+ *  @param[in] the_thread is the thread to requeue.
+ */
+void _Scheduler_priority_smp_Requeue(
+  Thread_Control *the_thread
+);
+
+/**
+ *  @brief Scheduler Priority SMP Tick
+ *
+ *  This routine performs the time slicing of each core and schedules.
+ */
+void _Scheduler_priority_smp_Tick( void );
+
+/**
+ *  @brief Scheduler Priority SMP Get Cluster Count
+ *
+ *  This routine returns the number of clusters.
+ */
+uint32_t _Scheduler_priority_smp_Get_cluster_count( void );
+
+/**
+ *  @brief Scheduler Priority SMP Set Cluster
+ *
+ *  This routine moves @a the_thread to the cluster with index
+ *  @a cluster_index and schedules if the thread is ready.
+ *
+ *  @param[in] the_thread is the thread to move.
+ *  @param[in] cluster_index is the index of the new cluster.
+ *
+ *  @retval true The thread was moved.
+ *  @retval false The cluster index is invalid.
+ */
+bool _Scheduler_priority_smp_Set_cluster(
+  Thread_Control *the_thread,
+  uint32_t        cluster_index
+);
+
+/**
+ *  @brief Scheduler Priority SMP Get Cluster
+ *
+ *  This routine returns the cluster index of @a the_thread.
+ *
+ *  @param[in] the_thread is the thread.
+ */
+uint32_t _Scheduler_priority_smp_Get_cluster(
+  const Thread_Control *the_thread
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**@}*/
+
+#endif
+/* end of include file */
@@ -32,12 +32,83 @@
 extern "C" {
 #endif
 
+/**
+ *  This type is used for ticket locks.  A processor draws a ticket and
+ *  waits until its ticket is served, so the lock is granted in FIFO order.
+ *  Waiting processors only read the @a now_serving field.  The ticket
+ *  dispenser is a short swap lock since SMP_CPU_SWAP is the only atomic
+ *  operation available on all SMP ports.
+ */
+typedef struct {
+  /** This field protects the @a next_ticket field. */
+  uint32_t           dispenser;
+  /** This field is the ticket handed out to the next processor. */
+  uint32_t           next_ticket;
+  /** This field is the ticket of the current owner. */
+  volatile uint32_t  now_serving;
+} SMP_lock_ticket_Control;
+
+typedef struct SMP_lock_MCS_node SMP_lock_MCS_node;
+
+/**
+ *  This type is used for the queue nodes of MCS locks.  Each waiting
+ *  processor spins on the @a waiting field of its own node.
+ */
+struct SMP_lock_MCS_node {
+  /** This field is the node of the next waiting processor. */
+  SMP_lock_MCS_node * volatile  next;
+  /** This field is cleared by the predecessor to hand over the lock. */
+  volatile uint32_t             waiting;
+};
+
+/**
+ *  This type is used for MCS queue locks.  The lock is the tail of a queue
+ *  of nodes and is granted in FIFO order.
+ */
+typedef struct {
+  /** This field is the node of the last processor in the queue. */
+  SMP_lock_MCS_node * volatile tail;
+} SMP_lock_MCS_Control;
+
+/**
+ *  This is the number of MCS queue nodes of each processor.  It limits the
+ *  number of simple locks a processor may hold or wait for at a time.
+ */
+#define SMP_LOCK_MCS_NODE_COUNT 8
+
+#if defined(__RTEMS_SMP_LOCK_TICKET__) && defined(__RTEMS_SMP_LOCK_MCS__)
+  #error "select either the ticket or the MCS SMP lock implementation"
+#endif
+
+#if defined(__RTEMS_SMP_LOCK_TICKET__) || defined(__RTEMS_SMP_LOCK_MCS__)
+  /**
+   *  This indicates that the simple and nested spinlocks are fair and
+   *  granted in FIFO order.
+   */
+  #define SMP_LOCK_FIFO
+#endif
+
 /**
  *  This type is used to lock elements for atomic access.
  *  This spinlock is a simple non-nesting spinlock, and
  *  may be used for short non-nesting accesses.
+ *
+ *  The implementation is selected at build time.  By default it is a
+ *  test-and-set lock.  With __RTEMS_SMP_LOCK_TICKET__ it is a ticket lock
+ *  and with __RTEMS_SMP_LOCK_MCS__ it is an MCS queue lock which uses the
+ *  queue nodes of the owner processor.
  */
-typedef uint32_t SMP_lock_spinlock_simple_Control;
+#if defined(__RTEMS_SMP_LOCK_TICKET__)
+  typedef SMP_lock_ticket_Control SMP_lock_spinlock_simple_Control;
+#elif defined(__RTEMS_SMP_LOCK_MCS__)
+  typedef struct {
+    SMP_lock_MCS_Control  queue;
+    /** This field is the queue node of the current owner. */
+    SMP_lock_MCS_node    *owner;
+  } SMP_lock_spinlock_simple_Control;
+#else
+  typedef uint32_t SMP_lock_spinlock_simple_Control;
+#endif
 
 /**
  *  This type is used to lock elements for atomic access.
@@ -137,6 +208,108 @@ void _SMP_lock_spinlock_nested_Release(
   ISR_Level                         level
 );
 
+/**
+ *  @brief Initialize a Ticket Lock
+ *
+ *  This method is used to initialize the ticket lock at @a lock.
+ *
+ *  @param [in] lock is the address of the lock to initialize.
+ */
+void _SMP_lock_ticket_Initialize(
+  SMP_lock_ticket_Control *lock
+);
+
+/**
+ *  @brief Draw a Ticket
+ *
+ *  This method is used to draw the next ticket of the lock at @a lock.
+ *  The caller owns the lock once the ticket is served.
+ *
+ *  @param [in] lock is the address of the lock.
+ *
+ *  @return This method returns the ticket of the caller.
+ */
+uint32_t _SMP_lock_ticket_Take(
+  SMP_lock_ticket_Control *lock
+);
+
+/**
+ *  @brief Draw a Ticket if the Lock is Free
+ *
+ *  This method is used to obtain the lock at @a lock without waiting.
+ *
+ *  @param [in] lock is the address of the lock.
+ *
+ *  @return This method returns true if the lock was obtained.
+ */
+bool _SMP_lock_ticket_Try_take(
+  SMP_lock_ticket_Control *lock
+);
+
+/**
+ *  @brief Is Ticket Served
+ *
+ *  This method returns true if @a ticket of the lock at @a lock is served.
+ *
+ *  @param [in] lock is the address of the lock.
+ *  @param [in] ticket is a ticket drawn by _SMP_lock_ticket_Take().
+ */
+bool _SMP_lock_ticket_Is_served(
+  const SMP_lock_ticket_Control *lock,
+  uint32_t                       ticket
+);
+
+/**
+ *  @brief Release a Ticket Lock
+ *
+ *  This method is used to hand the lock at @a lock over to the holder of
+ *  the next ticket.
+ *
+ *  @param [in] lock is the address of the lock.
+ */
+void _SMP_lock_ticket_Release(
+  SMP_lock_ticket_Control *lock
+);
+
+/**
+ *  @brief Initialize a MCS Lock
+ *
+ *  This method is used to initialize the MCS lock at @a lock.
+ *
+ *  @param [in] lock is the address of the lock to initialize.
+ */
+void _SMP_lock_MCS_Initialize(
+  SMP_lock_MCS_Control *lock
+);
+
+/**
+ *  @brief Obtain a MCS Lock
+ *
+ *  This method appends @a node to the queue of the lock at @a lock and
+ *  spins on @a node until the predecessor hands over the lock.
+ *
+ *  @param [in] lock is the address of the lock to obtain.
+ *  @param [in] node is the queue node of the caller.  It must remain valid
+ *              until the lock is released.
+ */
+void _SMP_lock_MCS_Obtain(
+  SMP_lock_MCS_Control *lock,
+  SMP_lock_MCS_node    *node
+);
+
+/**
+ *  @brief Release a MCS Lock
+ *
+ *  This method hands the lock at @a lock over to the successor of @a node.
+ *
+ *  @param [in] lock is the address of the lock to release.
+ *  @param [in] node is the queue node used to obtain the lock.
+ */
+void _SMP_lock_MCS_Release(
+  SMP_lock_MCS_Control *lock,
+  SMP_lock_MCS_node    *node
+);
+
 #ifdef __cplusplus
 }
 #endif
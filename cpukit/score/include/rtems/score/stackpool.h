@@ -0,0 +1,148 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreStack
+ *
+ * @brief Thread stack pool API.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_STACKPOOL_H
+#define _RTEMS_SCORE_STACKPOOL_H
+
+#include <rtems/score/cpu.h>
+#include <rtems/score/wkslab.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup ScoreStack
+ *
+ * @{
+ */
+
+/**
+ * @brief Configuration of a stack pool size class.
+ *
+ * Each size class is a workspace slab cache of stacks with the same size.
+ * A stack request is served by the smallest size class which is large
+ * enough.  Larger requests are served by the workspace directly.
+ */
+typedef struct {
+  /**
+   * @brief Size in bytes of the stacks of this size class.
+   */
+  size_t stack_size;
+
+  /**
+   * @brief Number of stacks allocated during system initialization.
+   */
+  uint32_t initial_count;
+
+  /**
+   * @brief Maximum number of free stacks kept by this size class.
+   *
+   * Stacks freed beyond this limit go back to the workspace.  A value of
+   * zero indicates no limit.  If a stack allocation fails, the cached stacks
+   * beyond the initial count of the other size classes go back to the
+   * workspace until the allocation succeeds.
+   */
+  uint32_t maximum_free_count;
+} Stack_pool_Class_configuration;
+
+/**
+ * @brief Configuration of the stack pool.
+ *
+ * @note It is instantiated by User Configuration via confdefs.h if
+ * CONFIGURE_TASK_STACK_POOL is defined.
+ */
+typedef struct {
+  /**
+   * @brief Table of size classes sorted by increasing stack size.
+   */
+  const Stack_pool_Class_configuration *classes;
+
+  /**
+   * @brief Number of size classes.
+   */
+  uint32_t class_count;
+} Stack_pool_Configuration;
+
+/**
+ * @brief Stack header which precedes each stack of the stack pool.
+ */
+typedef struct {
+  /**
+   * @brief Size class of the stack or NULL if the stack was allocated from
+   * the workspace directly.
+   */
+  Workspace_Slab *size_class;
+} Stack_pool_Header;
+
+/**
+ * @brief Size of the stack header rounded up to the stack alignment.
+ */
+#define STACK_POOL_HEADER_SIZE \
+  ((sizeof( Stack_pool_Header ) + CPU_STACK_ALIGNMENT - 1) \
+    & ~((uintptr_t) CPU_STACK_ALIGNMENT - 1))
+
+/**
+ * @brief Stack pool configuration.
+ */
+extern const Stack_pool_Configuration _Stack_pool_Configuration;
+
+/**
+ * @brief Initializes the size classes of the stack pool and allocates the
+ * initial stacks of each size class.
+ *
+ * This is the task stack allocator initialization hook of the stack pool.
+ *
+ * @param[in] stack_space_size is the size of the stack space.  It is unused
+ * since the stacks are allocated from the workspace.
+ */
+void _Stack_pool_Initialize( size_t stack_space_size );
+
+/**
+ * @brief Allocates a stack of at least @a stack_size bytes.
+ *
+ * This is the task stack allocator hook of the stack pool.  A free stack of
+ * the smallest size class which is large enough is used if available,
+ * otherwise a new stack is allocated from the workspace.
+ *
+ * @param[in] stack_size is the requested stack size.
+ *
+ * @return A pointer to the stack or NULL if no memory is available.
+ */
+void *_Stack_pool_Allocate( size_t stack_size );
+
+/**
+ * @brief Frees a stack to the stack pool.
+ *
+ * This is the task stack deallocator hook of the stack pool.  The stack is
+ * kept by its size class unless the free stack limit of the size class is
+ * reached.
+ *
+ * @param[in] stack is the stack returned by _Stack_pool_Allocate().
+ *
+ * @note If @a stack is equal to NULL, then the request is ignored.
+ */
+void _Stack_pool_Free( void *stack );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
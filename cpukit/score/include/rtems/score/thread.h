@@ -99,6 +99,7 @@ extern "C" {
 #include <rtems/score/tod.h>
 #include <rtems/score/tqdata.h>
 #include <rtems/score/watchdog.h>
+#include <rtems/score/wkslab.h>
 
 /**
  *  The following defines the "return type" of a thread.
@@ -299,10 +300,14 @@ typedef struct {
    */
   uint32_t              return_code;
 
-  /** This field is the chain header for the second through Nth tasks
-   *  of the same priority blocked waiting on the same object.
+  /** This field is the node on a priority discipline thread queue. */
+  RBTree_Node           Priority_node;
+  /** This field is the priority used to order this thread on a priority
+   *  discipline thread queue.  It is a copy of the current priority at
+   *  enqueue time, so a priority change does not corrupt the tree order
+   *  before the thread is requeued.
    */
-  Chain_Control         Block2n;
+  Priority_Control      queue_priority;
   /** This field points to the thread queue on which this thread is blocked. */
   Thread_queue_Control *queue;
 }   Thread_Wait_information;
@@ -482,6 +487,12 @@ SCORE_EXTERN volatile uint32_t   _Thread_Dispatch_disable_level;
  */
 SCORE_EXTERN uint32_t   _Thread_Maximum_extensions;
 
+/**
+ *  The following is the workspace slab cache for the user extension data
+ *  areas of the threads.
+ */
+SCORE_EXTERN Workspace_Slab _Thread_Extensions_slab;
+
 /**
  *  The following is used to manage the length of a timeslice quantum.
  */
@@ -493,6 +504,12 @@ SCORE_EXTERN uint32_t   _Thread_Ticks_per_timeslice;
  */
 #if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
 SCORE_EXTERN Thread_Control *_Thread_Allocated_fp;
+
+/**
+ *  The following is the workspace slab cache for the floating point
+ *  contexts of the threads.
+ */
+SCORE_EXTERN Workspace_Slab _Thread_Fp_context_slab;
 #endif
 
 /**
@@ -194,6 +194,22 @@ Thread_blocking_operation_States _Thread_queue_Enqueue_priority (
   ISR_Level            *level_p
 );
 
+/**
+ * @brief  Thread queue Compare priority
+ *
+ *  This routine compares the priorities of the threads of the priority
+ *  thread queue nodes @a left and @a right.  It is the red-black tree
+ *  compare function of the priority discipline thread queues.
+ *
+ *  @retval -1 The thread of @a left has a higher priority.
+ *  @retval 0 The threads have the same priority.
+ *  @retval 1 The thread of @a left has a lower priority.
+ */
+int _Thread_queue_Compare_priority(
+  const RBTree_Node *left,
+  const RBTree_Node *right
+);
+
 /**
  * @brief  Thread queue Extract priority Helper
  *
@@ -20,6 +20,9 @@
 #include <time.h>
 #include <rtems/score/timestamp.h>
 #include <rtems/score/basedefs.h> /* SCORE_EXTERN */
+#if defined(RTEMS_SMP)
+#include <rtems/score/smplock.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -122,10 +125,43 @@ extern "C" {
  */
 /**@{*/
 
+/**
+ *  @brief Free running counter read routine.
+ *
+ *  This type defines the prototype of a routine which returns the value of
+ *  a free running hardware counter.
+ */
+typedef uint32_t ( *TOD_Counter_read_routine )( void );
+
 /**
  *  @brief TOD control.
+ *
+ *  The clock tick updates the time of day and the uptime in a generation
+ *  counted snapshot.  The generation is odd while the snapshot is written.
+ *  A reader copies the snapshot and retries if the generation was odd or
+ *  changed in the meantime, so readers never disable interrupts.  The time
+ *  since the last tick is the delta of a free running counter to its value
+ *  at the last tick if the BSP provides a counter, and the value of the
+ *  nanoseconds since tick handler otherwise.  The counter value at the last
+ *  tick advances by the nominal counter increments per tick, so a late
+ *  clock tick interrupt does not let the time step backwards.
  */
 typedef struct {
+  /**
+   *  @brief Snapshot generation.
+   *
+   *  This value is incremented before and after each update of the
+   *  snapshot.
+   */
+  volatile uint32_t generation;
+
+#if defined(RTEMS_SMP)
+  /**
+   *  @brief Serializes the updates of the snapshot.
+   */
+  SMP_lock_spinlock_simple_Control lock;
+#endif
+
   /**
    *  @brief Current time of day value.
    */
@@ -152,6 +188,36 @@ typedef struct {
    *  time of day, and false otherwise.
    */
   bool is_set;
+
+  /**
+   *  @brief Free running counter read routine or NULL.
+   */
+  TOD_Counter_read_routine counter_read;
+
+  /**
+   *  @brief Mask of the valid free running counter bits.
+   */
+  uint32_t counter_mask;
+
+  /**
+   *  @brief Nanoseconds per counter increment in 32.32 fixed point format.
+   */
+  uint64_t counter_scale;
+
+  /**
+   *  @brief Counter increments per clock tick in 32.32 fixed point format.
+   */
+  uint64_t counter_per_tick;
+
+  /**
+   *  @brief Free running counter value at the last tick.
+   */
+  uint32_t counter_at_tick;
+
+  /**
+   *  @brief Fraction of the counter value at the last tick.
+   */
+  uint32_t counter_at_tick_fraction;
 } TOD_Control;
 
 SCORE_EXTERN TOD_Control _TOD;
@@ -245,6 +311,38 @@ void _TOD_Get_uptime_as_timespec(
  */
 void _TOD_Tickle_ticks( void );
 
+/**
+ *  @brief Announces several clock ticks at once.
+ *
+ *  This routine advances the uptime and the current time of day by
+ *  @a ticks clock ticks in one step.  The seconds watchdog set is advanced
+ *  by the number of second boundaries crossed and its expired watchdogs
+ *  fire once.  It is used by clock drivers which suppress the periodic
+ *  clock tick while the system is idle.
+ *
+ *  @param[in] ticks is the number of clock ticks elapsed since the last
+ *             tick.  It must not be zero.
+ */
+void _TOD_Announce_ticks( uint32_t ticks );
+
+/**
+ *  @brief Installs a free running counter.
+ *
+ *  This routine installs the free running counter read by @a read.  The
+ *  counter increments with @a frequency Hz and wraps around at
+ *  @a mask + 1.  The counter must run synchronously with the clock tick
+ *  and must not wrap around between two clock tick announcements.
+ *
+ *  @param[in] read is the counter read routine.
+ *  @param[in] frequency is the counter frequency in Hz.
+ *  @param[in] mask is the mask of the valid counter bits.
+ */
+void _TOD_Set_counter(
+  TOD_Counter_read_routine read,
+  uint32_t                 frequency,
+  uint32_t                 mask
+);
+
 /**
  *  @brief TOD_MILLISECONDS_TO_MICROSECONDS
  *
@@ -6,7 +6,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2008.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -34,8 +34,12 @@ extern "C" {
 
 #include <rtems/score/chain.h>
 #include <rtems/score/priority.h>
+#include <rtems/score/rbtree.h>
 #include <rtems/score/states.h>
 #include <rtems/score/threadsync.h>
+#if defined(RTEMS_SMP)
+  #include <rtems/score/smplock.h>
+#endif
 
 /**
  *  The following enumerated type details all of the disciplines
@@ -46,34 +50,6 @@ typedef enum {
   THREAD_QUEUE_DISCIPLINE_PRIORITY  /* PRIORITY queue discipline */
 }   Thread_queue_Disciplines;
 
-/**
- *  This is one of the constants used to manage the priority queues.
- *
- *  There are four chains used to maintain a priority -- each chain
- *  manages a distinct set of task priorities.  The number of chains
- *  is determined by TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS.
- *  The following set must be consistent.
- *
- *  The set below configures 4 headers -- each contains 64 priorities.
- *  Header x manages priority range (x*64) through ((x*64)+63).  If
- *  the priority is more than half way through the priority range it
- *  is in, then the search is performed from the rear of the chain.
- *  This halves the search time to find the insertion point.
- */
-#define TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS 4
-
-/**
- *  This is one of the constants used to manage the priority queues.
- *  @ref TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS for more details.
- */
-#define TASK_QUEUE_DATA_PRIORITIES_PER_HEADER      64
-
-/**
- *  This is one of the constants used to manage the priority queues.
- *  @ref TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS for more details.
- */
-#define TASK_QUEUE_DATA_REVERSE_SEARCH_MASK        0x20
-
 /**
  *  This is the structure used to manage sets of tasks which are blocked
  *  waiting to acquire a resource.
@@ -85,8 +61,10 @@ typedef struct {
   union {
     /** This is the FIFO discipline list. */
     Chain_Control Fifo;
-    /** This is the set of lists for priority discipline waiting. */
-    Chain_Control Priority[TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS];
+    /** This is the red-black tree for priority discipline waiting.  It is
+     *  ordered by priority and in FIFO order for equal priorities.
+     */
+    RBTree_Control Priority;
   } Queues;
   /** This field is used to manage the critical section. */
   Thread_blocking_operation_States sync_state;
@@ -100,6 +78,14 @@ typedef struct {
    *  waiting on this thread queue.
    */
   uint32_t                 timeout_status;
+#if defined(RTEMS_SMP)
+  /** This lock protects the state of the object which owns this thread
+   *  queue against concurrent access by other processors.  It allows
+   *  operations which do not block or unblock threads to proceed without
+   *  the thread dispatch disable lock.
+   */
+  SMP_lock_spinlock_simple_Control Lock;
+#endif
 }   Thread_queue_Control;
 
 #ifndef __RTEMS_APPLICATION__
@@ -7,7 +7,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2009.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -210,26 +210,73 @@ typedef struct {
 }   User_extensions_Table;
 
 /**
- * @brief Manages the switch callouts.
- *
- * They are managed separately from other extensions for performance reasons.
+ * @brief Manages each user extension set.
  */
 typedef struct {
-  Chain_Node                              Node;
-  User_extensions_thread_switch_extension thread_switch;
-}   User_extensions_Switch_control;
+  Chain_Node            Node;
+  User_extensions_Table Callouts;
+}   User_extensions_Control;
 
 /**
- * @brief Manages each user extension set.
+ * @brief Dispatch table of the user extensions.
+ *
+ * For each hook it contains a contiguous array of the handlers in invocation
+ * order.  Each array is terminated by a NULL pointer.  The arrays of the
+ * thread delete and fatal hooks are in reverse order of the extension list.
+ * The thread exitted handlers run with thread dispatching enabled, so their
+ * dispatcher walks the extension list instead, see User_extensions_Iterator.
  *
- * The switch control is part of the extensions control even if not used due to
- * the extension not having a switch handler.
+ * The dispatch table is compiled from the list of active extensions each time
+ * an extension set is added or removed, so the dispatchers neither walk the
+ * list nor test for absent handlers.
  */
 typedef struct {
-  Chain_Node                     Node;
-  User_extensions_Switch_control Switch;
-  User_extensions_Table          Callouts;
-}   User_extensions_Control;
+  User_extensions_thread_create_extension  *thread_create;
+  User_extensions_thread_start_extension   *thread_start;
+  User_extensions_thread_restart_extension *thread_restart;
+  User_extensions_thread_delete_extension  *thread_delete;
+  User_extensions_thread_switch_extension  *thread_switch;
+  User_extensions_thread_begin_extension   *thread_begin;
+  User_extensions_fatal_extension          *fatal;
+}   User_extensions_Dispatch_table;
+
+/**
+ * @brief Iterator of the thread exitted dispatcher.
+ *
+ * The thread exitted dispatcher walks the extension list backwards and calls
+ * each handler with thread dispatching enabled, so extension sets may be
+ * added or removed in the meantime.  The iterator is registered on
+ * _User_extensions_Iterators while the walk is in progress.  Removing an
+ * extension set moves each iterator positioned at it to the previous set, so
+ * no handler is skipped or called twice.  Sets added during the walk are
+ * appended behind its start and are not called.
+ */
+typedef struct {
+  /** This field is the node on _User_extensions_Iterators. */
+  Chain_Node        Node;
+  /** This field is the thread which runs the thread exitted handlers. */
+  Thread_Control   *executing;
+  /** This field is the next extension set to examine. */
+  const Chain_Node *position;
+}   User_extensions_Iterator;
+
+/**
+ * @brief Number of extension sets added by the APIs.
+ *
+ * The Classic and POSIX APIs each add one extension set during system
+ * initialization.
+ */
+#define USER_EXTENSIONS_API_SETS 2
+
+/**
+ * @brief Size of the dispatch table storage for @a _capacity extension sets.
+ *
+ * The storage contains two dispatch tables, see _User_extensions_Dispatch.
+ * The user extension table has exactly one pointer per hook, so its size is
+ * the size of one array element for each hook.
+ */
+#define USER_EXTENSIONS_DISPATCH_STORAGE_SIZE( _capacity ) \
+  (2 * ((_capacity) + 1) * sizeof( User_extensions_Table ))
 
 /**
  * @brief List of active extensions.
@@ -237,9 +284,31 @@ typedef struct {
 SCORE_EXTERN Chain_Control _User_extensions_List;
 
 /**
- * @brief List of active task switch extensions.
+ * @brief Iterators of the thread exitted dispatchers in progress.
+ *
+ * This chain is protected by disabled thread dispatching.
+ */
+SCORE_EXTERN Chain_Control _User_extensions_Iterators;
+
+/**
+ * @brief Dispatch table used by the dispatchers.
+ *
+ * The dispatch tables are double buffered.  A new dispatch table is compiled
+ * into the inactive buffer and published with a single store to this pointer,
+ * so a dispatcher interrupted by an update continues with a consistent table.
+ */
+SCORE_EXTERN const User_extensions_Dispatch_table
+  *volatile _User_extensions_Dispatch;
+
+/**
+ * @brief Dispatch table buffers.
  */
-SCORE_EXTERN Chain_Control _User_extensions_Switches_list;
+SCORE_EXTERN User_extensions_Dispatch_table _User_extensions_Dispatch_tables[ 2 ];
+
+/**
+ * @brief Number of extension sets the dispatch table buffers can hold.
+ */
+SCORE_EXTERN uint32_t _User_extensions_Dispatch_capacity;
 
 /**
  * @name Extension Maintainance
@@ -249,7 +318,27 @@ SCORE_EXTERN Chain_Control _User_extensions_Switches_list;
 
 void _User_extensions_Handler_initialization( void );
 
-void _User_extensions_Add_set(
+/**
+ * @brief Compiles the dispatch table.
+ *
+ * The dispatch table buffers grow if the active extensions do not fit into
+ * them.  Thread dispatching must be disabled and the allocator mutex must be
+ * locked, if the system is up.
+ *
+ * @retval true The new dispatch table is in use.
+ * @retval false Not enough memory to grow the dispatch table buffers.  The
+ * previous dispatch table is still in use.
+ */
+bool _User_extensions_Compile_dispatch_table( void );
+
+/**
+ * @brief Adds an extension set.
+ *
+ * @retval true The extension set was added.
+ * @retval false Not enough memory for the dispatch table.  The extension set
+ * was not added.
+ */
+bool _User_extensions_Add_set(
   User_extensions_Control *extension
 );
 
@@ -257,17 +346,22 @@ RTEMS_INLINE_ROUTINE void _User_extensions_Add_API_set(
   User_extensions_Control *extension
 )
 {
-  _User_extensions_Add_set( extension );
+  if ( !_User_extensions_Add_set( extension ) )
+    _Internal_error_Occurred(
+      INTERNAL_ERROR_CORE,
+      true,
+      INTERNAL_ERROR_WORKSPACE_ALLOCATION
+    );
 }
 
-RTEMS_INLINE_ROUTINE void _User_extensions_Add_set_with_table(
+RTEMS_INLINE_ROUTINE bool _User_extensions_Add_set_with_table(
   User_extensions_Control     *extension,
   const User_extensions_Table *extension_table
 )
 {
   extension->Callouts = *extension_table;
 
-  _User_extensions_Add_set( extension );
+  return _User_extensions_Add_set( extension );
 }
 
 void _User_extensions_Remove_set(
@@ -311,6 +405,18 @@ void _User_extensions_Thread_exitted(
   Thread_Control *executing
 );
 
+/**
+ * @brief Removes the iterators of a thread.
+ *
+ * A thread exitted handler may not return, for example if it deletes or
+ * restarts the executing thread.  The iterator of @a the_thread lives on its
+ * stack, so it must be removed before the thread is closed or reset.  Thread
+ * dispatching must be disabled.
+ */
+void _User_extensions_Remove_iterators(
+  Thread_Control *the_thread
+);
+
 void _User_extensions_Fatal(
   Internal_errors_Source source,
   bool                   is_internal,
@@ -32,6 +32,9 @@
 /**@{*/
 
 #include <rtems/score/object.h>
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+  #include <rtems/score/rbtree.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -122,6 +125,34 @@ typedef enum {
   WATCHDOG_BACKWARD
 } Watchdog_Adjust_directions;
 
+/**
+ *  @brief Watchdog Header Structure
+ *
+ *  The following record defines the control block used to manage a set
+ *  of watchdog timers.  By default the set is a delta chain in which each
+ *  watchdog stores the interval relative to its predecessor.  Insertion
+ *  into a delta chain is linear in the number of watchdogs on the chain.
+ *
+ *  If RTEMS is configured with ENABLE_WATCHDOG_RBTREE=1 the set is a
+ *  red-black tree ordered by the absolute expiration time of each
+ *  watchdog.  Insert and remove operations are then logarithmic and a
+ *  tickle only visits the watchdogs which expire.
+ */
+typedef struct {
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+  /** This field is the tree of watchdogs ordered by expiration time. */
+  RBTree_Control                  Watchdogs;
+  /** This field is the current time of this set in ticks or seconds.
+   *  Expiration times are compared using modulo arithmetic, so a backward
+   *  adjustment may wrap this value around.
+   */
+  uint64_t                        current;
+#else
+  /** This field is the delta chain of watchdogs. */
+  Chain_Control                   Watchdogs;
+#endif
+}   Watchdog_Header;
+
 /**
  *  @brief Watchdog Control Structure
  *
@@ -133,12 +164,27 @@ typedef struct {
    *  chains for set management.
    */
   Chain_Node                      Node;
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+  /** This field is a Red-Black Tree Node structure and allows this to be
+   *  placed on the tree of a watchdog set.
+   */
+  RBTree_Node                     Tree_node;
+  /** This field is the watchdog set this watchdog is inserted on.  It is
+   *  NULL if the watchdog is not in a tree, e.g. while it is on a chain of
+   *  watchdogs about to fire.
+   */
+  Watchdog_Header                *header;
+  /** This field is the expiration time in units of the watchdog set. */
+  uint64_t                        expire;
+#endif
   /** This field is the state of the watchdog. */
   Watchdog_States                 state;
   /** This field is the initially requested interval. */
   Watchdog_Interval               initial;
+#if !defined(__RTEMS_WATCHDOG_RBTREE__)
   /** This field is the remaining portion of the interval. */
   Watchdog_Interval               delta_interval;
+#endif
   /** This field is the number of system clock ticks when this was scheduled. */
   Watchdog_Interval               start_time;
   /** This field is the number of system clock ticks when this was suspended. */
@@ -189,16 +235,35 @@ extern Watchdog_Nanoseconds_since_last_tick_routine
 /**
  *  @brief Per Ticks Watchdog List
  *
- *  This is the watchdog chain which is managed at ticks.
+ *  This is the watchdog set which is managed at ticks.
  */
-SCORE_EXTERN Chain_Control _Watchdog_Ticks_chain;
+SCORE_EXTERN Watchdog_Header _Watchdog_Ticks_header;
 
 /**
  *  @brief Per Seconds Watchdog List
  *
- *  This is the watchdog chain which is managed at second boundaries.
+ *  This is the watchdog set which is managed at second boundaries.
  */
-SCORE_EXTERN Chain_Control _Watchdog_Seconds_chain;
+SCORE_EXTERN Watchdog_Header _Watchdog_Seconds_header;
+
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+/**
+ *  @brief Watchdog Compare
+ *
+ *  This routine is the red-black tree comparison function of watchdog
+ *  sets.  It orders watchdogs by their expiration time.  Watchdogs with
+ *  equal expiration times are kept in insertion order by the tree.
+ *
+ *  @param[in] first is the tree node of the first watchdog
+ *  @param[in] second is the tree node of the second watchdog
+ *  @return This method returns 1 if @a first expires later than @a second,
+ *          -1 if it expires earlier and 0 otherwise.
+ */
+int _Watchdog_Compare(
+  const RBTree_Node *first,
+  const RBTree_Node *second
+);
+#endif
 
 /**
  *  @brief Watchdog Handler Initialization
@@ -225,15 +290,15 @@ Watchdog_States _Watchdog_Remove (
 /**
  *  @brief Watchdog Adjust
  *
- *  This routine adjusts the @a header watchdog chain in the forward
+ *  This routine adjusts the @a header watchdog set in the forward
  *  or backward @a direction for @a units ticks.
  *
- *  @param[in] header is the watchdog chain to adjust
+ *  @param[in] header is the watchdog set to adjust
  *  @param[in] direction is the direction to adjust @a header
  *  @param[in] units is the number of units to adjust @a header
  */
 void _Watchdog_Adjust (
-  Chain_Control              *header,
+  Watchdog_Header            *header,
   Watchdog_Adjust_directions  direction,
   Watchdog_Interval           units
 );
@@ -241,10 +306,10 @@ void _Watchdog_Adjust (
 /**
  *  @brief Watchdog Adjust to Chain
  *
- *  This routine adjusts the @a header watchdog chain in the forward
+ *  This routine adjusts the @a header watchdog set in the forward
  *  @a direction for @a units_arg ticks.
  *
- *  @param[in] header is the watchdog chain to adjust
+ *  @param[in] header is the watchdog set to adjust
  *  @param[in] units_arg is the number of units to adjust @a header
  *  @param[in] to_fire is a pointer to an initialized Chain_Control to which
  *             all watchdog instances that are to be fired will be placed.
@@ -252,23 +317,39 @@ void _Watchdog_Adjust (
  *  @note This always adjusts forward.
  */
 void _Watchdog_Adjust_to_chain(
-  Chain_Control               *header,
+  Watchdog_Header             *header,
   Watchdog_Interval            units_arg,
   Chain_Control               *to_fire
 
 );
 
+/**
+ *  @brief Watchdog Advance
+ *
+ *  This routine advances the @a header watchdog set for @a units ticks
+ *  without firing any watchdog.  Watchdogs which expire due to this
+ *  adjustment remain on the set and fire on the next tickle or
+ *  adjustment of the set.
+ *
+ *  @param[in] header is the watchdog set to advance
+ *  @param[in] units is the number of units to advance @a header
+ */
+void _Watchdog_Advance(
+  Watchdog_Header             *header,
+  Watchdog_Interval            units
+);
+
 /**
  *  @brief Watchdog Insert
  *
- *  This routine inserts @a the_watchdog into the @a header watchdog chain
+ *  This routine inserts @a the_watchdog into the @a header watchdog set
  *  for a time of @a units.
  *
- *  @param[in] header is @a the_watchdog list to insert @a the_watchdog on
+ *  @param[in] header is @a the_watchdog set to insert @a the_watchdog on
  *  @param[in] the_watchdog is the watchdog to insert
  */
 void _Watchdog_Insert (
-  Chain_Control         *header,
+  Watchdog_Header       *header,
   Watchdog_Control      *the_watchdog
 );
 
@@ -276,12 +357,12 @@ void _Watchdog_Insert (
  *  @brief Watchdog Tickle
  *
  *  This routine is invoked at appropriate intervals to update
- *  the @a header watchdog chain.
+ *  the @a header watchdog set.
  *
- *  @param[in] header is the watchdog chain to tickle
+ *  @param[in] header is the watchdog set to tickle
  */
 void _Watchdog_Tickle (
-  Chain_Control *header
+  Watchdog_Header *header
 );
 
 /**
@@ -304,23 +385,23 @@ void _Watchdog_Report(
 );
 
 /**
- *  @brief Report Information on a Watchdog Chain
+ *  @brief Report Information on a Watchdog Set
  *
- *  This method prints report on the watchdog chain provided.
- *  The @a name may be used to identify the watchdog chain and
+ *  This method prints report on the watchdog set provided.
+ *  The @a name may be used to identify the watchdog set and
  *  a space will be printed after @a name if it is not NULL.
  *
  *  @param[in] name is a string to prefix the line with.  If NULL,
  *             nothing is printed.
- *  @param[in] header is the watchdog chain to be printed.
+ *  @param[in] header is the watchdog set to be printed.
  *
  *  @note This is a debug routine.  It uses printk() and prudence should
  *        exercised when using it.  It also disables interrupts so the
- *        chain can be traversed in a single atomic pass.
+ *        set can be traversed in a single atomic pass.
  */
 void _Watchdog_Report_chain(
   const char        *name,
-  Chain_Control     *header
+  Watchdog_Header   *header
 );
 
 /**
@@ -0,0 +1,239 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreWorkspace
+ *
+ * @brief Workspace slab cache API.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_WKSLAB_H
+#define _RTEMS_SCORE_WKSLAB_H
+
+#include <rtems/score/chain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup ScoreWorkspace
+ *
+ * @{
+ */
+
+/**
+ * @brief Workspace slab cache control.
+ *
+ * A slab cache provides objects of a fixed size from the RTEMS Executive
+ * Workspace.  If the workspace slab caches are enabled by the configuration,
+ * then freed objects are kept on a free list of the slab cache and reused
+ * by later allocations.  This makes the allocate and free operations constant
+ * time once the slab cache holds enough objects and avoids fragmentation of
+ * the workspace due to objects of varying lifetime.
+ *
+ * The slab caches are protected like the workspace itself, e.g. by the
+ * allocator mutex or with thread dispatching disabled.
+ */
+typedef struct {
+  /**
+   * @brief Node on the chain of all slab caches.
+   */
+  Chain_Node Node;
+
+  /**
+   * @brief Name of the slab cache.
+   */
+  const char *name;
+
+  /**
+   * @brief Size of each object in bytes.
+   *
+   * A value of zero indicates an uninitialized slab cache.
+   */
+  uintptr_t object_size;
+
+  /**
+   * @brief Free list of objects.
+   *
+   * The first word of each free object points to the next free object.
+   */
+  void *free_list;
+
+  /**
+   * @brief Number of objects owned by the slab cache.
+   *
+   * This is the number of objects allocated from the workspace by the slab
+   * cache and not yet freed to the workspace, so it is the sum of the used
+   * and free objects in every configuration.
+   */
+  uint32_t object_count;
+
+  /**
+   * @brief Number of objects on the free list.
+   */
+  uint32_t free_count;
+
+  /**
+   * @brief Number of objects currently in use.
+   */
+  uint32_t used_count;
+
+  /**
+   * @brief Maximum number of objects in use at the same time.
+   */
+  uint32_t max_used_count;
+
+  /**
+   * @brief Number of failed allocations.
+   */
+  uint32_t failed_count;
+
+  /**
+   * @brief Maximum number of objects on the free list.
+   *
+   * Objects freed beyond this limit go back to the workspace.  The default
+   * is no limit if the workspace slab caches are enabled by the
+   * configuration and zero otherwise.
+   *
+   * @see _Workspace_Slab_Set_free_limit().
+   */
+  uint32_t free_limit;
+} Workspace_Slab;
+
+/**
+ * @brief Information about a workspace slab cache.
+ *
+ * @see _Workspace_Slab_Get_information().
+ */
+typedef struct {
+  const char *name;
+  uintptr_t   object_size;
+  uint32_t    object_count;
+  uint32_t    free_count;
+  uint32_t    used_count;
+  uint32_t    max_used_count;
+  uint32_t    failed_count;
+} Workspace_Slab_information;
+
+/**
+ * @brief Chain of all initialized workspace slab caches.
+ */
+SCORE_EXTERN Chain_Control _Workspace_Slabs;
+
+/**
+ * @brief Initializes the workspace slab cache @a slab.
+ *
+ * The slab cache provides objects of @a object_size bytes and is added to
+ * the chain of all slab caches.
+ *
+ * @param[in] slab is the slab cache to initialize.
+ * @param[in] name is the name of the slab cache.
+ * @param[in] object_size is the size of each object in bytes.
+ */
+void _Workspace_Slab_initialize(
+  Workspace_Slab *slab,
+  const char     *name,
+  uintptr_t       object_size
+);
+
+/**
+ * @brief Allocates an object from the workspace slab cache @a slab.
+ *
+ * A free object of the slab cache is used if available, otherwise a new
+ * object is allocated from the workspace.
+ *
+ * @param[in] slab is the slab cache.
+ *
+ * @return A pointer to the object or NULL if no memory is available.
+ */
+void *_Workspace_Slab_allocate(
+  Workspace_Slab *slab
+);
+
+/**
+ * @brief Allocates objects from the workspace to the free list of the
+ * workspace slab cache @a slab.
+ *
+ * This can be used to warm up a slab cache during system initialization.
+ *
+ * @param[in] slab is the slab cache.
+ * @param[in] count is the number of objects to add to the free list.
+ *
+ * @return The number of objects added to the free list.  It is less than
+ * @a count if the workspace is exhausted.
+ */
+uint32_t _Workspace_Slab_reserve(
+  Workspace_Slab *slab,
+  uint32_t        count
+);
+
+/**
+ * @brief Frees an object to the workspace slab cache @a slab.
+ *
+ * The object must be allocated from the same slab cache.  If the free list
+ * of the slab cache is below its limit, then the object is kept on the free
+ * list, otherwise it is freed to the workspace.
+ *
+ * @param[in] slab is the slab cache.
+ * @param[in] object is the object to free.
+ *
+ * @note If @a object is equal to NULL, then the request is ignored.
+ */
+void _Workspace_Slab_free(
+  Workspace_Slab *slab,
+  void           *object
+);
+
+/**
+ * @brief Frees the objects on the free list of the workspace slab cache
+ * @a slab to the workspace until at most @a keep_count free objects remain.
+ *
+ * This can be used to make memory available for other allocations once the
+ * workspace is exhausted.
+ *
+ * @param[in] slab is the slab cache.
+ * @param[in] keep_count is the number of free objects to keep.
+ *
+ * @return The number of objects freed to the workspace.
+ */
+uint32_t _Workspace_Slab_drain(
+  Workspace_Slab *slab,
+  uint32_t        keep_count
+);
+
+/**
+ * @brief Gets information about a workspace slab cache.
+ *
+ * @param[in] index is the index of the slab cache on the chain of all slab
+ *            caches.
+ * @param[out] the_info is the information about the slab cache.
+ *
+ * @retval true The information is valid.
+ * @retval false There is no slab cache with this @a index.
+ */
+bool _Workspace_Slab_Get_information(
+  uint32_t                    index,
+  Workspace_Slab_information *the_info
+);
+
+/** @} */
+
+#ifndef __RTEMS_APPLICATION__
+#include <rtems/score/wkslab.inl>
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
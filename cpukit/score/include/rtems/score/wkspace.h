@@ -34,6 +34,7 @@ extern "C" {
 
 #include <rtems/score/heap.h>
 #include <rtems/score/interr.h>
+#include <rtems/score/wkslab.h>
 
 /**
  * @brief Executive Workspace Control
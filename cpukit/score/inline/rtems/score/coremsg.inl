@@ -6,7 +6,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2009.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -93,15 +93,23 @@ RTEMS_INLINE_ROUTINE void _CORE_message_queue_Copy_buffer (
 
 /**
  *  This function allocates a message buffer from the inactive
- *  message buffer chain.
+ *  message buffer chain.  The message buffer is off chain until it is
+ *  queued or freed, so a message buffer held by the application can be
+ *  told apart from a queued or free one.
  */
 RTEMS_INLINE_ROUTINE CORE_message_queue_Buffer_control *
 _CORE_message_queue_Allocate_message_buffer (
     CORE_message_queue_Control *the_message_queue
 )
 {
-   return (CORE_message_queue_Buffer_control *)
-     _Chain_Get( &the_message_queue->Inactive_messages );
+  CORE_message_queue_Buffer_control *the_message;
+
+  the_message = (CORE_message_queue_Buffer_control *)
+    _Chain_Get( &the_message_queue->Inactive_messages );
+  if ( the_message != NULL )
+    _Chain_Set_off_chain( &the_message->Node );
+
+  return the_message;
 }
 
 /**
@@ -151,15 +159,76 @@ RTEMS_INLINE_ROUTINE void _CORE_message_queue_Set_message_priority (
 
 /**
  *  This function removes the first message from the_message_queue
- *  and returns a pointer to it.
+ *  and returns a pointer to it.  The message buffer is off chain like an
+ *  allocated one.
  */
 RTEMS_INLINE_ROUTINE
   CORE_message_queue_Buffer_control *_CORE_message_queue_Get_pending_message (
   CORE_message_queue_Control *the_message_queue
 )
 {
-  return (CORE_message_queue_Buffer_control *)
+  CORE_message_queue_Buffer_control *the_message;
+
+  the_message = (CORE_message_queue_Buffer_control *)
     _Chain_Get_unprotected( &the_message_queue->Pending_messages );
+  if ( the_message != NULL )
+    _Chain_Set_off_chain( &the_message->Node );
+
+  return the_message;
+}
+
+/**
+ *  This function returns true if a thread waiting on @a the_message_queue
+ *  receives by reference and no message buffer is free for it, and false
+ *  otherwise.  A copy of a message cannot be delivered to such a thread.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_message_queue_Is_receiver_without_buffer (
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  Thread_Control *the_thread;
+
+  the_thread = _Thread_queue_First( &the_message_queue->Wait_queue );
+  return the_thread != NULL
+    && the_thread->Wait.option == CORE_MESSAGE_QUEUE_RECEIVE_BY_REFERENCE
+    && _Chain_Is_empty( &the_message_queue->Inactive_messages );
+}
+
+/**
+ *  This function returns true if @a the_thread waits to receive a message
+ *  by reference and false otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_message_queue_Is_receive_by_reference (
+  const Thread_Control *the_thread
+)
+{
+  return
+    (the_thread->Wait.option == CORE_MESSAGE_QUEUE_RECEIVE_BY_REFERENCE);
+}
+
+/**
+ *  This function returns true if threads wait to send a message to
+ *  @a the_message_queue and false otherwise.  A blocked sender has no
+ *  return argument.
+ *
+ *  NOTE: Senders block only if all message buffers contain pending
+ *        messages.  Receivers block only if no message is pending.  Thus
+ *        senders and receivers wait at the same time only if the
+ *        application holds all message buffers.  In this case a receiver
+ *        must not block.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_message_queue_Has_waiting_senders (
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  #if defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+    Thread_Control *the_thread;
+
+    the_thread = _Thread_queue_First( &the_message_queue->Wait_queue );
+    return ( the_thread != NULL && the_thread->Wait.return_argument == NULL );
+  #else
+    return false;
+  #endif
 }
 
 /**
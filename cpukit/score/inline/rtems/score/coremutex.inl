@@ -6,7 +6,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2009.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -40,7 +40,7 @@ RTEMS_INLINE_ROUTINE bool _CORE_mutex_Is_locked(
   CORE_mutex_Control  *the_mutex
 )
 {
-  return the_mutex->lock == CORE_MUTEX_LOCKED;
+  return the_mutex->lock != CORE_MUTEX_UNLOCKED;
 }
  
 /**
@@ -113,6 +113,26 @@ RTEMS_INLINE_ROUTINE bool _CORE_mutex_Is_priority_ceiling(
   return the_attribute->discipline == CORE_MUTEX_DISCIPLINES_PRIORITY_CEILING;
 }
  
+/**
+ *  @brief Does Mutex Use Fast Path
+ *
+ *  This routine returns true if the mutex may be obtained and released
+ *  with a single compare and swap operation on its lock field and false
+ *  otherwise.  This is the case if the holder needs no priority
+ *  adjustment, e.g. for the FIFO and PRIORITY disciplines.
+ *
+ *  @param[in] the_attribute is the attribute set of the mutex
+ *
+ *  @return This method returns true if the mutex has a fast path.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_mutex_Has_fast_path(
+  CORE_mutex_Attributes *the_attribute
+)
+{
+  return _CORE_mutex_Is_fifo( the_attribute ) ||
+    _CORE_mutex_Is_priority( the_attribute );
+}
+
 /*
  *  Seize Mutex with Quick Success Path
  *
@@ -133,8 +153,11 @@ RTEMS_INLINE_ROUTINE int _CORE_mutex_Seize_interrupt_trylock_body(
 
   executing = _Thread_Executing;
   executing->Wait.return_code = CORE_MUTEX_STATUS_SUCCESSFUL;
-  if ( !_CORE_mutex_Is_locked( the_mutex ) ) {
-    the_mutex->lock       = CORE_MUTEX_LOCKED;
+  if ( _Atomic_Compare_and_swap_uint32(
+         &the_mutex->lock,
+         CORE_MUTEX_UNLOCKED,
+         CORE_MUTEX_LOCKED
+       ) ) {
     the_mutex->holder     = executing;
     the_mutex->holder_id  = executing->Object.id;
     the_mutex->nest_count = 1;
@@ -221,6 +244,97 @@ RTEMS_INLINE_ROUTINE int _CORE_mutex_Seize_interrupt_trylock_body(
   return 1;
 }
 
+/**
+ *  @brief Mark Mutex as Contended
+ *
+ *  This routine marks @a the_mutex as contended before the calling thread
+ *  blocks on it, so that the holder uses the thread queue to release it.
+ *  The mutex may be released after a failed trylock.  In this case the
+ *  caller obtains it instead.
+ *
+ *  @param[in] the_mutex is the mutex to mark
+ *  @param[in] level_p is the interrupt level holder
+ *
+ *  @retval true The mutex is contended and the caller must block.
+ *          Interrupts are still disabled.
+ *  @retval false The trylock was done again and the caller must not block.
+ *          Interrupts are enabled.
+ *
+ *  @note Interrupts and thread dispatching must be disabled on entry.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_mutex_Set_contended(
+  CORE_mutex_Control  *the_mutex,
+  ISR_Level           *level_p
+)
+{
+  while ( true ) {
+    if ( _Atomic_Compare_and_swap_uint32(
+           &the_mutex->lock,
+           CORE_MUTEX_LOCKED,
+           CORE_MUTEX_CONTENDED
+         ) || the_mutex->lock == CORE_MUTEX_CONTENDED )
+      return true;
+
+    if ( !_CORE_mutex_Seize_interrupt_trylock( the_mutex, level_p ) )
+      return false;
+  }
+}
+
+/**
+ *  @brief Surrender Mutex with Quick Success Path
+ *
+ *  This routine releases @a the_mutex if the executing thread holds it
+ *  once and no thread may wait for it.  In this case the release is a
+ *  single compare and swap operation on the lock field and the thread
+ *  dispatch disable lock is not needed.
+ *
+ *  @param[in] the_mutex is the mutex to surrender
+ *  @param[in] level_p is the interrupt level holder
+ *
+ *  @retval true The mutex is released and interrupts are enabled.
+ *  @retval false The fast path is not possible.  Interrupts are still
+ *          disabled.  The caller must use _CORE_mutex_Surrender() with
+ *          thread dispatching disabled.
+ *
+ *  @note Interrupts must be disabled on entry.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_mutex_Fast_surrender(
+  CORE_mutex_Control  *the_mutex,
+  ISR_Level           *level_p
+)
+{
+  Thread_Control *executing;
+
+  executing = _Thread_Executing;
+  if ( !_CORE_mutex_Has_fast_path( &the_mutex->Attributes ) ||
+       the_mutex->holder != executing ||
+       the_mutex->nest_count != 1 ||
+       the_mutex->lock != CORE_MUTEX_LOCKED )
+    return false;
+
+  /*
+   *  The holder must be cleared before the mutex is released, otherwise
+   *  the nesting check of the next trylock may see a stale holder.
+   */
+  the_mutex->holder     = NULL;
+  the_mutex->holder_id  = 0;
+  the_mutex->nest_count = 0;
+  if ( !_Atomic_Compare_and_swap_uint32(
+         &the_mutex->lock,
+         CORE_MUTEX_LOCKED,
+         CORE_MUTEX_UNLOCKED
+       ) ) {
+    /* A thread started to wait in the meantime */
+    the_mutex->holder     = executing;
+    the_mutex->holder_id  = executing->Object.id;
+    the_mutex->nest_count = 1;
+    return false;
+  }
+  _ISR_Enable( *level_p );
+
+  return true;
+}
+
 /**@}*/
 
 #endif
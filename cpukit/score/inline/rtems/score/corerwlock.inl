@@ -28,6 +28,11 @@
 
 #include <rtems/score/thread.h>
 #include <rtems/score/threadq.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/isr.h>
+#if defined(RTEMS_SMP)
+  #include <rtems/bspsmp.h>
+#endif
 
 /**
  *
@@ -40,6 +45,142 @@ RTEMS_INLINE_ROUTINE void _CORE_RWLock_Initialize_attributes(
 )
 {
   the_attributes->XXX = 0;
+  the_attributes->big_reader = false;
+}
+
+#if defined(RTEMS_SMP)
+/**
+ *  This function returns true if the readers of the RWLock are counted
+ *  per processor.
+ *
+ *  @param[in] the_rwlock is the RWLock to check
+ *
+ *  @return This method returns true if the RWLock is a big reader RWLock.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_RWLock_Is_big_reader(
+  CORE_RWLock_Control *the_rwlock
+)
+{
+  return the_rwlock->per_cpu_readers != NULL;
+}
+
+/**
+ *  This routine adds @a delta to the reader counter of the current
+ *  processor for a big reader RWLock.  The compare and swap orders the
+ *  counter update before the following loads.
+ *
+ *  @param[in] the_rwlock is the RWLock to change
+ *  @param[in] delta is the value to add to the reader counter
+ *
+ *  @note Interrupts must be disabled.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_RWLock_Big_reader_Add(
+  CORE_RWLock_Control *the_rwlock,
+  uint32_t             delta
+)
+{
+  volatile uint32_t *readers =
+    &the_rwlock->per_cpu_readers[ bsp_smp_processor_id() ].readers;
+  uint32_t           value;
+  bool               done;
+
+  do {
+    value = *readers;
+    done = _Atomic_Compare_and_swap_uint32( readers, value, value + delta );
+  } while ( !done );
+}
+#endif
+
+/**
+ *  This routine attempts to obtain a big reader RWLock for reading without
+ *  the thread dispatch disable lock.  Only the reader counter of the
+ *  current processor is changed.
+ *
+ *  @param[in] the_rwlock is the RWLock to obtain
+ *  @param[in] level_p is the interrupt level of the caller
+ *
+ *  @return This method returns true if the RWLock was obtained and
+ *          interrupts are enabled.  It returns false if the caller must
+ *          use _CORE_RWLock_Obtain_for_reading(), and interrupts are
+ *          still disabled.
+ *
+ *  @note Interrupts must be disabled.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_RWLock_Fast_obtain_for_reading(
+  CORE_RWLock_Control *the_rwlock,
+  ISR_Level           *level_p
+)
+{
+#if defined(RTEMS_SMP)
+  if ( !_CORE_RWLock_Is_big_reader( the_rwlock ) ||
+       !the_rwlock->readers_may_proceed )
+    return false;
+
+  _CORE_RWLock_Big_reader_Add( the_rwlock, 1 );
+
+  /*
+   *  A writer clears the flag before it sums up the reader counters, so
+   *  either the writer sees our count or we see the cleared flag.
+   */
+  if ( the_rwlock->readers_may_proceed ) {
+    _ISR_Enable( *level_p );
+    return true;
+  }
+
+  /*
+   *  Back off.  The slow path hands the RWLock over to the writer in case
+   *  it waits for our count to drain.
+   */
+  _CORE_RWLock_Big_reader_Add( the_rwlock, (uint32_t) -1 );
+#endif
+
+  return false;
+}
+
+/**
+ *  This routine releases a big reader RWLock held for reading without the
+ *  thread dispatch disable lock, unless a writer waits for the readers to
+ *  drain.
+ *
+ *  @param[in] the_rwlock is the RWLock to release
+ *  @param[in] level_p is the interrupt level of the caller
+ *
+ *  @return This method returns true if the RWLock was released and
+ *          interrupts are enabled.  It returns false if the caller must
+ *          use _CORE_RWLock_Release(), and interrupts are still disabled.
+ *
+ *  @note Interrupts must be disabled.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_RWLock_Fast_release(
+  CORE_RWLock_Control *the_rwlock,
+  ISR_Level           *level_p
+)
+{
+#if defined(RTEMS_SMP)
+  /*
+   *  Without readers the caller does not hold the RWLock.  The slow path
+   *  reports this.
+   */
+  if ( !_CORE_RWLock_Is_big_reader( the_rwlock ) ||
+       the_rwlock->current_state == CORE_RWLOCK_LOCKED_FOR_WRITING ||
+       _CORE_RWLock_Big_reader_Count( the_rwlock ) == 0 )
+    return false;
+
+  _CORE_RWLock_Big_reader_Add( the_rwlock, (uint32_t) -1 );
+
+  if ( the_rwlock->readers_may_proceed ) {
+    _ISR_Enable( *level_p );
+    return true;
+  }
+
+  _Thread_Disable_dispatch();
+  _ISR_Enable( *level_p );
+  _CORE_RWLock_Big_reader_Grant( the_rwlock );
+  _Thread_Enable_dispatch();
+  return true;
+#else
+  return false;
+#endif
 }
 
 
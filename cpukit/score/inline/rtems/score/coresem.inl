@@ -56,6 +56,64 @@ RTEMS_INLINE_ROUTINE uint32_t  _CORE_semaphore_Get_count(
   return the_semaphore->count;
 }
 
+/**
+ *  This routine takes a unit from @a the_semaphore if the count is not
+ *  zero.  This is a compare and swap operation on the count, so no lock
+ *  is needed.
+ *
+ *  @param[in] the_semaphore is the semaphore to take a unit from
+ *  @return true if a unit was taken, false if the count is zero
+ *
+ *  @note Interrupts must be disabled on entry.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_semaphore_Take_unit(
+  CORE_semaphore_Control  *the_semaphore
+)
+{
+  uint32_t count;
+
+  do {
+    count = the_semaphore->count;
+    if ( count == 0 )
+      return false;
+  } while ( !_Atomic_Compare_and_swap_uint32(
+              &the_semaphore->count,
+              count,
+              count - 1
+            ) );
+
+  return true;
+}
+
+/**
+ *  This routine returns a unit to @a the_semaphore if the count is less
+ *  than the maximum count.
+ *
+ *  @param[in] the_semaphore is the semaphore to return a unit to
+ *  @return true if a unit was returned, false if the maximum count is
+ *          reached
+ *
+ *  @note Interrupts must be disabled on entry.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_semaphore_Return_unit(
+  CORE_semaphore_Control  *the_semaphore
+)
+{
+  uint32_t count;
+
+  do {
+    count = the_semaphore->count;
+    if ( count >= the_semaphore->Attributes.maximum_count )
+      return false;
+  } while ( !_Atomic_Compare_and_swap_uint32(
+              &the_semaphore->count,
+              count,
+              count + 1
+            ) );
+
+  return true;
+}
+
 /**
  *  This routine attempts to receive a unit from the_semaphore.
  *  If a unit is available or if the wait flag is false, then the routine
@@ -80,13 +138,13 @@ RTEMS_INLINE_ROUTINE void _CORE_semaphore_Seize_isr_disable(
 ) 
 { 
   Thread_Control *executing;
+  ISR_Level       lock_level;
 
   /* disabled when you get here */
   
   executing = _Thread_Executing;
   executing->Wait.return_code = CORE_SEMAPHORE_STATUS_SUCCESSFUL;
-  if ( the_semaphore->count != 0 ) {
-    the_semaphore->count -= 1;
+  if ( _CORE_semaphore_Take_unit( the_semaphore ) ) {
     _ISR_Enable( *level_p );
     return;
   }
@@ -97,16 +155,75 @@ RTEMS_INLINE_ROUTINE void _CORE_semaphore_Seize_isr_disable(
     return;
   }
 
+  /*
+   *  The thread dispatch disable lock must be obtained before the thread
+   *  queue lock.  A unit may be surrendered in the meantime, so check the
+   *  count again.
+   */
   _Thread_Disable_dispatch();
+  _Thread_queue_Lock( &the_semaphore->Wait_queue, &lock_level );
+  if ( _CORE_semaphore_Take_unit( the_semaphore ) ) {
+    _Thread_queue_Unlock( &the_semaphore->Wait_queue, lock_level );
+    _ISR_Enable( *level_p );
+    _Thread_Enable_dispatch();
+    return;
+  }
+
+  the_semaphore->may_have_waiters = true;
   _Thread_queue_Enter_critical_section( &the_semaphore->Wait_queue );
   executing->Wait.queue          = &the_semaphore->Wait_queue;
   executing->Wait.id             = id;
+  _Thread_queue_Unlock( &the_semaphore->Wait_queue, lock_level );
   _ISR_Enable( *level_p );
 
   _Thread_queue_Enqueue( &the_semaphore->Wait_queue, timeout );
   _Thread_Enable_dispatch();
 }
 
+/**
+ *  This routine surrenders a unit to @a the_semaphore if no thread may wait
+ *  on it.  In this case neither a thread must be unblocked nor thread
+ *  dispatching disabled, so only the thread queue lock is obtained.
+ *  Semaphore operations on distinct semaphores proceed in parallel on
+ *  different processors.
+ *
+ *  @param[in] the_semaphore is the semaphore to surrender
+ *  @param[in] level_p is a pointer to the interrupt level of the caller
+ *  @param[out] status_p is the status of the surrender operation
+ *
+ *  @retval true The surrender is done and interrupts are enabled.  The
+ *          status is returned in @a status_p.
+ *  @retval false A thread may wait on the semaphore.  Interrupts are still
+ *          disabled.  The caller must use _CORE_semaphore_Surrender() with
+ *          thread dispatching disabled.
+ *
+ *  @note Interrupts must be disabled on entry.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_semaphore_Fast_surrender(
+  CORE_semaphore_Control  *the_semaphore,
+  ISR_Level               *level_p,
+  CORE_semaphore_Status   *status_p
+)
+{
+  ISR_Level lock_level;
+
+  _Thread_queue_Lock( &the_semaphore->Wait_queue, &lock_level );
+  if ( the_semaphore->may_have_waiters ) {
+    _Thread_queue_Unlock( &the_semaphore->Wait_queue, lock_level );
+    return false;
+  }
+
+  if ( _CORE_semaphore_Return_unit( the_semaphore ) ) {
+    *status_p = CORE_SEMAPHORE_STATUS_SUCCESSFUL;
+  } else {
+    *status_p = CORE_SEMAPHORE_MAXIMUM_COUNT_EXCEEDED;
+  }
+  _Thread_queue_Unlock( &the_semaphore->Wait_queue, lock_level );
+  _ISR_Enable( *level_p );
+
+  return true;
+}
+
 /**@}*/
 
 #endif
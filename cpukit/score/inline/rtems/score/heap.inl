@@ -87,6 +87,247 @@ RTEMS_INLINE_ROUTINE void _Heap_Free_list_insert_after(
   next->prev = new_block;
 }
 
+RTEMS_INLINE_ROUTINE bool _Heap_Is_segregated_fit( const Heap_Control *heap )
+{
+  return heap->segregated_fit != NULL;
+}
+
+/**
+ * @brief Returns the position of the most significant bit of @a value.
+ *
+ * The @a value must not be zero.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Heap_Most_significant_bit( uintptr_t value )
+{
+  return (uint32_t) (8 * sizeof( unsigned long ) - 1)
+    - (uint32_t) __builtin_clzl( (unsigned long) value );
+}
+
+/**
+ * @brief Returns the size class index of a free block of size @a block_size.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Heap_Segregated_fit_index(
+  const Heap_Segregated_fit *segregated_fit,
+  uintptr_t block_size
+)
+{
+  uint32_t const offset = segregated_fit->first_level_offset;
+  uint32_t first_level = _Heap_Most_significant_bit( block_size );
+  uint32_t second_level = 0;
+
+  if ( first_level < offset ) {
+    return 0;
+  }
+
+  first_level -= offset;
+  if ( first_level >= segregated_fit->first_level_count ) {
+    return segregated_fit->first_level_count
+      * HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT - 1;
+  }
+
+  second_level = (uint32_t) (block_size
+    >> (first_level + offset - HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2))
+    & (HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT - 1);
+
+  return (first_level << HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2)
+    | second_level;
+}
+
+/**
+ * @brief Returns the index of the first non-empty free list with an index
+ * greater than or equal to @a index.
+ *
+ * Returns the free list count if no such free list exists.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Heap_Segregated_fit_find(
+  const Heap_Segregated_fit *segregated_fit,
+  uint32_t index
+)
+{
+  uint32_t first_level = index >> HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2;
+  uint32_t map = 0;
+
+  if ( first_level < segregated_fit->first_level_count ) {
+    map = segregated_fit->second_level_bitmap [first_level]
+      & (~0U << (index & (HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT - 1)));
+  }
+
+  if ( map == 0 ) {
+    if ( first_level + 1 < HEAP_SEGREGATED_FIT_FIRST_LEVEL_MAXIMUM ) {
+      map = segregated_fit->first_level_bitmap & (~0U << (first_level + 1));
+    }
+
+    if ( map == 0 ) {
+      return segregated_fit->first_level_count
+        * HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT;
+    }
+
+    first_level = (uint32_t) __builtin_ctz( map );
+    map = segregated_fit->second_level_bitmap [first_level];
+  }
+
+  return (first_level << HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2)
+    | (uint32_t) __builtin_ctz( map );
+}
+
+/**
+ * @brief Returns the count of free lists of the heap @a heap.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Heap_Free_list_count(
+  const Heap_Control *heap
+)
+{
+  const Heap_Segregated_fit *const segregated_fit = heap->segregated_fit;
+
+  if ( segregated_fit == NULL ) {
+    return 1;
+  } else {
+    return segregated_fit->first_level_count
+      * HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT;
+  }
+}
+
+/**
+ * @brief Returns the head of the free list with index @a index.
+ *
+ * @see _Heap_Free_list_count().
+ */
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_Free_list_head_at(
+  Heap_Control *heap,
+  uint32_t index
+)
+{
+  Heap_Segregated_fit *const segregated_fit = heap->segregated_fit;
+
+  if ( segregated_fit == NULL ) {
+    return &heap->free_list;
+  } else {
+    return &segregated_fit->free_lists [index];
+  }
+}
+
+/**
+ * @brief Returns the head of the free list which contains the free blocks of
+ * size @a block_size.
+ */
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_Free_list_head_of_size(
+  Heap_Control *heap,
+  uintptr_t block_size
+)
+{
+  Heap_Segregated_fit *const segregated_fit = heap->segregated_fit;
+
+  if ( segregated_fit == NULL ) {
+    return &heap->free_list;
+  } else {
+    return &segregated_fit->free_lists [
+      _Heap_Segregated_fit_index( segregated_fit, block_size )
+    ];
+  }
+}
+
+/**
+ * @brief Inserts the free block @a block of size @a block_size into the free
+ * lists.
+ *
+ * In case the first fit method is used, the block will be inserted after
+ * @a free_list_anchor, otherwise the block will be inserted at the begin of
+ * the free list of its size class.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_insert(
+  Heap_Control *heap,
+  Heap_Block *free_list_anchor,
+  Heap_Block *block,
+  uintptr_t block_size
+)
+{
+  Heap_Segregated_fit *const segregated_fit = heap->segregated_fit;
+
+  if ( segregated_fit == NULL ) {
+    _Heap_Free_list_insert_after( free_list_anchor, block );
+  } else {
+    uint32_t const index =
+      _Heap_Segregated_fit_index( segregated_fit, block_size );
+    uint32_t const first_level = index >> HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2;
+
+    _Heap_Free_list_insert_after( &segregated_fit->free_lists [index], block );
+
+    segregated_fit->second_level_bitmap [first_level] |=
+      1U << (index & (HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT - 1));
+    segregated_fit->first_level_bitmap |= 1U << first_level;
+  }
+}
+
+/**
+ * @brief Extracts the free block @a block from the free lists.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_extract(
+  Heap_Control *heap,
+  Heap_Block *block
+)
+{
+  Heap_Segregated_fit *const segregated_fit = heap->segregated_fit;
+  Heap_Block *next = block->next;
+  Heap_Block *prev = block->prev;
+
+  _Heap_Free_list_remove( block );
+
+  /*
+   * The previous and next block of the extracted block are only equal if the
+   * free list is empty now.  In this case both are the free list head.
+   */
+  if ( segregated_fit != NULL && next == prev ) {
+    uint32_t const index = (uint32_t) (prev - segregated_fit->free_lists);
+    uint32_t const first_level = index >> HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2;
+    uint32_t const map = segregated_fit->second_level_bitmap [first_level]
+      & ~(1U << (index & (HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT - 1)));
+
+    segregated_fit->second_level_bitmap [first_level] = map;
+    if ( map == 0 ) {
+      segregated_fit->first_level_bitmap &= ~(1U << first_level);
+    }
+  }
+}
+
+/**
+ * @brief Replaces the free block @a old_block with the free block
+ * @a new_block of size @a new_block_size in the free lists.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_replace(
+  Heap_Control *heap,
+  Heap_Block *old_block,
+  Heap_Block *new_block,
+  uintptr_t new_block_size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Free_block_extract( heap, old_block );
+    _Heap_Free_block_insert( heap, NULL, new_block, new_block_size );
+  } else {
+    _Heap_Free_list_replace( old_block, new_block );
+  }
+}
+
+/**
+ * @brief Updates the free lists after a size change of the free block
+ * @a block to @a new_block_size.
+ *
+ * The position of a free block in the first fit free list is independent of
+ * its size, so this is only necessary for the two-level segregated fit
+ * method.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_resize(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t new_block_size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Free_block_extract( heap, block );
+    _Heap_Free_block_insert( heap, NULL, block, new_block_size );
+  }
+}
+
 RTEMS_INLINE_ROUTINE bool _Heap_Is_aligned(
   uintptr_t value,
   uintptr_t alignment
@@ -6,7 +6,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2011.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -215,7 +215,8 @@ RTEMS_INLINE_ROUTINE Objects_Control *_Objects_Get_local_object(
     if ( index > information->maximum )
       return NULL;
   #endif
-  return information->local_table[ index ];
+  return information->local_table[ index >> information->local_table_shift ]
+    [ index & information->local_table_mask ];
 }
 
 /**
@@ -248,7 +249,48 @@ RTEMS_INLINE_ROUTINE void _Objects_Set_local_object(
       return;
   #endif
 
-  information->local_table[ index ] = the_object;
+  information->local_table[ index >> information->local_table_shift ]
+    [ index & information->local_table_mask ] = the_object;
+}
+
+/**
+ *  This function returns the control block of the object block with the
+ *  specified block number.
+ *
+ *  @param[in] information points to an Object Information Table
+ *  @param[in] block is the number of the object block
+ *
+ *  @return This method returns a pointer to the object block control.
+ *
+ *  @note The object block table must contain the block.
+ */
+RTEMS_INLINE_ROUTINE Objects_Block *_Objects_Get_block(
+  Objects_Information *information,
+  uint32_t             block
+)
+{
+  uint32_t       shift = information->object_blocks_shift;
+  Objects_Block *page = information->object_blocks[ block >> shift ];
+
+  return &page[ block & information->object_blocks_mask ];
+}
+
+/**
+ *  This function returns the number of the object block containing the
+ *  object with the specified index.
+ *
+ *  @param[in] information points to an Object Information Table
+ *  @param[in] index is the index of the object
+ *
+ *  @return This method returns the object block number.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Objects_Get_block_number(
+  Objects_Information *information,
+  uint32_t             index
+)
+{
+  return (index - _Objects_Get_index( information->minimum_id )) /
+    information->allocation_size;
 }
 
 /**
@@ -277,6 +319,48 @@ RTEMS_INLINE_ROUTINE void _Objects_Invalidate_Id(
   );
 }
 
+/**
+ *  This function returns the name hash bucket of the 32-bit name @a name.
+ *
+ *  @param[in] information points to an Object Information Table
+ *  @param[in] name is the object name
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Objects_Name_hash_u32(
+  const Objects_Information *information,
+  uint32_t                   name
+)
+{
+  uint32_t hash = name * 0x9e3779b1U;
+
+  return (hash ^ (hash >> 16)) & information->name_hash_mask;
+}
+
+#if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
+/**
+ *  This function returns the name hash bucket of the string name @a name.
+ *  Only the significant characters of the name are hashed.
+ *
+ *  @param[in] information points to an Object Information Table
+ *  @param[in] name is the object name
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Objects_Name_hash_string(
+  const Objects_Information *information,
+  const char                *name
+)
+{
+  uint32_t hash = 2166136261U;
+  uint32_t index;
+
+  for ( index = 0 ;
+        index < information->name_length && name[ index ] != '\0' ;
+        index++ ) {
+    hash = (hash ^ (unsigned char) name[ index ]) * 16777619U;
+  }
+
+  return (hash ^ (hash >> 16)) & information->name_hash_mask;
+}
+#endif
+
 /**
  *  This function places the_object control pointer and object name
  *  in the Local Pointer and Local Name Tables, respectively.
@@ -298,6 +382,9 @@ RTEMS_INLINE_ROUTINE void _Objects_Open(
   );
 
   the_object->name = name;
+
+  if ( information->name_hash_buckets != NULL )
+    _Objects_Name_hash_insert( information, the_object );
 }
 
 /**
@@ -322,6 +409,9 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_u32(
 
   /* ASSERT: information->is_string == false */ 
   the_object->name.name_u32 = name;
+
+  if ( information->name_hash_buckets != NULL )
+    _Objects_Name_hash_insert( information, the_object );
 }
 
 /**
@@ -348,6 +438,9 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_string(
     /* ASSERT: information->is_string */ 
     the_object->name.name_p = name;
   #endif
+
+  if ( information->name_hash_buckets != NULL )
+    _Objects_Name_hash_insert( information, the_object );
 }
 
 /**
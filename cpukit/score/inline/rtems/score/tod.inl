@@ -24,6 +24,7 @@
 #include <sys/time.h> /* struct timeval */
 
 #include <rtems/score/isr.h>
+#include <rtems/score/watchdog.h>
 
 /**
  *  @addtogroup ScoreTOD 
@@ -48,6 +49,122 @@ RTEMS_INLINE_ROUTINE void _TOD_Activate( void )
   /* XXX do we need something now that we are using timespec for TOD */
 }
 
+/**
+ *  This routine begins an update of the time snapshot.  It disables
+ *  interrupts and makes the generation odd.  It returns the previous
+ *  interrupt level.
+ */
+
+RTEMS_INLINE_ROUTINE ISR_Level _TOD_Update_begin( void )
+{
+  ISR_Level level;
+
+#if defined(RTEMS_SMP)
+  level = _SMP_lock_spinlock_simple_Obtain( &_TOD.lock );
+#else
+  _ISR_Disable( level );
+#endif
+
+  ++_TOD.generation;
+  RTEMS_COMPILER_MEMORY_BARRIER();
+
+  return level;
+}
+
+/**
+ *  This routine ends an update of the time snapshot.  It makes the
+ *  generation even and restores the interrupt level.
+ */
+
+RTEMS_INLINE_ROUTINE void _TOD_Update_end( ISR_Level level )
+{
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  ++_TOD.generation;
+
+#if defined(RTEMS_SMP)
+  _SMP_lock_spinlock_simple_Release( &_TOD.lock, level );
+#else
+  _ISR_Enable( level );
+#endif
+}
+
+/**
+ *  This routine begins a read of the time snapshot.  It returns the
+ *  generation to pass to _TOD_Read_retry().
+ */
+
+RTEMS_INLINE_ROUTINE uint32_t _TOD_Read_begin( void )
+{
+  uint32_t generation = _TOD.generation;
+
+  RTEMS_COMPILER_MEMORY_BARRIER();
+
+  return generation;
+}
+
+/**
+ *  This routine returns true if the snapshot was updated since the
+ *  read began with @a generation and the read must be repeated.
+ */
+
+RTEMS_INLINE_ROUTINE bool _TOD_Read_retry( uint32_t generation )
+{
+  RTEMS_COMPILER_MEMORY_BARRIER();
+
+  return ( generation & 1 ) != 0 || generation != _TOD.generation;
+}
+
+/**
+ *  This routine advances the counter value at the last tick by the nominal
+ *  counter increments of @a ticks clock ticks.  It must be called between
+ *  _TOD_Update_begin() and _TOD_Update_end().
+ */
+
+RTEMS_INLINE_ROUTINE void _TOD_Advance_counter( uint32_t ticks )
+{
+  uint64_t at_tick;
+
+  /* the integer part wraps around like the counter */
+  at_tick = ( (uint64_t) _TOD.counter_at_tick << 32 )
+    | _TOD.counter_at_tick_fraction;
+  at_tick += (uint64_t) ticks * _TOD.counter_per_tick;
+
+  _TOD.counter_at_tick = (uint32_t) ( at_tick >> 32 );
+  _TOD.counter_at_tick_fraction = (uint32_t) at_tick;
+}
+
+/**
+ *  This routine returns the nanoseconds since the last tick.  It must be
+ *  called between _TOD_Read_begin() and _TOD_Read_retry().
+ */
+
+RTEMS_INLINE_ROUTINE uint32_t _TOD_Nanoseconds_since_tick( void )
+{
+  TOD_Counter_read_routine read = _TOD.counter_read;
+
+  if ( read != NULL ) {
+    uint32_t delta = ( (*read)() - _TOD.counter_at_tick ) & _TOD.counter_mask;
+
+    return (uint32_t) ( ( (uint64_t) delta * _TOD.counter_scale ) >> 32 );
+  }
+
+  return (*_Watchdog_Nanoseconds_since_tick_handler)();
+}
+
+/**
+ *  This routine returns the number of clock ticks of NANOSECONDS_PER_TICK
+ *  nanoseconds each until the next time of day second boundary.  The
+ *  result is at least one.
+ */
+
+RTEMS_INLINE_ROUTINE uint32_t _TOD_Ticks_until_next_second(
+  uint32_t nanoseconds_per_tick
+)
+{
+  return ( TOD_NANOSECONDS_PER_SECOND - _TOD.seconds_trigger
+    + nanoseconds_per_tick - 1 ) / nanoseconds_per_tick;
+}
+
 /**
  *  This routine returns a timeval based upon the internal timespec format TOD.
  */
@@ -56,13 +173,10 @@ RTEMS_INLINE_ROUTINE void _TOD_Get_timeval(
   struct timeval *time
 )
 {
-  ISR_Level       level;
   struct timespec now;
   suseconds_t     useconds;
 
-  _ISR_Disable(level);
-    _TOD_Get( &now );
-  _ISR_Enable(level);
+  _TOD_Get( &now );
 
   useconds = (suseconds_t)now.tv_nsec;
   useconds /= (suseconds_t)TOD_NANOSECONDS_PER_MICROSECOND;
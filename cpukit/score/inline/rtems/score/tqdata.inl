@@ -27,40 +27,54 @@
  */
 
 /**
- *  This function returns the index of the priority chain on which
- *  a thread of the_priority should be placed.
+ *  This routine is invoked to indicate that the specified thread queue is
+ *  entering a critical section.
  */
-
-RTEMS_INLINE_ROUTINE uint32_t   _Thread_queue_Header_number (
-  Priority_Control the_priority
+ 
+RTEMS_INLINE_ROUTINE void _Thread_queue_Enter_critical_section (
+  Thread_queue_Control *the_thread_queue
 )
 {
-  return (the_priority / TASK_QUEUE_DATA_PRIORITIES_PER_HEADER);
+  the_thread_queue->sync_state = THREAD_BLOCKING_OPERATION_NOTHING_HAPPENED;
 }
 
 /**
- *  This function returns true if the_priority indicates that the
- *  enqueue search should start at the front of this priority
- *  group chain, and false if the search should start at the rear.
+ *  This routine obtains the lock of the specified thread queue.  Interrupts
+ *  must be disabled on this processor.  The previous interrupt level of the
+ *  lock is returned in @a lock_level.  On uniprocessor configurations the
+ *  disabled interrupts provide the mutual exclusion and this routine does
+ *  nothing.
  */
 
-RTEMS_INLINE_ROUTINE bool _Thread_queue_Is_reverse_search (
-  Priority_Control the_priority
+RTEMS_INLINE_ROUTINE void _Thread_queue_Lock (
+  Thread_queue_Control *the_thread_queue,
+  ISR_Level            *lock_level
 )
 {
-  return ( the_priority & TASK_QUEUE_DATA_REVERSE_SEARCH_MASK );
+#if defined(RTEMS_SMP)
+  *lock_level = _SMP_lock_spinlock_simple_Obtain( &the_thread_queue->Lock );
+#else
+  (void) the_thread_queue;
+  (void) lock_level;
+#endif
 }
 
 /**
- *  This routine is invoked to indicate that the specified thread queue is
- *  entering a critical section.
+ *  This routine releases the lock of the specified thread queue obtained by
+ *  _Thread_queue_Lock().
  */
- 
-RTEMS_INLINE_ROUTINE void _Thread_queue_Enter_critical_section (
-  Thread_queue_Control *the_thread_queue
+
+RTEMS_INLINE_ROUTINE void _Thread_queue_Unlock (
+  Thread_queue_Control *the_thread_queue,
+  ISR_Level             lock_level
 )
 {
-  the_thread_queue->sync_state = THREAD_BLOCKING_OPERATION_NOTHING_HAPPENED;
+#if defined(RTEMS_SMP)
+  _SMP_lock_spinlock_simple_Release( &the_thread_queue->Lock, lock_level );
+#else
+  (void) the_thread_queue;
+  (void) lock_level;
+#endif
 }
 
 /**
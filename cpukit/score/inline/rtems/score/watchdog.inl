@@ -87,32 +87,68 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Deactivate(
 
 }
 
+/**
+ *  This routine initializes the watchdog set HEADER to be empty.
+ */
+
+RTEMS_INLINE_ROUTINE void _Watchdog_Header_initialize(
+  Watchdog_Header *header
+)
+{
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+  _RBTree_Initialize_empty(
+    &header->Watchdogs,
+    _Watchdog_Compare,
+    false
+  );
+  header->current = 0;
+#else
+  _Chain_Initialize_empty( &header->Watchdogs );
+#endif
+}
+
+/**
+ *  This routine returns true if the watchdog set HEADER is empty,
+ *  and false otherwise.
+ */
+
+RTEMS_INLINE_ROUTINE bool _Watchdog_Is_empty(
+  Watchdog_Header *header
+)
+{
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+  return _RBTree_Is_empty( &header->Watchdogs );
+#else
+  return _Chain_Is_empty( &header->Watchdogs );
+#endif
+}
+
 /**
  *  This routine is invoked at each clock tick to update the ticks
- *  watchdog chain.
+ *  watchdog set.
  */
 
 RTEMS_INLINE_ROUTINE void _Watchdog_Tickle_ticks( void )
 {
 
-  _Watchdog_Tickle( &_Watchdog_Ticks_chain );
+  _Watchdog_Tickle( &_Watchdog_Ticks_header );
 
 }
 
 /**
  *  This routine is invoked at each clock tick to update the seconds
- *  watchdog chain.
+ *  watchdog set.
  */
 
 RTEMS_INLINE_ROUTINE void _Watchdog_Tickle_seconds( void )
 {
 
-  _Watchdog_Tickle( &_Watchdog_Seconds_chain );
+  _Watchdog_Tickle( &_Watchdog_Seconds_header );
 
 }
 
 /**
- *  This routine inserts THE_WATCHDOG into the ticks watchdog chain
+ *  This routine inserts THE_WATCHDOG into the ticks watchdog set
  *  for a time of UNITS ticks.  The INSERT_MODE indicates whether
  *  THE_WATCHDOG is to be activated automatically or later, explicitly
  *  by the caller.
@@ -126,12 +162,12 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Insert_ticks(
 
   the_watchdog->initial = units;
 
-  _Watchdog_Insert( &_Watchdog_Ticks_chain, the_watchdog );
+  _Watchdog_Insert( &_Watchdog_Ticks_header, the_watchdog );
 
 }
 
 /**
- *  This routine inserts THE_WATCHDOG into the seconds watchdog chain
+ *  This routine inserts THE_WATCHDOG into the seconds watchdog set
  *  for a time of UNITS seconds.  The INSERT_MODE indicates whether
  *  THE_WATCHDOG is to be activated automatically or later, explicitly
  *  by the caller.
@@ -145,12 +181,12 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Insert_seconds(
 
   the_watchdog->initial = units;
 
-  _Watchdog_Insert( &_Watchdog_Seconds_chain, the_watchdog );
+  _Watchdog_Insert( &_Watchdog_Seconds_header, the_watchdog );
 
 }
 
 /**
- *  This routine adjusts the seconds watchdog chain in the forward
+ *  This routine adjusts the seconds watchdog set in the forward
  *  or backward DIRECTION for UNITS seconds.  This is invoked when the
  *  current time of day is changed.
  */
@@ -161,12 +197,12 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Adjust_seconds(
 )
 {
 
-  _Watchdog_Adjust( &_Watchdog_Seconds_chain, direction, units );
+  _Watchdog_Adjust( &_Watchdog_Seconds_header, direction, units );
 
 }
 
 /**
- *  This routine adjusts the ticks watchdog chain in the forward
+ *  This routine adjusts the ticks watchdog set in the forward
  *  or backward DIRECTION for UNITS ticks.
  */
 
@@ -176,7 +212,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Adjust_ticks(
 )
 {
 
-  _Watchdog_Adjust( &_Watchdog_Ticks_chain, direction, units );
+  _Watchdog_Adjust( &_Watchdog_Ticks_header, direction, units );
 
 }
 
@@ -194,10 +230,93 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Reset(
 
   (void) _Watchdog_Remove( the_watchdog );
 
-  _Watchdog_Insert( &_Watchdog_Ticks_chain, the_watchdog );
+  _Watchdog_Insert( &_Watchdog_Ticks_header, the_watchdog );
 
 }
 
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+
+/**
+ *  This routine returns a pointer to the watchdog timer containing
+ *  the tree node NODE.
+ */
+
+RTEMS_INLINE_ROUTINE Watchdog_Control *_Watchdog_From_tree_node(
+  const RBTree_Node *node
+)
+{
+
+  return _RBTree_Container_of( node, Watchdog_Control, Tree_node );
+
+}
+
+/**
+ *  This routine returns a pointer to the first watchdog timer
+ *  in the watchdog set HEADER or NULL if the set is empty.
+ */
+
+RTEMS_INLINE_ROUTINE Watchdog_Control *_Watchdog_First(
+  Watchdog_Header *header
+)
+{
+  RBTree_Node *first = _RBTree_First( &header->Watchdogs, RBT_LEFT );
+
+  return first != NULL ? _Watchdog_From_tree_node( first ) : NULL;
+}
+
+/**
+ *  This routine returns a pointer to the last watchdog timer
+ *  in the watchdog set HEADER or NULL if the set is empty.
+ */
+
+RTEMS_INLINE_ROUTINE Watchdog_Control *_Watchdog_Last(
+  Watchdog_Header *header
+)
+{
+  RBTree_Node *last = _RBTree_First( &header->Watchdogs, RBT_RIGHT );
+
+  return last != NULL ? _Watchdog_From_tree_node( last ) : NULL;
+}
+
+/**
+ *  This routine returns true if THE_WATCHDOG timer expires at or before
+ *  the current time of the watchdog set HEADER.  The difference is
+ *  evaluated as a signed value so that the current time may wrap around.
+ */
+
+RTEMS_INLINE_ROUTINE bool _Watchdog_Is_expired(
+  const Watchdog_Header  *header,
+  const Watchdog_Control *the_watchdog
+)
+{
+
+  return (int64_t) ( the_watchdog->expire - header->current ) <= 0;
+
+}
+
+/**
+ *  This routine returns the interval until the first watchdog timer in
+ *  the watchdog set HEADER expires.  The set must not be empty.
+ */
+
+RTEMS_INLINE_ROUTINE Watchdog_Interval _Watchdog_First_interval(
+  Watchdog_Header *header
+)
+{
+  int64_t remaining = (int64_t)
+    ( _Watchdog_First( header )->expire - header->current );
+
+  if ( remaining <= 0 )
+    return 0;
+
+  if ( remaining > (int64_t) WATCHDOG_MAXIMUM_INTERVAL )
+    return WATCHDOG_MAXIMUM_INTERVAL;
+
+  return (Watchdog_Interval) remaining;
+}
+
+#else
+
 /**
  *  This routine returns a pointer to the watchdog timer following
  *  THE_WATCHDOG on the watchdog chain.
@@ -232,11 +351,11 @@ RTEMS_INLINE_ROUTINE Watchdog_Control *_Watchdog_Previous(
  */
 
 RTEMS_INLINE_ROUTINE Watchdog_Control *_Watchdog_First(
-  Chain_Control *header
+  Watchdog_Header *header
 )
 {
 
-  return ( (Watchdog_Control *) _Chain_First( header ) );
+  return ( (Watchdog_Control *) _Chain_First( &header->Watchdogs ) );
 
 }
 
@@ -246,14 +365,30 @@ RTEMS_INLINE_ROUTINE Watchdog_Control *_Watchdog_First(
  */
 
 RTEMS_INLINE_ROUTINE Watchdog_Control *_Watchdog_Last(
-  Chain_Control *header
+  Watchdog_Header *header
 )
 {
 
-  return ( (Watchdog_Control *) _Chain_Last( header ) );
+  return ( (Watchdog_Control *) _Chain_Last( &header->Watchdogs ) );
 
 }
 
+/**
+ *  This routine returns the interval until the first watchdog timer on
+ *  the watchdog chain HEADER expires.  The chain must not be empty.
+ */
+
+RTEMS_INLINE_ROUTINE Watchdog_Interval _Watchdog_First_interval(
+  Watchdog_Header *header
+)
+{
+
+  return _Watchdog_First( header )->delta_interval;
+
+}
+
+#endif
+
 /**@}*/
 
 #endif
@@ -0,0 +1,58 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreWorkspace
+ *
+ * @brief Workspace slab cache inlined routines.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_WKSLAB_H
+# error "Never use <rtems/score/wkslab.inl> directly; include <rtems/score/wkslab.h> instead."
+#endif
+
+#ifndef _RTEMS_SCORE_WKSLAB_INL
+#define _RTEMS_SCORE_WKSLAB_INL
+
+/**
+ * @addtogroup ScoreWorkspace
+ *
+ * @{
+ */
+
+/**
+ * @brief Returns true if the workspace slab cache @a slab is initialized.
+ */
+RTEMS_INLINE_ROUTINE bool _Workspace_Slab_Is_initialized(
+  const Workspace_Slab *slab
+)
+{
+  return slab->object_size != 0;
+}
+
+/**
+ * @brief Sets the maximum number of objects on the free list of the
+ * workspace slab cache @a slab.
+ *
+ * This must be called before the first allocation from the slab cache.
+ */
+RTEMS_INLINE_ROUTINE void _Workspace_Slab_Set_free_limit(
+  Workspace_Slab *slab,
+  uint32_t        free_limit
+)
+{
+  slab->free_limit = free_limit;
+}
+
+/** @} */
+
+#endif
+/* end of include file */
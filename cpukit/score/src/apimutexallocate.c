@@ -24,7 +24,8 @@ void _API_Mutex_Allocate(
     CORE_MUTEX_NESTING_ACQUIRES,
     false,
     CORE_MUTEX_DISCIPLINES_PRIORITY_INHERIT,
-    0
+    0,
+    false
   };
 
   mutex = (API_Mutex_Control *) _Objects_Allocate( &_API_Mutex_Information );
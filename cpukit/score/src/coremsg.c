@@ -7,7 +7,7 @@
  *  This core object provides task synchronization and communication functions
  *  via messages passed to queue objects.
  *
- *  COPYRIGHT (c) 1989-2009.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -95,13 +95,16 @@ bool _CORE_message_queue_Initialize(
   if (allocated_message_size < maximum_message_size)
     return false;
 
+  the_message_queue->message_buffer_size =
+    allocated_message_size + sizeof( CORE_message_queue_Buffer_control );
+
   /*
    *  Calculate how much total memory is required for message buffering and
    *  check for overflow on the multiplication.
    */
   if ( !size_t_mult32_with_overflow(
         (size_t) maximum_pending_messages,
-        allocated_message_size + sizeof(CORE_message_queue_Buffer_control),
+        the_message_queue->message_buffer_size,
         &message_buffering_required ) ) 
     return false;
 
@@ -122,7 +125,7 @@ bool _CORE_message_queue_Initialize(
     &the_message_queue->Inactive_messages,
     the_message_queue->message_buffers,
     (size_t) maximum_pending_messages,
-    allocated_message_size + sizeof( CORE_message_queue_Buffer_control )
+    the_message_queue->message_buffer_size
   );
 
   _Chain_Initialize_empty( &the_message_queue->Pending_messages );
@@ -7,7 +7,7 @@
  *  This core object provides task synchronization and communication functions
  *  via messages passed to queue objects.
  *
- *  COPYRIGHT (c) 1989-2008.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -79,7 +79,8 @@ CORE_message_queue_Status _CORE_message_queue_Broadcast(
    *        the message to threads waiting to receive -- not to send.
    */
 
-  if ( the_message_queue->number_of_pending_messages != 0 ) {
+  if ( the_message_queue->number_of_pending_messages != 0 ||
+       _CORE_message_queue_Has_waiting_senders( the_message_queue ) ) {
     *count = 0;
     return CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
   }
@@ -89,16 +90,46 @@ CORE_message_queue_Status _CORE_message_queue_Broadcast(
    *  receive a message.
    */
   number_broadcasted = 0;
-  while ((the_thread =
-          _Thread_queue_Dequeue(&the_message_queue->Wait_queue))) {
+  while ( true ) {
+    void *destination;
+
+    /*
+     *  A thread receiving by reference needs a message buffer.  If the
+     *  application holds all message buffers, then the broadcast stops
+     *  with an error and the remaining receivers keep waiting.
+     */
+    if ( _CORE_message_queue_Is_receiver_without_buffer( the_message_queue ) ) {
+      *count = number_broadcasted;
+      return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+    }
+
+    the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
+    if ( the_thread == NULL )
+      break;
+
     waitp = &the_thread->Wait;
+    destination = waitp->return_argument_second.mutable_object;
+
+    /*
+     *  A thread receiving by reference needs a message buffer.
+     */
+    if ( _CORE_message_queue_Is_receive_by_reference( the_thread ) ) {
+      CORE_message_queue_Buffer_control *the_message;
+
+      the_message =
+        _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+      if ( !the_message ) {
+        waitp->return_code = CORE_MESSAGE_QUEUE_STATUS_UNSATISFIED;
+        *count = number_broadcasted;
+        return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+      }
+      *(void **) destination = the_message->Contents.buffer;
+      destination = the_message->Contents.buffer;
+    }
+
     number_broadcasted += 1;
 
-    _CORE_message_queue_Copy_buffer(
-      buffer,
-      waitp->return_argument_second.mutable_object,
-      size
-    );
+    _CORE_message_queue_Copy_buffer( buffer, destination, size );
 
     *(size_t *) the_thread->Wait.return_argument = size;
 
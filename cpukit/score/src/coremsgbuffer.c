@@ -0,0 +1,134 @@
+/*
+ *  CORE Message Queue Handler
+ *
+ *  DESCRIPTION:
+ *
+ *  This package is the implementation of the CORE Message Queue Handler.
+ *  This core object provides task synchronization and communication functions
+ *  via messages passed to queue objects.
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stddef.h>
+
+#include <rtems/system.h>
+#include <rtems/score/chain.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/object.h>
+#include <rtems/score/coremsg.h>
+#include <rtems/score/states.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/threadq.h>
+
+/*
+ *  _CORE_message_queue_Get_buffer_control
+ *
+ *  This function returns the message buffer control of a message buffer
+ *  of the message queue.
+ *
+ *  Input parameters:
+ *    the_message_queue - pointer to message queue
+ *    buffer            - address of the message
+ *
+ *  Output parameters:
+ *    returns - message buffer control
+ *    NULL    - if buffer is not a message buffer of the message queue or
+ *              the message buffer is not held by the application
+ */
+
+CORE_message_queue_Buffer_control *_CORE_message_queue_Get_buffer_control(
+  CORE_message_queue_Control *the_message_queue,
+  void                       *buffer
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+  uintptr_t                          begin;
+  uintptr_t                          offset;
+
+  begin  = (uintptr_t) the_message_queue->message_buffers;
+  offset = (uintptr_t) buffer
+    - offsetof( CORE_message_queue_Buffer_control, Contents.buffer );
+
+  if ( offset < begin )
+    return NULL;
+
+  offset -= begin;
+
+  if ( offset % the_message_queue->message_buffer_size != 0 )
+    return NULL;
+
+  if ( offset / the_message_queue->message_buffer_size >=
+       the_message_queue->maximum_pending_messages )
+    return NULL;
+
+  the_message = (CORE_message_queue_Buffer_control *) (begin + offset);
+
+  /*
+   *  Only message buffers held by the application are off chain.  This
+   *  detects a message buffer which is returned or sent twice.
+   */
+  if ( !_Chain_Is_node_off_chain( &the_message->Node ) )
+    return NULL;
+
+  return the_message;
+}
+
+/*
+ *  _CORE_message_queue_Return_buffer
+ *
+ *  This routine returns a message buffer held by the application.  The
+ *  message of a blocked sender is placed in the message buffer, otherwise
+ *  the message buffer is freed.
+ *
+ *  Input parameters:
+ *    the_message_queue - pointer to message queue
+ *    the_message       - message buffer to return
+ *
+ *  Output parameters:  NONE
+ */
+
+void _CORE_message_queue_Return_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message
+)
+{
+  #if defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+    Thread_Control *the_thread;
+
+    if ( _CORE_message_queue_Has_waiting_senders( the_message_queue ) ) {
+      the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
+      if ( the_thread ) {
+        /*
+         *  There was a thread waiting to send a message.  This code
+         *  puts the message in the message queue on behalf of the
+         *  waiting task.
+         */
+        the_message->Contents.size = (size_t) the_thread->Wait.option;
+        _CORE_message_queue_Copy_buffer(
+          the_thread->Wait.return_argument_second.immutable_object,
+          the_message->Contents.buffer,
+          the_message->Contents.size
+        );
+
+        _CORE_message_queue_Insert_message(
+           the_message_queue,
+           the_message,
+           (CORE_message_queue_Submit_types) the_thread->Wait.count
+        );
+        return;
+      }
+    }
+  #endif
+
+  _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+}
@@ -7,7 +7,7 @@
  *  This core object provides task synchronization and communication functions
  *  via messages passed to queue objects.
  *
- *  COPYRIGHT (c) 1989-2007.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -136,6 +136,16 @@ void _CORE_message_queue_Seize(
     #endif
   }
 
+  /*
+   *  The application holds all message buffers and senders are blocked.
+   *  Receivers must not wait in this case.
+   */
+  if ( _CORE_message_queue_Has_waiting_senders( the_message_queue ) ) {
+    _ISR_Enable( level );
+    executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_UNSATISFIED;
+    return;
+  }
+
   if ( !wait ) {
     _ISR_Enable( level );
     executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_UNSATISFIED_NOWAIT;
@@ -147,6 +157,7 @@ void _CORE_message_queue_Seize(
   executing->Wait.id = id;
   executing->Wait.return_argument_second.mutable_object = buffer;
   executing->Wait.return_argument = size_p;
+  executing->Wait.option = CORE_MESSAGE_QUEUE_RECEIVE_BY_COPY;
   /* Wait.count will be filled in with the message priority */
   _ISR_Enable( level );
 
@@ -0,0 +1,112 @@
+/*
+ *  CORE Message Queue Handler
+ *
+ *  DESCRIPTION:
+ *
+ *  This package is the implementation of the CORE Message Queue Handler.
+ *  This core object provides task synchronization and communication functions
+ *  via messages passed to queue objects.
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/chain.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/object.h>
+#include <rtems/score/coremsg.h>
+#include <rtems/score/states.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/threadq.h>
+
+/*
+ *  _CORE_message_queue_Seize_buffer
+ *
+ *  This kernel routine dequeues a message and hands its message buffer to
+ *  the caller without a copy of the message.  The thread will be blocked if
+ *  wait is true, otherwise an error will be given to the thread if no
+ *  messages are available.
+ *
+ *  A thread waiting to send a message is not unblocked since the message
+ *  buffer is held by the caller.  It is unblocked when a message buffer
+ *  is returned.
+ *
+ *  Input parameters:
+ *    the_message_queue - pointer to message queue
+ *    id                - id of object we are waitig on
+ *    buffer_p          - pointer to the message address to be filled
+ *    size_p            - pointer to the message size to be filled
+ *    wait              - true if wait is allowed, false otherwise
+ *    timeout           - time to wait for a message
+ *
+ *  Output parameters:  NONE
+ *
+ *  INTERRUPT LATENCY:
+ *    available
+ *    wait
+ */
+
+void _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control      *the_message_queue,
+  Objects_Id                       id,
+  void                           **buffer_p,
+  size_t                          *size_p,
+  bool                             wait,
+  Watchdog_Interval                timeout
+)
+{
+  ISR_Level                          level;
+  CORE_message_queue_Buffer_control *the_message;
+  Thread_Control                    *executing;
+
+  executing = _Thread_Executing;
+  executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+  _ISR_Disable( level );
+  the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+  if ( the_message != NULL ) {
+    the_message_queue->number_of_pending_messages -= 1;
+    _ISR_Enable( level );
+
+    *buffer_p = the_message->Contents.buffer;
+    *size_p = the_message->Contents.size;
+    executing->Wait.count =
+      _CORE_message_queue_Get_message_priority( the_message );
+    return;
+  }
+
+  /*
+   *  The application holds all message buffers and senders are blocked.
+   *  Receivers must not wait in this case.
+   */
+  if ( _CORE_message_queue_Has_waiting_senders( the_message_queue ) ) {
+    _ISR_Enable( level );
+    executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_UNSATISFIED;
+    return;
+  }
+
+  if ( !wait ) {
+    _ISR_Enable( level );
+    executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_UNSATISFIED_NOWAIT;
+    return;
+  }
+
+  _Thread_queue_Enter_critical_section( &the_message_queue->Wait_queue );
+  executing->Wait.queue = &the_message_queue->Wait_queue;
+  executing->Wait.id = id;
+  executing->Wait.return_argument_second.mutable_object = buffer_p;
+  executing->Wait.return_argument = size_p;
+  executing->Wait.option = CORE_MESSAGE_QUEUE_RECEIVE_BY_REFERENCE;
+  /* Wait.count will be filled in with the message priority */
+  _ISR_Enable( level );
+
+  _Thread_queue_Enqueue( &the_message_queue->Wait_queue, timeout );
+}
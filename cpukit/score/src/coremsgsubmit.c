@@ -7,7 +7,7 @@
  *  This core object provides task synchronization and communication functions
  *  via messages passed to queue objects.
  *
- *  COPYRIGHT (c) 1989-2009.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -76,14 +76,35 @@ CORE_message_queue_Status _CORE_message_queue_Submit(
   /*
    *  Is there a thread currently waiting on this message queue?
    */
-  if ( the_message_queue->number_of_pending_messages == 0 ) {
+  if ( the_message_queue->number_of_pending_messages == 0 &&
+       !_CORE_message_queue_Has_waiting_senders( the_message_queue ) ) {
+    /*
+     *  A thread receiving by reference needs a message buffer.  If the
+     *  application holds all message buffers, then the message cannot be
+     *  delivered and the receiver keeps waiting.
+     */
+    if ( _CORE_message_queue_Is_receiver_without_buffer( the_message_queue ) )
+      return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+
     the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
     if ( the_thread ) {
-      _CORE_message_queue_Copy_buffer(
-        buffer,
-        the_thread->Wait.return_argument_second.mutable_object,
-        size
-      );
+      void *destination = the_thread->Wait.return_argument_second.mutable_object;
+
+      /*
+       *  A thread receiving by reference needs a message buffer.
+       */
+      if ( _CORE_message_queue_Is_receive_by_reference( the_thread ) ) {
+        the_message =
+          _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+        if ( !the_message ) {
+          the_thread->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_UNSATISFIED;
+          return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+        }
+        *(void **) destination = the_message->Contents.buffer;
+        destination = the_message->Contents.buffer;
+      }
+
+      _CORE_message_queue_Copy_buffer( buffer, destination, size );
       *(size_t *) the_thread->Wait.return_argument = size;
       the_thread->Wait.count = (uint32_t) submit_type;
 
@@ -130,6 +151,16 @@ CORE_message_queue_Status _CORE_message_queue_Submit(
       return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
     }
 
+    /*
+     *  Do NOT block if message buffers are held by the application.  A
+     *  sender may only block if all message buffers contain pending
+     *  messages, otherwise waiting senders and receivers could mix.
+     */
+    if ( the_message_queue->number_of_pending_messages !=
+         the_message_queue->maximum_pending_messages ) {
+      return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+    }
+
     /*
      *  Do NOT block on a send if the caller is in an ISR.  It is
      *  deadly to block in an ISR.
@@ -152,6 +183,7 @@ CORE_message_queue_Status _CORE_message_queue_Submit(
       _Thread_queue_Enter_critical_section( &the_message_queue->Wait_queue );
       executing->Wait.queue = &the_message_queue->Wait_queue;
       executing->Wait.id = id;
+      executing->Wait.return_argument = NULL;
       executing->Wait.return_argument_second.immutable_object = buffer;
       executing->Wait.option = (uint32_t) size;
       executing->Wait.count = submit_type;
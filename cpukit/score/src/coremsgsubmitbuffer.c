@@ -0,0 +1,118 @@
+/*
+ *  CORE Message Queue Handler
+ *
+ *  DESCRIPTION:
+ *
+ *  This package is the implementation of the CORE Message Queue Handler.
+ *  This core object provides task synchronization and communication functions
+ *  via messages passed to queue objects.
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/chain.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/object.h>
+#include <rtems/score/coremsg.h>
+#include <rtems/score/states.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/threadq.h>
+
+/*
+ *  _CORE_message_queue_Submit_buffer
+ *
+ *  This routine submits a message buffer held by the application without
+ *  a copy of the message.  A thread waiting to receive by reference gets
+ *  the message buffer.  A thread waiting to receive by copy gets a copy of
+ *  the message and the message buffer is freed.  Otherwise the message
+ *  buffer is queued as a pending message.
+ *
+ *  Input parameters:
+ *    the_message_queue            - message is submitted to this message queue
+ *    the_message                  - message buffer filled in by the caller
+ *    size                         - size in bytes of message to send
+ *    id                           - id of message queue
+ *    api_message_queue_mp_support - api specific mp support callout
+ *    submit_type                  - send or urgent message
+ *
+ *  Output parameters:
+ *    CORE_MESSAGE_QUEUE_SUCCESSFUL - if successful
+ *    error code                    - if unsuccessful
+ */
+
+CORE_message_queue_Status _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control                *the_message_queue,
+  CORE_message_queue_Buffer_control         *the_message,
+  size_t                                     size,
+  Objects_Id                                 id,
+  #if defined(RTEMS_MULTIPROCESSING)
+    CORE_message_queue_API_mp_support_callout  api_message_queue_mp_support,
+  #else
+    CORE_message_queue_API_mp_support_callout  api_message_queue_mp_support  __attribute__((unused)),
+  #endif
+  CORE_message_queue_Submit_types            submit_type
+)
+{
+  Thread_Control *the_thread;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    return CORE_MESSAGE_QUEUE_STATUS_INVALID_SIZE;
+  }
+
+  the_message->Contents.size = size;
+
+  /*
+   *  Is there a thread currently waiting on this message queue?
+   */
+  if ( the_message_queue->number_of_pending_messages == 0 &&
+       !_CORE_message_queue_Has_waiting_senders( the_message_queue ) ) {
+    the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
+    if ( the_thread ) {
+      void *destination = the_thread->Wait.return_argument_second.mutable_object;
+
+      if ( _CORE_message_queue_Is_receive_by_reference( the_thread ) ) {
+        *(void **) destination = the_message->Contents.buffer;
+      } else {
+        _CORE_message_queue_Copy_buffer(
+          the_message->Contents.buffer,
+          destination,
+          size
+        );
+        _CORE_message_queue_Free_message_buffer(
+          the_message_queue,
+          the_message
+        );
+      }
+      *(size_t *) the_thread->Wait.return_argument = size;
+      the_thread->Wait.count = (uint32_t) submit_type;
+
+      #if defined(RTEMS_MULTIPROCESSING)
+        if ( !_Objects_Is_local_id( the_thread->Object.id ) )
+          (*api_message_queue_mp_support) ( the_thread, id );
+      #endif
+      return CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+    }
+  }
+
+  /*
+   *  No one waiting on the message queue at this time, so queue the message
+   *  buffer up for a future receive.  There is always room for it since
+   *  each message buffer may be pending.
+   */
+  _CORE_message_queue_Insert_message(
+     the_message_queue,
+     the_message,
+     submit_type
+  );
+  return CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+}
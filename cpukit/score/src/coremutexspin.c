@@ -0,0 +1,107 @@
+/*
+ *  Mutex Handler -- Spin before blocking on an adaptive mutex
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/coremutex.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/timestamp.h>
+#include <rtems/score/tod.h>
+
+/*
+ *  This routine returns true if the thread executes on a processor other
+ *  than the current one.
+ */
+static bool _CORE_mutex_Is_executing_elsewhere(
+  const Thread_Control *the_thread
+)
+{
+  uint32_t self = bsp_smp_processor_id();
+  uint32_t cpu;
+
+  for ( cpu = 0 ; cpu < _SMP_Processor_count ; ++cpu ) {
+    if ( cpu != self && _Per_CPU_Information[ cpu ].executing == the_thread )
+      return true;
+  }
+
+  return false;
+}
+
+/*
+ *  _CORE_mutex_Seize_spin
+ *
+ *  This routine polls an adaptive mutex while its holder executes on
+ *  another processor.  A holder which executes is likely to release the
+ *  mutex soon, so the two context switches of a blocking obtain are
+ *  avoided.  The processors are only searched for the holder when the
+ *  holder changes.  The poll ends after the configured spin time.
+ *
+ *  Input parameters:
+ *    the_mutex - pointer to mutex control block
+ *    level_p   - pointer to the interrupt level of the caller
+ *
+ *  Output parameters:
+ *    true  - if the obtain operation is done, interrupts are enabled
+ *    false - if the caller must block, interrupts are disabled
+ */
+
+bool _CORE_mutex_Seize_spin(
+  CORE_mutex_Control  *the_mutex,
+  ISR_Level           *level_p
+)
+{
+  Thread_Control    *checked_holder = NULL;
+  Timestamp_Control  deadline;
+  Timestamp_Control  spin_time;
+  Timestamp_Control  now;
+
+  _TOD_Get_uptime( &deadline );
+  _Timestamp_Set(
+    &spin_time,
+    0,
+    rtems_configuration_smp_mutex_spin_nanoseconds
+  );
+  _Timestamp_Add_to( &deadline, &spin_time );
+
+  while ( true ) {
+    Thread_Control *holder;
+
+    if ( the_mutex->lock == CORE_MUTEX_UNLOCKED ) {
+      if ( !_CORE_mutex_Seize_interrupt_trylock( the_mutex, level_p ) )
+        return true;
+    } else {
+      /*
+       *  The holder is NULL for a short time while another processor
+       *  obtains or releases the mutex, so continue to poll in this case.
+       */
+      holder = the_mutex->holder;
+      if ( holder != NULL && holder != checked_holder ) {
+        if ( !_CORE_mutex_Is_executing_elsewhere( holder ) )
+          return false;
+        checked_holder = holder;
+      }
+    }
+
+    _TOD_Get_uptime( &now );
+    if ( _Timestamp_Greater_than( &now, &deadline ) )
+      return false;
+
+    _ISR_Enable( *level_p );
+    RTEMS_COMPILER_MEMORY_BARRIER();
+    _ISR_Disable( *level_p );
+  }
+}
@@ -22,6 +22,11 @@
 #include <rtems/score/states.h>
 #include <rtems/score/thread.h>
 #include <rtems/score/threadq.h>
+#include <rtems/score/wkspace.h>
+#if defined(RTEMS_SMP)
+  #include <string.h>
+  #include <rtems/score/smp.h>
+#endif
 
 /*
  *  _CORE_RWLock_Initialize
@@ -33,10 +38,12 @@
  *    the_rwlock            - the rwlock control block to initialize
  *    the_rwlock_attributes - the attributes specified at create time
  *
- *  Output parameters:  NONE
+ *  Output parameters:
+ *    true  - if the rwlock is initialized successfully
+ *    false - if the reader counters cannot be allocated
  */
 
-void _CORE_RWLock_Initialize(
+bool _CORE_RWLock_Initialize(
   CORE_RWLock_Control       *the_rwlock,
   CORE_RWLock_Attributes    *the_rwlock_attributes
 )
@@ -55,4 +62,22 @@ void _CORE_RWLock_Initialize(
     STATES_WAITING_FOR_RWLOCK,
     CORE_RWLOCK_TIMEOUT
   );
+
+#if defined(RTEMS_SMP)
+  the_rwlock->readers_may_proceed = false;
+  the_rwlock->per_cpu_readers = NULL;
+
+  if ( the_rwlock_attributes->big_reader ) {
+    size_t size = _SMP_Processor_count * sizeof( CORE_RWLock_Per_CPU_readers );
+
+    the_rwlock->per_cpu_readers = _Workspace_Allocate( size );
+    if ( !the_rwlock->per_cpu_readers )
+      return false;
+
+    memset( the_rwlock->per_cpu_readers, 0, size );
+    the_rwlock->readers_may_proceed = true;
+  }
+#endif
+
+  return true;
 }
@@ -0,0 +1,101 @@
+/*
+ *  SuperCore RWLock Handler -- Big reader RWLock support
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/corerwlock.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/threadq.h>
+
+/*
+ *  _CORE_RWLock_Big_reader_Count
+ *
+ *  This function sums up the reader counters of all processors.  The
+ *  counters use modulo arithmetic, so a counter may wrap around if its
+ *  readers migrated to another processor before the release.
+ *
+ *  Input parameters:
+ *    the_rwlock    - the rwlock control block to check
+ *
+ *  Output parameters:
+ *    returns       - the number of readers
+ */
+
+uint32_t _CORE_RWLock_Big_reader_Count(
+  CORE_RWLock_Control  *the_rwlock
+)
+{
+  uint32_t readers = 0;
+  uint32_t cpu;
+
+  for ( cpu = 0 ; cpu < _SMP_Processor_count ; ++cpu )
+    readers += the_rwlock->per_cpu_readers[ cpu ].readers;
+
+  return readers;
+}
+
+/*
+ *  _CORE_RWLock_Big_reader_Grant
+ *
+ *  This function hands a big reader rwlock over to the waiting threads.
+ *
+ *  Input parameters:
+ *    the_rwlock    - the rwlock control block to hand over
+ *
+ *  Output parameters:  NONE
+ */
+
+void _CORE_RWLock_Big_reader_Grant(
+  CORE_RWLock_Control  *the_rwlock
+)
+{
+  Thread_Control *next;
+  ISR_Level       level;
+
+  if ( the_rwlock->current_state == CORE_RWLOCK_LOCKED_FOR_WRITING )
+    return;
+
+  while ( 1 ) {
+    next = _Thread_queue_First( &the_rwlock->Wait_queue );
+
+    if ( !next ) {
+      the_rwlock->readers_may_proceed = true;
+      return;
+    }
+
+    if ( next->Wait.option == CORE_RWLOCK_THREAD_WAITING_FOR_WRITE ) {
+      /*
+       *  The last reader calls us again once the counters drain.
+       */
+      if ( _CORE_RWLock_Big_reader_Count( the_rwlock ) != 0 )
+        return;
+
+      the_rwlock->current_state = CORE_RWLOCK_LOCKED_FOR_WRITING;
+      _Thread_queue_Extract( &the_rwlock->Wait_queue, next );
+      return;
+    }
+
+    /*
+     *  The reader is counted on our processor on its behalf.  It releases
+     *  the rwlock on its own processor, which is fine for the sum.
+     */
+    _ISR_Disable( level );
+      _CORE_RWLock_Big_reader_Add( the_rwlock, 1 );
+    _ISR_Enable( level );
+
+    _Thread_queue_Extract( &the_rwlock->Wait_queue, next );
+  }
+}
@@ -0,0 +1,42 @@
+/*
+ *  SuperCore RWLock Handler -- Close a RWLock
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/corerwlock.h>
+#include <rtems/score/wkspace.h>
+
+/*
+ *  _CORE_RWLock_Close
+ *
+ *  This function returns the reader counters of a big reader rwlock to
+ *  the workspace.
+ *
+ *  Input parameters:
+ *    the_rwlock    - the rwlock control block to close
+ *
+ *  Output parameters:  NONE
+ */
+
+void _CORE_RWLock_Close(
+  CORE_RWLock_Control  *the_rwlock
+)
+{
+#if defined(RTEMS_SMP)
+  if ( the_rwlock->per_cpu_readers ) {
+    (void) _Workspace_Free( the_rwlock->per_cpu_readers );
+    the_rwlock->per_cpu_readers = NULL;
+  }
+#endif
+}
@@ -50,9 +50,32 @@ void _CORE_RWLock_Obtain_for_reading(
    *  If any thread is waiting, then we wait.
    */
 
+#if defined(RTEMS_SMP)
+  /*
+   *  A big reader which backed off in the fast path may have been the
+   *  last reader a waiting writer waits for.
+   */
+  if ( _CORE_RWLock_Is_big_reader( the_rwlock ) )
+    _CORE_RWLock_Big_reader_Grant( the_rwlock );
+#endif
+
   _ISR_Disable( level );
     switch ( the_rwlock->current_state ) {
       case CORE_RWLOCK_UNLOCKED:
+#if defined(RTEMS_SMP)
+        /*
+         *  The readers of a big reader rwlock are counted per processor
+         *  and they wait behind a writer waiting for the readers to drain.
+         */
+        if ( _CORE_RWLock_Is_big_reader( the_rwlock ) ) {
+          if ( _Thread_queue_First( &the_rwlock->Wait_queue ) )
+            break;
+          _CORE_RWLock_Big_reader_Add( the_rwlock, 1 );
+          _ISR_Enable( level );
+          executing->Wait.return_code = CORE_RWLOCK_SUCCESSFUL;
+          return;
+        }
+#endif
 	the_rwlock->current_state = CORE_RWLOCK_LOCKED_FOR_READING;
 	the_rwlock->number_of_readers += 1;
 	_ISR_Enable( level );
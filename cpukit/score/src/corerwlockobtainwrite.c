@@ -52,8 +52,27 @@ void _CORE_RWLock_Obtain_for_writing(
    */
 
   _ISR_Disable( level );
+#if defined(RTEMS_SMP)
+    /*
+     *  Stop new big readers before the reader counters are checked.  The
+     *  compare and swap orders the flag before the counters.
+     */
+    if ( _CORE_RWLock_Is_big_reader( the_rwlock ) )
+      (void) _Atomic_Compare_and_swap_uint32(
+        &the_rwlock->readers_may_proceed,
+        true,
+        false
+      );
+#endif
+
     switch ( the_rwlock->current_state ) {
       case CORE_RWLOCK_UNLOCKED:
+#if defined(RTEMS_SMP)
+        if ( _CORE_RWLock_Is_big_reader( the_rwlock ) &&
+             ( _Thread_queue_First( &the_rwlock->Wait_queue ) ||
+               _CORE_RWLock_Big_reader_Count( the_rwlock ) != 0 ) )
+          break;
+#endif
 	the_rwlock->current_state = CORE_RWLOCK_LOCKED_FOR_WRITING;
 	_ISR_Enable( level );
 	executing->Wait.return_code = CORE_RWLOCK_SUCCESSFUL;
@@ -70,6 +89,11 @@ void _CORE_RWLock_Obtain_for_writing(
 
     if ( !wait ) {
       _ISR_Enable( level );
+#if defined(RTEMS_SMP)
+      /* let the big readers proceed again if nobody else waits */
+      if ( _CORE_RWLock_Is_big_reader( the_rwlock ) )
+        _CORE_RWLock_Big_reader_Grant( the_rwlock );
+#endif
       executing->Wait.return_code = CORE_RWLOCK_UNAVAILABLE;
       return;
     }
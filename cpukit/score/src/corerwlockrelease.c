@@ -45,6 +45,30 @@ CORE_RWLock_Status _CORE_RWLock_Release(
    *  If any thread is waiting, then we wait.
    */
 
+#if defined(RTEMS_SMP)
+  /*
+   *  A big reader is released on the reader counter of its processor.  The
+   *  rwlock is handed over once all reader counters drain.
+   */
+  if ( _CORE_RWLock_Is_big_reader( the_rwlock ) ) {
+    _ISR_Disable( level );
+      if ( the_rwlock->current_state == CORE_RWLOCK_LOCKED_FOR_WRITING )
+        the_rwlock->current_state = CORE_RWLOCK_UNLOCKED;
+      else if ( _CORE_RWLock_Big_reader_Count( the_rwlock ) == 0 ) {
+        /* not held for reading, so leave the reader counters alone */
+        _ISR_Enable( level );
+        executing->Wait.return_code = CORE_RWLOCK_UNAVAILABLE;
+        return CORE_RWLOCK_SUCCESSFUL;
+      } else
+        _CORE_RWLock_Big_reader_Add( the_rwlock, (uint32_t) -1 );
+    _ISR_Enable( level );
+
+    executing->Wait.return_code = CORE_RWLOCK_SUCCESSFUL;
+    _CORE_RWLock_Big_reader_Grant( the_rwlock );
+    return CORE_RWLOCK_SUCCESSFUL;
+  }
+#endif
+
   _ISR_Disable( level );
     if ( the_rwlock->current_state == CORE_RWLOCK_UNLOCKED){
       _ISR_Enable( level );
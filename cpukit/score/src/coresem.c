@@ -49,6 +49,7 @@ void _CORE_semaphore_Initialize(
 
   the_semaphore->Attributes = *the_semaphore_attributes;
   the_semaphore->count      = initial_value;
+  the_semaphore->may_have_waiters = false;
 
   _Thread_queue_Initialize(
     &the_semaphore->Wait_queue,
@@ -52,12 +52,12 @@ void _CORE_semaphore_Seize(
 {
   Thread_Control *executing;
   ISR_Level       level;
+  ISR_Level       lock_level;
 
   executing = _Thread_Executing;
   executing->Wait.return_code = CORE_SEMAPHORE_STATUS_SUCCESSFUL;
   _ISR_Disable( level );
-  if ( the_semaphore->count != 0 ) {
-    the_semaphore->count -= 1;
+  if ( _CORE_semaphore_Take_unit( the_semaphore ) ) {
     _ISR_Enable( level );
     return;
   }
@@ -75,11 +75,23 @@ void _CORE_semaphore_Seize(
 
   /*
    *  If the semaphore is not available and the caller is willing to
-   *  block, then we now block the caller with optional timeout.
+   *  block, then we now block the caller with optional timeout.  The
+   *  thread dispatch disable lock is held by the caller, but a unit may
+   *  be surrendered by the fast path in the meantime, so check the count
+   *  again.
    */
+  _Thread_queue_Lock( &the_semaphore->Wait_queue, &lock_level );
+  if ( _CORE_semaphore_Take_unit( the_semaphore ) ) {
+    _Thread_queue_Unlock( &the_semaphore->Wait_queue, lock_level );
+    _ISR_Enable( level );
+    return;
+  }
+
+  the_semaphore->may_have_waiters = true;
   _Thread_queue_Enter_critical_section( &the_semaphore->Wait_queue );
   executing->Wait.queue = &the_semaphore->Wait_queue;
   executing->Wait.id    = id;
+  _Thread_queue_Unlock( &the_semaphore->Wait_queue, lock_level );
   _ISR_Enable( level );
   _Thread_queue_Enqueue( &the_semaphore->Wait_queue, timeout );
 }
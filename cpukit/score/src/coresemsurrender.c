@@ -49,6 +49,7 @@ CORE_semaphore_Status _CORE_semaphore_Surrender(
 {
   Thread_Control *the_thread;
   ISR_Level       level;
+  ISR_Level       lock_level;
   CORE_semaphore_Status status;
 
   status = CORE_SEMAPHORE_STATUS_SUCCESSFUL;
@@ -62,10 +63,17 @@ CORE_semaphore_Status _CORE_semaphore_Surrender(
 
   } else {
     _ISR_Disable( level );
-      if ( the_semaphore->count < the_semaphore->Attributes.maximum_count )
-        the_semaphore->count += 1;
-      else
+    _Thread_queue_Lock( &the_semaphore->Wait_queue, &lock_level );
+      /*
+       *  No thread waits on the semaphore.  Blocking requires the thread
+       *  dispatch disable lock, so no thread can start to wait until we are
+       *  done.  Further surrender operations may use the fast path.
+       */
+      the_semaphore->may_have_waiters = false;
+
+      if ( !_CORE_semaphore_Return_unit( the_semaphore ) )
         status = CORE_SEMAPHORE_MAXIMUM_COUNT_EXCEEDED;
+    _Thread_queue_Unlock( &the_semaphore->Wait_queue, lock_level );
     _ISR_Enable( level );
   }
 
@@ -47,4 +47,8 @@ void _CORE_spinlock_Initialize(
   the_spinlock->lock   = 0;
   the_spinlock->users  = 0;
   the_spinlock->holder = 0;
+
+  #if defined(CORE_SPINLOCK_FIFO)
+    _SMP_lock_ticket_Initialize( &the_spinlock->Ticket );
+  #endif
 }
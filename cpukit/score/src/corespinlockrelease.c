@@ -64,6 +64,13 @@ CORE_spinlock_Status _CORE_spinlock_Release(
     the_spinlock->lock   = CORE_SPINLOCK_UNLOCKED;
     the_spinlock->holder = 0;
 
+    #if defined(CORE_SPINLOCK_FIFO)
+      /*
+       *  Hand the spinlock over to the next waiting thread.
+       */
+      _SMP_lock_ticket_Release( &the_spinlock->Ticket );
+    #endif
+
   _ISR_Enable( level );
   return CORE_SPINLOCK_SUCCESSFUL;
 }
@@ -40,6 +40,9 @@ CORE_spinlock_Status _CORE_spinlock_Wait(
 )
 {
   ISR_Level level;
+  #if defined(CORE_SPINLOCK_FIFO)
+    uint32_t ticket;
+  #endif
   #if defined(FUNCTIONALITY_NOT_CURRENTLY_USED_BY_ANY_API)
     Watchdog_Interval       limit = _Watchdog_Ticks_since_boot + timeout;
   #endif
@@ -50,6 +53,44 @@ CORE_spinlock_Status _CORE_spinlock_Wait(
       _ISR_Enable( level );
       return CORE_SPINLOCK_HOLDER_RELOCKING;
     }
+
+  #if defined(CORE_SPINLOCK_FIFO)
+    /*
+     *  Draw a ticket.  If not willing to wait, draw it only if the spinlock
+     *  is available.
+     */
+    if ( wait ) {
+      ticket = _SMP_lock_ticket_Take( &the_spinlock->Ticket );
+    } else if ( _SMP_lock_ticket_Try_take( &the_spinlock->Ticket ) ) {
+      ticket = the_spinlock->Ticket.now_serving;
+    } else {
+      _ISR_Enable( level );
+      return CORE_SPINLOCK_UNAVAILABLE;
+    }
+    the_spinlock->users += 1;
+  _ISR_Enable( level );
+
+  /*
+   *  Wait for our turn.  Thread dispatching is enabled while spinning so the
+   *  holder may run on this processor.  The ticket keeps our place in the
+   *  queue and we spin only on the now serving field of the ticket lock.
+   */
+  if ( !_SMP_lock_ticket_Is_served( &the_spinlock->Ticket, ticket ) ) {
+    _Thread_Enable_dispatch();
+
+    while ( !_SMP_lock_ticket_Is_served( &the_spinlock->Ticket, ticket ) ) {
+      /* spin */
+    }
+
+    _Thread_Disable_dispatch();
+  }
+
+  _ISR_Disable( level );
+    the_spinlock->lock = CORE_SPINLOCK_LOCKED;
+    the_spinlock->holder = _Thread_Executing->Object.id;
+  _ISR_Enable( level );
+  return CORE_SPINLOCK_SUCCESSFUL;
+  #else
     the_spinlock->users += 1;
     for ( ;; ) {
       if ( the_spinlock->lock == CORE_SPINLOCK_UNLOCKED ) {
@@ -107,5 +148,5 @@ CORE_spinlock_Status _CORE_spinlock_Wait(
 
        _ISR_Disable( level );
     }
-
+  #endif
 }
@@ -40,5 +40,12 @@ void _TOD_Handler_initialization(void)
 
   /* TOD has not been set */
   _TOD.is_set = false;
+
+  /* No free running counter, use the nanoseconds since tick handler */
+  _TOD.generation = 0;
+  _TOD.counter_read = NULL;
+  #if defined(RTEMS_SMP)
+    _SMP_lock_spinlock_simple_Initialize( &_TOD.lock );
+  #endif
   _TOD_Activate();
 }
@@ -0,0 +1,79 @@
+/*
+ *  Time of Day (TOD) Handler -- Announce Ticks
+ */
+
+/*  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/timestamp.h>
+#include <rtems/score/tod.h>
+#include <rtems/score/watchdog.h>
+#include <rtems/config.h>
+
+/*
+ *  _TOD_Announce_ticks
+ *
+ *  This routine processes several clock ticks at once.
+ *
+ *  Input parameters:
+ *    ticks - number of clock ticks elapsed since the last tick
+ *
+ *  Output parameters: NONE
+ */
+
+void _TOD_Announce_ticks( uint32_t ticks )
+{
+  Timestamp_Control elapsed;
+  uint64_t          nanoseconds;
+  uint32_t          seconds;
+  ISR_Level         level;
+
+  nanoseconds = (uint64_t) ticks *
+    rtems_configuration_get_nanoseconds_per_tick();
+
+  /* Convert the elapsed time to a timestamp */
+  _Timestamp_Set(
+    &elapsed,
+    (uint32_t) ( nanoseconds / TOD_NANOSECONDS_PER_SECOND ),
+    (uint32_t) ( nanoseconds % TOD_NANOSECONDS_PER_SECOND )
+  );
+
+  /* Update the counter of ticks since boot */
+  _Watchdog_Ticks_since_boot += ticks;
+
+  level = _TOD_Update_begin();
+    /* Restart the time since the last tick */
+    if ( _TOD.counter_read != NULL )
+      _TOD_Advance_counter( ticks );
+
+    /* Update the uptime and the current TOD */
+    _Timestamp_Add_to( &_TOD.uptime, &elapsed );
+    _Timestamp_Add_to( &_TOD.now, &elapsed );
+
+    nanoseconds += _TOD.seconds_trigger;
+    seconds = (uint32_t) ( nanoseconds / TOD_NANOSECONDS_PER_SECOND );
+    _TOD.seconds_trigger =
+      (uint32_t) ( nanoseconds % TOD_NANOSECONDS_PER_SECOND );
+  _TOD_Update_end( level );
+
+  /*
+   *  The seconds watchdogs which expired at the skipped second boundaries
+   *  fire now together with those of the last boundary.
+   */
+  if ( seconds != 0 ) {
+    if ( seconds > 1 )
+      _Watchdog_Advance( &_Watchdog_Seconds_header, seconds - 1 );
+
+    _Watchdog_Tickle_seconds();
+  }
+}
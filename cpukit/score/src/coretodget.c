@@ -24,7 +24,7 @@ void _TOD_Get_as_timestamp(
   Timestamp_Control *tod
 )
 {
-  ISR_Level         level;
+  uint32_t          generation;
   Timestamp_Control offset;
   Timestamp_Control now;
   long              nanoseconds;
@@ -32,10 +32,11 @@ void _TOD_Get_as_timestamp(
   /* assume time checked for NULL by caller */
 
   /* _TOD.now is the native current time */
-  _ISR_Disable( level );
+  do {
+    generation = _TOD_Read_begin();
     now = _TOD.now;
-    nanoseconds = (*_Watchdog_Nanoseconds_since_tick_handler)();
-  _ISR_Enable( level );
+    nanoseconds = _TOD_Nanoseconds_since_tick();
+  } while ( _TOD_Read_retry( generation ) );
 
   _Timestamp_Set( &offset, 0, nanoseconds );
   _Timestamp_Add_to( &now, &offset );
@@ -35,7 +35,7 @@ void _TOD_Get_uptime(
   Timestamp_Control *uptime
 )
 {
-  ISR_Level         level;
+  uint32_t          generation;
   Timestamp_Control offset;
   Timestamp_Control up;
   long              nanoseconds;
@@ -43,10 +43,11 @@ void _TOD_Get_uptime(
   /* assume time checked for NULL by caller */
 
   /* _TOD.uptime is in native timestamp format */
-  _ISR_Disable( level );
+  do {
+    generation = _TOD_Read_begin();
     up = _TOD.uptime;
-    nanoseconds = (*_Watchdog_Nanoseconds_since_tick_handler)();
-  _ISR_Enable( level );
+    nanoseconds = _TOD_Nanoseconds_since_tick();
+  } while ( _TOD_Read_retry( generation ) );
 
   _Timestamp_Set( &offset, 0, nanoseconds );
   _Timestamp_Add_to( &up, &offset );
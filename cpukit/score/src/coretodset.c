@@ -28,6 +28,7 @@ void _TOD_Set_with_timestamp(
   uint32_t nanoseconds = _Timestamp_Get_nanoseconds( tod );
   Watchdog_Interval seconds_next = _Timestamp_Get_seconds( tod );
   Watchdog_Interval seconds_now;
+  ISR_Level level;
 
   _Thread_Disable_dispatch();
   _TOD_Deactivate();
@@ -39,9 +40,11 @@ void _TOD_Set_with_timestamp(
   else
     _Watchdog_Adjust_seconds( WATCHDOG_FORWARD, seconds_next - seconds_now );
 
-  _TOD.now = *tod;
-  _TOD.seconds_trigger = nanoseconds;
-  _TOD.is_set = true;
+  level = _TOD_Update_begin();
+    _TOD.now = *tod;
+    _TOD.seconds_trigger = nanoseconds;
+    _TOD.is_set = true;
+  _TOD_Update_end( level );
 
   _TOD_Activate();
   _Thread_Enable_dispatch();
@@ -0,0 +1,56 @@
+/*
+ *  Time of Day (TOD) Handler -- Set Free Running Counter
+ */
+
+/*  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/config.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/tod.h>
+
+/*
+ *  _TOD_Set_counter
+ *
+ *  The scale converts a counter delta to nanoseconds with one 32x64-bit
+ *  multiplication and a shift, so readers need no division.  The counter
+ *  increments per tick have a fraction, so that the counter value at the
+ *  last tick does not drift away from the counter.
+ */
+
+void _TOD_Set_counter(
+  TOD_Counter_read_routine read,
+  uint32_t                 frequency,
+  uint32_t                 mask
+)
+{
+  ISR_Level level;
+  uint64_t  per_tick;
+  uint64_t  fraction;
+
+  per_tick = (uint64_t) frequency *
+    rtems_configuration_get_nanoseconds_per_tick();
+  fraction = per_tick % TOD_NANOSECONDS_PER_SECOND;
+  per_tick = ( per_tick / TOD_NANOSECONDS_PER_SECOND ) << 32;
+  per_tick += ( fraction << 32 ) / TOD_NANOSECONDS_PER_SECOND;
+
+  level = _TOD_Update_begin();
+    _TOD.counter_scale =
+      ( (uint64_t) TOD_NANOSECONDS_PER_SECOND << 32 ) / frequency;
+    _TOD.counter_mask = mask;
+    _TOD.counter_per_tick = per_tick;
+    _TOD.counter_at_tick = (*read)();
+    _TOD.counter_at_tick_fraction = 0;
+    _TOD.counter_read = read;
+  _TOD_Update_end( level );
+}
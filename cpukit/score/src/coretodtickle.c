@@ -36,6 +36,8 @@ void _TOD_Tickle_ticks( void )
 {
   Timestamp_Control tick;
   uint32_t          nanoseconds_per_tick;
+  bool              second_elapsed;
+  ISR_Level         level;
 
   nanoseconds_per_tick = rtems_configuration_get_nanoseconds_per_tick();
 
@@ -45,17 +47,26 @@ void _TOD_Tickle_ticks( void )
   /* Update the counter of ticks since boot */
   _Watchdog_Ticks_since_boot += 1;
 
-  /* Update the uptime */
-  _Timestamp_Add_to( &_TOD.uptime, &tick );
-  /* we do not care how much the uptime changed */
+  level = _TOD_Update_begin();
+    /* Restart the time since the last tick */
+    if ( _TOD.counter_read != NULL )
+      _TOD_Advance_counter( 1 );
 
-  /* Update the current TOD */
-  _Timestamp_Add_to( &_TOD.now, &tick );
+    /* Update the uptime */
+    _Timestamp_Add_to( &_TOD.uptime, &tick );
+    /* we do not care how much the uptime changed */
 
-  _TOD.seconds_trigger += nanoseconds_per_tick;
-  if ( _TOD.seconds_trigger >= 1000000000UL ) {
-    _TOD.seconds_trigger -= 1000000000UL;
+    /* Update the current TOD */
+    _Timestamp_Add_to( &_TOD.now, &tick );
+
+    _TOD.seconds_trigger += nanoseconds_per_tick;
+    second_elapsed = _TOD.seconds_trigger >= 1000000000UL;
+    if ( second_elapsed )
+      _TOD.seconds_trigger -= 1000000000UL;
+  _TOD_Update_end( level );
+
+  /* The watchdog routines may read the time */
+  if ( second_elapsed )
     _Watchdog_Tickle_seconds();
-  }
 }
 
@@ -180,51 +180,103 @@ static uintptr_t _Heap_Check_block(
   return 0;
 }
 
-void *_Heap_Allocate_aligned_with_boundary(
+static uintptr_t _Heap_Check_free_list(
   Heap_Control *heap,
+  const Heap_Block *free_list_head,
   uintptr_t alloc_size,
   uintptr_t alignment,
-  uintptr_t boundary
+  uintptr_t boundary,
+  Heap_Block **block_ptr,
+  uint32_t *search_count
 )
 {
-  Heap_Statistics *const stats = &heap->stats;
   uintptr_t const block_size_floor = alloc_size + HEAP_BLOCK_HEADER_SIZE
     - HEAP_ALLOC_BONUS;
-  uintptr_t const page_size = heap->page_size;
-  Heap_Block *block = NULL;
+  Heap_Block *block = free_list_head->next;
   uintptr_t alloc_begin = 0;
-  uint32_t search_count = 0;
-  bool search_again = false;
-
-  if ( block_size_floor < alloc_size ) {
-    /* Integer overflow occured */
-    return NULL;
-  }
 
-  if ( boundary != 0 ) {
-    if ( boundary < alloc_size ) {
-      return NULL;
+  while ( block != free_list_head ) {
+    _HAssert( _Heap_Is_prev_used( block ) );
+
+    _Heap_Protection_block_check( heap, block );
+
+    /*
+     * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
+     * field.  Thus the value is about one unit larger than the real block
+     * size.  The greater than operator takes this into account.
+     */
+    if ( block->size_and_flag > block_size_floor ) {
+      if ( alignment == 0 ) {
+        alloc_begin = _Heap_Alloc_area_of_block( block );
+      } else {
+        alloc_begin = _Heap_Check_block(
+          heap,
+          block,
+          alloc_size,
+          alignment,
+          boundary
+        );
+      }
     }
 
-    if ( alignment == 0 ) {
-      alignment = page_size;
+    /* Statistics */
+    ++*search_count;
+
+    if ( alloc_begin != 0 ) {
+      *block_ptr = block;
+      break;
     }
+
+    block = block->next;
   }
 
-  do {
-    Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  return alloc_begin;
+}
 
-    block = _Heap_Free_list_first( heap );
-    while ( block != free_list_tail ) {
-      _HAssert( _Heap_Is_prev_used( block ) );
+static uintptr_t _Heap_Find_segregated_fit(
+  Heap_Control *heap,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  Heap_Block **block_ptr,
+  uint32_t *search_count
+)
+{
+  Heap_Segregated_fit *const segregated_fit = heap->segregated_fit;
+  uint32_t const free_list_count = _Heap_Free_list_count( heap );
+  uintptr_t const page_size = heap->page_size;
+  uintptr_t const block_size_floor = _Heap_Max(
+    alloc_size + HEAP_BLOCK_HEADER_SIZE - HEAP_ALLOC_BONUS,
+    heap->min_block_size
+  );
+  uintptr_t search_size = block_size_floor;
+  uintptr_t alloc_begin = 0;
+  uint32_t index = 0;
+
+  if ( alignment > page_size ) {
+    search_size += alignment + heap->min_block_size;
+  }
+
+  /*
+   * Round up the search size to the next size class boundary.  Every block in
+   * the size class of the rounded search size is then large enough (except
+   * for the last size class).  This is the good fit part with a constant time
+   * bound.
+   */
+  search_size += ((uintptr_t) 1 << (_Heap_Most_significant_bit( search_size )
+    - HEAP_SEGREGATED_FIT_SECOND_LEVEL_LOG2)) - 1;
+  if ( search_size > block_size_floor ) {
+    index = _Heap_Segregated_fit_index( segregated_fit, search_size );
+    index = _Heap_Segregated_fit_find( segregated_fit, index );
+
+    if ( index < free_list_count ) {
+      Heap_Block *const block = segregated_fit->free_lists [index].next;
 
       _Heap_Protection_block_check( heap, block );
 
-      /*
-       * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
-       * field.  Thus the value is about one unit larger than the real block
-       * size.  The greater than operator takes this into account.
-       */
+      /* Statistics */
+      ++*search_count;
+
       if ( block->size_and_flag > block_size_floor ) {
         if ( alignment == 0 ) {
           alloc_begin = _Heap_Alloc_area_of_block( block );
@@ -239,14 +291,93 @@ void *_Heap_Allocate_aligned_with_boundary(
         }
       }
 
-      /* Statistics */
-      ++search_count;
-
       if ( alloc_begin != 0 ) {
-        break;
+        *block_ptr = block;
+
+        return alloc_begin;
       }
+    }
+  }
+
+  /*
+   * Search all free lists which may contain a block large enough.  This is
+   * only necessary in case the heap is nearly exhausted, or for alignment and
+   * boundary constraints.
+   */
+  index = _Heap_Segregated_fit_index( segregated_fit, block_size_floor );
+  index = _Heap_Segregated_fit_find( segregated_fit, index );
+  while ( index < free_list_count ) {
+    alloc_begin = _Heap_Check_free_list(
+      heap,
+      &segregated_fit->free_lists [index],
+      alloc_size,
+      alignment,
+      boundary,
+      block_ptr,
+      search_count
+    );
+
+    if ( alloc_begin != 0 ) {
+      break;
+    }
 
-      block = block->next;
+    index = _Heap_Segregated_fit_find( segregated_fit, index + 1 );
+  }
+
+  return alloc_begin;
+}
+
+void *_Heap_Allocate_aligned_with_boundary(
+  Heap_Control *heap,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary
+)
+{
+  Heap_Statistics *const stats = &heap->stats;
+  uintptr_t const block_size_floor = alloc_size + HEAP_BLOCK_HEADER_SIZE
+    - HEAP_ALLOC_BONUS;
+  uintptr_t const page_size = heap->page_size;
+  Heap_Block *block = NULL;
+  uintptr_t alloc_begin = 0;
+  uint32_t search_count = 0;
+  bool search_again = false;
+
+  if ( block_size_floor < alloc_size ) {
+    /* Integer overflow occured */
+    return NULL;
+  }
+
+  if ( boundary != 0 ) {
+    if ( boundary < alloc_size ) {
+      return NULL;
+    }
+
+    if ( alignment == 0 ) {
+      alignment = page_size;
+    }
+  }
+
+  do {
+    if ( _Heap_Is_segregated_fit( heap ) ) {
+      alloc_begin = _Heap_Find_segregated_fit(
+        heap,
+        alloc_size,
+        alignment,
+        boundary,
+        &block,
+        &search_count
+      );
+    } else {
+      alloc_begin = _Heap_Check_free_list(
+        heap,
+        _Heap_Free_list_head( heap ),
+        alloc_size,
+        alignment,
+        boundary,
+        &block,
+        &search_count
+      );
     }
 
     search_again = _Heap_Protection_free_delayed_blocks( heap, alloc_begin );
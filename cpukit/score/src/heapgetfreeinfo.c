@@ -28,25 +28,31 @@ void _Heap_Get_free_information(
   Heap_Information    *info
 )
 {
-  Heap_Block *the_block;
-  Heap_Block *const tail = _Heap_Free_list_tail(the_heap);
+  uint32_t const free_list_count = _Heap_Free_list_count(the_heap);
+  uint32_t index;
 
   info->number = 0;
   info->largest = 0;
   info->total = 0;
 
-  for(the_block = _Heap_Free_list_first(the_heap);
-      the_block != tail;
-      the_block = the_block->next)
+  for(index = 0; index < free_list_count; ++index)
   {
-    uint32_t const the_size = _Heap_Block_size(the_block);
-
-    /* As we always coalesce free blocks, prev block must have been used. */
-    _HAssert(_Heap_Is_prev_used(the_block));
-
-    info->number++;
-    info->total += the_size;
-    if ( info->largest < the_size )
-        info->largest = the_size;
+    Heap_Block *const tail = _Heap_Free_list_head_at(the_heap, index);
+    Heap_Block *the_block;
+
+    for(the_block = tail->next;
+        the_block != tail;
+        the_block = the_block->next)
+    {
+      uint32_t const the_size = _Heap_Block_size(the_block);
+
+      /* As we always coalesce free blocks, prev block must have been used. */
+      _HAssert(_Heap_Is_prev_used(the_block));
+
+      info->number++;
+      info->total += the_size;
+      if ( info->largest < the_size )
+          info->largest = the_size;
+    }
   }
 }
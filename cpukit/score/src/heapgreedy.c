@@ -24,11 +24,12 @@ Heap_Block *_Heap_Greedy_allocate(
   size_t block_count
 )
 {
-  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  uint32_t const free_list_count = _Heap_Free_list_count( heap );
   Heap_Block *allocated_blocks = NULL;
   Heap_Block *blocks = NULL;
   Heap_Block *current;
   size_t i;
+  uint32_t index;
 
   for (i = 0; i < block_count; ++i) {
     void *next = _Heap_Allocate( heap, block_sizes [i] );
@@ -44,16 +45,20 @@ Heap_Block *_Heap_Greedy_allocate(
     }
   }
 
-  while ( (current = _Heap_Free_list_first( heap )) != free_list_tail ) {
-    _Heap_Block_allocate(
-      heap,
-      current,
-      _Heap_Alloc_area_of_block( current ),
-      _Heap_Block_size( current ) - HEAP_BLOCK_HEADER_SIZE
-    );
+  for (index = 0; index < free_list_count; ++index) {
+    Heap_Block *const free_list_tail = _Heap_Free_list_head_at( heap, index );
 
-    current->next = blocks;
-    blocks = current;
+    while ( (current = free_list_tail->next) != free_list_tail ) {
+      _Heap_Block_allocate(
+        heap,
+        current,
+        _Heap_Alloc_area_of_block( current ),
+        _Heap_Block_size( current ) - HEAP_BLOCK_HEADER_SIZE
+      );
+
+      current->next = blocks;
+      blocks = current;
+    }
   }
 
   while ( allocated_blocks != NULL ) {
@@ -0,0 +1,113 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreHeap
+ *
+ * @brief Heap Handler implementation.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <rtems/system.h>
+#include <rtems/score/heap.h>
+
+uintptr_t _Heap_Initialize_segregated_fit(
+  Heap_Control *heap,
+  void *heap_area_begin_ptr,
+  uintptr_t heap_area_size,
+  uintptr_t page_size
+)
+{
+  uintptr_t const heap_area_begin = (uintptr_t) heap_area_begin_ptr;
+  uintptr_t const heap_area_end = heap_area_begin + heap_area_size;
+  uintptr_t const index_begin =
+    _Heap_Align_up( heap_area_begin, CPU_ALIGNMENT );
+  uint32_t const first_level_offset =
+    _Heap_Most_significant_bit( sizeof( Heap_Block ) );
+  uint32_t first_level_count = 0;
+  uint32_t free_list_count = 0;
+  uint32_t index = 0;
+  uintptr_t index_size = 0;
+  uintptr_t index_end = 0;
+  uintptr_t size = 0;
+  Heap_Segregated_fit *segregated_fit = NULL;
+  Heap_Block *first_block = NULL;
+
+  if (
+    heap_area_end <= heap_area_begin
+      || index_begin < heap_area_begin
+      || _Heap_Most_significant_bit( heap_area_size ) < first_level_offset
+  ) {
+    /* Invalid area or area too small */
+    return 0;
+  }
+
+  /*
+   * The first level size classes cover the block sizes up to the heap area
+   * size.  Blocks of heap areas added by _Heap_Extend() which are larger than
+   * this end up in the last size class.
+   */
+  first_level_count = _Heap_Most_significant_bit( heap_area_size )
+    - first_level_offset + 1;
+  if ( first_level_count > HEAP_SEGREGATED_FIT_FIRST_LEVEL_MAXIMUM ) {
+    first_level_count = HEAP_SEGREGATED_FIT_FIRST_LEVEL_MAXIMUM;
+  }
+  free_list_count = first_level_count * HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT;
+
+  index_size = sizeof( *segregated_fit )
+    + (free_list_count - 1) * sizeof( segregated_fit->free_lists [0] );
+  index_end = index_begin + index_size;
+
+  if ( index_end < index_begin || index_end >= heap_area_end ) {
+    /* Area too small for the index */
+    return 0;
+  }
+
+  size = _Heap_Initialize(
+    heap,
+    (void *) index_end,
+    heap_area_end - index_end,
+    page_size
+  );
+  if ( size == 0 ) {
+    return 0;
+  }
+
+  segregated_fit = (Heap_Segregated_fit *) index_begin;
+  memset( segregated_fit, 0, sizeof( *segregated_fit ) );
+  segregated_fit->first_level_offset = first_level_offset;
+  segregated_fit->first_level_count = first_level_count;
+
+  for ( index = 0; index < free_list_count; ++index ) {
+    Heap_Block *const free_list_head = &segregated_fit->free_lists [index];
+
+    free_list_head->next = free_list_head;
+    free_list_head->prev = free_list_head;
+  }
+
+  /* Move the first block into the free list of its size class */
+  first_block = heap->first_block;
+  _Heap_Free_list_remove( first_block );
+  heap->segregated_fit = segregated_fit;
+  _Heap_Free_block_insert(
+    heap,
+    NULL,
+    first_block,
+    _Heap_Block_size( first_block )
+  );
+
+  return size;
+}
@@ -56,12 +56,14 @@ static void _Heap_Walk_print( int source, bool error, const char *fmt, ... )
 static bool _Heap_Walk_check_free_list(
   int source,
   Heap_Walk_printer printer,
-  Heap_Control *heap
+  Heap_Control *heap,
+  uint32_t index
 )
 {
   uintptr_t const page_size = heap->page_size;
-  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
-  const Heap_Block *const first_free_block = _Heap_Free_list_first( heap );
+  const Heap_Block *const free_list_tail =
+    _Heap_Free_list_head_at( heap, index );
+  const Heap_Block *const first_free_block = free_list_tail->next;
   const Heap_Block *prev_block = free_list_tail;
   const Heap_Block *free_block = first_free_block;
 
@@ -113,6 +115,20 @@ static bool _Heap_Walk_check_free_list(
       return false;
     }
 
+    if (
+      _Heap_Free_list_head_of_size( heap, _Heap_Block_size( free_block ) )
+        != free_list_tail
+    ) {
+      (*printer)(
+        source,
+        true,
+        "free block 0x%08x: in free list of wrong size class\n",
+        free_block
+      );
+
+      return false;
+    }
+
     prev_block = free_block;
     free_block = free_block->next;
   }
@@ -120,13 +136,52 @@ static bool _Heap_Walk_check_free_list(
   return true;
 }
 
+static bool _Heap_Walk_check_free_lists(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  Heap_Segregated_fit *const segregated_fit = heap->segregated_fit;
+  uint32_t const free_list_count = _Heap_Free_list_count( heap );
+  uint32_t index = 0;
+
+  for ( index = 0; index < free_list_count; ++index ) {
+    if ( !_Heap_Walk_check_free_list( source, printer, heap, index ) ) {
+      return false;
+    }
+
+    if ( segregated_fit != NULL ) {
+      const Heap_Block *const free_list_head =
+        _Heap_Free_list_head_at( heap, index );
+      bool const is_empty = free_list_head->next == free_list_head;
+      bool const is_marked =
+        _Heap_Segregated_fit_find( segregated_fit, index ) == index;
+
+      if ( is_empty == is_marked ) {
+        (*printer)(
+          source,
+          true,
+          "free list %u: bitmap index inconsistent\n",
+          index
+        );
+
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_is_in_free_list(
   Heap_Control *heap,
   Heap_Block *block
 )
 {
-  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
-  const Heap_Block *free_block = _Heap_Free_list_first( heap );
+  const Heap_Block *const free_list_tail =
+    _Heap_Free_list_head_of_size( heap, _Heap_Block_size( block ) );
+  const Heap_Block *free_block = free_list_tail->next;
 
   while ( free_block != free_list_tail ) {
     if ( free_block == block ) {
@@ -237,7 +292,7 @@ static bool _Heap_Walk_check_control(
     return false;
   }
 
-  return _Heap_Walk_check_free_list( source, printer, heap );
+  return _Heap_Walk_check_free_lists( source, printer, heap );
 }
 
 static bool _Heap_Walk_check_free_block(
@@ -247,12 +302,13 @@ static bool _Heap_Walk_check_free_block(
   Heap_Block *block
 )
 {
-  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
-  Heap_Block *const free_list_head = _Heap_Free_list_head( heap );
-  Heap_Block *const first_free_block = _Heap_Free_list_first( heap );
-  Heap_Block *const last_free_block = _Heap_Free_list_last( heap );
   bool const prev_used = _Heap_Is_prev_used( block );
   uintptr_t const block_size = _Heap_Block_size( block );
+  Heap_Block *const free_list_tail =
+    _Heap_Free_list_head_of_size( heap, block_size );
+  Heap_Block *const free_list_head = free_list_tail;
+  Heap_Block *const first_free_block = free_list_head->next;
+  Heap_Block *const last_free_block = free_list_tail->prev;
   Heap_Block *const next_block = _Heap_Block_at( block, block_size );
 
   (*printer)(
@@ -41,7 +41,8 @@ void rtems_iterate_over_all_threads(rtems_per_thread_routine routine)
       continue;
 
     for ( i=1 ; i <= information->maximum ; i++ ) {
-      the_thread = (Thread_Control *)information->local_table[ i ];
+      the_thread = (Thread_Control *)
+        _Objects_Get_local_object( information, i );
 
       if ( !the_thread )
 	continue;
@@ -76,11 +76,12 @@ Objects_Control *_Objects_Allocate(
     if ( the_object ) {
       uint32_t   block;
 
-      block = (uint32_t) _Objects_Get_index( the_object->id ) -
-              _Objects_Get_index( information->minimum_id );
-      block /= information->allocation_size;
+      block = _Objects_Get_block_number(
+        information,
+        _Objects_Get_index( the_object->id )
+      );
 
-      information->inactive_per_block[ block ]--;
+      _Objects_Get_block( information, block )->inactive--;
       information->inactive--;
     }
   }
@@ -15,6 +15,7 @@
 #endif
 
 #include <rtems/system.h>
+#include <rtems/config.h>
 #include <rtems/score/address.h>
 #include <rtems/score/chain.h>
 #include <rtems/score/object.h>
@@ -26,13 +27,92 @@
 #include <rtems/score/sysstate.h>
 #include <rtems/score/isr.h>
 
-#include <string.h>  /* for memcpy() */
+#include <string.h>  /* for memset() */
+
+/*
+ *  This routine allocates a cleared table area.  A failure is fatal unless
+ *  the object class is auto-extend.
+ */
+static void *_Objects_Allocate_table(
+  Objects_Information *information,
+  size_t               size
+)
+{
+  void *table;
+
+  if ( information->auto_extend ) {
+    table = _Workspace_Allocate( size );
+    if ( !table )
+      return NULL;
+  } else {
+    table = _Workspace_Allocate_or_fatal_error( size );
+  }
+
+  memset( table, 0, size );
+
+  return table;
+}
+
+/*
+ *  This routine makes sure the local table pages for the indexes from
+ *  index_base up to last_index and the object block table page of block
+ *  are present.  New pages are entered into the directories, which never
+ *  move.  This is safe with respect to readers, since the maximum of the
+ *  object class still excludes the new indexes.
+ */
+static bool _Objects_Extend_tables(
+  Objects_Information *information,
+  uint32_t             index_base,
+  uint32_t             last_index,
+  uint32_t             block
+)
+{
+  uint32_t page;
+
+  for ( page = index_base >> information->local_table_shift ;
+        page <= (last_index >> information->local_table_shift) ;
+        page++ ) {
+    if ( information->local_table[ page ] == NULL ) {
+      Objects_Control **local_page = (Objects_Control **)
+        _Objects_Allocate_table(
+          information,
+          (information->local_table_mask + 1) * sizeof(Objects_Control *)
+        );
+
+      if ( !local_page )
+        return false;
+
+      information->local_table[ page ] = local_page;
+    }
+  }
+
+  page = block >> information->object_blocks_shift;
+  if ( information->object_blocks[ page ] == NULL ) {
+    Objects_Block *block_page = (Objects_Block *) _Objects_Allocate_table(
+      information,
+      (information->object_blocks_mask + 1) * sizeof(Objects_Block)
+    );
+
+    if ( !block_page )
+      return false;
+
+    information->object_blocks[ page ] = block_page;
+  }
+
+  return true;
+}
 
 /*
  *  _Objects_Extend_information
  *
  *  This routine extends all object information related data structures.
  *
+ *  The local table and the object block table consist of a page directory
+ *  of fixed length and pages of fixed size.  An extension adds pages as
+ *  necessary and never copies existing tables, so the cost of an extension
+ *  depends only on the allocation size and not on the number of objects.
+ *  The name hash index is rebuilt when its capacity doubles.
+ *
  *  Input parameters:
  *    information     - object information table
  *
@@ -43,39 +123,46 @@ void _Objects_Extend_information(
   Objects_Information *information
 )
 {
-  Objects_Control  *the_object;
-  Chain_Control     Inactive;
-  uint32_t          block_count;
-  uint32_t          block;
-  uint32_t          index_base;
-  uint32_t          minimum_index;
-  uint32_t          index;
-  uint32_t          maximum;
-  size_t            block_size;
-  void             *new_object_block;
-  bool              do_extend;
+  Objects_Control   *the_object;
+  Chain_Control      Inactive;
+  uint32_t           block_count;
+  uint32_t           block;
+  uint32_t           index_base;
+  uint32_t           minimum_index;
+  uint32_t           index;
+  uint32_t           maximum;
+  size_t             block_size;
+  void              *new_object_block;
+  Objects_Control ***local_table;
+  Objects_Block    **object_blocks;
+  Objects_Block     *the_block;
+  bool               do_extend;
 
   /*
-   *  Search for a free block of indexes. If we do NOT need to allocate or
-   *  extend the block table, then we will change do_extend.
+   *  Search for a free block of indexes if a shrink released one. If we do
+   *  NOT need to extend the tables, then we will change do_extend.
    */
   do_extend     = true;
   minimum_index = _Objects_Get_index( information->minimum_id );
   index_base    = minimum_index;
   block         = 0;
 
-  /* if ( information->maximum < minimum_index ) */
   if ( information->object_blocks == NULL )
     block_count = 0;
   else {
     block_count = information->maximum / information->allocation_size;
 
-    for ( ; block < block_count; block++ ) {
-      if ( information->object_blocks[ block ] == NULL ) {
-        do_extend = false;
-        break;
-      } else
-        index_base += information->allocation_size;
+    if ( information->released_blocks > 0 ) {
+      for ( ; block < block_count; block++ ) {
+        if ( _Objects_Get_block( information, block )->objects == NULL ) {
+          do_extend = false;
+          break;
+        } else
+          index_base += information->allocation_size;
+      }
+    } else {
+      block = block_count;
+      index_base += block_count * information->allocation_size;
     }
   }
 
@@ -86,13 +173,13 @@ void _Objects_Extend_information(
    *  representable in the index portion of the object Id.  In the
    *  case of 16-bit Ids, this is only 256 object instances.
    */
-  if ( maximum > OBJECTS_ID_FINAL_INDEX ) {
+  if ( do_extend && maximum > OBJECTS_ID_FINAL_INDEX ) {
     return;
   }
 
   /*
-   * Allocate the name table, and the objects and if it fails either return or
-   * generate a fatal error depending on auto-extending being active.
+   * Allocate the objects and if it fails either return or generate a fatal
+   * error depending on auto-extending being active.
    */
   block_size = information->allocation_size * information->size;
   if ( information->auto_extend ) {
@@ -108,106 +195,119 @@ void _Objects_Extend_information(
    */
   if ( do_extend ) {
     ISR_Level         level;
-    void            **object_blocks;
-    uint32_t         *inactive_per_block;
-    Objects_Control **local_table;
-    void             *old_tables;
-    size_t            block_size;
+    Objects_Maximum  *name_hash_buckets;
+    Objects_Maximum  *name_hash_next;
+    uint32_t          name_hash_size;
+    void             *old_name_hash;
 
-    /*
-     *  Growing the tables means allocating a new area, doing a copy and
-     *  updating the information table.
-     *
-     *  If the maximum is minimum we do not have a table to copy. First
-     *  time through.
-     *
-     *  The allocation has :
-     *
-     *      void            *objects[block_count];
-     *      uint32_t         inactive_count[block_count];
-     *      Objects_Control *local_table[maximum];
-     *
-     *  This is the order in memory. Watch changing the order. See the memcpy
-     *  below.
-     */
+    local_table = information->local_table;
+    object_blocks = information->object_blocks;
 
-    /*
-     *  Up the block count and maximum
-     */
-    block_count++;
-
-    /*
-     *  Allocate the tables and break it up.
-     */
-    block_size = block_count *
-           (sizeof(void *) + sizeof(uint32_t) + sizeof(Objects_Name *)) +
-          ((maximum + minimum_index) * sizeof(Objects_Control *));
-    object_blocks = (void**) _Workspace_Allocate( block_size );
-
-    if ( !object_blocks ) {
-      _Workspace_Free( new_object_block );
-      return;
-    }
-
-    /*
-     *  Break the block into the various sections.
-     */
-    inactive_per_block = (uint32_t *) _Addresses_Add_offset(
-        object_blocks, block_count * sizeof(void*) );
-    local_table = (Objects_Control **) _Addresses_Add_offset(
-        inactive_per_block, block_count * sizeof(uint32_t) );
-
-    /*
-     *  Take the block count down. Saves all the (block_count - 1)
-     *  in the copies.
-     */
-    block_count--;
-
-    if ( information->maximum > minimum_index ) {
+    if ( object_blocks == NULL ) {
+      uint32_t   local_pages;
+      uint32_t   block_pages;
+      uint32_t   local_page_size;
+      uint32_t   block_page_size;
+      void     **tables;
 
       /*
-       *  Copy each section of the table over. This has to be performed as
-       *  separate parts as size of each block has changed.
+       *  First time through.  The allocation has:
+       *
+       *      Objects_Block   *object_blocks[block_pages];
+       *      Objects_Control **local_table[local_pages];
+       *      Objects_Control  *local_page[local_page_size];
+       *      Objects_Block     block_page[block_page_size];
+       *
+       *  A class of fixed size has exactly one page of each kind and the
+       *  local table page is sized to the objects of the class.  Further
+       *  pages of an auto-extend class are allocated as needed.
        */
+      local_pages = (OBJECTS_ID_FINAL_INDEX >> information->local_table_shift)
+        + 1;
+      block_pages = ((OBJECTS_ID_FINAL_INDEX / information->allocation_size)
+        >> information->object_blocks_shift) + 1;
+
+      if ( information->auto_extend )
+        local_page_size = information->local_table_mask + 1;
+      else
+        local_page_size = maximum + minimum_index;
+      block_page_size = information->object_blocks_mask + 1;
+
+      tables = (void **) _Objects_Allocate_table(
+        information,
+        (block_pages + local_pages + local_page_size) * sizeof(void *) +
+          block_page_size * sizeof(Objects_Block)
+      );
 
-      memcpy( object_blocks,
-              information->object_blocks,
-              block_count * sizeof(void*) );
-      memcpy( inactive_per_block,
-              information->inactive_per_block,
-              block_count * sizeof(uint32_t) );
-      memcpy( local_table,
-              information->local_table,
-              (information->maximum + minimum_index) * sizeof(Objects_Control *) );
-    } else {
+      if ( !tables ) {
+        _Workspace_Free( new_object_block );
+        return;
+      }
+
+      object_blocks = (Objects_Block **) tables;
+      local_table = (Objects_Control ***) &tables[ block_pages ];
+      local_table[ 0 ] = (Objects_Control **) &tables[
+        block_pages + local_pages
+      ];
+      object_blocks[ 0 ] = (Objects_Block *) &tables[
+        block_pages + local_pages + local_page_size
+      ];
 
       /*
-       *  Deal with the special case of the 0 to minimum_index
+       *  The empty table is published here, it reads NULL for index 0 like
+       *  the null local table.
        */
-      for ( index = 0; index < minimum_index; index++ ) {
-        local_table[ index ] = NULL;
-      }
+      information->object_blocks = object_blocks;
+      information->local_table = local_table;
+    }
+
+    if ( !_Objects_Extend_tables(
+           information,
+           index_base,
+           maximum + minimum_index - 1,
+           block
+         ) ) {
+      _Workspace_Free( new_object_block );
+      return;
     }
 
     /*
-     *  Initialise the new entries in the table.
+     *  The name hash index has a power of two number of buckets and as many
+     *  next links.  Its capacity doubles, so the rebuild is amortized over
+     *  the objects added since the last one.
      */
-    object_blocks[block_count] = NULL;
-    inactive_per_block[block_count] = 0;
+    name_hash_size = 0;
+    name_hash_buckets = NULL;
+    name_hash_next = NULL;
+    if ( rtems_configuration_get_object_name_hash() &&
+         ( information->name_hash_buckets == NULL ||
+           maximum + minimum_index > information->name_hash_mask + 1 ) ) {
+      name_hash_size = 1;
+      while ( name_hash_size < maximum + minimum_index )
+        name_hash_size <<= 1;
+
+      name_hash_buckets = (Objects_Maximum *) _Objects_Allocate_table(
+        information,
+        2 * name_hash_size * sizeof(Objects_Maximum)
+      );
 
-    for ( index=index_base ;
-          index < ( information->allocation_size + index_base );
-          index++ ) {
-      local_table[ index ] = NULL;
+      if ( !name_hash_buckets ) {
+        _Workspace_Free( new_object_block );
+        return;
+      }
+
+      name_hash_next = name_hash_buckets + name_hash_size;
     }
 
     _ISR_Disable( level );
 
-    old_tables = information->object_blocks;
-
-    information->object_blocks = object_blocks;
-    information->inactive_per_block = inactive_per_block;
-    information->local_table = local_table;
+    old_name_hash = NULL;
+    if ( name_hash_buckets != NULL ) {
+      old_name_hash = information->name_hash_buckets;
+      information->name_hash_mask = name_hash_size - 1;
+      information->name_hash_buckets = NULL;
+      information->name_hash_next = name_hash_next;
+    }
     information->maximum = (Objects_Maximum) maximum;
     information->maximum_id = _Objects_Build_id(
         information->the_api,
@@ -218,22 +318,26 @@ void _Objects_Extend_information(
 
     _ISR_Enable( level );
 
-    _Workspace_Free( old_tables );
-
-    block_count++;
+    if ( name_hash_buckets != NULL ) {
+      _Objects_Name_hash_rebuild( information, name_hash_buckets );
+      _Workspace_Free( old_name_hash );
+    }
+  } else {
+    information->released_blocks--;
   }
 
   /*
    *  Assign the new object block to the object block table.
    */
-  information->object_blocks[ block ] = new_object_block;
+  the_block = _Objects_Get_block( information, block );
+  the_block->objects = new_object_block;
 
   /*
    *  Initialize objects .. add to a local chain first.
    */
   _Chain_Initialize(
     &Inactive,
-    information->object_blocks[ block ],
+    the_block->objects,
     information->allocation_size,
     information->size
   );
@@ -257,7 +361,7 @@ void _Objects_Extend_information(
     index++;
   }
 
-  information->inactive_per_block[ block ] = information->allocation_size;
+  the_block->inactive = information->allocation_size;
   information->inactive =
     (Objects_Maximum)(information->inactive + information->allocation_size);
 }
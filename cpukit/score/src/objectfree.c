@@ -47,11 +47,12 @@ void _Objects_Free(
   if ( information->auto_extend ) {
     uint32_t    block;
 
-    block = (uint32_t) (_Objects_Get_index( the_object->id ) -
-                        _Objects_Get_index( information->minimum_id ));
-    block /= information->allocation_size;
+    block = _Objects_Get_block_number(
+      information,
+      _Objects_Get_index( the_object->id )
+    );
 
-    information->inactive_per_block[ block ]++;
+    _Objects_Get_block( information, block )->inactive++;
     information->inactive++;
 
     /*
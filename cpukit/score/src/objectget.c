@@ -75,7 +75,8 @@ Objects_Control *_Objects_Get(
    */
   if ( index <= information->maximum ) {
     _Thread_Disable_dispatch();
-    if ( (the_object = information->local_table[ index ]) != NULL ) {
+    the_object = _Objects_Get_local_object( information, index );
+    if ( the_object != NULL ) {
       *location = OBJECTS_LOCAL;
       return the_object;
     }
@@ -62,7 +62,8 @@ Objects_Control *_Objects_Get_isr_disable(
 
   _ISR_Disable( level );
   if ( information->maximum >= index ) {
-    if ( (the_object = information->local_table[ index ]) != NULL ) {
+    the_object = _Objects_Get_local_object( information, index );
+    if ( the_object != NULL ) {
       *location = OBJECTS_LOCAL;
       *level_p = level;
       return the_object;
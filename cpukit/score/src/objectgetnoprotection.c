@@ -61,7 +61,8 @@ Objects_Control *_Objects_Get_no_protection(
   index = id - information->minimum_id + 1;
 
   if ( information->maximum >= index ) {
-    if ( (the_object = information->local_table[ index ]) != NULL ) {
+    the_object = _Objects_Get_local_object( information, index );
+    if ( the_object != NULL ) {
       *location = OBJECTS_LOCAL;
       return the_object;
     }
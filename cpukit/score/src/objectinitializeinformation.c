@@ -1,7 +1,7 @@
 /*
  *  Object Handler Initialization per Object Class
  *
- *  COPYRIGHT (c) 1989-2011.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -25,6 +25,20 @@
 #include <rtems/score/sysstate.h>
 #include <rtems/score/isr.h>
 
+/*
+ *  This routine returns the base two logarithm of the smallest power of
+ *  two greater than or equal to size.
+ */
+static uint32_t _Objects_Page_shift( uint32_t size )
+{
+  uint32_t shift = 0;
+
+  while ( (1U << shift) < size )
+    ++shift;
+
+  return shift;
+}
+
 /*
  *  _Objects_Initialize_information
  *
@@ -58,20 +72,25 @@ void _Objects_Initialize_information(
 #endif
 )
 {
-  static Objects_Control *null_local_table = NULL;
-  uint32_t                minimum_index;
-  Objects_Maximum         maximum_per_allocation;
+  static Objects_Control  *null_local_table_page[ 1 ] = { NULL };
+  static Objects_Control **null_local_table[ 1 ] = { null_local_table_page };
+  uint32_t                 minimum_index;
+  uint32_t                 page_size;
+  Objects_Maximum          maximum_per_allocation;
   #if defined(RTEMS_MULTIPROCESSING)
-    uint32_t              index;
+    uint32_t               index;
   #endif
 
   information->the_api            = the_api;
   information->the_class          = the_class;
   information->size               = size;
   information->local_table        = 0;
-  information->inactive_per_block = 0;
   information->object_blocks      = 0;
+  information->released_blocks    = 0;
   information->inactive           = 0;
+  information->name_hash_mask     = 0;
+  information->name_hash_buckets  = NULL;
+  information->name_hash_next     = NULL;
   #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
     information->is_string        = is_string;
   #endif
@@ -112,7 +131,34 @@ void _Objects_Initialize_information(
   /*
    *  Provide a null local table entry for the case of any empty table.
    */
-  information->local_table = &null_local_table;
+  information->local_table = null_local_table;
+
+  /*
+   *  Select the table page sizes.  A class of fixed size uses a single page
+   *  covering every index.  An auto-extend class uses pages of at least one
+   *  allocation, so an extension adds at most two local table pages and one
+   *  object block table page.  The page directories are never copied.
+   */
+  if ( information->auto_extend ) {
+    page_size = maximum_per_allocation;
+    if ( page_size < OBJECTS_LOCAL_TABLE_PAGE_MINIMUM )
+      page_size = OBJECTS_LOCAL_TABLE_PAGE_MINIMUM;
+  } else {
+    page_size = OBJECTS_ID_FINAL_INDEX + 1;
+  }
+
+  information->local_table_shift = _Objects_Page_shift( page_size );
+  information->local_table_mask =
+    (1U << information->local_table_shift) - 1;
+
+  page_size = 1;
+  if ( information->auto_extend )
+    page_size = ((1U << information->local_table_shift) +
+      maximum_per_allocation - 1) / maximum_per_allocation;
+
+  information->object_blocks_shift = _Objects_Page_shift( page_size );
+  information->object_blocks_mask =
+    (1U << information->object_blocks_shift) - 1;
 
   /*
    *  Calculate minimum and maximum Id's
@@ -0,0 +1,131 @@
+/*
+ *  Object Handler -- Name Hash Index
+ *
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/object.h>
+
+/*
+ *  This routine returns true and the name hash bucket of the_object if
+ *  the_object has a name, otherwise false.
+ */
+static bool _Objects_Name_hash_get_bucket(
+  const Objects_Information *information,
+  const Objects_Control     *the_object,
+  uint32_t                  *bucket
+)
+{
+  #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
+    if ( information->is_string ) {
+      if ( the_object->name.name_p == NULL )
+        return false;
+
+      *bucket = _Objects_Name_hash_string(
+        information,
+        the_object->name.name_p
+      );
+      return true;
+    }
+  #endif
+
+  if ( the_object->name.name_u32 == 0 )
+    return false;
+
+  *bucket = _Objects_Name_hash_u32( information, the_object->name.name_u32 );
+  return true;
+}
+
+/*
+ *  This routine adds the_object to the name hash buckets in index order.
+ */
+static void _Objects_Name_hash_link(
+  Objects_Information  *information,
+  Objects_Maximum      *buckets,
+  Objects_Control      *the_object
+)
+{
+  Objects_Maximum *link;
+  Objects_Maximum  index;
+  uint32_t         bucket;
+
+  if ( !_Objects_Name_hash_get_bucket( information, the_object, &bucket ) )
+    return;
+
+  index = (Objects_Maximum) _Objects_Get_index( the_object->id );
+  link = &buckets[ bucket ];
+
+  while ( *link != 0 && *link < index )
+    link = &information->name_hash_next[ *link ];
+
+  information->name_hash_next[ index ] = *link;
+  *link = index;
+}
+
+void _Objects_Name_hash_insert(
+  Objects_Information  *information,
+  Objects_Control      *the_object
+)
+{
+  _Objects_Name_hash_link(
+    information,
+    information->name_hash_buckets,
+    the_object
+  );
+}
+
+void _Objects_Name_hash_remove(
+  Objects_Information  *information,
+  Objects_Control      *the_object
+)
+{
+  Objects_Maximum *link;
+  Objects_Maximum  index;
+  uint32_t         bucket;
+
+  if ( !_Objects_Name_hash_get_bucket( information, the_object, &bucket ) )
+    return;
+
+  index = (Objects_Maximum) _Objects_Get_index( the_object->id );
+  link = &information->name_hash_buckets[ bucket ];
+
+  while ( *link != 0 ) {
+    if ( *link == index ) {
+      *link = information->name_hash_next[ index ];
+      return;
+    }
+
+    link = &information->name_hash_next[ *link ];
+  }
+}
+
+void _Objects_Name_hash_rebuild(
+  Objects_Information  *information,
+  Objects_Maximum      *buckets
+)
+{
+  uint32_t index;
+
+  for ( index = 0 ; index <= information->name_hash_mask ; index++ )
+    buckets[ index ] = 0;
+
+  for ( index = 1 ; index <= information->maximum ; index++ ) {
+    Objects_Control *the_object =
+      _Objects_Get_local_object( information, index );
+
+    if ( the_object != NULL )
+      _Objects_Name_hash_link( information, buckets, the_object );
+  }
+
+  information->name_hash_buckets = buckets;
+}
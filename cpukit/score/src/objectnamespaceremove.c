@@ -1,5 +1,5 @@
 /*
- *  COPYRIGHT (c) 1989-2008.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -20,6 +20,12 @@ void _Objects_Namespace_remove(
   Objects_Control      *the_object
 )
 {
+  /*
+   *  Remove the object from the name hash index while the name is valid.
+   */
+  if ( information->name_hash_buckets != NULL )
+    _Objects_Name_hash_remove( information, the_object );
+
   #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
     /*
      *  If this is a string format name, then free the memory.
@@ -1,7 +1,7 @@
 /*
  *  Object Handler
  *
- *  COPYRIGHT (c) 1989-2010.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -29,7 +29,8 @@
  *  _Objects_Name_to_id_u32
  *
  *  These kernel routines search the object table(s) for the given
- *  object name and returns the associated object id.
+ *  object name and returns the associated object id.  The name hash
+ *  index is used if the object class has one.
  *
  *  Input parameters:
  *    information - object information
@@ -74,9 +75,23 @@ Objects_Name_or_id_lookup_errors _Objects_Name_to_id_u32(
       ))
    search_local_node = true;
 
-  if ( search_local_node ) {
+  if ( search_local_node && information->name_hash_buckets != NULL ) {
+    index = information->name_hash_buckets[
+      _Objects_Name_hash_u32( information, name )
+    ];
+
+    while ( index != 0 ) {
+      the_object = _Objects_Get_local_object( information, index );
+      if ( the_object && name == the_object->name.name_u32 ) {
+        *id = the_object->id;
+        return OBJECTS_NAME_OR_ID_LOOKUP_SUCCESSFUL;
+      }
+
+      index = information->name_hash_next[ index ];
+    }
+  } else if ( search_local_node ) {
     for ( index = 1; index <= information->maximum; index++ ) {
-      the_object = information->local_table[ index ];
+      the_object = _Objects_Get_local_object( information, index );
       if ( !the_object )
         continue;
 
@@ -1,7 +1,7 @@
 /*
  *  Object Handler - Object ID to Name (String)
  *
- *  COPYRIGHT (c) 1989-2010.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -32,7 +32,8 @@
  *  _Objects_Name_to_id_string
  *
  *  These kernel routines search the object table(s) for the given
- *  object name and returns the associated object id.
+ *  object name and returns the associated object id.  The name hash
+ *  index is used if the object class has one.
  *
  *  Input parameters:
  *    information - object information
@@ -62,10 +63,28 @@ Objects_Name_or_id_lookup_errors _Objects_Name_to_id_string(
   if ( !name )
     return OBJECTS_INVALID_NAME;
 
-  if ( information->maximum != 0 ) {
+  if ( information->name_hash_buckets != NULL ) {
+    index = information->name_hash_buckets[
+      _Objects_Name_hash_string( information, name )
+    ];
+
+    while ( index != 0 ) {
+      the_object = _Objects_Get_local_object( information, index );
+      if (
+        the_object
+          && the_object->name.name_p
+          && !strncmp( name, the_object->name.name_p, information->name_length )
+      ) {
+        *id = the_object->id;
+        return OBJECTS_NAME_OR_ID_LOOKUP_SUCCESSFUL;
+      }
+
+      index = information->name_hash_next[ index ];
+    }
+  } else if ( information->maximum != 0 ) {
 
     for ( index = 1; index <= information->maximum; index++ ) {
-      the_object = information->local_table[ index ];
+      the_object = _Objects_Get_local_object( information, index );
       if ( !the_object )
         continue;
 
@@ -1,5 +1,5 @@
 /*
- *  COPYRIGHT (c) 1989-2009.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -33,10 +33,20 @@ bool _Objects_Set_name(
 {
   size_t                 length;
   const char            *s;
+  bool                   is_hashed;
 
   s      = name;
   length = strnlen( name, information->name_length );
 
+  /*
+   *  The name hash index contains only open objects.
+   */
+  is_hashed = information->name_hash_buckets != NULL &&
+    _Objects_Get_local_object(
+      information,
+      _Objects_Get_index( the_object->id )
+    ) == the_object;
+
 #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
   if ( information->is_string ) {
     char *d;
@@ -45,6 +55,9 @@ bool _Objects_Set_name(
     if ( !d )
       return false;
 
+    if ( is_hashed )
+      _Objects_Name_hash_remove( information, the_object );
+
     _Workspace_Free( (void *)the_object->name.name_p );
     the_object->name.name_p = NULL;
 
@@ -54,6 +67,9 @@ bool _Objects_Set_name(
   } else
 #endif
   {
+    if ( is_hashed )
+      _Objects_Name_hash_remove( information, the_object );
+
     the_object->name.name_u32 =  _Objects_Build_name(
       ((0 <= length) ? s[ 0 ] : ' '),
       ((1 <  length) ? s[ 1 ] : ' '),
@@ -63,5 +79,8 @@ bool _Objects_Set_name(
 
   }
 
+  if ( is_hashed )
+    _Objects_Name_hash_insert( information, the_object );
+
   return true;
 }
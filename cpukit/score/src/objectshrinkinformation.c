@@ -30,8 +30,8 @@
  *  _Objects_Shrink_information
  *
  *  This routine shrinks object information related data structures.
- *  The object's name and object space are released. The local_table
- *  etc block does not shrink. The InActive list needs to be scanned
+ *  The object's name and object space are released. The local table
+ *  and object block table pages do not shrink. The InActive list needs to be scanned
  *  to find the objects are remove them.
  *  Input parameters:
  *    information     - object information table
@@ -46,6 +46,7 @@ void _Objects_Shrink_information(
 {
   Objects_Control  *the_object;
   Objects_Control  *extract_me;
+  Objects_Block    *the_block;
   uint32_t          block_count;
   uint32_t          block;
   uint32_t          index_base;
@@ -60,15 +61,16 @@ void _Objects_Shrink_information(
                  information->allocation_size;
 
   for ( block = 0; block < block_count; block++ ) {
-    if ( information->inactive_per_block[ block ] ==
-         information->allocation_size ) {
+    the_block = _Objects_Get_block( information, block );
+
+    if ( the_block->inactive == information->allocation_size ) {
 
       /*
        *  Assume the Inactive chain is never empty at this point
        */
       the_object = (Objects_Control *) _Chain_First( &information->Inactive );
 
-      do {
+      while ( !_Chain_Is_tail( &information->Inactive, &the_object->Node ) ) {
          index = _Objects_Get_index( the_object->id );
          /*
           *  Get the next node before the node is extracted
@@ -80,16 +82,16 @@ void _Objects_Shrink_information(
            _Chain_Extract( &extract_me->Node );
          }
        }
-       while ( the_object );
       /*
        *  Free the memory and reset the structures in the object' information
        */
 
-      _Workspace_Free( information->object_blocks[ block ] );
-      information->object_blocks[ block ] = NULL;
-      information->inactive_per_block[ block ] = 0;
+      _Workspace_Free( the_block->objects );
+      the_block->objects = NULL;
+      the_block->inactive = 0;
 
       information->inactive -= information->allocation_size;
+      information->released_blocks++;
 
       return;
     }
@@ -0,0 +1,270 @@
+/**
+ *  @file
+ *
+ *  @ingroup ScoreScheduler
+ *
+ *  @brief Priority SMP Scheduler ready queue implementation.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/schedulerprioritysmp.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/states.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/wkspace.h>
+
+/*
+ *  New threads are assigned to the clusters in a round-robin fashion.
+ */
+static uint32_t _Scheduler_priority_smp_Next_cluster;
+
+static Scheduler_priority_smp_Per_thread *_Scheduler_priority_smp_Info(
+  const Thread_Control *the_thread
+)
+{
+  return (Scheduler_priority_smp_Per_thread *) the_thread->scheduler_info;
+}
+
+void _Scheduler_priority_smp_Initialize( void )
+{
+  Scheduler_priority_smp_Control *control;
+  uint32_t                        cluster_count;
+  uint32_t                        cpu_count;
+  uint32_t                        index;
+
+  cluster_count = _Scheduler_priority_smp_Maximum_clusters;
+  if ( cluster_count == 0 )
+    cluster_count = 1;
+
+  cpu_count = rtems_configuration_smp_maximum_processors;
+
+  control = _Workspace_Allocate_or_fatal_error( sizeof( *control ) );
+  control->clusters = _Workspace_Allocate_or_fatal_error(
+    cluster_count * sizeof( *control->clusters )
+  );
+  control->pending = _Workspace_Allocate_or_fatal_error(
+    cpu_count * sizeof( *control->pending )
+  );
+  control->assigned = _Workspace_Allocate_or_fatal_error(
+    cpu_count * sizeof( *control->assigned )
+  );
+
+  for ( index = 0 ; index < cluster_count ; ++index ) {
+    Scheduler_priority_smp_Cluster *cluster = &control->clusters[ index ];
+    size_t                          priority;
+
+    cluster->major = 0;
+    for ( priority = 0 ; priority < 16 ; ++priority )
+      cluster->minor[ priority ] = 0;
+
+    cluster->ready = _Workspace_Allocate_or_fatal_error(
+      ((size_t) PRIORITY_MAXIMUM + 1) * sizeof( *cluster->ready )
+    );
+    for ( priority = 0 ; priority <= PRIORITY_MAXIMUM ; ++priority )
+      _Chain_Initialize_empty( &cluster->ready[ priority ] );
+  }
+
+  _Scheduler.information = control;
+}
+
+uint32_t _Scheduler_priority_smp_Get_cluster_count( void )
+{
+  uint32_t cluster_count = _Scheduler_priority_smp_Maximum_clusters;
+
+  if ( cluster_count == 0 )
+    cluster_count = 1;
+
+  if ( _SMP_Processor_count != 0 && cluster_count > _SMP_Processor_count )
+    cluster_count = _SMP_Processor_count;
+
+  return cluster_count;
+}
+
+static void _Scheduler_priority_smp_Set_cluster_info(
+  Scheduler_priority_smp_Per_thread *sched_info,
+  uint32_t                           cluster_index
+)
+{
+  Scheduler_priority_smp_Control *control =
+    (Scheduler_priority_smp_Control *) _Scheduler.information;
+
+  sched_info->cluster_index = cluster_index;
+  sched_info->cluster = &control->clusters[ cluster_index ];
+}
+
+void *_Scheduler_priority_smp_Allocate(
+  Thread_Control *the_thread
+)
+{
+  Scheduler_priority_smp_Per_thread *sched_info;
+  uint32_t                           cluster_index;
+
+  sched_info = _Workspace_Allocate( sizeof( *sched_info ) );
+  if ( sched_info == NULL )
+    return NULL;
+
+  cluster_index = _Scheduler_priority_smp_Next_cluster;
+  _Scheduler_priority_smp_Next_cluster =
+    (cluster_index + 1) % _Scheduler_priority_smp_Get_cluster_count();
+
+  /*
+   *  The cluster count may have decreased after the first allocations
+   *  since the number of cores is known late during initialization.
+   */
+  if ( cluster_index >= _Scheduler_priority_smp_Get_cluster_count() )
+    cluster_index = 0;
+
+  _Scheduler_priority_smp_Set_cluster_info( sched_info, cluster_index );
+  the_thread->scheduler_info = sched_info;
+
+  return sched_info;
+}
+
+void _Scheduler_priority_smp_Update(
+  Thread_Control *the_thread
+)
+{
+  Scheduler_priority_smp_Per_thread *sched_info;
+  Scheduler_priority_smp_Cluster    *cluster;
+  Priority_Control                   priority;
+
+  sched_info = _Scheduler_priority_smp_Info( the_thread );
+  cluster    = sched_info->cluster;
+  priority   = the_thread->current_priority;
+
+  sched_info->ready_chain = &cluster->ready[ priority ];
+
+  _Priority_bit_map_Initialize_information(
+    &sched_info->Priority_map,
+    priority
+  );
+
+  /* Use the bit maps of the cluster instead of the global bit maps */
+  sched_info->Priority_map.minor =
+    &cluster->minor[ _Priority_Bits_index( _Priority_Major( priority ) ) ];
+}
+
+void _Scheduler_priority_smp_Enqueue(
+  Thread_Control *the_thread
+)
+{
+  Scheduler_priority_smp_Per_thread *sched_info;
+
+  sched_info = _Scheduler_priority_smp_Info( the_thread );
+
+  *sched_info->Priority_map.minor |= sched_info->Priority_map.ready_minor;
+  sched_info->cluster->major |= sched_info->Priority_map.ready_major;
+
+  _Chain_Append_unprotected(
+    sched_info->ready_chain,
+    &the_thread->Object.Node
+  );
+}
+
+void _Scheduler_priority_smp_Enqueue_first(
+  Thread_Control *the_thread
+)
+{
+  Scheduler_priority_smp_Per_thread *sched_info;
+
+  sched_info = _Scheduler_priority_smp_Info( the_thread );
+
+  *sched_info->Priority_map.minor |= sched_info->Priority_map.ready_minor;
+  sched_info->cluster->major |= sched_info->Priority_map.ready_major;
+
+  _Chain_Prepend_unprotected(
+    sched_info->ready_chain,
+    &the_thread->Object.Node
+  );
+}
+
+void _Scheduler_priority_smp_Extract(
+  Thread_Control *the_thread
+)
+{
+  Scheduler_priority_smp_Per_thread *sched_info;
+  Chain_Control                     *ready;
+
+  sched_info = _Scheduler_priority_smp_Info( the_thread );
+  ready      = sched_info->ready_chain;
+
+  if ( _Chain_Has_only_one_node( ready ) ) {
+    _Chain_Initialize_empty( ready );
+
+    *sched_info->Priority_map.minor &= sched_info->Priority_map.block_minor;
+    if ( *sched_info->Priority_map.minor == 0 )
+      sched_info->cluster->major &= sched_info->Priority_map.block_major;
+  } else {
+    _Chain_Extract_unprotected( &the_thread->Object.Node );
+  }
+}
+
+void _Scheduler_priority_smp_Requeue(
+  Thread_Control *the_thread
+)
+{
+  Scheduler_priority_smp_Per_thread *sched_info;
+
+  sched_info = _Scheduler_priority_smp_Info( the_thread );
+
+  if ( !_Chain_Has_only_one_node( sched_info->ready_chain ) ) {
+    _Chain_Extract_unprotected( &the_thread->Object.Node );
+    _Chain_Append_unprotected(
+      sched_info->ready_chain,
+      &the_thread->Object.Node
+    );
+  }
+}
+
+bool _Scheduler_priority_smp_Set_cluster(
+  Thread_Control *the_thread,
+  uint32_t        cluster_index
+)
+{
+  Scheduler_priority_smp_Per_thread *sched_info;
+  ISR_Level                          level;
+  bool                               is_ready;
+
+  if ( cluster_index >= _Scheduler_priority_smp_Get_cluster_count() )
+    return false;
+
+  sched_info = _Scheduler_priority_smp_Info( the_thread );
+
+  _ISR_Disable( level );
+    is_ready = _States_Is_ready( the_thread->current_state );
+
+    if ( is_ready )
+      _Scheduler_priority_smp_Extract( the_thread );
+
+    _Scheduler_priority_smp_Set_cluster_info( sched_info, cluster_index );
+    _Scheduler_priority_smp_Update( the_thread );
+
+    if ( is_ready ) {
+      _Scheduler_priority_smp_Enqueue( the_thread );
+      _Scheduler_priority_smp_Schedule();
+    }
+  _ISR_Enable( level );
+
+  return true;
+}
+
+uint32_t _Scheduler_priority_smp_Get_cluster(
+  const Thread_Control *the_thread
+)
+{
+  return _Scheduler_priority_smp_Info( the_thread )->cluster_index;
+}
@@ -0,0 +1,32 @@
+/**
+ *  @file
+ *
+ *  @ingroup ScoreScheduler
+ *
+ *  @brief Priority SMP Scheduler block implementation.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/schedulerprioritysmp.h>
+
+void _Scheduler_priority_smp_Block(
+  Thread_Control   *the_thread
+)
+{
+  _Scheduler_priority_smp_Extract( the_thread );
+
+  _Scheduler_priority_smp_Schedule();
+}
@@ -0,0 +1,241 @@
+/**
+ *  @file
+ *
+ *  @ingroup ScoreScheduler
+ *
+ *  @brief Priority SMP Scheduler schedule implementation.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/schedulerprioritysmp.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/states.h>
+#include <rtems/score/thread.h>
+
+/*
+ *  This iterator visits the ready threads of a cluster in priority order.
+ *  It works on a copy of the bit maps and consumes one priority after the
+ *  other, so it only visits the priorities it actually needs.
+ */
+typedef struct {
+  Priority_bit_map_Control  major;
+  Priority_bit_map_Control  minor[ 16 ];
+  Chain_Control            *ready;
+  Chain_Control            *chain;
+  Chain_Node               *node;
+} Scheduler_priority_smp_Iterator;
+
+static void _Scheduler_priority_smp_Iterator_initialize(
+  Scheduler_priority_smp_Iterator      *iterator,
+  const Scheduler_priority_smp_Cluster *cluster
+)
+{
+  uint32_t index;
+
+  iterator->major = cluster->major;
+  for ( index = 0 ; index < 16 ; ++index )
+    iterator->minor[ index ] = cluster->minor[ index ];
+
+  iterator->ready = cluster->ready;
+  iterator->chain = NULL;
+  iterator->node = NULL;
+}
+
+static Thread_Control *_Scheduler_priority_smp_Iterator_next(
+  Scheduler_priority_smp_Iterator *iterator
+)
+{
+  Chain_Node *node = iterator->node;
+
+  while ( node == NULL || _Chain_Is_tail( iterator->chain, node ) ) {
+    Priority_bit_map_Control major;
+    Priority_bit_map_Control minor;
+    Priority_Control         priority;
+    uint32_t                 index;
+
+    if ( iterator->major == 0 )
+      return NULL;
+
+    /* This is _Priority_bit_map_Get_highest() on the copied bit maps */
+    _Bitfield_Find_first_bit( iterator->major, major );
+    _Bitfield_Find_first_bit( iterator->minor[ major ], minor );
+    priority = (_Priority_Bits_index( major ) << 4) +
+      _Priority_Bits_index( minor );
+
+    /* Consume this priority */
+    index = _Priority_Bits_index( _Priority_Major( priority ) );
+    iterator->minor[ index ] &= (Priority_bit_map_Control)
+      ~((uint32_t) _Priority_Mask( _Priority_Minor( priority ) ));
+    if ( iterator->minor[ index ] == 0 )
+      iterator->major &= (Priority_bit_map_Control)
+        ~((uint32_t) _Priority_Mask( _Priority_Major( priority ) ));
+
+    iterator->chain = &iterator->ready[ priority ];
+    node = _Chain_First( iterator->chain );
+  }
+
+  iterator->node = _Chain_Next( node );
+
+  return (Thread_Control *) node;
+}
+
+static bool _Scheduler_priority_smp_Is_executing(
+  const Thread_Control *the_thread
+)
+{
+  uint32_t cpu;
+
+  for ( cpu = 0 ; cpu < _SMP_Processor_count ; ++cpu ) {
+    if ( _Per_CPU_Information[ cpu ].executing == the_thread )
+      return true;
+  }
+
+  return false;
+}
+
+static void _Scheduler_priority_smp_Set_heir(
+  uint32_t        cpu,
+  Thread_Control *heir
+)
+{
+  Per_CPU_Control *per_cpu = &_Per_CPU_Information[ cpu ];
+
+  per_cpu->heir = heir;
+  if ( per_cpu->executing != heir )
+    per_cpu->dispatch_necessary = true;
+}
+
+static void _Scheduler_priority_smp_Schedule_cluster(
+  Scheduler_priority_smp_Control *control,
+  uint32_t                        cluster_index,
+  uint32_t                        cluster_count
+)
+{
+  Scheduler_priority_smp_Cluster  *cluster;
+  Scheduler_priority_smp_Iterator  iterator;
+  Thread_Control                 **pending = control->pending;
+  bool                            *assigned = control->assigned;
+  Thread_Control                  *candidate;
+  uint32_t                         cpu_count = 0;
+  uint32_t                         assigned_count = 0;
+  uint32_t                         pending_count = 0;
+  uint32_t                         cpu;
+
+  cluster = &control->clusters[ cluster_index ];
+
+  /*
+   *  Non-preemptible threads continue to execute on their core.
+   */
+  for ( cpu = cluster_index ; cpu < _SMP_Processor_count ;
+        cpu += cluster_count ) {
+    Thread_Control *executing = _Per_CPU_Information[ cpu ].executing;
+    Scheduler_priority_smp_Per_thread *sched_info =
+      (Scheduler_priority_smp_Per_thread *) executing->scheduler_info;
+
+    assigned[ cpu ] = false;
+    ++cpu_count;
+
+    if (
+      !executing->is_preemptible
+        && _States_Is_ready( executing->current_state )
+        && sched_info->cluster == cluster
+    ) {
+      _Scheduler_priority_smp_Set_heir( cpu, executing );
+      assigned[ cpu ] = true;
+      ++assigned_count;
+    }
+  }
+
+  /*
+   *  Visit the highest priority ready threads until each core has a
+   *  thread.  A thread which executes or is the heir on a core of the
+   *  cluster stays there.  Other threads wait for a free core.
+   */
+  _Scheduler_priority_smp_Iterator_initialize( &iterator, cluster );
+
+  while ( assigned_count + pending_count < cpu_count ) {
+    bool placed = false;
+
+    candidate = _Scheduler_priority_smp_Iterator_next( &iterator );
+    if ( candidate == NULL )
+      break;
+
+    for ( cpu = cluster_index ; cpu < _SMP_Processor_count ;
+          cpu += cluster_count ) {
+      if ( _Per_CPU_Information[ cpu ].executing == candidate ) {
+        if ( !assigned[ cpu ] ) {
+          _Scheduler_priority_smp_Set_heir( cpu, candidate );
+          assigned[ cpu ] = true;
+          ++assigned_count;
+        }
+        placed = true;
+        break;
+      }
+    }
+
+    if ( placed )
+      continue;
+
+    /*
+     *  A thread which still executes on a core of another cluster must
+     *  not start on a second core.  It gets a core of this cluster after
+     *  its core switched to another thread.
+     */
+    if ( _Scheduler_priority_smp_Is_executing( candidate ) )
+      continue;
+
+    for ( cpu = cluster_index ; cpu < _SMP_Processor_count ;
+          cpu += cluster_count ) {
+      if ( !assigned[ cpu ] && _Per_CPU_Information[ cpu ].heir == candidate ) {
+        assigned[ cpu ] = true;
+        ++assigned_count;
+        placed = true;
+        break;
+      }
+    }
+
+    if ( !placed )
+      pending[ pending_count++ ] = candidate;
+  }
+
+  /*
+   *  The remaining threads replace the heirs of the free cores.
+   */
+  for ( cpu = cluster_index ; cpu < _SMP_Processor_count && pending_count > 0 ;
+        cpu += cluster_count ) {
+    if ( !assigned[ cpu ] ) {
+      _Scheduler_priority_smp_Set_heir( cpu, pending[ --pending_count ] );
+      assigned[ cpu ] = true;
+    }
+  }
+}
+
+void _Scheduler_priority_smp_Schedule( void )
+{
+  Scheduler_priority_smp_Control *control =
+    (Scheduler_priority_smp_Control *) _Scheduler.information;
+  uint32_t cluster_count = _Scheduler_priority_smp_Get_cluster_count();
+  uint32_t cluster_index;
+
+  for ( cluster_index = 0 ; cluster_index < cluster_count ; ++cluster_index ) {
+    _Scheduler_priority_smp_Schedule_cluster(
+      control,
+      cluster_index,
+      cluster_count
+    );
+  }
+}
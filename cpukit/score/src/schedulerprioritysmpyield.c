@@ -0,0 +1,45 @@
+/**
+ *  @file
+ *
+ *  @ingroup ScoreScheduler
+ *
+ *  @brief Priority SMP Scheduler yield implementation.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/schedulerprioritysmp.h>
+#include <rtems/score/thread.h>
+
+void _Scheduler_priority_smp_Yield( void )
+{
+  ISR_Level       level;
+  Thread_Control *executing;
+
+  executing = _Thread_Executing;
+  _ISR_Disable( level );
+
+    _Scheduler_priority_smp_Requeue( executing );
+
+    _ISR_Flash( level );
+
+    _Scheduler_priority_smp_Schedule();
+
+    if ( !_Thread_Is_heir( executing ) )
+      _Thread_Dispatch_necessary = true;
+
+  _ISR_Enable( level );
+}
@@ -15,6 +15,10 @@
 #include <rtems/score/smplock.h>
 #include <rtems/score/smp.h>
 #include <rtems/score/isr.h>
+#if defined(__RTEMS_SMP_LOCK_MCS__)
+  #include <rtems/score/interr.h>
+  #include <rtems/score/percpu.h>
+#endif
 
 /*
  * Some debug stuff that is being left in, but disabled.  This will keep 
@@ -67,6 +71,256 @@
   #define debug_dump_log()
 #endif
 
+/*
+ * Ticket lock methods.  The dispenser is held only to draw a ticket, so
+ * waiting processors spin on the now serving field and not on the bus.
+ * The callers must disable interrupts.
+ */
+static void _SMP_lock_ticket_Dispenser_obtain(
+  SMP_lock_ticket_Control *lock
+)
+{
+  uint32_t   value = 1;
+  uint32_t   previous;
+
+  do {
+    RTEMS_COMPILER_MEMORY_BARRIER();
+    SMP_CPU_SWAP( &lock->dispenser, value, previous );
+    RTEMS_COMPILER_MEMORY_BARRIER();
+  } while (previous == 1);
+}
+
+static void _SMP_lock_ticket_Dispenser_release(
+  SMP_lock_ticket_Control *lock
+)
+{
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  lock->dispenser = 0;
+}
+
+void _SMP_lock_ticket_Initialize(
+  SMP_lock_ticket_Control *lock
+)
+{
+  lock->dispenser = 0;
+  lock->next_ticket = 0;
+  lock->now_serving = 0;
+}
+
+uint32_t _SMP_lock_ticket_Take(
+  SMP_lock_ticket_Control *lock
+)
+{
+  uint32_t ticket;
+
+  _SMP_lock_ticket_Dispenser_obtain( lock );
+  ticket = lock->next_ticket;
+  lock->next_ticket = ticket + 1;
+  _SMP_lock_ticket_Dispenser_release( lock );
+
+  return ticket;
+}
+
+bool _SMP_lock_ticket_Try_take(
+  SMP_lock_ticket_Control *lock
+)
+{
+  uint32_t ticket;
+  bool     is_free;
+
+  _SMP_lock_ticket_Dispenser_obtain( lock );
+  ticket = lock->next_ticket;
+  is_free = ticket == lock->now_serving;
+  if ( is_free )
+    lock->next_ticket = ticket + 1;
+  _SMP_lock_ticket_Dispenser_release( lock );
+
+  return is_free;
+}
+
+bool _SMP_lock_ticket_Is_served(
+  const SMP_lock_ticket_Control *lock,
+  uint32_t                       ticket
+)
+{
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  return lock->now_serving == ticket;
+}
+
+void _SMP_lock_ticket_Release(
+  SMP_lock_ticket_Control *lock
+)
+{
+  /* Only the owner writes the now serving field */
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  lock->now_serving = lock->now_serving + 1;
+}
+
+/*
+ * MCS lock methods.  The release uses the variant of Mellor-Crummey and
+ * Scott which needs only an atomic swap and no compare and swap.
+ */
+void _SMP_lock_MCS_Initialize(
+  SMP_lock_MCS_Control *lock
+)
+{
+  lock->tail = NULL;
+}
+
+void _SMP_lock_MCS_Obtain(
+  SMP_lock_MCS_Control *lock,
+  SMP_lock_MCS_node    *node
+)
+{
+  uintptr_t          previous;
+  SMP_lock_MCS_node *predecessor;
+
+  node->next = NULL;
+  node->waiting = 1;
+
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  SMP_CPU_SWAP( (uintptr_t *) &lock->tail, (uintptr_t) node, previous );
+  RTEMS_COMPILER_MEMORY_BARRIER();
+
+  predecessor = (SMP_lock_MCS_node *) previous;
+  if ( predecessor != NULL ) {
+    predecessor->next = node;
+
+    while ( node->waiting ) {
+      RTEMS_COMPILER_MEMORY_BARRIER();
+    }
+  }
+}
+
+void _SMP_lock_MCS_Release(
+  SMP_lock_MCS_Control *lock,
+  SMP_lock_MCS_node    *node
+)
+{
+  SMP_lock_MCS_node *successor = node->next;
+
+  if ( successor == NULL ) {
+    SMP_lock_MCS_node *usurper;
+    uintptr_t          previous;
+
+    /*
+     *  No successor is known, so try to empty the queue.
+     */
+    RTEMS_COMPILER_MEMORY_BARRIER();
+    SMP_CPU_SWAP( (uintptr_t *) &lock->tail, (uintptr_t) NULL, previous );
+    if ( (SMP_lock_MCS_node *) previous == node )
+      return;
+
+    /*
+     *  Other processors enqueued in the meantime.  Restore the tail.
+     *  Processors which found the queue empty after the first swap own the
+     *  lock now and our successors have to wait behind them.
+     */
+    SMP_CPU_SWAP( (uintptr_t *) &lock->tail, previous, previous );
+    usurper = (SMP_lock_MCS_node *) previous;
+
+    while ( (successor = node->next) == NULL ) {
+      RTEMS_COMPILER_MEMORY_BARRIER();
+    }
+
+    if ( usurper != NULL ) {
+      usurper->next = successor;
+      return;
+    }
+  }
+
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  successor->waiting = 0;
+}
+
+#if defined(__RTEMS_SMP_LOCK_MCS__)
+/*
+ * The simple locks use the queue nodes of the processor.  A node is in use
+ * while the processor waits for or owns a lock.  Interrupts are disabled
+ * while the nodes are allocated and freed.
+ */
+static SMP_lock_MCS_node *_SMP_lock_MCS_Allocate_node(void)
+{
+  Per_CPU_Control *per_cpu = &_Per_CPU_Information[ bsp_smp_processor_id() ];
+  uint32_t         used = per_cpu->smp_lock_nodes_used;
+  uint32_t         index = 0;
+
+  while ( (used & (1U << index)) != 0 ) {
+    ++index;
+
+    if ( index == SMP_LOCK_MCS_NODE_COUNT ) {
+      _Internal_error_Occurred(
+        INTERNAL_ERROR_CORE,
+        true,
+        INTERNAL_ERROR_OUT_OF_SMP_LOCK_NODES
+      );
+    }
+  }
+
+  per_cpu->smp_lock_nodes_used = used | (1U << index);
+
+  return &per_cpu->smp_lock_nodes[ index ];
+}
+
+static void _SMP_lock_MCS_Free_node(
+  SMP_lock_MCS_node *node
+)
+{
+  Per_CPU_Control *per_cpu = &_Per_CPU_Information[ bsp_smp_processor_id() ];
+  uint32_t         index = (uint32_t) (node - &per_cpu->smp_lock_nodes[ 0 ]);
+
+  per_cpu->smp_lock_nodes_used &= ~(1U << index);
+}
+#endif
+
+/*
+ * Obtain and release the simple lock with interrupts already disabled.
+ * These are shared by the simple and nested methods.
+ */
+static void _SMP_lock_spinlock_simple_Acquire(
+  SMP_lock_spinlock_simple_Control *lock
+)
+{
+#if defined(__RTEMS_SMP_LOCK_TICKET__)
+  uint32_t ticket = _SMP_lock_ticket_Take( lock );
+
+  while ( !_SMP_lock_ticket_Is_served( lock, ticket ) ) {
+    /* spin on the now serving field */
+  }
+#elif defined(__RTEMS_SMP_LOCK_MCS__)
+  SMP_lock_MCS_node *node = _SMP_lock_MCS_Allocate_node();
+
+  _SMP_lock_MCS_Obtain( &lock->queue, node );
+  lock->owner = node;
+#else
+  uint32_t   value = 1;
+  uint32_t   previous;
+
+  do {
+    RTEMS_COMPILER_MEMORY_BARRIER();
+    SMP_CPU_SWAP( lock, value, previous );
+    RTEMS_COMPILER_MEMORY_BARRIER();
+  } while (previous == 1);
+#endif
+}
+
+static void _SMP_lock_spinlock_simple_Surrender(
+  SMP_lock_spinlock_simple_Control *lock
+)
+{
+#if defined(__RTEMS_SMP_LOCK_TICKET__)
+  _SMP_lock_ticket_Release( lock );
+#elif defined(__RTEMS_SMP_LOCK_MCS__)
+  SMP_lock_MCS_node *node = lock->owner;
+
+  _SMP_lock_MCS_Release( &lock->queue, node );
+  _SMP_lock_MCS_Free_node( node );
+#else
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  *lock = 0;
+#endif
+}
+
 /*
  * SMP spinlock simple methods
  */
@@ -74,7 +328,14 @@ void _SMP_lock_spinlock_simple_Initialize(
   SMP_lock_spinlock_simple_Control *lock
 )
 {
+#if defined(__RTEMS_SMP_LOCK_TICKET__)
+  _SMP_lock_ticket_Initialize( lock );
+#elif defined(__RTEMS_SMP_LOCK_MCS__)
+  _SMP_lock_MCS_Initialize( &lock->queue );
+  lock->owner = NULL;
+#else
   *lock = 0;
+#endif
 }
 
 ISR_Level _SMP_lock_spinlock_simple_Obtain(
@@ -82,16 +343,10 @@ ISR_Level _SMP_lock_spinlock_simple_Obtain(
 )
 {
    ISR_Level  level = 0;
-   uint32_t   value = 1;
-   uint32_t   previous;
 
    /* Note: Disable provides an implicit memory barrier. */
   _ISR_Disable_on_this_core( level );
-   do {
-     RTEMS_COMPILER_MEMORY_BARRIER();
-     SMP_CPU_SWAP( lock, value, previous );
-     RTEMS_COMPILER_MEMORY_BARRIER();
-   } while (previous == 1);
+   _SMP_lock_spinlock_simple_Acquire( lock );
 
   return level;
 }
@@ -101,7 +356,7 @@ void _SMP_lock_spinlock_simple_Release(
   ISR_Level                        level
 )
 {
-   *lock = 0;
+   _SMP_lock_spinlock_simple_Surrender( lock );
    _ISR_Enable_on_this_core( level );
 }
 
@@ -112,7 +367,7 @@ void _SMP_lock_spinlock_nested_Initialize(
   SMP_lock_spinlock_nested_Control *lock
 )
 {
-  lock->lock = 0;
+  _SMP_lock_spinlock_simple_Initialize( &lock->lock );
   lock->count = 0;
   lock->cpu_id = -1;
 }
@@ -143,8 +398,7 @@ void _SMP_lock_spinlock_nested_Release(
     lock->cpu_id = -1;
     debug_logit( 'U', lock );
     lock->count  = 0;
-    RTEMS_COMPILER_MEMORY_BARRIER();
-    lock->lock = 0;
+    _SMP_lock_spinlock_simple_Surrender( &lock->lock );
   } else {
     debug_logit( 'u', lock );
     lock->count--;
@@ -158,8 +412,6 @@ ISR_Level _SMP_lock_spinlock_nested_Obtain(
 )
 {
   ISR_Level  level = 0;
-  uint32_t   value = 1;
-  uint32_t   previous;
   int        cpu_id;
 
   /* Note: Disable provides an implicit memory barrier. */
@@ -168,27 +420,19 @@ ISR_Level _SMP_lock_spinlock_nested_Obtain(
   cpu_id = bsp_smp_processor_id();
 
   /*
-   *  Attempt to obtain the lock.  If we do not get it immediately, then
-   *  do a single "monitor" iteration.  This should allow the loop to back
-   *  off the bus a bit and allow the other core to finish sooner.
+   *  Deal with nested calls from one cpu.  Only the owner sets the cpu_id
+   *  to its own identifier, so this check needs no lock.  It must be done
+   *  before the acquire since the ticket and MCS locks queue the caller.
    */
-  while (1) {
-    RTEMS_COMPILER_MEMORY_BARRIER();
-    SMP_CPU_SWAP( &lock->lock, value, previous );
-    RTEMS_COMPILER_MEMORY_BARRIER();
-    if ( previous == 0 ) {
-      /* was not locked */
-      break;
-    }
-
-    /* Deal with nested calls from one cpu */
-    if (cpu_id == lock->cpu_id) {
-      lock->count++;
-      debug_logit( 'l', lock );
-      return level;
-    }
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  if (cpu_id == lock->cpu_id) {
+    lock->count++;
+    debug_logit( 'l', lock );
+    return level;
   }
 
+  _SMP_lock_spinlock_simple_Acquire( &lock->lock );
+
   lock->cpu_id = cpu_id;
   lock->count = 1;
   debug_logit( 'L', lock );
@@ -0,0 +1,192 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreStack
+ *
+ * @brief Thread stack pool implementation.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <rtems/system.h>
+#include <rtems/score/address.h>
+#include <rtems/score/stackpool.h>
+#include <rtems/score/wkspace.h>
+
+/*
+ *  The size of a size class name is large enough for the name prefix and
+ *  the decimal digits of a 64-bit stack size.
+ */
+#define STACK_POOL_CLASS_NAME_SIZE 32
+
+typedef struct {
+  Workspace_Slab slab;
+  char           name[ STACK_POOL_CLASS_NAME_SIZE ];
+} Stack_pool_Class;
+
+static Stack_pool_Class *_Stack_pool_Classes;
+
+static void *_Stack_pool_Header_to_stack( Stack_pool_Header *header )
+{
+  return _Addresses_Add_offset( header, STACK_POOL_HEADER_SIZE );
+}
+
+static Stack_pool_Header *_Stack_pool_Stack_to_header( void *stack )
+{
+  return _Addresses_Subtract_offset( stack, STACK_POOL_HEADER_SIZE );
+}
+
+/*
+ *  Sets the name of a size class to "task stack" followed by the stack
+ *  size, so that the slab cache information tells the classes apart.
+ */
+static void _Stack_pool_Set_class_name( char *name, size_t stack_size )
+{
+  static const char prefix[] = "task stack ";
+  char              digits[ STACK_POOL_CLASS_NAME_SIZE ];
+  size_t            digit_count = 0;
+  size_t            i;
+
+  do {
+    digits[ digit_count++ ] = (char) ( '0' + stack_size % 10 );
+    stack_size /= 10;
+  } while ( stack_size != 0 );
+
+  memcpy( name, prefix, sizeof( prefix ) - 1 );
+  i = sizeof( prefix ) - 1;
+  while ( digit_count > 0 )
+    name[ i++ ] = digits[ --digit_count ];
+  name[ i ] = '\0';
+}
+
+void _Stack_pool_Initialize( size_t stack_space_size )
+{
+  const Stack_pool_Configuration *config = &_Stack_pool_Configuration;
+  uint32_t                        i;
+
+  _Stack_pool_Classes = _Workspace_Allocate_or_fatal_error(
+    config->class_count * sizeof( *_Stack_pool_Classes )
+  );
+
+  for ( i = 0 ; i < config->class_count ; ++i ) {
+    const Stack_pool_Class_configuration *class_config;
+    Stack_pool_Class                     *size_class;
+    uint32_t                              free_limit;
+
+    class_config = &config->classes[ i ];
+    size_class = &_Stack_pool_Classes[ i ];
+
+    _Stack_pool_Set_class_name( size_class->name, class_config->stack_size );
+    _Workspace_Slab_initialize(
+      &size_class->slab,
+      size_class->name,
+      STACK_POOL_HEADER_SIZE + class_config->stack_size
+    );
+
+    free_limit = class_config->maximum_free_count;
+    if ( free_limit == 0 )
+      free_limit = UINT32_MAX;
+
+    _Workspace_Slab_Set_free_limit( &size_class->slab, free_limit );
+    _Workspace_Slab_reserve( &size_class->slab, class_config->initial_count );
+  }
+}
+
+static Stack_pool_Header *_Stack_pool_Allocate_header(
+  Workspace_Slab *size_class,
+  size_t          stack_size
+)
+{
+  if ( size_class != NULL )
+    return _Workspace_Slab_allocate( size_class );
+
+  return _Workspace_Allocate( STACK_POOL_HEADER_SIZE + stack_size );
+}
+
+/*
+ *  Frees the cached stacks of the other size classes to the workspace
+ *  until the allocation succeeds.  Each size class keeps the number of
+ *  stacks it reserved during system initialization, so that the warm
+ *  stacks survive a temporary exhaustion of the workspace.
+ */
+static Stack_pool_Header *_Stack_pool_Drain_and_allocate_header(
+  Workspace_Slab *size_class,
+  size_t          stack_size
+)
+{
+  const Stack_pool_Configuration *config = &_Stack_pool_Configuration;
+  Stack_pool_Header              *header = NULL;
+  uint32_t                        i;
+
+  for ( i = 0 ; i < config->class_count && header == NULL ; ++i ) {
+    Workspace_Slab *other = &_Stack_pool_Classes[ i ].slab;
+
+    if (
+      other != size_class
+        && _Workspace_Slab_drain( other, config->classes[ i ].initial_count )
+    ) {
+      header = _Stack_pool_Allocate_header( size_class, stack_size );
+    }
+  }
+
+  return header;
+}
+
+void *_Stack_pool_Allocate( size_t stack_size )
+{
+  const Stack_pool_Configuration *config = &_Stack_pool_Configuration;
+  Workspace_Slab                 *size_class = NULL;
+  Stack_pool_Header              *header;
+  uint32_t                        i;
+
+  for ( i = 0 ; i < config->class_count ; ++i ) {
+    if ( stack_size <= config->classes[ i ].stack_size ) {
+      size_class = &_Stack_pool_Classes[ i ].slab;
+      break;
+    }
+  }
+
+  header = _Stack_pool_Allocate_header( size_class, stack_size );
+
+  /*
+   *  The workspace is exhausted, but the other size classes may cache
+   *  stacks which are of no use for this request.
+   */
+  if ( header == NULL )
+    header = _Stack_pool_Drain_and_allocate_header( size_class, stack_size );
+
+  if ( header == NULL )
+    return NULL;
+
+  header->size_class = size_class;
+
+  return _Stack_pool_Header_to_stack( header );
+}
+
+void _Stack_pool_Free( void *stack )
+{
+  Stack_pool_Header *header;
+
+  if ( stack == NULL )
+    return;
+
+  header = _Stack_pool_Stack_to_header( stack );
+
+  if ( header->size_class != NULL )
+    _Workspace_Slab_free( header->size_class, header );
+  else
+    _Workspace_Free( header );
+}
@@ -79,6 +79,21 @@ void _Thread_Handler_initialization(void)
 
   _Thread_Maximum_extensions = maximum_extensions;
 
+  #if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
+    _Workspace_Slab_initialize(
+      &_Thread_Fp_context_slab,
+      "FP contexts",
+      CONTEXT_FP_SIZE
+    );
+  #endif
+
+  if ( maximum_extensions )
+    _Workspace_Slab_initialize(
+      &_Thread_Extensions_slab,
+      "extension areas",
+      (maximum_extensions + 1) * sizeof( void * )
+    );
+
   _Thread_Ticks_per_timeslice  = ticks_per_timeslice;
 
   #if defined(RTEMS_MULTIPROCESSING)
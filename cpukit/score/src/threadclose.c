@@ -54,6 +54,8 @@ void _Thread_Close(
 
   _Thread_Disable_dispatch();
 
+  _User_extensions_Remove_iterators( the_thread );
+
   /*
    *  Now we are in a dispatching critical section again and we
    *  can take the thread OUT of the published set.  It is invalid
@@ -87,7 +89,10 @@ void _Thread_Close(
 #endif
   the_thread->fp_context = NULL;
 
-  _Workspace_Free( the_thread->Start.fp_context );
+  _Workspace_Slab_free(
+    &_Thread_Fp_context_slab,
+    the_thread->Start.fp_context
+  );
 #endif
 
   /*
@@ -97,6 +102,6 @@ void _Thread_Close(
   _Thread_Stack_Free( the_thread );
   the_thread->Start.stack = NULL;
 
-  _Workspace_Free( the_thread->extensions );
+  _Workspace_Slab_free( &_Thread_Extensions_slab, the_thread->extensions );
   the_thread->extensions = NULL;
 }
@@ -117,7 +117,7 @@ bool _Thread_Initialize(
    */
   #if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
     if ( is_fp ) {
-      fp_area = _Workspace_Allocate( CONTEXT_FP_SIZE );
+      fp_area = _Workspace_Slab_allocate( &_Thread_Fp_context_slab );
       if ( !fp_area )
         goto failed;
       fp_area = _Context_Fp_start( fp_area, 0 );
@@ -140,9 +140,7 @@ bool _Thread_Initialize(
    *  Allocate the extensions area for this thread
    */
   if ( _Thread_Maximum_extensions ) {
-    extensions_area = _Workspace_Allocate(
-      (_Thread_Maximum_extensions + 1) * sizeof( void * )
-    );
+    extensions_area = _Workspace_Slab_allocate( &_Thread_Extensions_slab );
     if ( !extensions_area )
       goto failed;
   }
@@ -226,10 +224,10 @@ failed:
   for ( i=0 ; i <= THREAD_API_LAST ; i++ )
     _Workspace_Free( the_thread->API_Extensions[i] );
 
-  _Workspace_Free( extensions_area );
+  _Workspace_Slab_free( &_Thread_Extensions_slab, extensions_area );
 
   #if ( CPU_HARDWARE_FP == TRUE ) || ( CPU_SOFTWARE_FP == TRUE )
-    _Workspace_Free( fp_area );
+    _Workspace_Slab_free( &_Thread_Fp_context_slab, fp_area );
   #endif
 
    _Workspace_Free( sched );
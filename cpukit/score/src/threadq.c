@@ -2,7 +2,7 @@
  *  Thread Queue Handler
  *
  *
- *  COPYRIGHT (c) 1989-2008.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -18,11 +18,41 @@
 #include <rtems/score/chain.h>
 #include <rtems/score/isr.h>
 #include <rtems/score/object.h>
+#include <rtems/score/rbtree.h>
 #include <rtems/score/states.h>
 #include <rtems/score/thread.h>
 #include <rtems/score/threadq.h>
 #include <rtems/score/tqdata.h>
 
+/*
+ *  _Thread_queue_Compare_priority
+ *
+ *  This routine orders the threads of a priority thread queue.  Equal
+ *  priorities compare as equal, so the red-black tree inserts a thread
+ *  after all threads of its priority.
+ */
+
+int _Thread_queue_Compare_priority(
+  const RBTree_Node *left,
+  const RBTree_Node *right
+)
+{
+  Priority_Control left_priority =
+    _RBTree_Container_of( left, Thread_Control, Wait.Priority_node )
+      ->Wait.queue_priority;
+  Priority_Control right_priority =
+    _RBTree_Container_of( right, Thread_Control, Wait.Priority_node )
+      ->Wait.queue_priority;
+
+  if ( left_priority < right_priority )
+    return -1;
+
+  if ( left_priority > right_priority )
+    return 1;
+
+  return 0;
+}
+
 /*
  *  _Thread_queue_Initialize
  *
@@ -49,13 +79,16 @@ void _Thread_queue_Initialize(
   the_thread_queue->timeout_status = timeout_status;
   the_thread_queue->sync_state     = THREAD_BLOCKING_OPERATION_SYNCHRONIZED;
 
-  if ( the_discipline == THREAD_QUEUE_DISCIPLINE_PRIORITY ) {
-    uint32_t   index;
+  #if defined(RTEMS_SMP)
+    _SMP_lock_spinlock_simple_Initialize( &the_thread_queue->Lock );
+  #endif
 
-    for( index=0 ;
-         index < TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS ;
-         index++)
-      _Chain_Initialize_empty( &the_thread_queue->Queues.Priority[index] );
+  if ( the_discipline == THREAD_QUEUE_DISCIPLINE_PRIORITY ) {
+    _RBTree_Initialize_empty(
+      &the_thread_queue->Queues.Priority,
+      _Thread_queue_Compare_priority,
+      false
+    );
   } else { /* must be THREAD_QUEUE_DISCIPLINE_FIFO */
     _Chain_Initialize_empty( &the_thread_queue->Queues.Fifo );
   }
@@ -48,6 +48,8 @@ bool _Thread_Restart(
 
     _Thread_Set_transient( the_thread );
 
+    _User_extensions_Remove_iterators( the_thread );
+
     _Thread_Reset( the_thread, pointer_argument, numeric_argument );
 
     _Thread_Load_environment( the_thread );
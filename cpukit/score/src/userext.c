@@ -7,7 +7,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2008.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -25,18 +25,182 @@
 #include <rtems/score/wkspace.h>
 #include <string.h>
 
+/*
+ *  Sets the handler array of a hook to the next part of the storage.
+ */
+#define USER_EXTENSIONS_CARVE( _table, _hook, _storage, _size ) \
+  do { \
+    (_table)->_hook = (void *) (_storage); \
+    (_storage) += (_size) * sizeof( *(_table)->_hook ); \
+  } while ( 0 )
+
+/*
+ *  Places the handler arrays of dispatch table buffer @a index into the
+ *  storage for @a capacity extension sets.
+ */
+static void _User_extensions_Carve_dispatch_table(
+  uint32_t  index,
+  char     *storage,
+  uint32_t  capacity
+)
+{
+  User_extensions_Dispatch_table *table;
+  size_t                          size = capacity + 1;
+
+  table = &_User_extensions_Dispatch_tables[ index ];
+  storage += index * USER_EXTENSIONS_DISPATCH_STORAGE_SIZE( capacity ) / 2;
+
+  USER_EXTENSIONS_CARVE( table, thread_create, storage, size );
+  USER_EXTENSIONS_CARVE( table, thread_start, storage, size );
+  USER_EXTENSIONS_CARVE( table, thread_restart, storage, size );
+  USER_EXTENSIONS_CARVE( table, thread_delete, storage, size );
+  USER_EXTENSIONS_CARVE( table, thread_switch, storage, size );
+  USER_EXTENSIONS_CARVE( table, thread_begin, storage, size );
+  USER_EXTENSIONS_CARVE( table, fatal, storage, size );
+}
+
+bool _User_extensions_Compile_dispatch_table( void )
+{
+  User_extensions_Dispatch_table *table;
+  const Chain_Node               *the_node;
+  const User_extensions_Table    *callouts;
+  uint32_t                        index;
+  uint32_t                        count = 0;
+  uint32_t                        capacity;
+  char                           *storage = NULL;
+  char                           *old_storage = NULL;
+  size_t                          create = 0;
+  size_t                          start = 0;
+  size_t                          restart = 0;
+  size_t                          delete = 0;
+  size_t                          switch_ = 0;
+  size_t                          begin = 0;
+  size_t                          fatal = 0;
+
+  for ( the_node = _Chain_First( &_User_extensions_List );
+        !_Chain_Is_tail( &_User_extensions_List, the_node ) ;
+        the_node = the_node->next ) {
+    ++count;
+  }
+
+  /*
+   *  Compile into the buffer which is not in use by the dispatchers.
+   */
+  if ( _User_extensions_Dispatch == &_User_extensions_Dispatch_tables[ 0 ] )
+    index = 1;
+  else
+    index = 0;
+
+  table = &_User_extensions_Dispatch_tables[ index ];
+  capacity = _User_extensions_Dispatch_capacity;
+
+  if ( count > capacity ) {
+    capacity = count + rtems_resource_maximum_per_allocation(
+      rtems_configuration_get_maximum_extensions()
+    );
+
+    storage = _Workspace_Allocate(
+      USER_EXTENSIONS_DISPATCH_STORAGE_SIZE( capacity )
+    );
+    if ( storage == NULL )
+      return false;
+
+    old_storage = (char *) _User_extensions_Dispatch_tables[ 0 ].thread_create;
+    _User_extensions_Carve_dispatch_table( index, storage, capacity );
+  }
+
+  for ( the_node = _Chain_First( &_User_extensions_List );
+        !_Chain_Is_tail( &_User_extensions_List, the_node ) ;
+        the_node = the_node->next ) {
+    callouts = &((const User_extensions_Control *) the_node)->Callouts;
+
+    if ( callouts->thread_create != NULL )
+      table->thread_create[ create++ ] = callouts->thread_create;
+    if ( callouts->thread_start != NULL )
+      table->thread_start[ start++ ] = callouts->thread_start;
+    if ( callouts->thread_restart != NULL )
+      table->thread_restart[ restart++ ] = callouts->thread_restart;
+    if ( callouts->thread_switch != NULL )
+      table->thread_switch[ switch_++ ] = callouts->thread_switch;
+    if ( callouts->thread_begin != NULL )
+      table->thread_begin[ begin++ ] = callouts->thread_begin;
+  }
+
+  for ( the_node = _Chain_Last( &_User_extensions_List );
+        !_Chain_Is_head( &_User_extensions_List, the_node ) ;
+        the_node = the_node->previous ) {
+    callouts = &((const User_extensions_Control *) the_node)->Callouts;
+
+    if ( callouts->thread_delete != NULL )
+      table->thread_delete[ delete++ ] = callouts->thread_delete;
+    if ( callouts->fatal != NULL )
+      table->fatal[ fatal++ ] = callouts->fatal;
+  }
+
+  table->thread_create[ create ] = NULL;
+  table->thread_start[ start ] = NULL;
+  table->thread_restart[ restart ] = NULL;
+  table->thread_delete[ delete ] = NULL;
+  table->thread_switch[ switch_ ] = NULL;
+  table->thread_begin[ begin ] = NULL;
+  table->fatal[ fatal ] = NULL;
+
+  /*
+   *  The table must be complete before the dispatchers may see it.
+   */
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  _User_extensions_Dispatch = table;
+
+  /*
+   *  The previous table is no longer in use.  Our caller locked the
+   *  allocator mutex and disabled thread dispatching.  The thread create
+   *  and delete dispatchers may block, but their callers locked the
+   *  allocator mutex too.  The thread exitted dispatcher does not use the
+   *  table.  All other dispatchers run with thread dispatching disabled.
+   */
+  if ( capacity != _User_extensions_Dispatch_capacity ) {
+    _User_extensions_Carve_dispatch_table( 1 - index, storage, capacity );
+    _User_extensions_Dispatch_capacity = capacity;
+    _Workspace_Free( old_storage );
+  }
+
+  return true;
+}
+
 void _User_extensions_Handler_initialization(void)
 {
   User_extensions_Control *extension;
   uint32_t                 i;
   uint32_t                 number_of_extensions;
   User_extensions_Table   *initial_extensions;
+  uint32_t                 capacity;
+  char                    *storage;
 
   number_of_extensions = Configuration.number_of_initial_extensions;
   initial_extensions   = Configuration.User_extension_table;
 
   _Chain_Initialize_empty( &_User_extensions_List );
-  _Chain_Initialize_empty( &_User_extensions_Switches_list );
+  _Chain_Initialize_empty( &_User_extensions_Iterators );
+
+  /*
+   *  The dispatch table buffers hold all extension sets of the configuration
+   *  so that they only grow for unlimited extension objects.
+   */
+  capacity = number_of_extensions + USER_EXTENSIONS_API_SETS
+    + rtems_resource_maximum_per_allocation(
+        rtems_configuration_get_maximum_extensions()
+      );
+
+  storage = _Workspace_Allocate_or_fatal_error(
+    USER_EXTENSIONS_DISPATCH_STORAGE_SIZE( capacity )
+  );
+
+  _User_extensions_Carve_dispatch_table( 0, storage, capacity );
+  _User_extensions_Carve_dispatch_table( 1, storage, capacity );
+  _User_extensions_Dispatch_capacity = capacity;
+  _User_extensions_Dispatch = NULL;
+
+  (void) _User_extensions_Compile_dispatch_table();
 
   if ( initial_extensions ) {
     extension = (User_extensions_Control *)
@@ -51,9 +215,11 @@ void _User_extensions_Handler_initialization(void)
     );
 
     for ( i = 0 ; i < number_of_extensions ; i++ ) {
-      _User_extensions_Add_set_with_table (extension, &initial_extensions[i]);
+      (void) _User_extensions_Add_set_with_table(
+        extension,
+        &initial_extensions[i]
+      );
       extension++;
     }
   }
 }
-
@@ -7,7 +7,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2007.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -26,12 +26,26 @@ void _User_extensions_Remove_set (
   User_extensions_Control  *the_extension
 )
 {
+  Chain_Node *the_node;
+
+  /*
+   *  Our caller disabled thread dispatching.  Move the thread exitted
+   *  iterators positioned at this set to the previous set.
+   */
+  for ( the_node = _Chain_First( &_User_extensions_Iterators );
+        !_Chain_Is_tail( &_User_extensions_Iterators, the_node ) ;
+        the_node = the_node->next ) {
+    User_extensions_Iterator *iter = (User_extensions_Iterator *) the_node;
+
+    if ( iter->position == &the_extension->Node )
+      iter->position = the_extension->Node.previous;
+  }
+
   _Chain_Extract( &the_extension->Node );
 
   /*
-   * If a switch handler is present, remove it.
+   * The dispatch table only shrinks, so this cannot fail.
    */
 
-  if ( the_extension->Callouts.thread_switch != NULL )
-    _Chain_Extract( &the_extension->Switch.Node );
+  (void) _User_extensions_Compile_dispatch_table();
 }
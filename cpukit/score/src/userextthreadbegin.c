@@ -7,7 +7,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2007.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -20,23 +20,19 @@
 #endif
 
 #include <rtems/system.h>
+#include <rtems/score/thread.h>
 #include <rtems/score/userext.h>
 
 void _User_extensions_Thread_begin (
   Thread_Control *executing
 )
 {
-  Chain_Node              *the_node;
-  User_extensions_Control *the_extension;
+  User_extensions_thread_begin_extension *the_begin;
 
-  for ( the_node = _Chain_First( &_User_extensions_List );
-        !_Chain_Is_tail( &_User_extensions_List, the_node ) ;
-        the_node = the_node->next ) {
-
-    the_extension = (User_extensions_Control *) the_node;
-
-    if ( the_extension->Callouts.thread_begin != NULL )
-      (*the_extension->Callouts.thread_begin)( executing );
+  for ( the_begin = _User_extensions_Dispatch->thread_begin ;
+        *the_begin != NULL ;
+        ++the_begin ) {
+    (**the_begin)( executing );
   }
 }
 
@@ -44,17 +40,65 @@ void _User_extensions_Thread_exitted (
   Thread_Control *executing
 )
 {
-  Chain_Node              *the_node;
-  User_extensions_Control *the_extension;
+  User_extensions_Iterator                 iter;
+  User_extensions_thread_exitted_extension the_exitted;
+  const Chain_Node                        *the_node;
+
+  /*
+   *  The handlers run with thread dispatching enabled, so extension sets
+   *  may be added or removed in the meantime.  The iterator is advanced
+   *  with thread dispatching disabled and _User_extensions_Remove_set()
+   *  moves it off a removed set, see User_extensions_Iterator.
+   */
+  iter.executing = executing;
+
+  _Thread_Disable_dispatch();
+    iter.position = _Chain_Last( &_User_extensions_List );
+    _Chain_Append_unprotected( &_User_extensions_Iterators, &iter.Node );
+  _Thread_Enable_dispatch();
+
+  while ( true ) {
+    the_exitted = NULL;
+
+    _Thread_Disable_dispatch();
+      the_node = iter.position;
+
+      while (
+        the_exitted == NULL
+          && !_Chain_Is_head( &_User_extensions_List, the_node )
+      ) {
+        the_exitted = ((const User_extensions_Control *) the_node)
+          ->Callouts.thread_exitted;
+        the_node = the_node->previous;
+      }
+
+      iter.position = the_node;
 
-  for ( the_node = _Chain_Last( &_User_extensions_List );
-        !_Chain_Is_head( &_User_extensions_List, the_node ) ;
-        the_node = the_node->previous ) {
+      if ( the_exitted == NULL )
+        _Chain_Extract_unprotected( &iter.Node );
+    _Thread_Enable_dispatch();
+
+    if ( the_exitted == NULL )
+      break;
+
+    (*the_exitted)( executing );
+  }
+}
+
+void _User_extensions_Remove_iterators (
+  Thread_Control *the_thread
+)
+{
+  Chain_Node *the_node;
+  Chain_Node *next;
 
-    the_extension = (User_extensions_Control *) the_node;
+  for ( the_node = _Chain_First( &_User_extensions_Iterators );
+        !_Chain_Is_tail( &_User_extensions_Iterators, the_node ) ;
+        the_node = next ) {
+    next = the_node->next;
 
-    if ( the_extension->Callouts.thread_exitted != NULL )
-      (*the_extension->Callouts.thread_exitted)( executing );
+    if ( ((User_extensions_Iterator *) the_node)->executing == the_thread )
+      _Chain_Extract_unprotected( the_node );
   }
 }
 
@@ -64,16 +108,17 @@ void _User_extensions_Fatal (
   Internal_errors_t       the_error
 )
 {
-  Chain_Node              *the_node;
-  User_extensions_Control *the_extension;
+  const User_extensions_Dispatch_table *table = _User_extensions_Dispatch;
+  User_extensions_fatal_extension      *the_fatal;
 
-  for ( the_node = _Chain_Last( &_User_extensions_List );
-        !_Chain_Is_head( &_User_extensions_List, the_node ) ;
-        the_node = the_node->previous ) {
+  /*
+   * A fatal error may occur before the handler is initialized.
+   */
 
-    the_extension = (User_extensions_Control *) the_node;
+  if ( table == NULL )
+    return;
 
-    if ( the_extension->Callouts.fatal != NULL )
-      (*the_extension->Callouts.fatal)( the_source, is_internal, the_error );
+  for ( the_fatal = table->fatal ; *the_fatal != NULL ; ++the_fatal ) {
+    (**the_fatal)( the_source, is_internal, the_error );
   }
 }
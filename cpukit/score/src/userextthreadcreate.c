@@ -7,7 +7,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2007.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -26,24 +26,15 @@ bool _User_extensions_Thread_create (
   Thread_Control *the_thread
 )
 {
-  Chain_Node              *the_node;
-  User_extensions_Control *the_extension;
-  bool                     status;
-
-  for ( the_node = _Chain_First( &_User_extensions_List );
-        !_Chain_Is_tail( &_User_extensions_List, the_node ) ;
-        the_node = the_node->next ) {
-
-    the_extension = (User_extensions_Control *) the_node;
-
-    if ( the_extension->Callouts.thread_create != NULL ) {
-      status = (*the_extension->Callouts.thread_create)(
-        _Thread_Executing,
-        the_thread
-      );
-      if ( !status )
-        return false;
-    }
+  User_extensions_thread_create_extension *the_create;
+  bool                                     status;
+
+  for ( the_create = _User_extensions_Dispatch->thread_create ;
+        *the_create != NULL ;
+        ++the_create ) {
+    status = (**the_create)( _Thread_Executing, the_thread );
+    if ( !status )
+      return false;
   }
 
   return true;
@@ -7,7 +7,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2007.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -26,19 +26,11 @@ void _User_extensions_Thread_delete (
   Thread_Control *the_thread
 )
 {
-  Chain_Node              *the_node;
-  User_extensions_Control *the_extension;
+  User_extensions_thread_delete_extension *the_delete;
 
-  for ( the_node = _Chain_Last( &_User_extensions_List );
-        !_Chain_Is_head( &_User_extensions_List, the_node ) ;
-        the_node = the_node->previous ) {
-
-    the_extension = (User_extensions_Control *) the_node;
-
-    if ( the_extension->Callouts.thread_delete != NULL )
-      (*the_extension->Callouts.thread_delete)(
-        _Thread_Executing,
-        the_thread
-      );
+  for ( the_delete = _User_extensions_Dispatch->thread_delete ;
+        *the_delete != NULL ;
+        ++the_delete ) {
+    (**the_delete)( _Thread_Executing, the_thread );
   }
 }
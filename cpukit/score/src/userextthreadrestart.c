@@ -7,7 +7,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2007.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -26,19 +26,11 @@ void _User_extensions_Thread_restart (
   Thread_Control *the_thread
 )
 {
-  Chain_Node              *the_node;
-  User_extensions_Control *the_extension;
+  User_extensions_thread_restart_extension *the_restart;
 
-  for ( the_node = _Chain_First( &_User_extensions_List );
-        !_Chain_Is_tail( &_User_extensions_List, the_node ) ;
-        the_node = the_node->next ) {
-
-    the_extension = (User_extensions_Control *) the_node;
-
-    if ( the_extension->Callouts.thread_restart != NULL )
-      (*the_extension->Callouts.thread_restart)(
-        _Thread_Executing,
-        the_thread
-      );
+  for ( the_restart = _User_extensions_Dispatch->thread_restart ;
+        *the_restart != NULL ;
+        ++the_restart ) {
+    (**the_restart)( _Thread_Executing, the_thread );
   }
 }
@@ -7,7 +7,7 @@
  */
 
 /*
- *  COPYRIGHT (c) 1989-2007.
+ *  COPYRIGHT (c) 1989-2012.
  *  On-Line Applications Research Corporation (OAR).
  *
  *  The license and distribution terms for this file may be
@@ -27,15 +27,11 @@ void _User_extensions_Thread_switch (
   Thread_Control *heir
 )
 {
-  Chain_Node                     *the_node;
-  User_extensions_Switch_control *the_extension_switch;
+  User_extensions_thread_switch_extension *the_switch;
 
-  for ( the_node = _Chain_First( &_User_extensions_Switches_list );
-        !_Chain_Is_tail( &_User_extensions_Switches_list, the_node ) ;
-        the_node = the_node->next ) {
-
-    the_extension_switch = (User_extensions_Switch_control *) the_node;
-
-    (*the_extension_switch->thread_switch)( executing, heir );
+  for ( the_switch = _User_extensions_Dispatch->thread_switch ;
+        *the_switch != NULL ;
+        ++the_switch ) {
+    (**the_switch)( executing, heir );
   }
 }
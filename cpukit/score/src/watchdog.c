@@ -34,6 +34,34 @@ void _Watchdog_Handler_initialization( void )
   _Watchdog_Sync_level = 0;
   _Watchdog_Ticks_since_boot = 0;
 
-  _Chain_Initialize_empty( &_Watchdog_Ticks_chain );
-  _Chain_Initialize_empty( &_Watchdog_Seconds_chain );
+  _Watchdog_Header_initialize( &_Watchdog_Ticks_header );
+  _Watchdog_Header_initialize( &_Watchdog_Seconds_header );
 }
+
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+/*
+ *  _Watchdog_Compare
+ *
+ *  This routine orders two watchdogs of a watchdog set by their
+ *  expiration time.  The difference is evaluated as a signed value
+ *  since the current time of the set may wrap around.
+ */
+
+int _Watchdog_Compare(
+  const RBTree_Node *first,
+  const RBTree_Node *second
+)
+{
+  int64_t difference = (int64_t)
+    ( _Watchdog_From_tree_node( first )->expire -
+      _Watchdog_From_tree_node( second )->expire );
+
+  if ( difference > 0 )
+    return 1;
+
+  if ( difference < 0 )
+    return -1;
+
+  return 0;
+}
+#endif
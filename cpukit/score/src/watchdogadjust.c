@@ -21,19 +21,19 @@
 /*
  *  _Watchdog_Adjust
  *
- *  This routine adjusts the delta chain backward or forward in response
+ *  This routine adjusts the watchdog set backward or forward in response
  *  to a time change.
  *
  *  Input parameters:
- *    header    - pointer to the delta chain to be adjusted
- *    direction - forward or backward adjustment to delta chain
+ *    header    - pointer to the watchdog set to be adjusted
+ *    direction - forward or backward adjustment to watchdog set
  *    units     - units to adjust
  *
  *  Output parameters:
  */
 
 void _Watchdog_Adjust(
-  Chain_Control               *header,
+  Watchdog_Header             *header,
   Watchdog_Adjust_directions   direction,
   Watchdog_Interval            units
 )
@@ -42,6 +42,30 @@ void _Watchdog_Adjust(
 
   _ISR_Disable( level );
 
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+  /*
+   *  The expiration times are absolute, so only the current time of the
+   *  set has to move.  A forward adjustment advances all but one unit here
+   *  and lets _Watchdog_Tickle() advance the last unit and fire all
+   *  watchdogs which expired.
+   */
+  switch ( direction ) {
+    case WATCHDOG_BACKWARD:
+      header->current -= units;
+      break;
+    case WATCHDOG_FORWARD:
+      if ( units ) {
+        header->current += units - 1;
+
+        _ISR_Enable( level );
+
+        _Watchdog_Tickle( header );
+
+        return;
+      }
+      break;
+  }
+#else
   /*
    * NOTE: It is safe NOT to make 'header' a pointer
    *       to volatile data (contrast this with watchdoginsert.c)
@@ -51,7 +75,7 @@ void _Watchdog_Adjust(
    *
    *       Till Straumann, 7/2003
    */
-  if ( !_Chain_Is_empty( header ) ) {
+  if ( !_Watchdog_Is_empty( header ) ) {
     switch ( direction ) {
       case WATCHDOG_BACKWARD:
         _Watchdog_First( header )->delta_interval += units;
@@ -71,13 +95,14 @@ void _Watchdog_Adjust(
 
             _ISR_Disable( level );
 
-            if ( _Chain_Is_empty( header ) )
+            if ( _Watchdog_Is_empty( header ) )
               break;
           }
         }
         break;
     }
   }
+#endif
 
   _ISR_Enable( level );
 
@@ -21,7 +21,7 @@
 #include <rtems/score/watchdog.h>
 
 void _Watchdog_Adjust_to_chain(
-  Chain_Control               *header,
+  Watchdog_Header             *header,
   Watchdog_Interval            units_arg,
   Chain_Control               *to_fire
 
@@ -37,11 +37,30 @@ void _Watchdog_Adjust_to_chain(
 
   _ISR_Disable( level );
 
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+  header->current += units;
+
+  while ( 1 ) {
+    first = _Watchdog_First( header );
+    if ( first == NULL || !_Watchdog_Is_expired( header, first ) )
+      break;
+
+    /*
+     *  The watchdog stays active but is no longer in the tree.  Thus
+     *  _Watchdog_Remove() extracts it from the chain to fire.
+     */
+    _RBTree_Extract_unprotected( &header->Watchdogs, &first->Tree_node );
+    first->header = NULL;
+    _Chain_Append_unprotected( to_fire, &first->Node );
+
+    _ISR_Flash( level );
+  }
+#else
   while ( 1 ) {
     if ( units <= 0 ) {
       break;
     }
-    if ( _Chain_Is_empty( header ) ) {
+    if ( _Watchdog_Is_empty( header ) ) {
       break;
     }
     first = _Watchdog_First( header );
@@ -68,14 +87,14 @@ void _Watchdog_Adjust_to_chain(
 
       _ISR_Flash( level );
 
-      if ( _Chain_Is_empty( header ) )
+      if ( _Watchdog_Is_empty( header ) )
         break;
       first = _Watchdog_First( header );
       if ( first->delta_interval != 0 )
         break;
     }
   }
+#endif
 
   _ISR_Enable( level );
 }
-
@@ -0,0 +1,58 @@
+/**
+ *  @file watchdogadvance.c
+ *
+ *  This is used by the Timer Server task.
+ */
+
+/*  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/watchdog.h>
+
+void _Watchdog_Advance(
+  Watchdog_Header             *header,
+  Watchdog_Interval            units
+)
+{
+  ISR_Level          level;
+#if !defined(__RTEMS_WATCHDOG_RBTREE__)
+  Watchdog_Control  *the_watchdog;
+#endif
+
+  _ISR_Disable( level );
+
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+  header->current += units;
+#else
+  /*
+   *  Consume the units along the chain.  Each watchdog which expires is
+   *  left with a delta of zero so that it fires together with its
+   *  predecessors.  The expired watchdogs are visited with interrupts
+   *  disabled, but they will be removed soon anyway.
+   */
+  for ( the_watchdog = _Watchdog_First( header ) ;
+        units != 0 && _Watchdog_Next( the_watchdog ) != NULL ;
+        the_watchdog = _Watchdog_Next( the_watchdog ) ) {
+    if ( units < the_watchdog->delta_interval ) {
+      the_watchdog->delta_interval -= units;
+      break;
+    }
+
+    units -= the_watchdog->delta_interval;
+    the_watchdog->delta_interval = 0;
+  }
+#endif
+
+  _ISR_Enable( level );
+}
@@ -18,6 +18,50 @@
 #include <rtems/score/isr.h>
 #include <rtems/score/watchdog.h>
 
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+
+/*
+ *  _Watchdog_Insert
+ *
+ *  This routine inserts a watchdog timer into the tree of the watchdog
+ *  set.  The expiration time is the current time of the set plus the
+ *  initial interval.  The insert is logarithmic in the number of watchdogs
+ *  in the set and thus done with interrupts disabled in one pass.
+ */
+
+void _Watchdog_Insert(
+  Watchdog_Header       *header,
+  Watchdog_Control      *the_watchdog
+)
+{
+  ISR_Level          level;
+
+  _ISR_Disable( level );
+
+  /*
+   *  Check to see if the watchdog has just been inserted by a
+   *  higher priority interrupt.  If so, abandon this insert.
+   */
+
+  if ( the_watchdog->state != WATCHDOG_INACTIVE ) {
+    _ISR_Enable( level );
+    return;
+  }
+
+  _Watchdog_Activate( the_watchdog );
+
+  the_watchdog->header = header;
+  the_watchdog->expire = header->current + the_watchdog->initial;
+
+  _RBTree_Insert_unprotected( &header->Watchdogs, &the_watchdog->Tree_node );
+
+  the_watchdog->start_time = _Watchdog_Ticks_since_boot;
+
+  _ISR_Enable( level );
+}
+
+#else
+
 /*
  *  _Watchdog_Insert
  *
@@ -26,7 +70,7 @@
  */
 
 void _Watchdog_Insert(
-  Chain_Control         *header,
+  Watchdog_Header       *header,
   Watchdog_Control      *the_watchdog
 )
 {
@@ -95,3 +139,5 @@ exit_insert:
   _Watchdog_Sync_count--;
   _ISR_Enable( level );
 }
+
+#endif
@@ -21,8 +21,8 @@
 /*
  *  _Watchdog_Remove
  *
- *  The routine removes a watchdog from a delta chain and updates
- *  the delta counters of the remaining watchdogs.
+ *  The routine removes a watchdog from a watchdog set.  In case of a
+ *  delta chain the delta counters of the remaining watchdogs are updated.
  */
 
 Watchdog_States _Watchdog_Remove(
@@ -31,7 +31,9 @@ Watchdog_States _Watchdog_Remove(
 {
   ISR_Level         level;
   Watchdog_States   previous_state;
+#if !defined(__RTEMS_WATCHDOG_RBTREE__)
   Watchdog_Control *next_watchdog;
+#endif
 
   _ISR_Disable( level );
   previous_state = the_watchdog->state;
@@ -52,6 +54,22 @@ Watchdog_States _Watchdog_Remove(
     case WATCHDOG_REMOVE_IT:
 
       the_watchdog->state = WATCHDOG_INACTIVE;
+
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+      /*
+       *  A watchdog without a set has been moved to a chain of watchdogs
+       *  about to fire, see _Watchdog_Adjust_to_chain().
+       */
+      if ( the_watchdog->header != NULL ) {
+        _RBTree_Extract_unprotected(
+          &the_watchdog->header->Watchdogs,
+          &the_watchdog->Tree_node
+        );
+        the_watchdog->header = NULL;
+      } else {
+        _Chain_Extract_unprotected( &the_watchdog->Node );
+      }
+#else
       next_watchdog = _Watchdog_Next( the_watchdog );
 
       if ( _Watchdog_Next(next_watchdog) )
@@ -61,6 +79,7 @@ Watchdog_States _Watchdog_Remove(
         _Watchdog_Sync_level = _ISR_Nest_level;
 
       _Chain_Extract_unprotected( &the_watchdog->Node );
+#endif
       break;
   }
   the_watchdog->stop_time = _Watchdog_Ticks_since_boot;
@@ -25,11 +25,31 @@ void _Watchdog_Report(
   Watchdog_Control  *watch
 )
 {
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+  unsigned long remaining = 0;
+
+  /*
+   *  Report the ticks remaining until the expiration so that the output
+   *  matches the delta chain format.  The printk() implementation does
+   *  not support 64-bit conversions.
+   */
+  if ( watch->header != NULL &&
+       !_Watchdog_Is_expired( watch->header, watch ) )
+    remaining = (unsigned long) ( watch->expire - watch->header->current );
+#endif
+
   printk(
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+    "%s%s%4lu %5d %p %p 0x%08x %p\n",
+    ((name) ? name : ""),
+    ((name) ? " "  : ""),
+    remaining,
+#else
     "%s%s%4d %5d %p %p 0x%08x %p\n",
     ((name) ? name : ""),
     ((name) ? " "  : ""),
     watch->delta_interval,
+#endif
     watch->initial,
     watch,
     watch->routine,
@@ -23,23 +23,38 @@
 
 void _Watchdog_Report_chain(
   const char        *name,
-  Chain_Control     *header
+  Watchdog_Header   *header
 )
 {
   ISR_Level          level;
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+  RBTree_Node       *node;
+#else
   Chain_Node        *node;
+#endif
 
   _ISR_Disable( level );
     printk( "Watchdog Chain: %s %p\n", name, header );
-    if ( !_Chain_Is_empty( header ) ) {
-      for ( node = _Chain_First( header ) ;
-            node != _Chain_Tail(header) ;
+    if ( !_Watchdog_Is_empty( header ) ) {
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+      for ( node = _RBTree_First( &header->Watchdogs, RBT_LEFT ) ;
+            node != NULL ;
+            node = _RBTree_Next_unprotected( node, RBT_RIGHT ) )
+      {
+        Watchdog_Control *watch = _Watchdog_From_tree_node( node );
+
+        _Watchdog_Report( NULL, watch );
+      }
+#else
+      for ( node = _Chain_First( &header->Watchdogs ) ;
+            node != _Chain_Tail( &header->Watchdogs ) ;
             node = node->next )
       {
         Watchdog_Control *watch = (Watchdog_Control *) node;
 
         _Watchdog_Report( NULL, watch );
       }
+#endif
       printk( "== end of %s \n", name );
     } else {
       printk( "Chain is empty\n" );
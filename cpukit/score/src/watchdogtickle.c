@@ -21,17 +21,65 @@
 /*
  *  _Watchdog_Tickle
  *
- *  This routine decrements the delta counter in response to a tick.  The
- *  delta chain is updated accordingly.
+ *  This routine advances the watchdog set in response to a tick and
+ *  fires all watchdogs which expire.  In case of a delta chain the delta
+ *  counter of the first watchdog is decremented.
  *
  *  Input parameters:
- *    header - pointer to the delta chain to be tickled
+ *    header - pointer to the watchdog set to be tickled
  *
  *  Output parameters: NONE
  */
 
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+
 void _Watchdog_Tickle(
-  Chain_Control *header
+  Watchdog_Header *header
+)
+{
+  ISR_Level level;
+  Watchdog_Control *the_watchdog;
+  Watchdog_States  watchdog_state;
+
+  _ISR_Disable( level );
+
+  header->current++;
+
+  /*
+   *  Only the watchdogs which expire now are visited.  The first watchdog
+   *  of the tree is cached by the tree control, so the usual case of no
+   *  expired watchdog is constant time.
+   */
+  while ( true ) {
+    the_watchdog = _Watchdog_First( header );
+
+    if ( the_watchdog == NULL || !_Watchdog_Is_expired( header, the_watchdog ) )
+      break;
+
+    watchdog_state = _Watchdog_Remove( the_watchdog );
+
+    _ISR_Enable( level );
+
+    /*
+     *  See below for the other states.  They should never occur.
+     */
+    if ( watchdog_state == WATCHDOG_ACTIVE ) {
+      (*the_watchdog->routine)(
+        the_watchdog->id,
+        the_watchdog->user_data
+      );
+    }
+
+    _ISR_Disable( level );
+  }
+
+  _ISR_Enable( level );
+}
+
+#else
+
+void _Watchdog_Tickle(
+  Watchdog_Header *header
 )
 {
   ISR_Level level;
@@ -46,7 +94,7 @@ void _Watchdog_Tickle(
 
   _ISR_Disable( level );
 
-  if ( _Chain_Is_empty( header ) )
+  if ( _Watchdog_Is_empty( header ) )
     goto leave;
 
   the_watchdog = _Watchdog_First( header );
@@ -118,9 +166,11 @@ void _Watchdog_Tickle(
      _ISR_Disable( level );
 
      the_watchdog = _Watchdog_First( header );
-   } while ( !_Chain_Is_empty( header ) &&
+   } while ( !_Watchdog_Is_empty( header ) &&
              (the_watchdog->delta_interval == 0) );
 
 leave:
    _ISR_Enable(level);
 }
+
+#endif
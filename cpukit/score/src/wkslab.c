@@ -0,0 +1,166 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreWorkspace
+ *
+ * @brief Workspace slab cache implementation.
+ */
+
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/config.h>
+#include <rtems/score/wkspace.h>
+
+void _Workspace_Slab_initialize(
+  Workspace_Slab *slab,
+  const char     *name,
+  uintptr_t       object_size
+)
+{
+  /* A free object must be able to hold the free list link */
+  if ( object_size < sizeof( void * ) )
+    object_size = sizeof( void * );
+
+  slab->name = name;
+  slab->object_size = object_size;
+  slab->free_list = NULL;
+  slab->object_count = 0;
+  slab->free_count = 0;
+  slab->used_count = 0;
+  slab->max_used_count = 0;
+  slab->failed_count = 0;
+  slab->free_limit = rtems_configuration_get_work_space_slab() ?
+    UINT32_MAX : 0;
+
+  _Chain_Append_unprotected( &_Workspace_Slabs, &slab->Node );
+}
+
+void *_Workspace_Slab_allocate(
+  Workspace_Slab *slab
+)
+{
+  void *object = slab->free_list;
+
+  if ( object != NULL ) {
+    slab->free_list = *(void **) object;
+    --slab->free_count;
+  } else {
+    object = _Workspace_Allocate( slab->object_size );
+    if ( object == NULL ) {
+      ++slab->failed_count;
+      return NULL;
+    }
+
+    ++slab->object_count;
+  }
+
+  if ( ++slab->used_count > slab->max_used_count )
+    slab->max_used_count = slab->used_count;
+
+  return object;
+}
+
+void _Workspace_Slab_free(
+  Workspace_Slab *slab,
+  void           *object
+)
+{
+  if ( object == NULL )
+    return;
+
+  --slab->used_count;
+
+  if ( slab->free_count < slab->free_limit ) {
+    *(void **) object = slab->free_list;
+    slab->free_list = object;
+    ++slab->free_count;
+  } else {
+    _Workspace_Free( object );
+    --slab->object_count;
+  }
+}
+
+uint32_t _Workspace_Slab_reserve(
+  Workspace_Slab *slab,
+  uint32_t        count
+)
+{
+  uint32_t reserved;
+
+  for ( reserved = 0 ; reserved < count ; ++reserved ) {
+    void *object = _Workspace_Allocate( slab->object_size );
+
+    if ( object == NULL )
+      break;
+
+    *(void **) object = slab->free_list;
+    slab->free_list = object;
+    ++slab->free_count;
+    ++slab->object_count;
+  }
+
+  return reserved;
+}
+
+uint32_t _Workspace_Slab_drain(
+  Workspace_Slab *slab,
+  uint32_t        keep_count
+)
+{
+  uint32_t drained = 0;
+
+  while ( slab->free_count > keep_count ) {
+    void *object = slab->free_list;
+
+    slab->free_list = *(void **) object;
+    _Workspace_Free( object );
+    --slab->free_count;
+    ++drained;
+  }
+
+  slab->object_count -= drained;
+
+  return drained;
+}
+
+bool _Workspace_Slab_Get_information(
+  uint32_t                    index,
+  Workspace_Slab_information *the_info
+)
+{
+  const Chain_Node *node = _Chain_Immutable_first( &_Workspace_Slabs );
+  const Chain_Node *tail = _Chain_Immutable_tail( &_Workspace_Slabs );
+  const Workspace_Slab *slab;
+
+  while ( index > 0 && node != tail ) {
+    node = _Chain_Immutable_next( node );
+    --index;
+  }
+
+  if ( node == tail )
+    return false;
+
+  slab = (const Workspace_Slab *) node;
+
+  the_info->name = slab->name;
+  the_info->object_size = slab->object_size;
+  the_info->object_count = slab->object_count;
+  the_info->free_count = slab->free_count;
+  the_info->used_count = slab->used_count;
+  the_info->max_used_count = slab->max_used_count;
+  the_info->failed_count = slab->failed_count;
+
+  return true;
+}
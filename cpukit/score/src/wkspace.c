@@ -37,12 +37,23 @@ void _Workspace_Handler_initialization(void)
   if ( rtems_configuration_get_do_zero_of_workspace() )
     memset( starting_address, 0, size );
 
-  memory_available = _Heap_Initialize(
-    &_Workspace_Area,
-    starting_address,
-    size,
-    CPU_HEAP_ALIGNMENT
-  );
+  _Chain_Initialize_empty( &_Workspace_Slabs );
+
+  if ( rtems_configuration_get_work_space_segregated_fit() ) {
+    memory_available = _Heap_Initialize_segregated_fit(
+      &_Workspace_Area,
+      starting_address,
+      size,
+      CPU_HEAP_ALIGNMENT
+    );
+  } else {
+    memory_available = _Heap_Initialize(
+      &_Workspace_Area,
+      starting_address,
+      size,
+      CPU_HEAP_ALIGNMENT
+    );
+  }
 
   if ( memory_available == 0 )
     _Internal_error_Occurred(
@@ -70,6 +70,23 @@ the mutex is used.
 
 Note that the mutex will be initialized with default attributes.
 
+@subsection PTHREAD_MUTEX_ADAPTIVE_NP
+
+This non-portable mutex type is provided by @code{<rtems/posix/mutexnp.h>}.
+It may be passed to @code{pthread_mutexattr_settype} as shown below:
+
+@example
+#include <pthread.h>
+#include <rtems/posix/mutexnp.h>
+
+pthread_mutexattr_settype( &attr, PTHREAD_MUTEX_ADAPTIVE_NP );
+@end example
+
+A mutex of this type behaves like a @code{PTHREAD_MUTEX_NORMAL} mutex.
+On SMP configurations, a thread which finds the mutex locked by a thread
+executing on another processor spins for a bounded time before it blocks.
+The time is set by @code{CONFIGURE_SMP_MUTEX_SPIN_NANOSECONDS}.
+
 @section Operations
 
 There is currently no text in this section.
@@ -13,6 +13,7 @@ The RTEMS shell has the following rtems commands:
 
 @item @code{halt} - Shutdown the system
 @item @code{cpuuse} - print or reset per thread cpu usage
+@item @code{top} - print recent per thread cpu usage
 @item @code{stackuse} - print per thread stack usage
 @item @code{perioduse} - print or reset per period usage
 @item @code{wkspace} - Display information on Executive Workspace
@@ -210,6 +211,90 @@ following prototype:
 extern rtems_shell_cmd_t rtems_shell_CPUUSE_Command;
 @end example
 
+@c
+@c
+@c
+@page
+@subsection top - print recent per thread cpu usage
+
+@pgindex top
+
+@subheading SYNOPSYS:
+
+@example
+top [-n iterations] [-w seconds]
+@end example
+
+@subheading DESCRIPTION:
+
+This command prints the per thread cpu usage of the last second
+sorted by usage and refreshes the report every second until a
+key is pressed.  The @code{-w} option selects a window of up to
+60 seconds.  The @code{-n} option stops the command after the
+given number of refreshes.
+
+@subheading EXIT STATUS:
+
+This command returns 0 on success and non-zero if an error is encountered.
+
+@subheading NOTES:
+
+The usage is sampled by a task which takes a snapshot of the
+cpu time used by each thread every second.  If the application
+did not start the sampler with
+@code{rtems_cpu_usage_sampler_start}, the command runs one
+while it executes.  The sampler disables thread dispatching only
+while it samples a single thread.  The percentages are relative
+to one processor.
+
+@subheading EXAMPLES:
+
+The following is an example of how to use @code{top}:
+
+@example
+SHLL [/] $ top -n 2
+CPU usage of the last 1 second(s), press a key to exit
+   ID         NAME         PERCENT
+0x09010001   IDLE           97.812
+0x0a010002   SHLL            2.003
+0x0a010001   UI1             0.185
+@end example
+
+@subheading CONFIGURATION:
+
+@findex CONFIGURE_SHELL_NO_COMMAND_TOP
+@findex CONFIGURE_SHELL_COMMAND_TOP
+
+This command is included in the default shell command set.
+When building a custom command set, define
+@code{CONFIGURE_SHELL_COMMAND_TOP} to have this
+command included.
+
+This command can be excluded from the shell command set by
+defining @code{CONFIGURE_SHELL_NO_COMMAND_TOP} when all
+shell commands have been configured.
+
+@subheading PROGRAMMING INFORMATION:
+
+@findex rtems_shell_rtems_main_top
+
+The @code{top} is implemented by a C language function
+which has the following prototype:
+
+@example
+int rtems_shell_rtems_main_top(
+  int    argc,
+  char **argv
+);
+@end example
+
+The configuration structure for the @code{top} has the
+following prototype:
+
+@example
+extern rtems_shell_cmd_t rtems_shell_TOP_Command;
+@end example
+
 @c
 @c
 @c
@@ -419,6 +504,10 @@ following information:
 @item Total bytes used
 @end itemize
 
+For each workspace slab cache the object size, the number of objects
+owned by the slab cache, the number of free, used and maximum used
+objects and the number of failed allocations are printed.
+
 @subheading EXIT STATUS:
 
 This command always succeeds and returns 0.
@@ -439,6 +528,10 @@ Total bytes free:      132336
 Number of used blocks: 36
 Largest used block:    16408
 Total bytes used:      55344
+
+Slab cache              Size  Objects     Free     Used  Max used   Failed
+FP contexts              108        2        0        2         2        0
+extension areas            8        2        0        2         2        0
 @end example
 
 @subheading CONFIGURATION:
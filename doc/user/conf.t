@@ -134,6 +134,20 @@ related configuration parameters supported by
 wishes to enable the gathering of more detailed statistics on the
 C Malloc Family of routines.
 
+@findex CONFIGURE_MALLOC_TASK_CACHE
+@item @code{CONFIGURE_MALLOC_TASK_CACHE} is defined when the application
+wishes to enable a per task cache for small allocations of the C Malloc
+Family of routines.  Most @code{malloc()} and @code{free()} calls for
+small sizes are then satisfied by the cache of the executing task without
+obtaining the allocator mutex.  Memory moves between the task caches and
+the C Program Heap in batches.  The cache of a task is returned to the
+C Program Heap when the task is deleted.  The cache uses one user extension
+object in addition to @code{CONFIGURE_MAXIMUM_USER_EXTENSIONS}.  Memory
+held by the caches is not available for larger allocations.  A double free
+of a small memory area is only detected if RTEMS is built with
+@code{RTEMS_DEBUG} defined.  The malloc statistics report the memory held
+by the caches separately from the allocated memory.
+
 @findex CONFIGURE_MALLOC_BSP_SUPPORTS_SBRK
 @item @code{CONFIGURE_MALLOC_BSP_SUPPORTS_SBRK} is defined by a BSP
 to indicate that it does not allocate all available memory to the
@@ -235,6 +249,34 @@ RTEMS "unlimited" objects option.  You will be able to create objects
 until you run out of all available memory rather then just until you
 run out of RTEMS Workspace.
 
+@findex CONFIGURE_WORKSPACE_SEGREGATED_FIT
+@item @code{CONFIGURE_WORKSPACE_SEGREGATED_FIT} configures the RTEMS
+Workspace to use the two-level segregated fit allocator instead of the
+first fit allocator.  The free blocks are kept in free lists of size
+classes and a bitmap index of the non-empty free lists is maintained.
+Allocate and free operations have a constant time bound independent of
+the heap fragmentation.  A small part of the RTEMS Workspace is used for
+the index.  By default, this is not defined.
+
+@findex CONFIGURE_MALLOC_SEGREGATED_FIT
+@item @code{CONFIGURE_MALLOC_SEGREGATED_FIT} configures the C Program
+Heap to use the two-level segregated fit allocator.  This has no effect
+if @code{CONFIGURE_UNIFIED_WORK_AREAS} is defined, in this case see
+@code{CONFIGURE_WORKSPACE_SEGREGATED_FIT}.  By default, this is not
+defined.
+
+@findex CONFIGURE_WORKSPACE_SLAB
+@item @code{CONFIGURE_WORKSPACE_SLAB} configures the slab caches of the
+RTEMS Workspace to keep freed objects for later allocations of the same
+size.  Slab caches are used for the floating point contexts and user
+extension tables of threads and for the POSIX key value tables.  Once a
+slab cache holds enough objects, task and key creation and deletion no
+longer allocate from or free to the RTEMS Workspace heap, so these
+operations take constant time and do not fragment the RTEMS Workspace.
+Objects kept by a slab cache are not available for other purposes.  The
+slab statistics are available via @code{rtems_workspace_get_slab_info}
+and the shell @code{wkspace} command.  By default, this is not defined.
+
 @findex CONFIGURE_MICROSECONDS_PER_TICK
 @item @code{CONFIGURE_MICROSECONDS_PER_TICK} is the length
 of time between clock ticks.  By default, this is set to
@@ -289,6 +331,35 @@ may point to a user provided routine to free task stacks.
 The default value for this field is NULL which indicates that
 task stacks will be allocated from the RTEMS Workspace.
 
+@findex CONFIGURE_TASK_STACK_POOL
+@item @code{CONFIGURE_TASK_STACK_POOL} configures a pool of task stacks
+in the RTEMS Workspace.  A task stack is allocated from the first size
+class large enough for it and returned to this size class when the task
+is deleted, so task creation and deletion with a cached stack neither
+allocate from nor free to the RTEMS Workspace heap.  Stacks larger than
+every size class are allocated from the RTEMS Workspace.  This cannot be
+combined with @code{CONFIGURE_TASK_STACK_ALLOCATOR} or
+@code{CONFIGURE_TASK_STACK_DEALLOCATOR}.  By default, this is not
+defined.
+
+@findex CONFIGURE_TASK_STACK_POOL_CLASSES
+@item @code{CONFIGURE_TASK_STACK_POOL_CLASSES} is the list of size class
+initializers of the task stack pool.  Each initializer has the form
+@code{@{ stack_size, initial_count, maximum_free_count @}} and the size
+classes must be sorted by increasing stack size.  The pool allocates
+@code{initial_count} stacks of the size class during system
+initialization and keeps at most @code{maximum_free_count} freed stacks,
+where zero means no limit.  If a stack allocation fails, the freed
+stacks of the other size classes beyond their @code{initial_count} go
+back to the RTEMS Workspace one size class at a time until the
+allocation succeeds.  Each size class is reported by
+@code{rtems_workspace_get_slab_info} under the name @code{task stack}
+followed by its stack size.  The memory for the initial stacks and for
+the rounding up of stack sizes to the size class must be accounted for
+with @code{CONFIGURE_EXTRA_TASK_STACKS}.  By default, there are three
+size classes with one, two and four times the configured minimum stack
+size, no initial stacks and at most four freed stacks each.
+
 @findex CONFIGURE_ZERO_WORKSPACE_AUTOMATICALLY
 @item @code{CONFIGURE_ZERO_WORKSPACE_AUTOMATICALLY}
 indicates whether RTEMS should zero the RTEMS Workspace and
@@ -435,6 +506,25 @@ only selected when @code{CONFIGURE_SMP_APPLICATION} is defined.  In a
 configuration with SMP enabled at configure time, it may be explicitly
 selected by defining @code{CONFIGURE_SCHEDULER_SIMPLE_SMP}.
 
+@findex CONFIGURE_SCHEDULER_PRIORITY_SMP
+@findex CONFIGURE_SCHEDULER_PRIORITY_SMP_CLUSTERS
+@item Deterministic SMP Priority Scheduler - This scheduler is derived from
+the Deterministic Priority Scheduler and schedules threads across
+multiple cores.  The cores are partitioned into
+@code{CONFIGURE_SCHEDULER_PRIORITY_SMP_CLUSTERS} clusters, which defaults
+to one.  Core N belongs to cluster N modulo the cluster count.  Each
+cluster has its own ready queue with a priority bit map and one FIFO per
+priority, so blocking or unblocking a thread is a constant time
+operation.  The highest priority ready threads of a cluster execute on
+the cores of this cluster.  The time to allocate the threads to the cores
+depends on the number of cores of the cluster and not on the number of
+ready threads.  With one cluster the scheduling is global and with one
+cluster per core it is partitioned.  New tasks are assigned to the
+clusters in a round-robin fashion and may be moved to another cluster
+with @code{rtems_task_set_scheduler_cluster}.  In a configuration with SMP
+enabled at configure time, it may be selected by defining
+@code{CONFIGURE_SCHEDULER_PRIORITY_SMP}.
+
 @findex CONFIGURE_SCHEDULER_EDF
 @item Earliest Deadline First Scheduler (EDF) - This is an alternative
 scheduler in RTEMS for single core applications. The EDF schedules tasks
@@ -505,6 +595,19 @@ is to make use of multiple CPU cores in an SMP target system.
 of CPU cores in the SMP configuration.  If there are more cores available
 than configured, the rest will be ignored.
 
+@findex CONFIGURE_SMP_MUTEX_SPIN_NANOSECONDS
+@item @code{CONFIGURE_SMP_MUTEX_SPIN_NANOSECONDS} is set to the maximum
+time in nanoseconds a thread polls an adaptive mutex while its holder
+executes on another processor before the thread blocks.  The default
+value is 10000.
+
+@findex CONFIGURE_MAXIMUM_TASK_POOLS
+@item @code{CONFIGURE_MAXIMUM_TASK_POOLS} is set to the maximum number of
+task pools created with @code{rtems_task_pool_create} which can be
+concurrently active.  It reserves the RTEMS Workspace for the job queues
+of the task pools.  The workers are Classic API tasks and must be included
+in @code{CONFIGURE_MAXIMUM_TASKS}.  The default value is 0.
+
 @end itemize
 
 @c
@@ -825,6 +928,12 @@ The default is 0.
 POSIX API keys that can be concurrently active.
 The default is 0.
 
+@findex CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_STORES
+@item @code{CONFIGURE_MAXIMUM_POSIX_KEY_VALUE_STORES} is the maximum number
+of tasks and threads which have a non-NULL value for a POSIX API key at
+the same time.  Each of them needs a value store in the RTEMS Workspace.
+The default is the total number of configured tasks and threads.
+
 @findex CONFIGURE_MAXIMUM_POSIX_TIMERS
 @item @code{CONFIGURE_MAXIMUM_POSIX_TIMERS} is the maximum number of
 POSIX API timers that can be concurrently active.
@@ -203,6 +203,11 @@ inheritance (default)
 @item @code{@value{RPREFIX}NO_PRIORITY_CEILING} - do not use priority
 ceiling (default)
 
+@item @code{@value{RPREFIX}ADAPTIVE} - spin while the holder executes
+on another processor before blocking
+
+@item @code{@value{RPREFIX}NO_ADAPTIVE} - block immediately (default)
+
 @item @code{@value{RPREFIX}LOCAL} - local semaphore (default)
 
 @item @code{@value{RPREFIX}GLOBAL} - global semaphore
@@ -494,6 +499,11 @@ inheritance (default)
 @item @code{@value{RPREFIX}NO_PRIORITY_CEILING} - do not use priority
 ceiling (default)
 
+@item @code{@value{RPREFIX}ADAPTIVE} - spin while the holder executes
+on another processor before blocking
+
+@item @code{@value{RPREFIX}NO_ADAPTIVE} - block immediately (default)
+
 @item @code{@value{RPREFIX}LOCAL} - local semaphore (default)
 
 @item @code{@value{RPREFIX}GLOBAL} - global semaphore
@@ -0,0 +1,170 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include "test_support.h"
+#include <rtems/cpuuse.h>
+
+#define SAMPLER_PRIORITY 1
+
+#define INIT_PRIORITY 2
+
+#define HOG_PRIORITY 3
+
+#define PERIOD 10
+
+#define INTERVALS 4
+
+#define MAXIMUM_SAMPLES 8
+
+/* forward declarations to avoid warnings */
+rtems_task Init(rtems_task_argument argument);
+
+static volatile bool Hog_run;
+
+static rtems_task Hog_task(
+  rtems_task_argument argument
+)
+{
+  while ( Hog_run ) {
+    /* Burn the processor */
+  }
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+}
+
+/*
+ *  Returns the usage of the thread in the last intervals.
+ */
+static uint32_t usage_of( rtems_id id, uint32_t intervals )
+{
+  rtems_status_code      status;
+  rtems_cpu_usage_sample samples[ MAXIMUM_SAMPLES ];
+  uint32_t               count = MAXIMUM_SAMPLES;
+  uint32_t               i;
+
+  status = rtems_cpu_usage_get_samples( intervals, samples, &count );
+  directive_failed( status, "rtems_cpu_usage_get_samples" );
+
+  for ( i = 0 ; i < count ; i++ ) {
+    rtems_test_assert( samples[ i ].usage <= 100000 );
+    if ( samples[ i ].id == id )
+      return samples[ i ].usage;
+  }
+
+  rtems_test_assert( 0 );
+  return 0;
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code      status;
+  rtems_cpu_usage_sample sample;
+  rtems_id               hog_id;
+  uint32_t               count = 1;
+  uint32_t               usage;
+
+  puts( "\n\n*** TEST CPUUSE02 ***" );
+
+  puts( "Init - rtems_cpu_usage_get_samples - sampler stopped" );
+  status = rtems_cpu_usage_get_samples( 1, &sample, &count );
+  fatal_directive_status( status, RTEMS_UNSATISFIED, "no sampler" );
+  rtems_test_assert( count == 0 );
+  rtems_test_assert( rtems_cpu_usage_sampler_maximum_threads() == 0 );
+
+  puts( "Init - rtems_cpu_usage_sampler_start - invalid interval count" );
+  status = rtems_cpu_usage_sampler_start( SAMPLER_PRIORITY, PERIOD, 0 );
+  fatal_directive_status( status, RTEMS_INVALID_NUMBER, "no intervals" );
+
+  puts( "Init - rtems_cpu_usage_sampler_start" );
+  status = rtems_cpu_usage_sampler_start(
+    SAMPLER_PRIORITY,
+    PERIOD,
+    INTERVALS
+  );
+  directive_failed( status, "rtems_cpu_usage_sampler_start" );
+  rtems_test_assert( rtems_cpu_usage_sampler_maximum_threads() > 0 );
+
+  status = rtems_cpu_usage_sampler_start(
+    SAMPLER_PRIORITY,
+    PERIOD,
+    INTERVALS
+  );
+  fatal_directive_status( status, RTEMS_RESOURCE_IN_USE, "second sampler" );
+
+  puts( "Init - rtems_cpu_usage_get_samples - no interval yet" );
+  count = 1;
+  status = rtems_cpu_usage_get_samples( 1, &sample, &count );
+  fatal_directive_status( status, RTEMS_UNSATISFIED, "no interval" );
+
+  status = rtems_task_create(
+    rtems_build_name( 'H', 'O', 'G', ' ' ),
+    HOG_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &hog_id
+  );
+  directive_failed( status, "rtems_task_create" );
+
+  Hog_run = true;
+  status = rtems_task_start( hog_id, Hog_task, 0 );
+  directive_failed( status, "rtems_task_start" );
+
+  puts( "Init - the hog uses the processor while Init sleeps" );
+  status = rtems_task_wake_after( INTERVALS * PERIOD );
+  directive_failed( status, "rtems_task_wake_after" );
+
+  usage = usage_of( hog_id, 1 );
+  rtems_test_assert( usage > 50000 );
+  rtems_test_assert( usage_of( rtems_task_self(), 1 ) < 50000 );
+
+  puts( "Init - the hog stops" );
+  Hog_run = false;
+  status = rtems_task_wake_after( (INTERVALS + 1) * PERIOD );
+  directive_failed( status, "rtems_task_wake_after" );
+
+  /* The spike is out of the window of the last interval */
+  rtems_test_assert( usage_of( hog_id, 1 ) == 0 );
+
+  puts( "Init - rtems_cpu_usage_sampler_stop" );
+  status = rtems_cpu_usage_sampler_stop();
+  directive_failed( status, "rtems_cpu_usage_sampler_stop" );
+
+  status = rtems_cpu_usage_sampler_stop();
+  fatal_directive_status( status, RTEMS_UNSATISFIED, "stopped sampler" );
+
+  status = rtems_task_delete( hog_id );
+  directive_failed( status, "rtems_task_delete" );
+
+  puts( "*** END OF TEST CPUUSE02 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             3
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY        INIT_PRIORITY
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
@@ -0,0 +1,174 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include "test_support.h"
+#include <rtems/malloc.h>
+
+#define AREA_COUNT 100
+
+#define SMALL_SIZE 24
+
+#define TASK_SIZE 200
+
+#define TASK_AREA_COUNT 4
+
+static void *Areas[ AREA_COUNT ];
+
+static const rtems_extensions_table Extensions;
+
+/* forward declarations to avoid warnings */
+rtems_task Init(rtems_task_argument argument);
+
+static uint32_t allocated_size( void )
+{
+  rtems_malloc_statistics_t stats;
+  int                       sc;
+
+  sc = malloc_get_statistics( &stats );
+  rtems_test_assert( sc == 0 );
+
+  return (uint32_t) (stats.lifetime_allocated - stats.lifetime_freed)
+    - stats.cached;
+}
+
+static uint32_t used_blocks( void )
+{
+  Heap_Information_block info;
+  int                    sc;
+
+  sc = malloc_info( &info );
+  rtems_test_assert( sc == 0 );
+
+  return info.Used.number;
+}
+
+static rtems_task Task(
+  rtems_task_argument argument
+)
+{
+  void *areas[ TASK_AREA_COUNT ];
+  int   i;
+
+  for ( i = 0 ; i < TASK_AREA_COUNT ; i++ ) {
+    areas[ i ] = malloc( TASK_SIZE );
+    rtems_test_assert( areas[ i ] != NULL );
+  }
+
+  for ( i = 0 ; i < TASK_AREA_COUNT ; i++ ) {
+    free( areas[ i ] );
+  }
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( 0 );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code          status;
+  rtems_malloc_statistics_t  stats;
+  rtems_id                   task_id;
+  rtems_id                   extension_id;
+  uint32_t                   allocated;
+  uint32_t                   used;
+  void                      *p;
+  void                      *q;
+  int                        i;
+
+  puts( "\n\n*** TEST MALLOC06 ***" );
+
+  puts( "malloc - free - malloc returns the cached area" );
+  p = malloc( SMALL_SIZE );
+  rtems_test_assert( p != NULL );
+  free( p );
+  q = malloc( SMALL_SIZE );
+  rtems_test_assert( q == p );
+  free( q );
+
+  puts( "malloc and free of many small areas - statistics are accurate" );
+  allocated = allocated_size();
+  for ( i = 0 ; i < AREA_COUNT ; i++ ) {
+    Areas[ i ] = malloc( SMALL_SIZE );
+    rtems_test_assert( Areas[ i ] != NULL );
+  }
+  rtems_test_assert( allocated_size() > allocated );
+  for ( i = 0 ; i < AREA_COUNT ; i++ ) {
+    free( Areas[ i ] );
+  }
+  rtems_test_assert( allocated_size() == allocated );
+
+  (void) malloc_get_statistics( &stats );
+  rtems_test_assert( stats.cache_malloc_hits >= AREA_COUNT );
+  rtems_test_assert( stats.cache_free_hits >= AREA_COUNT );
+  rtems_test_assert( stats.cached >= AREA_COUNT * SMALL_SIZE );
+
+  puts( "task delete returns the task cache to the heap" );
+  used = used_blocks();
+
+  status = rtems_task_create(
+    rtems_build_name( 'T', 'A', '1', ' ' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &task_id
+  );
+  directive_failed( status, "rtems_task_create" );
+
+  status = rtems_task_start( task_id, Task, 0 );
+  directive_failed( status, "rtems_task_start" );
+
+  status = rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+  directive_failed( status, "rtems_task_wake_after" );
+
+  rtems_test_assert( used_blocks() > used );
+
+  status = rtems_task_delete( task_id );
+  directive_failed( status, "rtems_task_delete" );
+
+  rtems_test_assert( used_blocks() == used );
+
+  puts( "rtems_extension_create - application extension is available" );
+  status = rtems_extension_create(
+    rtems_build_name( 'E', 'X', 'T', ' ' ),
+    &Extensions,
+    &extension_id
+  );
+  directive_failed( status, "rtems_extension_create" );
+
+  status = rtems_extension_delete( extension_id );
+  directive_failed( status, "rtems_extension_delete" );
+
+  puts( "*** END OF TEST MALLOC06 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MALLOC_TASK_CACHE
+#define CONFIGURE_MALLOC_STATISTICS
+
+#define CONFIGURE_MAXIMUM_TASKS             2
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS   1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
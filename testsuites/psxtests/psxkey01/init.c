@@ -43,9 +43,17 @@ void *POSIX_Init(
 
   rtems_workspace_greedy_allocate( NULL, 0 );
 
-  puts("Init: pthread_key_create - ENOMEM (Workspace not available)");
-  empty_line();
+  puts("Init: pthread_key_create - OK (Workspace not needed)");
   status = pthread_key_create( &Key_id[0], Key_destructor );
+  fatal_directive_check_status_only( status, 0, "pthread_key_create" );
+
+  puts("Init: pthread_setspecific - OK (NULL value)");
+  status = pthread_setspecific( Key_id[0], NULL );
+  fatal_directive_check_status_only( status, 0, "pthread_setspecific" );
+
+  puts("Init: pthread_setspecific - ENOMEM (Workspace not available)");
+  empty_line();
+  status = pthread_setspecific( Key_id[0], &Key_id[0] );
   fatal_directive_check_status_only( status, ENOMEM, "no workspace available" );
 
   puts( "*** END OF POSIX KEY 01 TEST ***" );
@@ -14,6 +14,7 @@
 #include <tmacros.h>
 #include <errno.h>
 #include <pthread.h>
+#include <rtems/posix/mutexnp.h>
 
 /* forward declarations to avoid warnings */
 void *POSIX_Init(void *argument);
@@ -31,6 +32,7 @@ ToCheck_t TypesToCheck[] = {
   { "PTHREAD_MUTEX_RECURSIVE - OK",  PTHREAD_MUTEX_RECURSIVE,  0 },
   { "PTHREAD_MUTEX_ERRORCHECK - OK", PTHREAD_MUTEX_ERRORCHECK, 0 },
   { "PTHREAD_MUTEX_DEFAULT - OK",    PTHREAD_MUTEX_DEFAULT,    0 },
+  { "PTHREAD_MUTEX_ADAPTIVE_NP - OK", PTHREAD_MUTEX_ADAPTIVE_NP, 0 },
 };
 
 #define TO_CHECK sizeof(TypesToCheck) / sizeof(ToCheck_t)
@@ -25,6 +25,10 @@
 /* #define __USE_XOPEN2K XXX already defined on GNU/Linux */
 #include <pthread.h>
 
+#if defined(__rtems__)
+#include <rtems/posix/rwlock.h> /* for pthread_rwlockattr_setbigreader_np */
+#endif
+
 /* forward declarations to avoid warnings */
 void *ReadLockThread(void *arg);
 void *WriteLockThread(void *arg);
@@ -482,6 +486,88 @@ int main(
   status = pthread_rwlock_unlock( &rwlock );
   rtems_test_assert( status == 0 );
 
+#if defined(__rtems__)
+  /*************** BIG READER RWLOCK ***************/
+  puts( "pthread_rwlock_destroy( &rwlock ) -- OK" );
+  status = pthread_rwlock_destroy( &rwlock );
+  rtems_test_assert( status == 0 );
+
+  puts( "pthread_rwlockattr_setbigreader_np( NULL, 1 ) -- EINVAL" );
+  status = pthread_rwlockattr_setbigreader_np( NULL, 1 );
+  rtems_test_assert( status == EINVAL );
+
+  puts( "pthread_rwlockattr_init( &attr ) -- OK" );
+  status = pthread_rwlockattr_init( &attr );
+  rtems_test_assert( status == 0 );
+
+  puts( "pthread_rwlockattr_getbigreader_np( &attr, NULL ) -- EINVAL" );
+  status = pthread_rwlockattr_getbigreader_np( &attr, NULL );
+  rtems_test_assert( status == EINVAL );
+
+  puts( "pthread_rwlockattr_setbigreader_np( &attr, 1 ) -- OK" );
+  status = pthread_rwlockattr_setbigreader_np( &attr, 1 );
+  rtems_test_assert( status == 0 );
+
+  puts( "pthread_rwlockattr_getbigreader_np( &attr, &p ) -- OK" );
+  status = pthread_rwlockattr_getbigreader_np( &attr, &p );
+  rtems_test_assert( status == 0 );
+  rtems_test_assert( p == 1 );
+
+  puts( "pthread_rwlockattr_getpshared( &attr, &p ) -- OK" );
+  status = pthread_rwlockattr_getpshared( &attr, &p );
+  rtems_test_assert( status == 0 );
+  rtems_test_assert( p == PTHREAD_PROCESS_PRIVATE );
+
+  puts( "pthread_rwlock_init( &rwlock, &attr ) big reader -- OK" );
+  status = pthread_rwlock_init( &rwlock, &attr );
+  rtems_test_assert( status == 0 );
+
+  puts( "pthread_rwlock_rdlock( &rwlock ) twice -- OK" );
+  status = pthread_rwlock_rdlock( &rwlock );
+  rtems_test_assert( status == 0 );
+  status = pthread_rwlock_rdlock( &rwlock );
+  rtems_test_assert( status == 0 );
+
+  puts( "pthread_rwlock_trywrlock( &rwlock ) -- EBUSY" );
+  status = pthread_rwlock_trywrlock( &rwlock );
+  rtems_test_assert( status == EBUSY );
+
+  puts( "pthread_rwlock_unlock( &rwlock ) twice -- OK" );
+  status = pthread_rwlock_unlock( &rwlock );
+  rtems_test_assert( status == 0 );
+  status = pthread_rwlock_unlock( &rwlock );
+  rtems_test_assert( status == 0 );
+
+  puts( "pthread_rwlock_wrlock( &rwlock ) -- OK" );
+  status = pthread_rwlock_wrlock( &rwlock );
+  rtems_test_assert( status == 0 );
+
+  puts( "pthread_rwlock_tryrdlock( &rwlock ) -- EBUSY" );
+  status = pthread_rwlock_tryrdlock( &rwlock );
+  rtems_test_assert( status == EBUSY );
+
+  puts( "pthread_rwlock_unlock( &rwlock ) -- OK" );
+  status = pthread_rwlock_unlock( &rwlock );
+  rtems_test_assert( status == 0 );
+
+  puts( "pthread_rwlock_tryrdlock( &rwlock ) -- OK" );
+  status = pthread_rwlock_tryrdlock( &rwlock );
+  rtems_test_assert( status == 0 );
+
+  puts( "pthread_rwlock_unlock( &rwlock ) -- OK" );
+  status = pthread_rwlock_unlock( &rwlock );
+  rtems_test_assert( status == 0 );
+
+  puts( "pthread_rwlockattr_setbigreader_np( &attr, 0 ) -- OK" );
+  status = pthread_rwlockattr_setbigreader_np( &attr, 0 );
+  rtems_test_assert( status == 0 );
+
+  puts( "pthread_rwlockattr_getbigreader_np( &attr, &p ) -- OK" );
+  status = pthread_rwlockattr_getbigreader_np( &attr, &p );
+  rtems_test_assert( status == 0 );
+  rtems_test_assert( p == 0 );
+#endif
+
   /*************** END OF TEST *****************/
   puts( "*** END OF POSIX RWLOCK TEST 01 ***" );
   exit(0);
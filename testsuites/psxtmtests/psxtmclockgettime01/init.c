@@ -0,0 +1,105 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <timesys.h>
+#include <rtems/timerdrv.h>
+#include "test_support.h"
+
+#include <time.h>
+
+/*
+ *  The monotonicity check reads the clock during this number of clock
+ *  ticks, so that it crosses several tick updates of the time snapshot.
+ */
+#define CHECK_TICKS 5
+
+/* forward declarations to avoid warnings */
+void *POSIX_Init(void *argument);
+
+static bool timespec_less( const struct timespec *a, const struct timespec *b )
+{
+  return a->tv_sec < b->tv_sec
+    || ( a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec );
+}
+
+static void benchmark_clock_gettime( clockid_t clock_id, const char *name )
+{
+  benchmark_timer_t end_time;
+  struct timespec   now;
+  int               index;
+  int               sc;
+
+  benchmark_timer_initialize();
+    for ( index = 0 ; index < OPERATION_COUNT ; index++ )
+      (void) clock_gettime( clock_id, &now );
+  end_time = benchmark_timer_read();
+
+  sc = clock_gettime( clock_id, &now );
+  rtems_test_assert( sc == 0 );
+
+  put_time( name, end_time, OPERATION_COUNT, 0, 0 );
+}
+
+static void check_monotonic( void )
+{
+  struct timespec previous;
+  struct timespec now;
+  rtems_interval  start;
+  uint32_t        reads = 0;
+  int             sc;
+
+  sc = clock_gettime( CLOCK_MONOTONIC, &previous );
+  rtems_test_assert( sc == 0 );
+
+  start = rtems_clock_get_ticks_since_boot();
+  while ( rtems_clock_get_ticks_since_boot() - start < CHECK_TICKS ) {
+    sc = clock_gettime( CLOCK_MONOTONIC, &now );
+    rtems_test_assert( sc == 0 );
+    rtems_test_assert( !timespec_less( &now, &previous ) );
+
+    previous = now;
+    ++reads;
+  }
+
+  rtems_test_assert( reads > 0 );
+}
+
+void *POSIX_Init(
+  void *argument
+)
+{
+  puts( "\n\n*** POSIX TIME TEST PSXTMCLOCKGETTIME01 ***" );
+
+  benchmark_clock_gettime( CLOCK_MONOTONIC, "clock_gettime - CLOCK_MONOTONIC" );
+  benchmark_clock_gettime( CLOCK_REALTIME, "clock_gettime - CLOCK_REALTIME" );
+
+  check_monotonic();
+
+  puts( "*** END OF POSIX TIME TEST PSXTMCLOCKGETTIME01 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS     1
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
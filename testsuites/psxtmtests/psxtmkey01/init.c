@@ -17,11 +17,32 @@
 #include <pthread.h>
 #include "test_support.h"
 
+/*
+ *  The keys are created with this number of threads configured.  The
+ *  memory needed by a key must not depend on the number of threads.
+ */
+#define KEY_COUNT 1000
+
+#define THREAD_COUNT 256
+
 /* forward declarations to avoid warnings */
 void *POSIX_Init(void *argument);
 
 pthread_key_t Key;
 
+static pthread_key_t Keys[ KEY_COUNT ];
+
+static uint32_t workspace_used( void )
+{
+  Heap_Information_block info;
+  bool                   ok;
+
+  ok = rtems_workspace_get_information( &info );
+  rtems_test_assert( ok );
+
+  return info.Used.total;
+}
+
 static void benchmark_pthread_key_create(void)
 {
   benchmark_timer_t end_time;
@@ -62,6 +83,59 @@ static void benchmark_pthread_key_delete(void)
 
 }
 
+static void benchmark_pthread_key_create_many(void)
+{
+  benchmark_timer_t end_time;
+  uint32_t          used;
+  int               i;
+  int               status;
+
+  used = workspace_used();
+
+  benchmark_timer_initialize();
+    for ( i = 0 ; i < KEY_COUNT ; i++ )
+      (void) pthread_key_create( &Keys[ i ], NULL );
+  end_time = benchmark_timer_read();
+
+  used = workspace_used() - used;
+
+  /* check that the last key was created */
+  status = pthread_setspecific( Keys[ KEY_COUNT - 1 ], NULL );
+  rtems_test_assert( status == 0 );
+
+  put_time(
+    "pthread_key_create: 1000 keys, 256 threads configured",
+    end_time,
+    KEY_COUNT,
+    0,
+    0
+  );
+
+  printf(
+    "pthread_key_create: workspace used by 1000 keys: %" PRIu32 " bytes\n",
+    used
+  );
+}
+
+static void benchmark_pthread_key_delete_many(void)
+{
+  benchmark_timer_t end_time;
+  int               i;
+
+  benchmark_timer_initialize();
+    for ( i = 0 ; i < KEY_COUNT ; i++ )
+      (void) pthread_key_delete( Keys[ i ] );
+  end_time = benchmark_timer_read();
+
+  put_time(
+    "pthread_key_delete: 1000 keys, 256 threads configured",
+    end_time,
+    KEY_COUNT,
+    0,
+    0
+  );
+}
+
 void *POSIX_Init(void *argument)
 {
 
@@ -73,6 +147,10 @@ void *POSIX_Init(void *argument)
   /* key deletion*/
   benchmark_pthread_key_delete();
   
+  /* many keys with many threads configured */
+  benchmark_pthread_key_create_many();
+  benchmark_pthread_key_delete_many();
+
   puts( "*** END OF POSIX TIME TEST PSXTMKEY01 ***" );
 
   rtems_test_exit(0);
@@ -83,8 +161,8 @@ void *POSIX_Init(void *argument)
 #define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
 #define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
 
-#define CONFIGURE_MAXIMUM_POSIX_THREADS     2
-#define CONFIGURE_MAXIMUM_POSIX_KEYS     1
+#define CONFIGURE_MAXIMUM_POSIX_THREADS     THREAD_COUNT
+#define CONFIGURE_MAXIMUM_POSIX_KEYS        KEY_COUNT
 #define CONFIGURE_POSIX_INIT_THREAD_TABLE
 
 #define CONFIGURE_INIT
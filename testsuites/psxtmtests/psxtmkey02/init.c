@@ -17,6 +17,16 @@
 #include <pthread.h>
 #include "test_support.h"
 
+/*
+ *  Each of the other threads sets KEYS_PER_THREAD of the KEY_COUNT keys.
+ *  The Init thread sets all keys.
+ */
+#define KEY_COUNT 1000
+
+#define THREAD_COUNT 256
+
+#define KEYS_PER_THREAD 4
+
 /* forward declarations to avoid warnings */
 void *POSIX_Init(void *argument);
 void benchmark_pthread_setspecific(void *value_p);
@@ -25,6 +35,140 @@ void benchmark_pthread_getspecific( void *expected );
 pthread_key_t Key;
 int           Value1;
 
+static pthread_key_t Keys[ KEY_COUNT ];
+
+static pthread_mutex_t Start_mutex;
+
+static pthread_mutex_t Stop_mutex;
+
+static volatile int Ready_count;
+
+static volatile int Done_count;
+
+static uint32_t workspace_used( void )
+{
+  Heap_Information_block info;
+  bool                   ok;
+
+  ok = rtems_workspace_get_information( &info );
+  rtems_test_assert( ok );
+
+  return info.Used.total;
+}
+
+static void *Value_thread( void *argument )
+{
+  int index = (int) (intptr_t) argument;
+  int i;
+  int status;
+
+  ++Ready_count;
+
+  /* Wait until all threads exist */
+  status = pthread_mutex_lock( &Start_mutex );
+  rtems_test_assert( status == 0 );
+  status = pthread_mutex_unlock( &Start_mutex );
+  rtems_test_assert( status == 0 );
+
+  for ( i = 0 ; i < KEYS_PER_THREAD ; i++ ) {
+    int k = (index * KEYS_PER_THREAD + i) % KEY_COUNT;
+
+    status = pthread_setspecific( Keys[ k ], &Keys[ k ] );
+    rtems_test_assert( status == 0 );
+    rtems_test_assert( pthread_getspecific( Keys[ k ] ) == &Keys[ k ] );
+  }
+
+  ++Done_count;
+
+  /* Keep the values until the end of the test */
+  (void) pthread_mutex_lock( &Stop_mutex );
+
+  return NULL;
+}
+
+static void benchmark_many_keys(void)
+{
+  benchmark_timer_t end_time;
+  int               i;
+
+  benchmark_timer_initialize();
+    for ( i = 0 ; i < KEY_COUNT ; i++ )
+      (void) pthread_setspecific( Keys[ i ], &Keys[ i ] );
+  end_time = benchmark_timer_read();
+
+  put_time(
+    "pthread_setspecific: 1000 keys",
+    end_time,
+    KEY_COUNT,
+    0,
+    0
+  );
+
+  benchmark_timer_initialize();
+    for ( i = 0 ; i < KEY_COUNT ; i++ )
+      (void) pthread_getspecific( Keys[ i ] );
+  end_time = benchmark_timer_read();
+
+  put_time(
+    "pthread_getspecific: 1000 keys",
+    end_time,
+    KEY_COUNT,
+    0,
+    0
+  );
+
+  for ( i = 0 ; i < KEY_COUNT ; i++ )
+    rtems_test_assert( pthread_getspecific( Keys[ i ] ) == &Keys[ i ] );
+}
+
+static void measure_values_of_threads(void)
+{
+  uint32_t used;
+  int      i;
+  int      status;
+
+  status = pthread_mutex_init( &Start_mutex, NULL );
+  rtems_test_assert( status == 0 );
+  status = pthread_mutex_init( &Stop_mutex, NULL );
+  rtems_test_assert( status == 0 );
+  status = pthread_mutex_lock( &Start_mutex );
+  rtems_test_assert( status == 0 );
+  status = pthread_mutex_lock( &Stop_mutex );
+  rtems_test_assert( status == 0 );
+
+  for ( i = 0 ; i < THREAD_COUNT - 1 ; i++ ) {
+    pthread_t thread;
+
+    status = pthread_create(
+      &thread,
+      NULL,
+      Value_thread,
+      (void *) (intptr_t) i
+    );
+    rtems_test_assert( status == 0 );
+  }
+
+  while ( Ready_count < THREAD_COUNT - 1 )
+    sched_yield();
+
+  used = workspace_used();
+
+  status = pthread_mutex_unlock( &Start_mutex );
+  rtems_test_assert( status == 0 );
+
+  while ( Done_count < THREAD_COUNT - 1 )
+    sched_yield();
+
+  used = workspace_used() - used;
+
+  printf(
+    "pthread_setspecific: workspace used by %d values of 255 threads: %"
+      PRIu32 " bytes\n",
+    (THREAD_COUNT - 1) * KEYS_PER_THREAD,
+    used
+  );
+}
+
 void benchmark_pthread_setspecific( void *value_p )
 {
   benchmark_timer_t end_time;
@@ -69,6 +213,7 @@ void *POSIX_Init(
 )
 {
   int  status;
+  int  i;
 
   puts( "\n\n*** POSIX TIME TEST PSXTMKEY02 ***" );
 
@@ -84,6 +229,15 @@ void *POSIX_Init(
   status = pthread_key_delete( Key );
   rtems_test_assert( status == 0 );
 
+  /* many keys and threads */
+  for ( i = 0 ; i < KEY_COUNT ; i++ ) {
+    status = pthread_key_create( &Keys[ i ], NULL );
+    rtems_test_assert( status == 0 );
+  }
+
+  benchmark_many_keys();
+  measure_values_of_threads();
+
   puts( "*** END OF POSIX TIME TEST PSXTMKEY02 ***" );
   rtems_test_exit(0);
 }
@@ -93,8 +247,9 @@ void *POSIX_Init(
 #define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
 #define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
 
-#define CONFIGURE_MAXIMUM_POSIX_THREADS  2
-#define CONFIGURE_MAXIMUM_POSIX_KEYS     1
+#define CONFIGURE_MAXIMUM_POSIX_THREADS  THREAD_COUNT
+#define CONFIGURE_MAXIMUM_POSIX_KEYS     KEY_COUNT
+#define CONFIGURE_MAXIMUM_POSIX_MUTEXES  2
 #define CONFIGURE_POSIX_INIT_THREAD_TABLE
 
 #define CONFIGURE_INIT
@@ -0,0 +1,221 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+
+#include <tmacros.h>
+#include "test_support.h"
+
+/*
+ *  Each worker task obtains and releases its own semaphore during this
+ *  number of clock ticks.
+ */
+#define BENCHMARK_TICKS 50
+
+#define MAXIMUM_WORKERS 4
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Init_id;
+
+static rtems_id Workers[ MAXIMUM_WORKERS ];
+
+static rtems_id Semaphores[ MAXIMUM_WORKERS ];
+
+static volatile uint32_t Counts[ MAXIMUM_WORKERS ];
+
+static volatile rtems_interval Start_tick;
+
+static rtems_event_set worker_event( int worker )
+{
+  return RTEMS_EVENT_0 << worker;
+}
+
+static void run_benchmark( int worker )
+{
+  rtems_id          semaphore = Semaphores[ worker ];
+  rtems_interval    start = Start_tick;
+  rtems_interval    end = start + BENCHMARK_TICKS;
+  uint32_t          count = 0;
+  rtems_status_code status;
+
+  while ( rtems_clock_get_ticks_since_boot() < start )
+    ;
+
+  do {
+    int i;
+
+    for ( i = 0 ; i < 64 ; i++ ) {
+      status = rtems_semaphore_obtain( semaphore, RTEMS_WAIT, 0 );
+      directive_failed( status, "rtems_semaphore_obtain" );
+
+      status = rtems_semaphore_release( semaphore );
+      directive_failed( status, "rtems_semaphore_release" );
+    }
+
+    count += 64;
+  } while ( rtems_clock_get_ticks_since_boot() < end );
+
+  Counts[ worker ] = count;
+}
+
+static rtems_task Worker_task(
+  rtems_task_argument argument
+)
+{
+  int               worker = (int) argument;
+  rtems_event_set   received;
+  rtems_status_code status;
+
+  while ( true ) {
+    status = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &received
+    );
+    directive_failed( status, "rtems_event_receive" );
+
+    run_benchmark( worker );
+
+    status = rtems_event_send( Init_id, worker_event( worker ) );
+    directive_failed( status, "rtems_event_send" );
+  }
+}
+
+static uint32_t benchmark( int worker_count )
+{
+  rtems_event_set   events = 0;
+  rtems_event_set   received;
+  uint32_t          total = 0;
+  rtems_status_code status;
+  int               worker;
+
+  Start_tick = rtems_clock_get_ticks_since_boot() + 2;
+
+  for ( worker = 0 ; worker < worker_count ; worker++ ) {
+    status = rtems_event_send( Workers[ worker ], RTEMS_EVENT_0 );
+    directive_failed( status, "rtems_event_send" );
+
+    events |= worker_event( worker );
+  }
+
+  /*
+   *  Block the Init task so that each worker task runs on its own
+   *  processor.
+   */
+  status = rtems_event_receive(
+    events,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &received
+  );
+  directive_failed( status, "rtems_event_receive" );
+
+  for ( worker = 0 ; worker < worker_count ; worker++ ) {
+    total += Counts[ worker ];
+  }
+
+  return total;
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  int               processors;
+  int               worker_count;
+  int               worker;
+  uint32_t          single = 0;
+
+  locked_print_initialize();
+  locked_printf( "\n\n*** TEST SMP10 ***\n" );
+
+  Init_id = rtems_task_self();
+
+  processors = rtems_smp_get_number_of_processors();
+  if ( processors > MAXIMUM_WORKERS )
+    processors = MAXIMUM_WORKERS;
+
+  for ( worker = 0 ; worker < processors ; worker++ ) {
+    status = rtems_semaphore_create(
+      rtems_build_name( 'S', 'E', 'M', '0' + worker ),
+      1,
+      RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+      0,
+      &Semaphores[ worker ]
+    );
+    directive_failed( status, "rtems_semaphore_create" );
+
+    status = rtems_task_create(
+      rtems_build_name( 'W', 'O', 'R', '0' + worker ),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &Workers[ worker ]
+    );
+    directive_failed( status, "rtems_task_create" );
+
+    status = rtems_task_start( Workers[ worker ], Worker_task, worker );
+    directive_failed( status, "rtems_task_start" );
+  }
+
+  locked_printf(
+    " %d ticks of obtain/release pairs on disjoint semaphores\n",
+    BENCHMARK_TICKS
+  );
+
+  for ( worker_count = 1 ; worker_count <= processors ; worker_count++ ) {
+    uint32_t total = benchmark( worker_count );
+    uint32_t speedup;
+
+    if ( worker_count == 1 )
+      single = total;
+
+    speedup = single != 0 ? (uint32_t) ((100ULL * total) / single) : 0;
+
+    locked_printf(
+      " %d processor(s): %" PRIu32 " pairs, speedup %" PRIu32 ".%02" PRIu32
+        "\n",
+      worker_count,
+      total,
+      speedup / 100,
+      speedup % 100
+    );
+  }
+
+  locked_printf( "*** END OF TEST SMP10 ***\n" );
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS   MAXIMUM_WORKERS
+
+#define CONFIGURE_MAXIMUM_TASKS            \
+    (1 + CONFIGURE_SMP_MAXIMUM_PROCESSORS)
+#define CONFIGURE_MAXIMUM_SEMAPHORES       CONFIGURE_SMP_MAXIMUM_PROCESSORS
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
@@ -0,0 +1,248 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+
+#include <tmacros.h>
+#include "test_support.h"
+
+#include <rtems/score/smplock.h>
+
+/*
+ *  Each worker task obtains and releases the shared lock during this
+ *  number of clock ticks.
+ */
+#define BENCHMARK_TICKS 50
+
+#define MAXIMUM_WORKERS 4
+
+#if defined(__RTEMS_SMP_LOCK_TICKET__)
+  #define LOCK_NAME "ticket"
+#elif defined(__RTEMS_SMP_LOCK_MCS__)
+  #define LOCK_NAME "MCS"
+#else
+  #define LOCK_NAME "test-and-set"
+#endif
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Init_id;
+
+static rtems_id Workers[ MAXIMUM_WORKERS ];
+
+static SMP_lock_spinlock_simple_Control Lock;
+
+static volatile uint32_t Shared_count;
+
+static volatile uint32_t Counts[ MAXIMUM_WORKERS ];
+
+static volatile uint32_t Max_waits[ MAXIMUM_WORKERS ];
+
+static volatile rtems_interval Start_tick;
+
+static rtems_event_set worker_event( int worker )
+{
+  return RTEMS_EVENT_0 << worker;
+}
+
+static uint64_t uptime_in_nanoseconds( void )
+{
+  struct timespec   uptime;
+  rtems_status_code status;
+
+  status = rtems_clock_get_uptime( &uptime );
+  directive_failed( status, "rtems_clock_get_uptime" );
+
+  return (uint64_t) uptime.tv_sec * 1000000000 + uptime.tv_nsec;
+}
+
+static void run_benchmark( int worker )
+{
+  rtems_interval    start = Start_tick;
+  rtems_interval    end = start + BENCHMARK_TICKS;
+  uint32_t          count = 0;
+  uint32_t          max_wait = 0;
+
+  while ( rtems_clock_get_ticks_since_boot() < start )
+    ;
+
+  do {
+    int i;
+
+    for ( i = 0 ; i < 16 ; i++ ) {
+      uint64_t  before = uptime_in_nanoseconds();
+      uint64_t  wait;
+      ISR_Level level;
+
+      level = _SMP_lock_spinlock_simple_Obtain( &Lock );
+      ++Shared_count;
+      _SMP_lock_spinlock_simple_Release( &Lock, level );
+
+      wait = uptime_in_nanoseconds() - before;
+      if ( wait > max_wait )
+        max_wait = (uint32_t) wait;
+    }
+
+    count += 16;
+  } while ( rtems_clock_get_ticks_since_boot() < end );
+
+  Counts[ worker ] = count;
+  Max_waits[ worker ] = max_wait;
+}
+
+static rtems_task Worker_task(
+  rtems_task_argument argument
+)
+{
+  int               worker = (int) argument;
+  rtems_event_set   received;
+  rtems_status_code status;
+
+  while ( true ) {
+    status = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &received
+    );
+    directive_failed( status, "rtems_event_receive" );
+
+    run_benchmark( worker );
+
+    status = rtems_event_send( Init_id, worker_event( worker ) );
+    directive_failed( status, "rtems_event_send" );
+  }
+}
+
+static void benchmark( int worker_count )
+{
+  rtems_event_set   events = 0;
+  rtems_event_set   received;
+  uint32_t          total = 0;
+  uint32_t          max_wait = 0;
+  uint64_t          per_second;
+  rtems_status_code status;
+  int               worker;
+
+  Shared_count = 0;
+  Start_tick = rtems_clock_get_ticks_since_boot() + 2;
+
+  for ( worker = 0 ; worker < worker_count ; worker++ ) {
+    status = rtems_event_send( Workers[ worker ], RTEMS_EVENT_0 );
+    directive_failed( status, "rtems_event_send" );
+
+    events |= worker_event( worker );
+  }
+
+  /*
+   *  Block the Init task so that each worker task runs on its own
+   *  processor.
+   */
+  status = rtems_event_receive(
+    events,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &received
+  );
+  directive_failed( status, "rtems_event_receive" );
+
+  for ( worker = 0 ; worker < worker_count ; worker++ ) {
+    total += Counts[ worker ];
+
+    if ( Max_waits[ worker ] > max_wait )
+      max_wait = Max_waits[ worker ];
+  }
+
+  /*
+   *  The lock must provide mutual exclusion.
+   */
+  rtems_test_assert( Shared_count == total );
+
+  per_second = (1000000ULL * total)
+    / (BENCHMARK_TICKS * rtems_configuration_get_microseconds_per_tick());
+
+  locked_printf(
+    " %d processor(s): %" PRIu64 " acquisitions/s, max wait %" PRIu32 "ns\n",
+    worker_count,
+    per_second,
+    max_wait
+  );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  int               processors;
+  int               worker_count;
+  int               worker;
+
+  locked_print_initialize();
+  locked_printf( "\n\n*** TEST SMP11 ***\n" );
+
+  Init_id = rtems_task_self();
+
+  _SMP_lock_spinlock_simple_Initialize( &Lock );
+
+  processors = rtems_smp_get_number_of_processors();
+  if ( processors > MAXIMUM_WORKERS )
+    processors = MAXIMUM_WORKERS;
+
+  for ( worker = 0 ; worker < processors ; worker++ ) {
+    status = rtems_task_create(
+      rtems_build_name( 'W', 'O', 'R', '0' + worker ),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &Workers[ worker ]
+    );
+    directive_failed( status, "rtems_task_create" );
+
+    status = rtems_task_start( Workers[ worker ], Worker_task, worker );
+    directive_failed( status, "rtems_task_start" );
+  }
+
+  locked_printf(
+    " %d ticks of obtain/release pairs on one %s lock\n",
+    BENCHMARK_TICKS,
+    LOCK_NAME
+  );
+
+  for ( worker_count = 1 ; worker_count <= processors ; worker_count++ ) {
+    benchmark( worker_count );
+  }
+
+  locked_printf( "*** END OF TEST SMP11 ***\n" );
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS   MAXIMUM_WORKERS
+
+#define CONFIGURE_MAXIMUM_TASKS            \
+    (1 + CONFIGURE_SMP_MAXIMUM_PROCESSORS)
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
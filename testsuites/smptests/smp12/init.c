@@ -0,0 +1,227 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+
+#include <tmacros.h>
+#include "test_support.h"
+
+/*
+ *  The background tasks are always ready, so each scheduling decision
+ *  sees this number of ready tasks.
+ */
+#define BACKGROUND_TASKS 128
+
+#define SAMPLES 1000
+
+#define MAXIMUM_CLUSTERS 2
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Init_id;
+
+static rtems_id Waiter_id;
+
+static volatile uint64_t Send_time;
+
+static volatile uint64_t Total_latency;
+
+static volatile uint32_t Max_latency;
+
+static uint64_t uptime_in_nanoseconds( void )
+{
+  struct timespec   uptime;
+  rtems_status_code status;
+
+  status = rtems_clock_get_uptime( &uptime );
+  directive_failed( status, "rtems_clock_get_uptime" );
+
+  return (uint64_t) uptime.tv_sec * 1000000000 + uptime.tv_nsec;
+}
+
+static rtems_task Background_task(
+  rtems_task_argument argument
+)
+{
+  while ( true ) {
+    /* Stay ready all the time */
+  }
+}
+
+static rtems_task Waiter_task(
+  rtems_task_argument argument
+)
+{
+  rtems_event_set   received;
+  rtems_status_code status;
+
+  while ( true ) {
+    uint64_t latency;
+
+    status = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &received
+    );
+    directive_failed( status, "rtems_event_receive" );
+
+    latency = uptime_in_nanoseconds() - Send_time;
+    Total_latency += latency;
+    if ( latency > Max_latency )
+      Max_latency = (uint32_t) latency;
+
+    status = rtems_event_send( Init_id, RTEMS_EVENT_0 );
+    directive_failed( status, "rtems_event_send" );
+  }
+}
+
+static void benchmark( uint32_t cluster )
+{
+  rtems_event_set   received;
+  rtems_status_code status;
+  uint32_t          actual;
+  int               sample;
+
+  status = rtems_task_set_scheduler_cluster( Waiter_id, cluster );
+  directive_failed( status, "rtems_task_set_scheduler_cluster" );
+
+  status = rtems_task_get_scheduler_cluster( Waiter_id, &actual );
+  directive_failed( status, "rtems_task_get_scheduler_cluster" );
+  rtems_test_assert( actual == cluster );
+
+  Total_latency = 0;
+  Max_latency = 0;
+
+  for ( sample = 0 ; sample < SAMPLES ; sample++ ) {
+    Send_time = uptime_in_nanoseconds();
+
+    status = rtems_event_send( Waiter_id, RTEMS_EVENT_0 );
+    directive_failed( status, "rtems_event_send" );
+
+    status = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &received
+    );
+    directive_failed( status, "rtems_event_receive" );
+  }
+
+  locked_printf(
+    " cluster %" PRIu32 ": average dispatch latency %" PRIu64 "ns,"
+      " max %" PRIu32 "ns\n",
+    cluster,
+    Total_latency / SAMPLES,
+    Max_latency
+  );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  uint32_t          clusters;
+  uint32_t          cluster;
+  int               task;
+
+  locked_print_initialize();
+  locked_printf( "\n\n*** TEST SMP12 ***\n" );
+
+  Init_id = rtems_task_self();
+
+  for ( task = 0 ; task < BACKGROUND_TASKS ; task++ ) {
+    rtems_id id;
+
+    status = rtems_task_create(
+      rtems_build_name( 'B', 'G', 'N', 'D' ),
+      10 + task % 16,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    directive_failed( status, "rtems_task_create" );
+
+    status = rtems_task_start( id, Background_task, 0 );
+    directive_failed( status, "rtems_task_start" );
+  }
+
+  status = rtems_task_create(
+    rtems_build_name( 'W', 'A', 'I', 'T' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &Waiter_id
+  );
+  directive_failed( status, "rtems_task_create" );
+
+  status = rtems_task_start( Waiter_id, Waiter_task, 0 );
+  directive_failed( status, "rtems_task_start" );
+
+  clusters = (uint32_t) rtems_smp_get_number_of_processors();
+  if ( clusters > MAXIMUM_CLUSTERS )
+    clusters = MAXIMUM_CLUSTERS;
+
+  status = rtems_task_set_scheduler_cluster( Waiter_id, clusters );
+  fatal_directive_status(
+    status,
+    RTEMS_INVALID_NUMBER,
+    "rtems_task_set_scheduler_cluster with invalid cluster"
+  );
+
+  status = rtems_task_get_scheduler_cluster( Waiter_id, NULL );
+  fatal_directive_status(
+    status,
+    RTEMS_INVALID_ADDRESS,
+    "rtems_task_get_scheduler_cluster with NULL"
+  );
+
+  locked_printf(
+    " %d ready background tasks, %" PRIu32 " cluster(s)\n",
+    BACKGROUND_TASKS,
+    clusters
+  );
+
+  for ( cluster = 0 ; cluster < clusters ; cluster++ ) {
+    benchmark( cluster );
+  }
+
+  locked_printf( "*** END OF TEST SMP12 ***\n" );
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS   4
+
+#define CONFIGURE_SCHEDULER_PRIORITY_SMP
+#define CONFIGURE_SCHEDULER_PRIORITY_SMP_CLUSTERS MAXIMUM_CLUSTERS
+
+#define CONFIGURE_MAXIMUM_TASKS            (2 + BACKGROUND_TASKS)
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY       1
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
@@ -0,0 +1,347 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+
+#include <tmacros.h>
+#include "test_support.h"
+
+/*
+ *  Each benchmark submits batches of jobs during this number of clock
+ *  ticks.
+ */
+#define BENCHMARK_TICKS 50
+
+#define JOBS_PER_BATCH 64
+
+#define MAXIMUM_PROCESSORS 4
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_task_pool Pool;
+
+static rtems_task_pool_job Jobs[ JOBS_PER_BATCH ];
+
+static volatile uint32_t Results[ JOBS_PER_BATCH ];
+
+static volatile uint32_t Values[ JOBS_PER_BATCH ];
+
+static rtems_id Request_queue;
+
+static rtems_id Reply_queue;
+
+static rtems_task_pool_group Nested_group;
+
+static SMP_lock_spinlock_simple_Control Nested_lock;
+
+static volatile uint32_t Nested_sum;
+
+static void job_routine( void *arg )
+{
+  uint32_t index = (uint32_t) (uintptr_t) arg;
+  uint32_t value = index;
+  int      i;
+
+  /* Some work on data local to the job */
+  for ( i = 0 ; i < 100 ; i++ )
+    value = value * 1103515245 + 12345;
+
+  Values[ index ] = value;
+  ++Results[ index ];
+}
+
+static void check_batch( uint32_t batches )
+{
+  int index;
+
+  for ( index = 0 ; index < JOBS_PER_BATCH ; index++ )
+    rtems_test_assert( Results[ index ] == batches );
+}
+
+static void clear_results( void )
+{
+  int index;
+
+  for ( index = 0 ; index < JOBS_PER_BATCH ; index++ )
+    Results[ index ] = 0;
+}
+
+static void print_rate( const char *name, uint32_t batches )
+{
+  uint64_t per_second = (1000000ULL * batches * JOBS_PER_BATCH)
+    / (BENCHMARK_TICKS * rtems_configuration_get_microseconds_per_tick());
+
+  locked_printf( " %s: %" PRIu64 " jobs/s\n", name, per_second );
+}
+
+static void benchmark_task_pool( void )
+{
+  rtems_task_pool_group group;
+  rtems_interval        end;
+  rtems_status_code     status;
+  uint32_t              batches = 0;
+
+  clear_results();
+  rtems_task_pool_group_initialize( &group );
+
+  end = rtems_clock_get_ticks_since_boot() + BENCHMARK_TICKS;
+
+  do {
+    uint32_t index;
+
+    for ( index = 0 ; index < JOBS_PER_BATCH ; index++ ) {
+      status = rtems_task_pool_submit(
+        Pool,
+        &group,
+        &Jobs[ index ],
+        job_routine,
+        (void *) (uintptr_t) index
+      );
+      directive_failed( status, "rtems_task_pool_submit" );
+    }
+
+    status = rtems_task_pool_wait( Pool, &group );
+    directive_failed( status, "rtems_task_pool_wait" );
+
+    ++batches;
+  } while ( rtems_clock_get_ticks_since_boot() < end );
+
+  check_batch( batches );
+  print_rate( "task pool", batches );
+}
+
+static rtems_task Queue_worker(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+
+  while ( true ) {
+    uint32_t index;
+    size_t   size;
+
+    status = rtems_message_queue_receive(
+      Request_queue,
+      &index,
+      &size,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    directive_failed( status, "rtems_message_queue_receive" );
+
+    job_routine( (void *) (uintptr_t) index );
+
+    status = rtems_message_queue_send( Reply_queue, &index, sizeof( index ) );
+    directive_failed( status, "rtems_message_queue_send" );
+  }
+}
+
+static void benchmark_message_queue( void )
+{
+  rtems_interval    end;
+  rtems_status_code status;
+  uint32_t          batches = 0;
+
+  clear_results();
+
+  end = rtems_clock_get_ticks_since_boot() + BENCHMARK_TICKS;
+
+  do {
+    uint32_t index;
+
+    for ( index = 0 ; index < JOBS_PER_BATCH ; index++ ) {
+      status = rtems_message_queue_send(
+        Request_queue,
+        &index,
+        sizeof( index )
+      );
+      directive_failed( status, "rtems_message_queue_send" );
+    }
+
+    for ( index = 0 ; index < JOBS_PER_BATCH ; index++ ) {
+      uint32_t reply;
+      size_t   size;
+
+      status = rtems_message_queue_receive(
+        Reply_queue,
+        &reply,
+        &size,
+        RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+      directive_failed( status, "rtems_message_queue_receive" );
+    }
+
+    ++batches;
+  } while ( rtems_clock_get_ticks_since_boot() < end );
+
+  check_batch( batches );
+  print_rate( "message queue", batches );
+}
+
+static void nested_child( void *arg )
+{
+  ISR_Level level;
+
+  /* The sum is shared by all children */
+  level = _SMP_lock_spinlock_simple_Obtain( &Nested_lock );
+    Nested_sum += (uint32_t) (uintptr_t) arg;
+  _SMP_lock_spinlock_simple_Release( &Nested_lock, level );
+}
+
+static void nested_parent( void *arg )
+{
+  rtems_task_pool_group group;
+  rtems_status_code     status;
+  uint32_t              index;
+
+  rtems_task_pool_group_initialize( &group );
+
+  for ( index = 0 ; index < JOBS_PER_BATCH ; index++ ) {
+    status = rtems_task_pool_submit(
+      Pool,
+      &group,
+      &Jobs[ index ],
+      nested_child,
+      (void *) (uintptr_t) index
+    );
+    directive_failed( status, "rtems_task_pool_submit" );
+  }
+
+  status = rtems_task_pool_wait( Pool, &group );
+  directive_failed( status, "rtems_task_pool_wait" );
+}
+
+static void test_nested_jobs( void )
+{
+  rtems_task_pool_job parent;
+  rtems_status_code   status;
+
+  Nested_sum = 0;
+  _SMP_lock_spinlock_simple_Initialize( &Nested_lock );
+  rtems_task_pool_group_initialize( &Nested_group );
+
+  status = rtems_task_pool_submit(
+    Pool,
+    &Nested_group,
+    &parent,
+    nested_parent,
+    NULL
+  );
+  directive_failed( status, "rtems_task_pool_submit" );
+
+  status = rtems_task_pool_wait( Pool, &Nested_group );
+  directive_failed( status, "rtems_task_pool_wait" );
+
+  rtems_test_assert( Nested_sum == JOBS_PER_BATCH * (JOBS_PER_BATCH - 1) / 2 );
+  locked_printf( " nested jobs: sum %" PRIu32 "\n", Nested_sum );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  int               processors;
+  int               worker;
+
+  locked_print_initialize();
+  locked_printf( "\n\n*** TEST SMP13 ***\n" );
+
+  processors = rtems_smp_get_number_of_processors();
+
+  status = rtems_task_pool_create(
+    rtems_build_name( 'P', 'O', 'O', 'L' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &Pool
+  );
+  directive_failed( status, "rtems_task_pool_create" );
+
+  status = rtems_message_queue_create(
+    rtems_build_name( 'R', 'E', 'Q', ' ' ),
+    JOBS_PER_BATCH,
+    sizeof( uint32_t ),
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &Request_queue
+  );
+  directive_failed( status, "rtems_message_queue_create" );
+
+  status = rtems_message_queue_create(
+    rtems_build_name( 'R', 'E', 'P', ' ' ),
+    JOBS_PER_BATCH,
+    sizeof( uint32_t ),
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &Reply_queue
+  );
+  directive_failed( status, "rtems_message_queue_create" );
+
+  for ( worker = 0 ; worker < processors ; worker++ ) {
+    rtems_id id;
+
+    status = rtems_task_create(
+      rtems_build_name( 'Q', 'W', 'R', '0' + worker ),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    directive_failed( status, "rtems_task_create" );
+
+    status = rtems_task_start( id, Queue_worker, 0 );
+    directive_failed( status, "rtems_task_start" );
+  }
+
+  locked_printf(
+    " %d processor(s), %d ticks, batches of %d jobs\n",
+    processors,
+    BENCHMARK_TICKS,
+    JOBS_PER_BATCH
+  );
+
+  benchmark_task_pool();
+  benchmark_message_queue();
+  test_nested_jobs();
+
+  status = rtems_task_pool_delete( Pool );
+  directive_failed( status, "rtems_task_pool_delete" );
+
+  locked_printf( "*** END OF TEST SMP13 ***\n" );
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS   MAXIMUM_PROCESSORS
+
+#define CONFIGURE_MAXIMUM_TASKS            \
+    (1 + 2 * CONFIGURE_SMP_MAXIMUM_PROCESSORS)
+#define CONFIGURE_MAXIMUM_TASK_POOLS       1
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES   2
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+    (2 * CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(JOBS_PER_BATCH, sizeof(uint32_t)))
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
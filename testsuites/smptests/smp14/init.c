@@ -0,0 +1,265 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+
+#include <tmacros.h>
+#include "test_support.h"
+
+/*
+ *  Each benchmark lets the workers compete for the mutex during this
+ *  number of clock ticks.
+ */
+#define BENCHMARK_TICKS 50
+
+/*
+ *  The work inside and outside of the critical section in loop
+ *  iterations.  The critical section is short compared to two context
+ *  switches.
+ */
+#define CRITICAL_SECTION_LOOPS 200
+
+#define OUTSIDE_LOOPS 400
+
+#define MAXIMUM_PROCESSORS 4
+
+#define WORKER_EVENT RTEMS_EVENT_0
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Init_id;
+
+static rtems_id Mutex_id;
+
+static volatile bool Stop;
+
+static volatile uint32_t Counter;
+
+static uint32_t Obtains[ MAXIMUM_PROCESSORS ];
+
+static uint64_t Total_latency[ MAXIMUM_PROCESSORS ];
+
+static uint32_t Max_latency[ MAXIMUM_PROCESSORS ];
+
+static uint64_t uptime_in_nanoseconds( void )
+{
+  struct timespec   uptime;
+  rtems_status_code status;
+
+  status = rtems_clock_get_uptime( &uptime );
+  directive_failed( status, "rtems_clock_get_uptime" );
+
+  return (uint64_t) uptime.tv_sec * 1000000000 + uptime.tv_nsec;
+}
+
+static void busy( uint32_t loops )
+{
+  volatile uint32_t i;
+
+  for ( i = 0 ; i < loops ; i++ ) {
+    /* Burn some time */
+  }
+}
+
+static rtems_task Worker_task(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  uint32_t          worker = (uint32_t) argument;
+
+  while ( !Stop ) {
+    uint64_t begin;
+    uint32_t latency;
+
+    begin = uptime_in_nanoseconds();
+    status = rtems_semaphore_obtain(
+      Mutex_id,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    directive_failed( status, "rtems_semaphore_obtain" );
+    latency = (uint32_t) (uptime_in_nanoseconds() - begin);
+
+    /* The counter detects a violation of the mutual exclusion */
+    Counter = Counter + 1;
+    busy( CRITICAL_SECTION_LOOPS );
+
+    status = rtems_semaphore_release( Mutex_id );
+    directive_failed( status, "rtems_semaphore_release" );
+
+    ++Obtains[ worker ];
+    Total_latency[ worker ] += latency;
+    if ( latency > Max_latency[ worker ] )
+      Max_latency[ worker ] = latency;
+
+    busy( OUTSIDE_LOOPS );
+  }
+
+  status = rtems_event_send( Init_id, WORKER_EVENT );
+  directive_failed( status, "rtems_event_send" );
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+}
+
+static void benchmark( const char *name, rtems_attribute adaptive )
+{
+  rtems_status_code status;
+  rtems_id          workers[ MAXIMUM_PROCESSORS ];
+  uint32_t          processors;
+  uint32_t          worker;
+  uint32_t          obtains = 0;
+  uint64_t          total_latency = 0;
+  uint32_t          max_latency = 0;
+  uint64_t          per_second;
+
+  status = rtems_semaphore_create(
+    rtems_build_name( 'M', 'T', 'X', ' ' ),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | adaptive,
+    0,
+    &Mutex_id
+  );
+  directive_failed( status, "rtems_semaphore_create" );
+
+  processors = (uint32_t) rtems_smp_get_number_of_processors();
+  if ( processors > MAXIMUM_PROCESSORS )
+    processors = MAXIMUM_PROCESSORS;
+
+  Stop = false;
+  Counter = 0;
+
+  for ( worker = 0 ; worker < processors ; worker++ ) {
+    Obtains[ worker ] = 0;
+    Total_latency[ worker ] = 0;
+    Max_latency[ worker ] = 0;
+
+    status = rtems_task_create(
+      rtems_build_name( 'W', 'R', 'K', '0' + worker ),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &workers[ worker ]
+    );
+    directive_failed( status, "rtems_task_create" );
+
+    status = rtems_task_start( workers[ worker ], Worker_task, worker );
+    directive_failed( status, "rtems_task_start" );
+  }
+
+  status = rtems_task_wake_after( BENCHMARK_TICKS );
+  directive_failed( status, "rtems_task_wake_after" );
+
+  Stop = true;
+
+  for ( worker = 0 ; worker < processors ; worker++ ) {
+    rtems_event_set received;
+
+    status = rtems_event_receive(
+      WORKER_EVENT,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &received
+    );
+    directive_failed( status, "rtems_event_receive" );
+  }
+
+  for ( worker = 0 ; worker < processors ; worker++ ) {
+    status = rtems_task_delete( workers[ worker ] );
+    directive_failed( status, "rtems_task_delete" );
+
+    obtains += Obtains[ worker ];
+    total_latency += Total_latency[ worker ];
+    if ( Max_latency[ worker ] > max_latency )
+      max_latency = Max_latency[ worker ];
+  }
+
+  rtems_test_assert( obtains > 0 );
+  rtems_test_assert( Counter == obtains );
+
+  status = rtems_semaphore_delete( Mutex_id );
+  directive_failed( status, "rtems_semaphore_delete" );
+
+  per_second = (1000000ULL * obtains)
+    / (BENCHMARK_TICKS * rtems_configuration_get_microseconds_per_tick());
+
+  locked_printf(
+    " %s mutex: %" PRIu64 " obtains/s, average latency %" PRIu64 "ns,"
+      " max %" PRIu32 "ns\n",
+    name,
+    per_second,
+    total_latency / obtains,
+    max_latency
+  );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  rtems_id          id;
+
+  locked_print_initialize();
+  locked_printf( "\n\n*** TEST SMP14 ***\n" );
+
+  Init_id = rtems_task_self();
+
+  status = rtems_semaphore_create(
+    rtems_build_name( 'C', 'N', 'T', ' ' ),
+    1,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_ADAPTIVE,
+    0,
+    &id
+  );
+  fatal_directive_status(
+    status,
+    RTEMS_NOT_DEFINED,
+    "rtems_semaphore_create of adaptive counting semaphore"
+  );
+
+  locked_printf(
+    " %d processor(s), %d ticks, critical section of %d loops\n",
+    rtems_smp_get_number_of_processors(),
+    BENCHMARK_TICKS,
+    CRITICAL_SECTION_LOOPS
+  );
+
+  benchmark( "blocking", RTEMS_NO_ADAPTIVE );
+  benchmark( "adaptive", RTEMS_ADAPTIVE );
+
+  locked_printf( "*** END OF TEST SMP14 ***\n" );
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS   MAXIMUM_PROCESSORS
+
+#define CONFIGURE_MAXIMUM_TASKS            (1 + MAXIMUM_PROCESSORS)
+#define CONFIGURE_MAXIMUM_SEMAPHORES       1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY       1
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
@@ -0,0 +1,245 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <pthread.h>
+
+#include <tmacros.h>
+#include "test_support.h"
+
+#include <rtems/posix/rwlock.h> /* for pthread_rwlockattr_setbigreader_np */
+
+/*
+ *  Each benchmark lets the readers use the rwlock during this number of
+ *  clock ticks.  The writer updates the table every WRITE_INTERVAL ticks.
+ */
+#define BENCHMARK_TICKS 50
+
+#define WRITE_INTERVAL 5
+
+/*
+ *  The readers look up entries of this table.
+ */
+#define TABLE_SIZE 16
+
+#define MAXIMUM_PROCESSORS 4
+
+#define READER_EVENT RTEMS_EVENT_0
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Init_id;
+
+static pthread_rwlock_t RWLock;
+
+static volatile bool Stop;
+
+/*
+ *  The writer keeps all entries equal, so a reader which sees different
+ *  entries detects a violation of the exclusion.
+ */
+static volatile uint32_t Table[ TABLE_SIZE ];
+
+static uint32_t Reads[ MAXIMUM_PROCESSORS ];
+
+static rtems_task Reader_task(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  uint32_t          reader = (uint32_t) argument;
+  int               eno;
+
+  while ( !Stop ) {
+    uint32_t first;
+    uint32_t index;
+
+    eno = pthread_rwlock_rdlock( &RWLock );
+    rtems_test_assert( eno == 0 );
+
+    first = Table[ 0 ];
+    for ( index = 1 ; index < TABLE_SIZE ; index++ )
+      rtems_test_assert( Table[ index ] == first );
+
+    eno = pthread_rwlock_unlock( &RWLock );
+    rtems_test_assert( eno == 0 );
+
+    ++Reads[ reader ];
+  }
+
+  status = rtems_event_send( Init_id, READER_EVENT );
+  directive_failed( status, "rtems_event_send" );
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+}
+
+static void update_table( void )
+{
+  uint32_t index;
+  int      eno;
+
+  eno = pthread_rwlock_wrlock( &RWLock );
+  rtems_test_assert( eno == 0 );
+
+  for ( index = 0 ; index < TABLE_SIZE ; index++ )
+    Table[ index ] = Table[ index ] + 1;
+
+  eno = pthread_rwlock_unlock( &RWLock );
+  rtems_test_assert( eno == 0 );
+}
+
+static void benchmark( const char *name, int big_reader )
+{
+  rtems_status_code    status;
+  pthread_rwlockattr_t attr;
+  rtems_id             readers[ MAXIMUM_PROCESSORS ];
+  uint32_t             processors;
+  uint32_t             reader;
+  uint32_t             writes = 0;
+  uint32_t             reads = 0;
+  uint32_t             ticks;
+  uint64_t             per_second;
+  int                  eno;
+
+  eno = pthread_rwlockattr_init( &attr );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlockattr_setbigreader_np( &attr, big_reader );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlock_init( &RWLock, &attr );
+  rtems_test_assert( eno == 0 );
+
+  processors = (uint32_t) rtems_smp_get_number_of_processors();
+  if ( processors > MAXIMUM_PROCESSORS )
+    processors = MAXIMUM_PROCESSORS;
+
+  Stop = false;
+
+  for ( reader = 0 ; reader < processors ; reader++ ) {
+    Reads[ reader ] = 0;
+
+    status = rtems_task_create(
+      rtems_build_name( 'R', 'D', 'R', '0' + reader ),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &readers[ reader ]
+    );
+    directive_failed( status, "rtems_task_create" );
+
+    status = rtems_task_start( readers[ reader ], Reader_task, reader );
+    directive_failed( status, "rtems_task_start" );
+  }
+
+  for ( ticks = 0 ; ticks < BENCHMARK_TICKS ; ticks += WRITE_INTERVAL ) {
+    status = rtems_task_wake_after( WRITE_INTERVAL );
+    directive_failed( status, "rtems_task_wake_after" );
+
+    update_table();
+    ++writes;
+  }
+
+  Stop = true;
+
+  for ( reader = 0 ; reader < processors ; reader++ ) {
+    rtems_event_set received;
+
+    status = rtems_event_receive(
+      READER_EVENT,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &received
+    );
+    directive_failed( status, "rtems_event_receive" );
+  }
+
+  for ( reader = 0 ; reader < processors ; reader++ ) {
+    status = rtems_task_delete( readers[ reader ] );
+    directive_failed( status, "rtems_task_delete" );
+
+    reads += Reads[ reader ];
+  }
+
+  rtems_test_assert( reads > 0 );
+
+  /* The lock is free again, so a writer obtains it immediately */
+  eno = pthread_rwlock_trywrlock( &RWLock );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlock_unlock( &RWLock );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlock_destroy( &RWLock );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_rwlockattr_destroy( &attr );
+  rtems_test_assert( eno == 0 );
+
+  per_second = (1000000ULL * reads)
+    / (BENCHMARK_TICKS * rtems_configuration_get_microseconds_per_tick());
+
+  locked_printf(
+    " %s rwlock: %" PRIu64 " reads/s, %" PRIu32 " writes\n",
+    name,
+    per_second,
+    writes
+  );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  locked_print_initialize();
+  locked_printf( "\n\n*** TEST SMP15 ***\n" );
+
+  Init_id = rtems_task_self();
+
+  locked_printf(
+    " %d processor(s), %d ticks, write every %d ticks\n",
+    rtems_smp_get_number_of_processors(),
+    BENCHMARK_TICKS,
+    WRITE_INTERVAL
+  );
+
+  benchmark( "shared counter", 0 );
+  benchmark( "big reader", 1 );
+
+  rtems_test_assert( Table[ 0 ] == 2 * (BENCHMARK_TICKS / WRITE_INTERVAL) );
+
+  locked_printf( "*** END OF TEST SMP15 ***\n" );
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS   MAXIMUM_PROCESSORS
+
+#define CONFIGURE_MAXIMUM_TASKS            (1 + MAXIMUM_PROCESSORS)
+#define CONFIGURE_MAXIMUM_POSIX_RWLOCKS    1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY       1
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
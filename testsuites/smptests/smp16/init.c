@@ -0,0 +1,184 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+
+#include <tmacros.h>
+#include "test_support.h"
+
+/*
+ *  The readers read the uptime during this number of clock ticks.
+ */
+#define CHECK_TICKS 50
+
+#define MAXIMUM_PROCESSORS 4
+
+#define READER_EVENT RTEMS_EVENT_0
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Init_id;
+
+static rtems_id Mutex_id;
+
+static volatile bool Stop;
+
+/*
+ *  This is the latest uptime read by any reader.  It is protected by the
+ *  mutex, so the reads are ordered across the processors.
+ */
+static struct timespec Last;
+
+static uint32_t Reads[ MAXIMUM_PROCESSORS ];
+
+static bool timespec_less( const struct timespec *a, const struct timespec *b )
+{
+  return a->tv_sec < b->tv_sec
+    || ( a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec );
+}
+
+static rtems_task Reader_task(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  uint32_t          reader = (uint32_t) argument;
+
+  while ( !Stop ) {
+    struct timespec now;
+
+    status = rtems_semaphore_obtain( Mutex_id, RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+    directive_failed( status, "rtems_semaphore_obtain" );
+
+    status = rtems_clock_get_uptime( &now );
+    directive_failed( status, "rtems_clock_get_uptime" );
+
+    rtems_test_assert( !timespec_less( &now, &Last ) );
+    Last = now;
+
+    status = rtems_semaphore_release( Mutex_id );
+    directive_failed( status, "rtems_semaphore_release" );
+
+    ++Reads[ reader ];
+  }
+
+  status = rtems_event_send( Init_id, READER_EVENT );
+  directive_failed( status, "rtems_event_send" );
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  rtems_id          readers[ MAXIMUM_PROCESSORS ];
+  uint32_t          processors;
+  uint32_t          reader;
+  uint32_t          reads = 0;
+
+  locked_print_initialize();
+  locked_printf( "\n\n*** TEST SMP16 ***\n" );
+
+  Init_id = rtems_task_self();
+
+  processors = (uint32_t) rtems_smp_get_number_of_processors();
+  if ( processors > MAXIMUM_PROCESSORS )
+    processors = MAXIMUM_PROCESSORS;
+
+  locked_printf(
+    " %d processor(s), %d ticks\n",
+    rtems_smp_get_number_of_processors(),
+    CHECK_TICKS
+  );
+
+  status = rtems_semaphore_create(
+    rtems_build_name( 'M', 'T', 'X', ' ' ),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY,
+    0,
+    &Mutex_id
+  );
+  directive_failed( status, "rtems_semaphore_create" );
+
+  status = rtems_clock_get_uptime( &Last );
+  directive_failed( status, "rtems_clock_get_uptime" );
+
+  for ( reader = 0 ; reader < processors ; reader++ ) {
+    status = rtems_task_create(
+      rtems_build_name( 'R', 'D', 'R', '0' + reader ),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &readers[ reader ]
+    );
+    directive_failed( status, "rtems_task_create" );
+
+    status = rtems_task_start( readers[ reader ], Reader_task, reader );
+    directive_failed( status, "rtems_task_start" );
+  }
+
+  status = rtems_task_wake_after( CHECK_TICKS );
+  directive_failed( status, "rtems_task_wake_after" );
+
+  Stop = true;
+
+  for ( reader = 0 ; reader < processors ; reader++ ) {
+    rtems_event_set received;
+
+    status = rtems_event_receive(
+      READER_EVENT,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &received
+    );
+    directive_failed( status, "rtems_event_receive" );
+  }
+
+  for ( reader = 0 ; reader < processors ; reader++ ) {
+    status = rtems_task_delete( readers[ reader ] );
+    directive_failed( status, "rtems_task_delete" );
+
+    reads += Reads[ reader ];
+  }
+
+  rtems_test_assert( reads > 0 );
+
+  locked_printf( " uptime is monotonic across processors\n" );
+
+  locked_printf( "*** END OF TEST SMP16 ***\n" );
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS   MAXIMUM_PROCESSORS
+
+#define CONFIGURE_MAXIMUM_TASKS            (1 + MAXIMUM_PROCESSORS)
+#define CONFIGURE_MAXIMUM_SEMAPHORES       1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY       1
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
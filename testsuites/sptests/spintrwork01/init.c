@@ -0,0 +1,138 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#define SERVER_PRIORITY 1
+
+/* forward declarations to avoid warnings */
+rtems_task Init(rtems_task_argument argument);
+void Work_routine(void *arg, uint32_t count);
+rtems_timer_service_routine Storm_routine(rtems_id timer, void *arg);
+
+rtems_interrupt_work Work;
+
+volatile uint32_t Work_calls;
+volatile uint32_t Work_count;
+
+void Work_routine(
+  void     *arg,
+  uint32_t  count
+)
+{
+  rtems_test_assert( arg == &Work );
+  ++Work_calls;
+  Work_count += count;
+}
+
+rtems_timer_service_routine Storm_routine(
+  rtems_id  timer,
+  void     *arg
+)
+{
+  rtems_status_code status;
+  int               i;
+
+  for ( i = 0 ; i < 3 ; ++i ) {
+    status = rtems_interrupt_work_submit( &Work );
+    rtems_test_assert( status == RTEMS_SUCCESSFUL );
+  }
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  rtems_id          timer;
+
+  puts( "\n\n*** TEST INTERRUPT WORK 01 ***" );
+
+  rtems_interrupt_work_initialize( &Work, Work_routine, &Work );
+
+  puts( "Init - rtems_interrupt_work_submit - NULL - RTEMS_INVALID_ADDRESS" );
+  status = rtems_interrupt_work_submit( NULL );
+  fatal_directive_status(
+    status,
+    RTEMS_INVALID_ADDRESS,
+    "rtems_interrupt_work_submit NULL"
+  );
+
+  puts( "Init - rtems_interrupt_work_submit - RTEMS_INCORRECT_STATE" );
+  status = rtems_interrupt_work_submit( &Work );
+  fatal_directive_status(
+    status,
+    RTEMS_INCORRECT_STATE,
+    "rtems_interrupt_work_submit no server"
+  );
+
+  puts( "Init - rtems_interrupt_work_initiate_server - OK" );
+  status = rtems_interrupt_work_initiate_server(
+    SERVER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    0
+  );
+  directive_failed( status, "rtems_interrupt_work_initiate_server" );
+
+  puts(
+    "Init - rtems_interrupt_work_initiate_server - RTEMS_INCORRECT_STATE"
+  );
+  status = rtems_interrupt_work_initiate_server(
+    SERVER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    0
+  );
+  fatal_directive_status(
+    status,
+    RTEMS_INCORRECT_STATE,
+    "rtems_interrupt_work_initiate_server again"
+  );
+
+  puts( "Init - rtems_interrupt_work_submit - from task - OK" );
+  status = rtems_interrupt_work_submit( &Work );
+  directive_failed( status, "rtems_interrupt_work_submit" );
+  rtems_test_assert( Work_calls == 1 );
+  rtems_test_assert( Work_count == 1 );
+
+  puts( "Init - rtems_interrupt_work_submit - 3 times from ISR - one call" );
+  status = rtems_timer_create( rtems_build_name( 'T', 'M', 'R', ' ' ), &timer );
+  directive_failed( status, "rtems_timer_create" );
+
+  status = rtems_timer_fire_after( timer, 1, Storm_routine, NULL );
+  directive_failed( status, "rtems_timer_fire_after" );
+
+  status = rtems_task_wake_after( 2 );
+  directive_failed( status, "rtems_task_wake_after" );
+  rtems_test_assert( Work_calls == 2 );
+  rtems_test_assert( Work_count == 4 );
+
+  puts( "*** END OF TEST INTERRUPT WORK 01 ***" );
+  rtems_test_exit( 0 );
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS           2
+#define CONFIGURE_MAXIMUM_TIMERS          1
+#define CONFIGURE_INIT_TASK_PRIORITY      2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
+/* end of file */
@@ -0,0 +1,120 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+/* forward declarations to avoid warnings */
+rtems_task Init(rtems_task_argument argument);
+
+#define SEMAPHORE_COUNT 50000
+
+#define SEMAPHORES_PER_ALLOCATION 64
+
+rtems_id Semaphores[ SEMAPHORE_COUNT ];
+
+static uint32_t Create_semaphores( void )
+{
+  rtems_status_code status;
+  uint32_t          created;
+
+  puts( "Init - create semaphores over many object table extensions" );
+
+  for ( created = 0 ; created < SEMAPHORE_COUNT ; created++ ) {
+    status = rtems_semaphore_create(
+      rtems_build_name( 'O', 'B', 'J', 'T' ),
+      1,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      0,
+      &Semaphores[ created ]
+    );
+    if ( status == RTEMS_TOO_MANY )
+      break;
+    directive_failed( status, "rtems_semaphore_create" );
+  }
+
+  rtems_test_assert( created > SEMAPHORES_PER_ALLOCATION );
+
+  return created;
+}
+
+static void Check_semaphores( uint32_t count )
+{
+  rtems_status_code status;
+  uint32_t          i;
+
+  puts( "Init - obtain and release each semaphore by its id" );
+
+  for ( i = 0 ; i < count ; i++ ) {
+    status = rtems_semaphore_obtain( Semaphores[ i ], RTEMS_NO_WAIT, 0 );
+    directive_failed( status, "rtems_semaphore_obtain" );
+
+    status = rtems_semaphore_release( Semaphores[ i ] );
+    directive_failed( status, "rtems_semaphore_release" );
+  }
+}
+
+static void Delete_semaphores( uint32_t count )
+{
+  rtems_status_code status;
+  uint32_t          i;
+
+  puts( "Init - delete each semaphore - ids become invalid" );
+
+  for ( i = 0 ; i < count ; i++ ) {
+    status = rtems_semaphore_delete( Semaphores[ i ] );
+    directive_failed( status, "rtems_semaphore_delete" );
+  }
+
+  for ( i = 0 ; i < count ; i++ ) {
+    status = rtems_semaphore_obtain( Semaphores[ i ], RTEMS_NO_WAIT, 0 );
+    fatal_directive_status(
+      status,
+      RTEMS_INVALID_ID,
+      "rtems_semaphore_obtain"
+    );
+  }
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  uint32_t count;
+
+  puts( "\n\n*** TEST OBJECT TABLE 01 ***" );
+
+  count = Create_semaphores();
+  Check_semaphores( count );
+  Delete_semaphores( count );
+
+  puts( "*** END OF TEST OBJECT TABLE 01 ***" );
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS         1
+#define CONFIGURE_MAXIMUM_SEMAPHORES \
+  rtems_resource_unlimited( SEMAPHORES_PER_ALLOCATION )
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
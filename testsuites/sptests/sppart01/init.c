@@ -0,0 +1,147 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+/* forward declarations to avoid warnings */
+rtems_task Init(rtems_task_argument argument);
+
+#define BUFFER_COUNT 4
+
+#define BUFFER_SIZE 16
+
+static uint8_t Area[ BUFFER_COUNT * BUFFER_SIZE ] CPU_STRUCTURE_ALIGNMENT;
+
+static rtems_id Create_partition( rtems_attribute attribute_set )
+{
+  rtems_status_code status;
+  rtems_id          id;
+
+  status = rtems_partition_create(
+    rtems_build_name( 'P', 'A', 'R', 'T' ),
+    Area,
+    sizeof( Area ),
+    BUFFER_SIZE,
+    attribute_set,
+    &id
+  );
+  directive_failed( status, "rtems_partition_create" );
+
+  return id;
+}
+
+static void Check_handles( rtems_attribute attribute_set, const char *kind )
+{
+  rtems_status_code       status;
+  rtems_id                id;
+  rtems_partition_handle  handle;
+  rtems_partition_handle  new_handle;
+  void                   *buffer;
+
+  id = Create_partition( attribute_set );
+  status = rtems_partition_get_handle( id, &handle );
+  directive_failed( status, "rtems_partition_get_handle" );
+
+  printf( "Init - %s - delete with a buffer from the handle - in use\n", kind );
+  status = rtems_partition_get_buffer_by_handle( handle, &buffer );
+  directive_failed( status, "rtems_partition_get_buffer_by_handle" );
+  status = rtems_partition_delete( id );
+  fatal_directive_status(
+    status,
+    RTEMS_RESOURCE_IN_USE,
+    "rtems_partition_delete"
+  );
+
+  printf( "Init - %s - return the buffer by handle and delete\n", kind );
+  status = rtems_partition_return_buffer_by_handle( handle, buffer );
+  directive_failed( status, "rtems_partition_return_buffer_by_handle" );
+  status = rtems_partition_delete( id );
+  directive_failed( status, "rtems_partition_delete" );
+
+  printf( "Init - %s - handle of a deleted partition - invalid id\n", kind );
+  status = rtems_partition_get_buffer_by_handle( handle, &buffer );
+  fatal_directive_status(
+    status,
+    RTEMS_INVALID_ID,
+    "rtems_partition_get_buffer_by_handle"
+  );
+
+  /*
+   *  The only partition control block is reused by the new partition.
+   */
+  printf( "Init - %s - handle of a replaced partition - invalid id\n", kind );
+  id = Create_partition( attribute_set );
+  rtems_test_assert( handle.partition != NULL );
+  status = rtems_partition_get_buffer_by_handle( handle, &buffer );
+  fatal_directive_status(
+    status,
+    RTEMS_INVALID_ID,
+    "rtems_partition_get_buffer_by_handle"
+  );
+
+  status = rtems_partition_get_handle( id, &new_handle );
+  directive_failed( status, "rtems_partition_get_handle" );
+  rtems_test_assert( new_handle.partition == handle.partition );
+  status = rtems_partition_get_buffer_by_handle( new_handle, &buffer );
+  directive_failed( status, "rtems_partition_get_buffer_by_handle" );
+  status = rtems_partition_return_buffer_by_handle( handle, buffer );
+  fatal_directive_status(
+    status,
+    RTEMS_INVALID_ID,
+    "rtems_partition_return_buffer_by_handle"
+  );
+
+  printf( "Init - %s - buffers by identifier count as used\n", kind );
+  status = rtems_partition_return_buffer( id, buffer );
+  directive_failed( status, "rtems_partition_return_buffer" );
+  status = rtems_partition_get_buffer( id, &buffer );
+  directive_failed( status, "rtems_partition_get_buffer" );
+  status = rtems_partition_delete( id );
+  fatal_directive_status(
+    status,
+    RTEMS_RESOURCE_IN_USE,
+    "rtems_partition_delete"
+  );
+  status = rtems_partition_return_buffer_by_handle( new_handle, buffer );
+  directive_failed( status, "rtems_partition_return_buffer_by_handle" );
+  status = rtems_partition_delete( id );
+  directive_failed( status, "rtems_partition_delete" );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  puts( "\n\n*** TEST PARTITION 01 ***" );
+
+  Check_handles( RTEMS_PARTITION_NO_PER_CPU_CACHE, "chain" );
+  Check_handles( RTEMS_PARTITION_PER_CPU_CACHE, "per CPU cache" );
+
+  puts( "*** END OF TEST PARTITION 01 ***" );
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS         1
+#define CONFIGURE_MAXIMUM_PARTITIONS    1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
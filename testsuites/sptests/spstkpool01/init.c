@@ -0,0 +1,167 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <string.h>
+
+/* forward declarations to avoid warnings */
+rtems_task Init(rtems_task_argument argument);
+rtems_task Worker(rtems_task_argument argument);
+
+#define POOLED_STACK_SIZE (2 * CPU_STACK_MINIMUM_SIZE)
+
+#define OVERSIZED_STACK_SIZE (8 * CPU_STACK_MINIMUM_SIZE)
+
+#define WORKER_PRIORITY 1
+
+rtems_task Worker(
+  rtems_task_argument argument
+)
+{
+  rtems_task_suspend( RTEMS_SELF );
+}
+
+static uint32_t Workspace_free_size( void )
+{
+  Heap_Information_block info;
+  bool                   sc;
+
+  sc = rtems_workspace_get_information( &info );
+  rtems_test_assert( sc );
+
+  return info.Free.total;
+}
+
+static void Create_start_delete( size_t stack_size )
+{
+  rtems_status_code status;
+  rtems_id          id;
+
+  status = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    WORKER_PRIORITY,
+    stack_size,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  directive_failed( status, "rtems_task_create" );
+
+  status = rtems_task_start( id, Worker, 0 );
+  directive_failed( status, "rtems_task_start" );
+
+  status = rtems_task_delete( id );
+  directive_failed( status, "rtems_task_delete" );
+}
+
+static uint32_t Workspace_used_by_task( size_t stack_size )
+{
+  rtems_status_code status;
+  rtems_id          id;
+  uint32_t          before;
+  uint32_t          used;
+
+  before = Workspace_free_size();
+
+  status = rtems_task_create(
+    rtems_build_name( 'S', 'I', 'Z', 'E' ),
+    WORKER_PRIORITY,
+    stack_size,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  directive_failed( status, "rtems_task_create" );
+
+  used = before - Workspace_free_size();
+
+  status = rtems_task_delete( id );
+  directive_failed( status, "rtems_task_delete" );
+
+  return used;
+}
+
+static void Check_stack_sources( void )
+{
+  uint32_t before;
+
+  puts( "Init - task with a pooled stack - stack taken from the pool" );
+  before = Workspace_free_size();
+  rtems_test_assert( Workspace_used_by_task( POOLED_STACK_SIZE )
+    < POOLED_STACK_SIZE );
+  rtems_test_assert( Workspace_free_size() == before );
+
+  puts( "Init - create/start/delete of a pooled task - workspace unchanged" );
+  Create_start_delete( POOLED_STACK_SIZE );
+  rtems_test_assert( Workspace_free_size() == before );
+
+  puts( "Init - task with an oversized stack - stack taken from workspace" );
+  rtems_test_assert( Workspace_used_by_task( OVERSIZED_STACK_SIZE )
+    >= OVERSIZED_STACK_SIZE );
+  rtems_test_assert( Workspace_free_size() == before );
+}
+
+static void Check_class_names( void )
+{
+  Workspace_Slab_information info;
+  char                       name[ 32 ];
+  uint32_t                   index = 0;
+  bool                       found = false;
+
+  puts( "Init - size classes are named by their stack size" );
+  sprintf( name, "task stack %lu", (unsigned long) POOLED_STACK_SIZE );
+  while ( rtems_workspace_get_slab_info( index, &info ) ) {
+    if ( strcmp( info.name, name ) == 0 ) {
+      rtems_test_assert( info.object_count == 1 );
+      found = true;
+    }
+    ++index;
+  }
+  rtems_test_assert( found );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  puts( "\n\n*** TEST STACK POOL 01 ***" );
+
+  Check_stack_sources();
+  Check_class_names();
+
+  puts( "*** END OF TEST STACK POOL 01 ***" );
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS         2
+#define CONFIGURE_INIT_TASK_PRIORITY    (WORKER_PRIORITY + 1)
+
+#define CONFIGURE_TASK_STACK_POOL
+#define CONFIGURE_TASK_STACK_POOL_CLASSES \
+  { CONFIGURE_MINIMUM_TASK_STACK_SIZE, 0, 0 }, \
+  { POOLED_STACK_SIZE, 1, 1 }
+
+#define CONFIGURE_EXTRA_TASK_STACKS \
+  (POOLED_STACK_SIZE + OVERSIZED_STACK_SIZE)
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
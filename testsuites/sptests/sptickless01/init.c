@@ -0,0 +1,203 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+/* forward declarations to avoid warnings */
+rtems_task Init(rtems_task_argument argument);
+rtems_timer_service_routine Timer_routine(rtems_id timer, void *arg);
+
+#if defined(BSP_FEATURE_TICKLESS_IDLE)
+
+/*
+ *  Clock ISRs since initialization, provided by the clock driver shell
+ */
+extern volatile uint32_t Clock_driver_ticks;
+
+#define MICROSECONDS_PER_TICK 100
+
+/*
+ *  This is the time a delay or timer may expire late.  It covers the
+ *  partial tick at the start of an interval and the interrupt latency.
+ */
+#define MAXIMUM_LATENCY (10 * MICROSECONDS_PER_TICK)
+
+static const rtems_interval Delays[] = { 1, 2, 7, 50, 1000, 12345 };
+
+static volatile bool Timer_fired;
+
+static rtems_status_code Timer_status;
+
+static struct timespec Timer_uptime;
+
+/*
+ *  The timer routine runs in interrupt context, so it only records the
+ *  uptime and the status for the task.
+ */
+rtems_timer_service_routine Timer_routine(
+  rtems_id  timer,
+  void     *arg
+)
+{
+  Timer_status = rtems_clock_get_uptime( &Timer_uptime );
+  Timer_fired = true;
+}
+
+static uint64_t Uptime_in_microseconds( void )
+{
+  rtems_status_code status;
+  struct timespec   uptime;
+
+  status = rtems_clock_get_uptime( &uptime );
+  directive_failed( status, "rtems_clock_get_uptime" );
+
+  return (uint64_t) uptime.tv_sec * 1000000 + uptime.tv_nsec / 1000;
+}
+
+static void Check_elapsed( uint64_t elapsed, uint64_t expected )
+{
+  rtems_test_assert( elapsed + MICROSECONDS_PER_TICK >= expected );
+  rtems_test_assert( elapsed <= expected + MAXIMUM_LATENCY );
+}
+
+static void Check_delays( void )
+{
+  size_t i;
+
+  puts( "Init - rtems_task_wake_after - delays expire in time" );
+
+  for ( i = 0 ; i < sizeof( Delays ) / sizeof( Delays[ 0 ] ) ; i++ ) {
+    rtems_status_code status;
+    uint64_t          start;
+    uint64_t          elapsed;
+
+    /* Start at a tick boundary */
+    status = rtems_task_wake_after( 1 );
+    directive_failed( status, "rtems_task_wake_after" );
+
+    start = Uptime_in_microseconds();
+
+    status = rtems_task_wake_after( Delays[ i ] );
+    directive_failed( status, "rtems_task_wake_after" );
+
+    elapsed = Uptime_in_microseconds() - start;
+    Check_elapsed( elapsed, (uint64_t) Delays[ i ] * MICROSECONDS_PER_TICK );
+  }
+}
+
+static void Check_timer( void )
+{
+  rtems_status_code status;
+  rtems_id          timer;
+  uint64_t          start;
+  uint64_t          fired;
+
+  puts( "Init - rtems_timer_fire_after - timer fires in time" );
+
+  status = rtems_timer_create( rtems_build_name( 'T', 'M', 'R', ' ' ), &timer );
+  directive_failed( status, "rtems_timer_create" );
+
+  status = rtems_task_wake_after( 1 );
+  directive_failed( status, "rtems_task_wake_after" );
+
+  start = Uptime_in_microseconds();
+
+  status = rtems_timer_fire_after( timer, 500, Timer_routine, NULL );
+  directive_failed( status, "rtems_timer_fire_after" );
+
+  while ( !Timer_fired ) {
+    status = rtems_task_wake_after( 1000 );
+    directive_failed( status, "rtems_task_wake_after" );
+  }
+
+  directive_failed( Timer_status, "rtems_clock_get_uptime" );
+
+  fired = (uint64_t) Timer_uptime.tv_sec * 1000000
+    + Timer_uptime.tv_nsec / 1000;
+  Check_elapsed( fired - start, 500 * MICROSECONDS_PER_TICK );
+
+  status = rtems_timer_delete( timer );
+  directive_failed( status, "rtems_timer_delete" );
+}
+
+static void Check_interrupt_rate( void )
+{
+  rtems_status_code status;
+  rtems_interval    ticks_per_second;
+  rtems_interval    ticks;
+  uint32_t          isrs;
+
+  puts( "Init - idle second - fewer clock interrupts than ticks" );
+
+  ticks_per_second = rtems_clock_get_ticks_per_second();
+
+  ticks = rtems_clock_get_ticks_since_boot();
+  isrs = Clock_driver_ticks;
+
+  status = rtems_task_wake_after( ticks_per_second );
+  directive_failed( status, "rtems_task_wake_after" );
+
+  ticks = rtems_clock_get_ticks_since_boot() - ticks;
+  isrs = Clock_driver_ticks - isrs;
+
+  rtems_test_assert( ticks >= ticks_per_second );
+  rtems_test_assert(
+    ticks <= ticks_per_second + MAXIMUM_LATENCY / MICROSECONDS_PER_TICK
+  );
+  rtems_test_assert( isrs < ticks );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  puts( "\n\n*** TEST TICKLESS 01 ***" );
+
+  Check_delays();
+  Check_timer();
+  Check_interrupt_rate();
+
+  puts( "*** END OF TEST TICKLESS 01 ***" );
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_TICKLESS_IDLE
+#define CONFIGURE_MICROSECONDS_PER_TICK MICROSECONDS_PER_TICK
+#define CONFIGURE_MAXIMUM_TIMERS        1
+
+#else
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  puts( "\n\n*** TEST TICKLESS 01 ***" );
+  puts( "The BSP does not support tickless idle" );
+  puts( "*** END OF TEST TICKLESS 01 ***" );
+  rtems_test_exit(0);
+}
+
+#endif
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS         1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
@@ -0,0 +1,195 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#define HIGH_PRIORITY 2
+
+#define LOW_PRIORITY 3
+
+#define SLOW_TICKS 5
+
+/* forward declarations to avoid warnings */
+rtems_task Init(rtems_task_argument argument);
+rtems_timer_service_routine Slow_routine(rtems_id timer, void *arg);
+rtems_timer_service_routine Fast_routine(rtems_id timer, void *arg);
+
+volatile rtems_interval Slow_done;
+
+volatile rtems_interval Fast_fired;
+
+rtems_timer_service_routine Slow_routine(
+  rtems_id  timer,
+  void     *arg
+)
+{
+  rtems_interval end = rtems_clock_get_ticks_since_boot() + SLOW_TICKS;
+
+  /* Keep the low priority server busy */
+  while ( (int32_t) ( end - rtems_clock_get_ticks_since_boot() ) > 0 ) {
+    /* spin */
+  }
+
+  Slow_done = rtems_clock_get_ticks_since_boot();
+}
+
+rtems_timer_service_routine Fast_routine(
+  rtems_id  timer,
+  void     *arg
+)
+{
+  Fast_fired = rtems_clock_get_ticks_since_boot();
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  rtems_id          high;
+  rtems_id          low;
+  rtems_id          slow_timer;
+  rtems_id          fast_timer;
+  rtems_interval    start;
+
+  puts( "\n\n*** TEST TIMER SERVER 01 ***" );
+
+  status = rtems_timer_create( rtems_build_name( 'S', 'L', 'O', 'W' ), &slow_timer );
+  directive_failed( status, "rtems_timer_create" );
+
+  status = rtems_timer_create( rtems_build_name( 'F', 'A', 'S', 'T' ), &fast_timer );
+  directive_failed( status, "rtems_timer_create" );
+
+  puts( "Init - rtems_timer_create_server - RTEMS_INVALID_NAME" );
+  status = rtems_timer_create_server(
+    0,
+    HIGH_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &high
+  );
+  fatal_directive_status( status, RTEMS_INVALID_NAME, "create server" );
+
+  puts( "Init - rtems_timer_create_server - RTEMS_INVALID_ADDRESS" );
+  status = rtems_timer_create_server(
+    rtems_build_name( 'T', 'S', 'H', 'I' ),
+    HIGH_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    NULL
+  );
+  fatal_directive_status( status, RTEMS_INVALID_ADDRESS, "create server" );
+
+  puts( "Init - rtems_timer_create_server - RTEMS_INVALID_PRIORITY" );
+  status = rtems_timer_create_server(
+    rtems_build_name( 'T', 'S', 'H', 'I' ),
+    RTEMS_MAXIMUM_PRIORITY + 1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &high
+  );
+  fatal_directive_status( status, RTEMS_INVALID_PRIORITY, "create server" );
+
+  puts( "Init - rtems_timer_server_fire_after - RTEMS_INCORRECT_STATE" );
+  status = rtems_timer_server_fire_after( fast_timer, 1, Fast_routine, NULL );
+  fatal_directive_status( status, RTEMS_INCORRECT_STATE, "fire after" );
+
+  puts( "Init - rtems_timer_create_server - high and low priority servers" );
+  status = rtems_timer_create_server(
+    rtems_build_name( 'T', 'S', 'H', 'I' ),
+    HIGH_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &high
+  );
+  directive_failed( status, "rtems_timer_create_server" );
+
+  status = rtems_timer_create_server(
+    rtems_build_name( 'T', 'S', 'L', 'O' ),
+    LOW_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &low
+  );
+  directive_failed( status, "rtems_timer_create_server" );
+
+  puts( "Init - rtems_timer_set_server - RTEMS_INVALID_ID" );
+  status = rtems_timer_set_server( 0, high );
+  fatal_directive_status( status, RTEMS_INVALID_ID, "set server" );
+
+  status = rtems_timer_set_server( fast_timer, rtems_task_self() );
+  fatal_directive_status( status, RTEMS_INVALID_ID, "set server" );
+
+  puts(
+    "Init - rtems_timer_server_fire_after - default server "
+      "RTEMS_INCORRECT_STATE"
+  );
+  status = rtems_timer_server_fire_after( fast_timer, 1, Fast_routine, NULL );
+  fatal_directive_status( status, RTEMS_INCORRECT_STATE, "fire after" );
+
+  status = rtems_timer_set_server( fast_timer, high );
+  directive_failed( status, "rtems_timer_set_server" );
+
+  status = rtems_timer_set_server( slow_timer, low );
+  directive_failed( status, "rtems_timer_set_server" );
+
+  /* Start at a tick boundary */
+  status = rtems_task_wake_after( 1 );
+  directive_failed( status, "rtems_task_wake_after" );
+
+  start = rtems_clock_get_ticks_since_boot();
+
+  puts( "Init - slow routine on low priority server" );
+  status = rtems_timer_server_fire_after( slow_timer, 1, Slow_routine, NULL );
+  directive_failed( status, "rtems_timer_server_fire_after" );
+
+  puts( "Init - fast routine on high priority server" );
+  status = rtems_timer_server_fire_after( fast_timer, 2, Fast_routine, NULL );
+  directive_failed( status, "rtems_timer_server_fire_after" );
+
+  puts( "Init - rtems_timer_set_server - RTEMS_RESOURCE_IN_USE" );
+  status = rtems_timer_set_server( fast_timer, low );
+  fatal_directive_status( status, RTEMS_RESOURCE_IN_USE, "set server" );
+
+  status = rtems_task_wake_after( 2 * SLOW_TICKS );
+  directive_failed( status, "rtems_task_wake_after" );
+
+  rtems_test_assert( Slow_done != 0 );
+  rtems_test_assert( Slow_done - start >= 1 + SLOW_TICKS );
+
+  puts( "Init - fast routine was not delayed by the slow routine" );
+  rtems_test_assert( Fast_fired == start + 2 );
+
+  status = rtems_timer_set_server( fast_timer, RTEMS_TIMER_DEFAULT_SERVER );
+  directive_failed( status, "rtems_timer_set_server" );
+
+  puts( "*** END OF TEST TIMER SERVER 01 ***" );
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS         3
+#define CONFIGURE_MAXIMUM_TIMERS        2
+#define CONFIGURE_MAXIMUM_TIMER_SERVERS 2
+
+#define CONFIGURE_INIT_TASK_PRIORITY    1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
@@ -28,12 +28,12 @@ rtems_task Init(
 {
   rtems_time_of_day  time;
   rtems_status_code  status;
-  Chain_Control      empty;
+  Watchdog_Header    empty;
 
    puts( "\n*** RTEMS WATCHDOG ***" );
 
   puts( "INIT - report on empty watchdog chain" );
-  _Chain_Initialize_empty( &empty );
+  _Watchdog_Header_initialize( &empty );
   _Watchdog_Report_chain( "Empty Chain", &empty );
 
   build_time( &time, 12, 31, 1988, 9, 0, 0, 0 );
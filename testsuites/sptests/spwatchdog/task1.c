@@ -25,8 +25,10 @@ rtems_task Task_1(
   rtems_task_argument argument
 )
 {
-  rtems_id          tmid;
-  rtems_status_code status;
+  rtems_id           tmid;
+  rtems_status_code  status;
+  Watchdog_Control  *the_watchdog;
+  Watchdog_Interval  remaining;
 
 /* Get id */
 
@@ -75,17 +77,37 @@ rtems_task Task_1(
   status = rtems_timer_reset( tmid );
   directive_failed( status, "rtems_timer_reset" );
 
+  /*
+   *  _Watchdog_Report prints the ticks remaining for the only watchdog
+   *  on the ticks set.  This is the delta interval on a delta chain and
+   *  the distance to the current time of the set on a red-black tree,
+   *  so the output below is the same for both implementations.
+   */
+  puts( "TA1 - _Watchdog_Report - remaining ticks match the interval" );
+  the_watchdog = _Watchdog_First( &_Watchdog_Ticks_header );
+#if defined(__RTEMS_WATCHDOG_RBTREE__)
+  remaining = (Watchdog_Interval)
+    ( the_watchdog->expire - _Watchdog_Ticks_header.current );
+#else
+  remaining = the_watchdog->delta_interval;
+#endif
+  rtems_test_assert( remaining > 0 );
+  rtems_test_assert( remaining <= the_watchdog->initial );
+  rtems_test_assert(
+    the_watchdog->initial == 3 * rtems_clock_get_ticks_per_second()
+  );
+
   puts( "TA1 - _Watchdog_Report_chain - with name"  );
-  _Watchdog_Report_chain( "_Watchdog_Ticks_chain", & _Watchdog_Ticks_chain );
+  _Watchdog_Report_chain( "_Watchdog_Ticks_header", & _Watchdog_Ticks_header );
 
   puts( "TA1 - _Watchdog_Report_chain - no name"  );
-  _Watchdog_Report_chain( NULL, & _Watchdog_Ticks_chain);
+  _Watchdog_Report_chain( NULL, & _Watchdog_Ticks_header);
 
   puts( "TA1 - _Watchdog_Report - with name"  );
-  _Watchdog_Report("first", (Watchdog_Control *)_Chain_First(&_Watchdog_Ticks_chain));
+  _Watchdog_Report("first", _Watchdog_First(&_Watchdog_Ticks_header));
 
   puts( "TA1 - _Watchdog_Report - no name"  );
-  _Watchdog_Report( NULL, (Watchdog_Control *)_Chain_First(&_Watchdog_Ticks_chain) );
+  _Watchdog_Report( NULL, _Watchdog_First(&_Watchdog_Ticks_header) );
 
   puts( "TA1 - timer_deleting - timer 1" );
   status = rtems_timer_delete( tmid );
@@ -54,6 +54,65 @@ static void test_workspace_string_duplicate(void)
   _Workspace_Free( dup_e );
 }
 
+static Workspace_Slab Test_slab;
+
+static void test_workspace_slab(void)
+{
+  Workspace_Slab_information info;
+  uint32_t                   index = 0;
+  bool                       retbool;
+  void                      *p;
+  void                      *q;
+
+  puts( "rtems_workspace_get_slab_info - null pointer" );
+  retbool = rtems_workspace_get_slab_info( 0, NULL );
+  rtems_test_assert( retbool == false );
+
+  puts( "_Workspace_Slab_allocate - free - allocate returns the same object" );
+  _Workspace_Slab_initialize( &Test_slab, "test", 24 );
+  p = _Workspace_Slab_allocate( &Test_slab );
+  rtems_test_assert( p != NULL );
+  _Workspace_Slab_free( &Test_slab, p );
+  q = _Workspace_Slab_allocate( &Test_slab );
+  rtems_test_assert( q == p );
+
+  puts( "rtems_workspace_get_slab_info - OK" );
+  do {
+    retbool = rtems_workspace_get_slab_info( index, &info );
+    rtems_test_assert( retbool == true );
+    ++index;
+  } while ( strcmp( info.name, "test" ) != 0 );
+
+  rtems_test_assert( info.object_size == 24 );
+  rtems_test_assert( info.object_count == 1 );
+  rtems_test_assert( info.free_count == 0 );
+  rtems_test_assert( info.used_count == 1 );
+  rtems_test_assert( info.max_used_count == 1 );
+  rtems_test_assert( info.failed_count == 0 );
+
+  _Workspace_Slab_free( &Test_slab, q );
+  retbool = rtems_workspace_get_slab_info( index - 1, &info );
+  rtems_test_assert( retbool == true );
+  rtems_test_assert( info.free_count == 1 );
+  rtems_test_assert( info.used_count == 0 );
+
+  puts( "_Workspace_Slab_reserve - free limit zero - objects counted" );
+  _Workspace_Slab_Set_free_limit( &Test_slab, 0 );
+  rtems_test_assert( _Workspace_Slab_reserve( &Test_slab, 1 ) == 1 );
+  p = _Workspace_Slab_allocate( &Test_slab );
+  rtems_test_assert( p != NULL );
+  _Workspace_Slab_free( &Test_slab, p );
+  retbool = rtems_workspace_get_slab_info( index - 1, &info );
+  rtems_test_assert( retbool == true );
+  rtems_test_assert( info.object_count == 1 );
+  rtems_test_assert( info.free_count == 1 );
+  rtems_test_assert( info.used_count == 0 );
+
+  puts( "rtems_workspace_get_slab_info - invalid index" );
+  retbool = rtems_workspace_get_slab_info( index, &info );
+  rtems_test_assert( retbool == false );
+}
+
 rtems_task Init(
   rtems_task_argument argument
 )
@@ -100,6 +159,8 @@ rtems_task Init(
   puts( "_Workspace_String_duplicate - samples" );
   test_workspace_string_duplicate();
 
+  test_workspace_slab();
+
   puts( "*** END OF TEST WORKSPACE CLASSIC API ***" );
   rtems_test_exit( 0 );
 }
@@ -113,5 +174,7 @@ rtems_task Init(
 
 #define CONFIGURE_MAXIMUM_TASKS             1
 
+#define CONFIGURE_WORKSPACE_SLAB
+
 #define CONFIGURE_INIT
 #include <rtems/confdefs.h>
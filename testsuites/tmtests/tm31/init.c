@@ -0,0 +1,199 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <bsp.h>
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+/*
+ *  The number of armed timers is increased by a factor of ten up to this
+ *  maximum.  With the default OPERATION_COUNT this is 10000 timers.
+ */
+#define MAXIMUM_TIMERS (100 * OPERATION_COUNT)
+
+/*
+ *  The armed timers must not fire during the test.
+ */
+#define LONG_INTERVAL 0x10000000
+
+rtems_id Timer_id[ MAXIMUM_TIMERS ];
+
+rtems_id Probe_id;
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_timer_service_routine Timer_routine(
+  rtems_id  id,
+  void     *argument
+)
+{
+}
+
+static void arm_timers(
+  uint32_t from,
+  uint32_t to
+)
+{
+  rtems_status_code status;
+  uint32_t          index;
+
+  for ( index = from ; index < to ; index++ ) {
+    status = rtems_timer_fire_after(
+      Timer_id[ index ],
+      LONG_INTERVAL + index,
+      Timer_routine,
+      NULL
+    );
+    directive_failed( status, "rtems_timer_fire_after" );
+  }
+}
+
+static void benchmark_timers(
+  uint32_t armed
+)
+{
+  rtems_status_code status;
+  uint32_t          index;
+  uint32_t          insert_time = 0;
+  uint32_t          cancel_time = 0;
+  uint32_t          tick_time = 0;
+  uint32_t          tick_max = 0;
+  uint32_t          elapsed;
+  char              message[ 80 ];
+
+  /*
+   *  The probe is inserted behind all armed timers.  This is the worst case
+   *  for the delta chain insert.
+   */
+  for ( index = 0 ; index < OPERATION_COUNT ; index++ ) {
+    benchmark_timer_initialize();
+      (void) rtems_timer_fire_after(
+        Probe_id,
+        2 * LONG_INTERVAL,
+        Timer_routine,
+        NULL
+      );
+    insert_time += benchmark_timer_read();
+
+    benchmark_timer_initialize();
+      (void) rtems_timer_cancel( Probe_id );
+    cancel_time += benchmark_timer_read();
+  }
+
+  /*
+   *  Each tick fires the probe in front of all armed timers.
+   */
+  for ( index = 0 ; index < OPERATION_COUNT ; index++ ) {
+    status = rtems_timer_fire_after( Probe_id, 1, Timer_routine, NULL );
+    directive_failed( status, "rtems_timer_fire_after" );
+
+    benchmark_timer_initialize();
+      (void) rtems_clock_tick();
+    elapsed = benchmark_timer_read();
+
+    tick_time += elapsed;
+    if ( elapsed > tick_max )
+      tick_max = elapsed;
+  }
+
+  sprintf( message, "rtems_timer_fire_after: %" PRIu32 " armed", armed );
+  put_time(
+    message,
+    insert_time,
+    OPERATION_COUNT,
+    0,
+    CALLING_OVERHEAD_TIMER_FIRE_AFTER
+  );
+
+  sprintf( message, "rtems_timer_cancel: %" PRIu32 " armed", armed );
+  put_time(
+    message,
+    cancel_time,
+    OPERATION_COUNT,
+    0,
+    CALLING_OVERHEAD_TIMER_CANCEL
+  );
+
+  sprintf( message, "rtems_clock_tick: %" PRIu32 " armed", armed );
+  put_time(
+    message,
+    tick_time,
+    OPERATION_COUNT,
+    0,
+    CALLING_OVERHEAD_CLOCK_TICK
+  );
+
+  sprintf( message, "rtems_clock_tick (maximum): %" PRIu32 " armed", armed );
+  put_time(
+    message,
+    tick_max,
+    1,
+    0,
+    CALLING_OVERHEAD_CLOCK_TICK
+  );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  uint32_t          index;
+  uint32_t          armed;
+
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 31 ***" );
+
+  status = rtems_timer_create( rtems_build_name( 'P', 'R', 'O', 'B' ), &Probe_id );
+  directive_failed( status, "rtems_timer_create PROBE" );
+
+  for ( index = 0 ; index < MAXIMUM_TIMERS ; index++ ) {
+    status = rtems_timer_create(
+      rtems_build_name( 'T', 'I', 'M', 'E' ),
+      &Timer_id[ index ]
+    );
+    directive_failed( status, "rtems_timer_create LOOP" );
+  }
+
+  armed = 0;
+  benchmark_timers( armed );
+
+  for ( index = 1 ; index <= MAXIMUM_TIMERS ; index *= 10 ) {
+    arm_timers( armed, index );
+    armed = index;
+    benchmark_timers( armed );
+  }
+
+  puts( "*** END OF TIME TEST 31 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             1
+#define CONFIGURE_MAXIMUM_TIMERS            (MAXIMUM_TIMERS + 1)
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
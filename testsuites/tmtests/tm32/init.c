@@ -0,0 +1,183 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <bsp.h>
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+#include <rtems/score/heap.h>
+
+/*
+ *  The heap is fragmented by this number of live allocations of random
+ *  size.  Every second allocation is freed before the benchmark starts.
+ */
+#define SLOT_COUNT 512
+
+#define MINIMUM_ALLOCATION_SIZE 8
+
+#define MAXIMUM_ALLOCATION_SIZE 256
+
+#define HEAP_AREA_SIZE (SLOT_COUNT * MAXIMUM_ALLOCATION_SIZE)
+
+static char Heap_area[ HEAP_AREA_SIZE ] CPU_STRUCTURE_ALIGNMENT;
+
+static Heap_Control Heap;
+
+static void *Slot[ SLOT_COUNT ];
+
+static uint32_t Random_state;
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static uint32_t random_next( void )
+{
+  Random_state = Random_state * 1664525 + 1013904223;
+
+  return Random_state >> 8;
+}
+
+static uintptr_t random_size( void )
+{
+  return MINIMUM_ALLOCATION_SIZE
+    + random_next() % (MAXIMUM_ALLOCATION_SIZE - MINIMUM_ALLOCATION_SIZE);
+}
+
+static void fragment_heap( void )
+{
+  uint32_t index;
+
+  for ( index = 0 ; index < SLOT_COUNT ; index++ ) {
+    Slot[ index ] = _Heap_Allocate( &Heap, random_size() );
+  }
+
+  for ( index = 0 ; index < SLOT_COUNT ; index += 2 ) {
+    _Heap_Free( &Heap, Slot[ index ] );
+    Slot[ index ] = NULL;
+  }
+}
+
+static void benchmark_heap(
+  const char *name,
+  bool        segregated_fit
+)
+{
+  uint32_t  index;
+  uint32_t  slot;
+  uint32_t  elapsed;
+  uint32_t  allocate_time = 0;
+  uint32_t  allocate_max = 0;
+  uint32_t  free_time = 0;
+  uint32_t  free_max = 0;
+  uintptr_t size;
+  bool      ok;
+  char      message[ 80 ];
+
+  Random_state = 0;
+
+  if ( segregated_fit ) {
+    size = _Heap_Initialize_segregated_fit(
+      &Heap,
+      Heap_area,
+      sizeof( Heap_area ),
+      0
+    );
+  } else {
+    size = _Heap_Initialize( &Heap, Heap_area, sizeof( Heap_area ), 0 );
+  }
+  rtems_test_assert( size != 0 );
+
+  fragment_heap();
+
+  /*
+   *  Replace a random slot in each iteration.  This keeps the heap in a
+   *  fragmented state.
+   */
+  for ( index = 0 ; index < OPERATION_COUNT ; index++ ) {
+    slot = random_next() % SLOT_COUNT;
+
+    if ( Slot[ slot ] != NULL ) {
+      benchmark_timer_initialize();
+        ok = _Heap_Free( &Heap, Slot[ slot ] );
+      elapsed = benchmark_timer_read();
+      rtems_test_assert( ok );
+
+      free_time += elapsed;
+      if ( elapsed > free_max )
+        free_max = elapsed;
+    }
+
+    size = random_size();
+
+    benchmark_timer_initialize();
+      Slot[ slot ] = _Heap_Allocate( &Heap, size );
+    elapsed = benchmark_timer_read();
+
+    allocate_time += elapsed;
+    if ( elapsed > allocate_max )
+      allocate_max = elapsed;
+  }
+
+  rtems_test_assert( _Heap_Walk( &Heap, 0, false ) );
+
+  sprintf( message, "_Heap_Allocate: %s", name );
+  put_time( message, allocate_time, OPERATION_COUNT, 0, 0 );
+
+  sprintf( message, "_Heap_Allocate (maximum): %s", name );
+  put_time( message, allocate_max, 1, 0, 0 );
+
+  sprintf( message, "_Heap_Free: %s", name );
+  put_time( message, free_time, OPERATION_COUNT, 0, 0 );
+
+  sprintf( message, "_Heap_Free (maximum): %s", name );
+  put_time( message, free_max, 1, 0, 0 );
+
+  printf(
+    "%s: free blocks %" PRIu32 ", maximum search %" PRIu32 "\n",
+    name,
+    Heap.stats.free_blocks,
+    Heap.stats.max_search
+  );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 32 ***" );
+
+  benchmark_heap( "first fit", false );
+  benchmark_heap( "segregated fit", true );
+
+  puts( "*** END OF TIME TEST 32 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
@@ -0,0 +1,180 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+/*
+ *  The blocking obtain is measured with up to this number of tasks waiting
+ *  on the semaphore, including the blocking task.
+ */
+#define MAXIMUM_WAITERS 256
+
+#define WAITER_PRIORITIES 64
+
+#define WAITER_BASE_PRIORITY 10
+
+#define SAMPLES 8
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Semaphore_id;
+
+static rtems_id Waiter_id[ MAXIMUM_WAITERS ];
+
+static rtems_task Waiter_task(
+  rtems_task_argument argument
+)
+{
+  (void) rtems_semaphore_obtain(
+    Semaphore_id,
+    RTEMS_DEFAULT_OPTIONS,
+    RTEMS_NO_TIMEOUT
+  );
+}
+
+static rtems_task Blocking_task(
+  rtems_task_argument argument
+)
+{
+  /* start blocking rtems_semaphore_obtain time */
+  benchmark_timer_initialize();
+
+  (void) rtems_semaphore_obtain(
+    Semaphore_id,
+    RTEMS_DEFAULT_OPTIONS,
+    RTEMS_NO_TIMEOUT
+  );
+}
+
+static rtems_id start_waiter(
+  rtems_task_priority priority,
+  rtems_task_entry    entry
+)
+{
+  rtems_status_code status;
+  rtems_id          id;
+
+  status = rtems_task_create(
+    rtems_build_name( 'W', 'A', 'I', 'T' ),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  directive_failed( status, "rtems_task_create of waiter" );
+
+  /* The waiter preempts us and blocks on the semaphore */
+  status = rtems_task_start( id, entry, 0 );
+  directive_failed( status, "rtems_task_start of waiter" );
+
+  return id;
+}
+
+static void benchmark_obtain( uint32_t waiters )
+{
+  rtems_status_code status;
+  uint32_t          index;
+  uint32_t          sample;
+  uint32_t          total = 0;
+  char              message[ 80 ];
+
+  /* The other waiters are already enqueued */
+  for ( index = 0 ; index < waiters - 1 ; index++ ) {
+    Waiter_id[ index ] = start_waiter(
+      WAITER_BASE_PRIORITY + index % WAITER_PRIORITIES,
+      Waiter_task
+    );
+  }
+
+  for ( sample = 0 ; sample < SAMPLES ; sample++ ) {
+    rtems_id id;
+    uint32_t elapsed;
+
+    id = start_waiter(
+      WAITER_BASE_PRIORITY + WAITER_PRIORITIES / 2,
+      Blocking_task
+    );
+    elapsed = benchmark_timer_read();
+    total += elapsed;
+
+    status = rtems_task_delete( id );
+    directive_failed( status, "rtems_task_delete of blocking task" );
+  }
+
+  for ( index = 0 ; index < waiters - 1 ; index++ ) {
+    status = rtems_task_delete( Waiter_id[ index ] );
+    directive_failed( status, "rtems_task_delete of waiter" );
+  }
+
+  sprintf(
+    message,
+    "rtems_semaphore_obtain: not available -- caller blocks, %" PRIu32
+      " waiters",
+    waiters
+  );
+  put_time( message, total, SAMPLES, 0, 0 );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  uint32_t          waiters;
+
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 33 ***" );
+
+  status = rtems_semaphore_create(
+    rtems_build_name( 'S', 'M', '1', ' ' ),
+    0,
+    RTEMS_PRIORITY,
+    RTEMS_NO_PRIORITY,
+    &Semaphore_id
+  );
+  directive_failed( status, "rtems_semaphore_create of SM1" );
+
+  for ( waiters = 1 ; waiters <= MAXIMUM_WAITERS ; waiters *= 2 ) {
+    benchmark_obtain( waiters );
+  }
+
+  status = rtems_semaphore_delete( Semaphore_id );
+  directive_failed( status, "rtems_semaphore_delete of SM1" );
+
+  puts( "*** END OF TIME TEST 33 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             (1 + MAXIMUM_WAITERS)
+#define CONFIGURE_MAXIMUM_SEMAPHORES        1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY        250
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
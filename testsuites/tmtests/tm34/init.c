@@ -0,0 +1,197 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+#define MAXIMUM_MESSAGE_SIZE 4096
+
+#define MAXIMUM_PENDING_MESSAGES 2
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Queue_id;
+
+static uint32_t Message[ MAXIMUM_MESSAGE_SIZE / sizeof( uint32_t ) ];
+
+static void benchmark_copy( size_t size )
+{
+  rtems_status_code status;
+  uint32_t          index;
+  uint32_t          elapsed;
+  size_t            received;
+  char              message[ 80 ];
+
+  benchmark_timer_initialize();
+    for ( index = 0 ; index < OPERATION_COUNT ; index++ ) {
+      (void) rtems_message_queue_send( Queue_id, Message, size );
+      (void) rtems_message_queue_receive(
+        Queue_id,
+        Message,
+        &received,
+        RTEMS_NO_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+    }
+  elapsed = benchmark_timer_read();
+
+  status = rtems_message_queue_send( Queue_id, Message, size );
+  directive_failed( status, "rtems_message_queue_send" );
+
+  status = rtems_message_queue_receive(
+    Queue_id,
+    Message,
+    &received,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  directive_failed( status, "rtems_message_queue_receive" );
+  rtems_test_assert( received == size );
+
+  sprintf(
+    message,
+    "rtems_message_queue_send/receive: copy, %u bytes",
+    (unsigned) size
+  );
+  put_time( message, elapsed, OPERATION_COUNT, 0, 0 );
+}
+
+static void benchmark_buffer( size_t size )
+{
+  rtems_status_code  status;
+  uint32_t           index;
+  uint32_t           elapsed;
+  size_t             received;
+  void              *buffer;
+  char               message[ 80 ];
+
+  benchmark_timer_initialize();
+    for ( index = 0 ; index < OPERATION_COUNT ; index++ ) {
+      (void) rtems_message_queue_get_buffer( Queue_id, &buffer );
+      (void) rtems_message_queue_send_buffer( Queue_id, buffer, size );
+      (void) rtems_message_queue_receive_buffer(
+        Queue_id,
+        &buffer,
+        &received,
+        RTEMS_NO_WAIT,
+        RTEMS_NO_TIMEOUT
+      );
+      (void) rtems_message_queue_return_buffer( Queue_id, buffer );
+    }
+  elapsed = benchmark_timer_read();
+
+  status = rtems_message_queue_get_buffer( Queue_id, &buffer );
+  directive_failed( status, "rtems_message_queue_get_buffer" );
+
+  memcpy( buffer, Message, size );
+
+  status = rtems_message_queue_send_buffer( Queue_id, buffer, size );
+  directive_failed( status, "rtems_message_queue_send_buffer" );
+
+  status = rtems_message_queue_receive_buffer(
+    Queue_id,
+    &buffer,
+    &received,
+    RTEMS_NO_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  directive_failed( status, "rtems_message_queue_receive_buffer" );
+  rtems_test_assert( received == size );
+  rtems_test_assert( memcmp( buffer, Message, size ) == 0 );
+
+  status = rtems_message_queue_return_buffer( Queue_id, buffer );
+  directive_failed( status, "rtems_message_queue_return_buffer" );
+
+  status = rtems_message_queue_return_buffer( Queue_id, Message );
+  fatal_directive_status(
+    status,
+    RTEMS_INVALID_ADDRESS,
+    "rtems_message_queue_return_buffer with foreign buffer"
+  );
+
+  status = rtems_message_queue_return_buffer( Queue_id, buffer );
+  fatal_directive_status(
+    status,
+    RTEMS_INVALID_ADDRESS,
+    "rtems_message_queue_return_buffer of returned buffer"
+  );
+
+  sprintf(
+    message,
+    "rtems_message_queue_get/send/receive/return_buffer: %u bytes",
+    (unsigned) size
+  );
+  put_time( message, elapsed, OPERATION_COUNT, 0, 0 );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  size_t            size;
+  uint32_t          index;
+
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 34 ***" );
+
+  for ( index = 0 ; index < MAXIMUM_MESSAGE_SIZE / sizeof( uint32_t ) ;
+        index++ ) {
+    Message[ index ] = index;
+  }
+
+  status = rtems_message_queue_create(
+    rtems_build_name( 'M', 'Q', '1', ' ' ),
+    MAXIMUM_PENDING_MESSAGES,
+    MAXIMUM_MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &Queue_id
+  );
+  directive_failed( status, "rtems_message_queue_create of MQ1" );
+
+  for ( size = 16 ; size <= MAXIMUM_MESSAGE_SIZE ; size *= 4 ) {
+    benchmark_copy( size );
+    benchmark_buffer( size );
+  }
+
+  status = rtems_message_queue_delete( Queue_id );
+  directive_failed( status, "rtems_message_queue_delete of MQ1" );
+
+  puts( "*** END OF TIME TEST 34 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             1
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES    1
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+    CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( \
+      MAXIMUM_PENDING_MESSAGES, \
+      MAXIMUM_MESSAGE_SIZE \
+    )
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
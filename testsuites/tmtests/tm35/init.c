@@ -0,0 +1,147 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+#define SEMAPHORE_COUNT (10 * OPERATION_COUNT)
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Semaphore_id[ SEMAPHORE_COUNT ];
+
+static rtems_name semaphore_name( uint32_t index )
+{
+  return rtems_build_name(
+    'S',
+    (char) ('A' + index / 676),
+    (char) ('A' + (index / 26) % 26),
+    (char) ('A' + index % 26)
+  );
+}
+
+static void benchmark_ident( const char *message, rtems_name name )
+{
+  uint32_t index;
+  uint32_t elapsed;
+  rtems_id id;
+
+  benchmark_timer_initialize();
+    for ( index = 0 ; index < OPERATION_COUNT ; index++ )
+      (void) rtems_semaphore_ident( name, RTEMS_SEARCH_ALL_NODES, &id );
+  elapsed = benchmark_timer_read();
+
+  put_time( message, elapsed, OPERATION_COUNT, 0, 0 );
+}
+
+static void test_rename_and_delete( void )
+{
+  rtems_status_code status;
+  rtems_id          id;
+  rtems_id          last = Semaphore_id[ SEMAPHORE_COUNT - 1 ];
+
+  /* A duplicate name finds the semaphore with the lowest index */
+  status = rtems_object_set_name( last, "SAAA" );
+  directive_failed( status, "rtems_object_set_name" );
+
+  status = rtems_semaphore_ident(
+    semaphore_name( 0 ),
+    RTEMS_SEARCH_ALL_NODES,
+    &id
+  );
+  directive_failed( status, "rtems_semaphore_ident of duplicate" );
+  rtems_test_assert( id == Semaphore_id[ 0 ] );
+
+  status = rtems_semaphore_ident(
+    semaphore_name( SEMAPHORE_COUNT - 1 ),
+    RTEMS_SEARCH_ALL_NODES,
+    &id
+  );
+  fatal_directive_status(
+    status,
+    RTEMS_INVALID_NAME,
+    "rtems_semaphore_ident of old name"
+  );
+
+  status = rtems_semaphore_delete( Semaphore_id[ 0 ] );
+  directive_failed( status, "rtems_semaphore_delete" );
+
+  status = rtems_semaphore_ident(
+    semaphore_name( 0 ),
+    RTEMS_SEARCH_ALL_NODES,
+    &id
+  );
+  directive_failed( status, "rtems_semaphore_ident of renamed" );
+  rtems_test_assert( id == last );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  uint32_t          index;
+
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 35 ***" );
+
+  for ( index = 0 ; index < SEMAPHORE_COUNT ; index++ ) {
+    status = rtems_semaphore_create(
+      semaphore_name( index ),
+      1,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      RTEMS_NO_PRIORITY,
+      &Semaphore_id[ index ]
+    );
+    directive_failed( status, "rtems_semaphore_create" );
+  }
+
+  benchmark_ident(
+    "rtems_semaphore_ident: first created semaphore",
+    semaphore_name( 0 )
+  );
+  benchmark_ident(
+    "rtems_semaphore_ident: last created semaphore",
+    semaphore_name( SEMAPHORE_COUNT - 1 )
+  );
+  benchmark_ident(
+    "rtems_semaphore_ident: unknown name",
+    rtems_build_name( 'N', 'O', 'N', 'E' )
+  );
+
+  test_rename_and_delete();
+
+  puts( "*** END OF TIME TEST 35 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             1
+#define CONFIGURE_MAXIMUM_SEMAPHORES        SEMAPHORE_COUNT
+#define CONFIGURE_OBJECT_NAME_HASH
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
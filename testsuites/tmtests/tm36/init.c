@@ -0,0 +1,176 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+#include <rtems/capture.h>
+
+/*
+ *  Each yield is a context switch to the other task and back, which the
+ *  capture engine traces with four records.
+ */
+#define RECORDS_PER_YIELD 4
+
+#define CAPTURE_SIZE (RECORDS_PER_YIELD * OPERATION_COUNT)
+
+#define TASK_PRIORITY 100
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Yield_id;
+
+static rtems_task Yield_task(
+  rtems_task_argument argument
+)
+{
+  while ( true ) {
+    (void) rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+  }
+}
+
+static void benchmark_context_switch( const char *message )
+{
+  uint32_t index;
+  uint32_t elapsed;
+
+  benchmark_timer_initialize();
+    for ( index = 0 ; index < OPERATION_COUNT ; index++ )
+      (void) rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+  elapsed = benchmark_timer_read();
+
+  /* Two context switches per yield */
+  put_time( message, elapsed, 2 * OPERATION_COUNT, 0, 0 );
+}
+
+static void check_records( void )
+{
+  rtems_status_code       status;
+  rtems_capture_record_t *recs;
+  uint32_t                read;
+  uint32_t                index;
+  uint32_t                total = 0;
+
+  do {
+    status = rtems_capture_read( 0, 0, &read, &recs );
+    directive_failed( status, "rtems_capture_read" );
+
+    for ( index = 0 ; index < read ; index++ ) {
+      rtems_test_assert(
+        recs[ index ].task_id == rtems_task_self() ||
+          recs[ index ].task_id == Yield_id
+      );
+      rtems_test_assert( rtems_capture_find_task( recs[ index ].task_id ) );
+    }
+
+    status = rtems_capture_release( read );
+    directive_failed( status, "rtems_capture_release" );
+
+    total += read;
+  } while ( read > 0 );
+
+  rtems_test_assert( total >= RECORDS_PER_YIELD * OPERATION_COUNT );
+  rtems_test_assert( rtems_capture_buffer_count() == 1 );
+  rtems_test_assert( rtems_capture_buffer_overflows( 0 ) == 0 );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 36 ***" );
+
+  status = rtems_task_create(
+    rtems_build_name( 'Y', 'L', 'D', ' ' ),
+    TASK_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &Yield_id
+  );
+  directive_failed( status, "rtems_task_create of YLD" );
+
+  status = rtems_task_start( Yield_id, Yield_task, 0 );
+  directive_failed( status, "rtems_task_start of YLD" );
+
+  benchmark_context_switch(
+    "rtems_task_wake_after: yield -- capture engine closed"
+  );
+
+  /* The margin takes the records of the capture engine calls */
+  status = rtems_capture_open( CAPTURE_SIZE + 16, NULL );
+  directive_failed( status, "rtems_capture_open" );
+
+  benchmark_context_switch(
+    "rtems_task_wake_after: yield -- capture engine disabled"
+  );
+
+  status = rtems_capture_watch_global( true );
+  directive_failed( status, "rtems_capture_watch_global" );
+
+  status = rtems_capture_set_trigger(
+    0,
+    0,
+    rtems_build_name( 'Y', 'L', 'D', ' ' ),
+    0,
+    rtems_capture_from_any,
+    rtems_capture_switch
+  );
+  directive_failed( status, "rtems_capture_set_trigger" );
+
+  status = rtems_capture_control( true );
+  directive_failed( status, "rtems_capture_control" );
+
+  benchmark_context_switch(
+    "rtems_task_wake_after: yield -- capture engine tracing"
+  );
+
+  status = rtems_capture_control( false );
+  directive_failed( status, "rtems_capture_control" );
+
+  check_records();
+
+  status = rtems_capture_close();
+  directive_failed( status, "rtems_capture_close" );
+
+  puts( "*** END OF TIME TEST 36 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             2
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS   1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+/* The capture engine task and control blocks */
+#define CONFIGURE_MEMORY_OVERHEAD           4
+
+#define CONFIGURE_INIT_TASK_PRIORITY        TASK_PRIORITY
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
@@ -0,0 +1,153 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+#define MAXIMUM_EXTENSIONS 8
+
+#define TASK_PRIORITY 100
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Extension_id[ MAXIMUM_EXTENSIONS ];
+
+static volatile uint32_t Switches;
+
+static void Switch_extension(
+  rtems_tcb *executing,
+  rtems_tcb *heir
+)
+{
+  ++Switches;
+}
+
+static const rtems_extensions_table Switch_extensions = {
+  NULL,                    /* create */
+  NULL,                    /* start */
+  NULL,                    /* restart */
+  NULL,                    /* delete */
+  Switch_extension,        /* switch */
+  NULL,                    /* begin */
+  NULL,                    /* exitted */
+  NULL                     /* fatal */
+};
+
+static rtems_task Yield_task(
+  rtems_task_argument argument
+)
+{
+  while ( true ) {
+    (void) rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+  }
+}
+
+static void benchmark_context_switch( uint32_t extensions )
+{
+  uint32_t index;
+  uint32_t elapsed;
+  char     message[ 80 ];
+
+  Switches = 0;
+
+  benchmark_timer_initialize();
+    for ( index = 0 ; index < OPERATION_COUNT ; index++ )
+      (void) rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+  elapsed = benchmark_timer_read();
+
+  /* Each extension sees both context switches of a yield */
+  rtems_test_assert( Switches == 2 * OPERATION_COUNT * extensions );
+
+  sprintf(
+    message,
+    "rtems_task_wake_after: yield -- %" PRIu32 " switch extensions",
+    extensions
+  );
+  put_time( message, elapsed, 2 * OPERATION_COUNT, 0, 0 );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+  rtems_id          id;
+  uint32_t          extensions = 0;
+  uint32_t          index;
+
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 37 ***" );
+
+  status = rtems_task_create(
+    rtems_build_name( 'Y', 'L', 'D', ' ' ),
+    TASK_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  directive_failed( status, "rtems_task_create of YLD" );
+
+  status = rtems_task_start( id, Yield_task, 0 );
+  directive_failed( status, "rtems_task_start of YLD" );
+
+  benchmark_context_switch( 0 );
+
+  while ( extensions < MAXIMUM_EXTENSIONS ) {
+    status = rtems_extension_create(
+      rtems_build_name( 'E', 'X', 'T', '0' + extensions ),
+      &Switch_extensions,
+      &Extension_id[ extensions ]
+    );
+    directive_failed( status, "rtems_extension_create" );
+    ++extensions;
+
+    if ( extensions == 1 || extensions == 4 || extensions == 8 )
+      benchmark_context_switch( extensions );
+  }
+
+  /* The deleted extensions must no longer be invoked */
+  for ( index = 0 ; index < MAXIMUM_EXTENSIONS ; index++ ) {
+    status = rtems_extension_delete( Extension_id[ index ] );
+    directive_failed( status, "rtems_extension_delete" );
+  }
+
+  Switches = 0;
+  (void) rtems_task_wake_after( RTEMS_YIELD_PROCESSOR );
+  rtems_test_assert( Switches == 0 );
+
+  puts( "*** END OF TIME TEST 37 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             2
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS   MAXIMUM_EXTENSIONS
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY        TASK_PRIORITY
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
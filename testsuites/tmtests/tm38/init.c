@@ -0,0 +1,183 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+#define BUFFER_SIZE 64
+
+#define BUFFER_COUNT 32
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static uint8_t Area[ 2 ][ BUFFER_COUNT * BUFFER_SIZE ] CPU_STRUCTURE_ALIGNMENT;
+
+static rtems_id Partition_id[ 2 ];
+
+static void benchmark_by_id( rtems_id id, const char *kind )
+{
+  rtems_status_code status;
+  uint32_t          index;
+  uint32_t          elapsed;
+  void             *buffer;
+  char              message[ 80 ];
+
+  benchmark_timer_initialize();
+    for ( index = 0 ; index < OPERATION_COUNT ; index++ ) {
+      (void) rtems_partition_get_buffer( id, &buffer );
+      (void) rtems_partition_return_buffer( id, buffer );
+    }
+  elapsed = benchmark_timer_read();
+
+  status = rtems_partition_get_buffer( id, &buffer );
+  directive_failed( status, "rtems_partition_get_buffer" );
+  status = rtems_partition_return_buffer( id, buffer );
+  directive_failed( status, "rtems_partition_return_buffer" );
+
+  sprintf( message, "rtems_partition_get/return_buffer: %s", kind );
+  put_time( message, elapsed, OPERATION_COUNT, 0, 0 );
+}
+
+static void benchmark_by_handle( rtems_id id, const char *kind )
+{
+  rtems_status_code      status;
+  rtems_partition_handle handle;
+  uint32_t               index;
+  uint32_t               elapsed;
+  void                  *buffer;
+  char                   message[ 80 ];
+
+  status = rtems_partition_get_handle( id, &handle );
+  directive_failed( status, "rtems_partition_get_handle" );
+
+  benchmark_timer_initialize();
+    for ( index = 0 ; index < OPERATION_COUNT ; index++ ) {
+      (void) rtems_partition_get_buffer_by_handle( handle, &buffer );
+      (void) rtems_partition_return_buffer_by_handle( handle, buffer );
+    }
+  elapsed = benchmark_timer_read();
+
+  status = rtems_partition_get_buffer_by_handle( handle, &buffer );
+  directive_failed( status, "rtems_partition_get_buffer_by_handle" );
+  status = rtems_partition_return_buffer_by_handle( handle, buffer );
+  directive_failed( status, "rtems_partition_return_buffer_by_handle" );
+
+  sprintf( message, "rtems_partition_get/return_buffer_by_handle: %s", kind );
+  put_time( message, elapsed, OPERATION_COUNT, 0, 0 );
+}
+
+static void check_exhaustion( rtems_id id )
+{
+  rtems_status_code  status;
+  void              *buffers[ BUFFER_COUNT ];
+  void              *buffer;
+  uint32_t           index;
+
+  /* Each buffer must be handed out exactly once */
+  for ( index = 0 ; index < BUFFER_COUNT ; index++ ) {
+    status = rtems_partition_get_buffer( id, &buffers[ index ] );
+    directive_failed( status, "rtems_partition_get_buffer" );
+    memset( buffers[ index ], (int) index, BUFFER_SIZE );
+  }
+
+  status = rtems_partition_get_buffer( id, &buffer );
+  fatal_directive_status(
+    status,
+    RTEMS_UNSATISFIED,
+    "rtems_partition_get_buffer of exhausted partition"
+  );
+
+  for ( index = 0 ; index < BUFFER_COUNT ; index++ ) {
+    rtems_test_assert(
+      *(uint8_t *) buffers[ index ] == (uint8_t) index
+    );
+  }
+
+  status = rtems_partition_delete( id );
+  fatal_directive_status(
+    status,
+    RTEMS_RESOURCE_IN_USE,
+    "rtems_partition_delete with used buffers"
+  );
+
+  for ( index = 0 ; index < BUFFER_COUNT ; index++ ) {
+    status = rtems_partition_return_buffer( id, buffers[ index ] );
+    directive_failed( status, "rtems_partition_return_buffer" );
+  }
+
+  status = rtems_partition_delete( id );
+  directive_failed( status, "rtems_partition_delete" );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code status;
+
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 38 ***" );
+
+  status = rtems_partition_create(
+    rtems_build_name( 'P', 'A', 'R', 'T' ),
+    Area[ 0 ],
+    sizeof( Area[ 0 ] ),
+    BUFFER_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &Partition_id[ 0 ]
+  );
+  directive_failed( status, "rtems_partition_create" );
+
+  status = rtems_partition_create(
+    rtems_build_name( 'P', 'C', 'P', 'U' ),
+    Area[ 1 ],
+    sizeof( Area[ 1 ] ),
+    BUFFER_SIZE,
+    RTEMS_PARTITION_PER_CPU_CACHE,
+    &Partition_id[ 1 ]
+  );
+  directive_failed( status, "rtems_partition_create per CPU cache" );
+
+  benchmark_by_id( Partition_id[ 0 ], "chain" );
+  benchmark_by_id( Partition_id[ 1 ], "per CPU cache" );
+  benchmark_by_handle( Partition_id[ 0 ], "chain" );
+  benchmark_by_handle( Partition_id[ 1 ], "per CPU cache" );
+
+  check_exhaustion( Partition_id[ 0 ] );
+  check_exhaustion( Partition_id[ 1 ] );
+
+  puts( "*** END OF TIME TEST 38 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             1
+#define CONFIGURE_MAXIMUM_PARTITIONS        2
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
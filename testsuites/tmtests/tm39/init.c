@@ -0,0 +1,118 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+#define POOLED_STACK_SIZE (2 * CPU_STACK_MINIMUM_SIZE)
+
+#define OVERSIZED_STACK_SIZE (8 * CPU_STACK_MINIMUM_SIZE)
+
+#define WORKER_PRIORITY 1
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_task Worker(
+  rtems_task_argument argument
+)
+{
+  (void) rtems_task_suspend( RTEMS_SELF );
+}
+
+static void benchmark_create_start_delete(
+  size_t      stack_size,
+  const char *message
+)
+{
+  rtems_status_code status;
+  rtems_id          id;
+  uint32_t          index;
+  uint32_t          elapsed;
+
+  benchmark_timer_initialize();
+    for ( index = 0 ; index < OPERATION_COUNT ; index++ ) {
+      (void) rtems_task_create(
+        rtems_build_name( 'W', 'O', 'R', 'K' ),
+        WORKER_PRIORITY,
+        stack_size,
+        RTEMS_DEFAULT_MODES,
+        RTEMS_DEFAULT_ATTRIBUTES,
+        &id
+      );
+      (void) rtems_task_start( id, Worker, 0 );
+      (void) rtems_task_delete( id );
+    }
+  elapsed = benchmark_timer_read();
+
+  status = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    WORKER_PRIORITY,
+    stack_size,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  directive_failed( status, "rtems_task_create" );
+  status = rtems_task_delete( id );
+  directive_failed( status, "rtems_task_delete" );
+
+  put_time( message, elapsed, OPERATION_COUNT, 0, 0 );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 39 ***" );
+
+  benchmark_create_start_delete(
+    POOLED_STACK_SIZE,
+    "rtems_task_create/start/delete: pooled stack"
+  );
+  benchmark_create_start_delete(
+    OVERSIZED_STACK_SIZE,
+    "rtems_task_create/start/delete: oversized stack"
+  );
+
+  puts( "*** END OF TIME TEST 39 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             2
+#define CONFIGURE_INIT_TASK_PRIORITY        (WORKER_PRIORITY + 1)
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_TASK_STACK_POOL
+#define CONFIGURE_TASK_STACK_POOL_CLASSES \
+  { CONFIGURE_MINIMUM_TASK_STACK_SIZE, 0, 0 }, \
+  { POOLED_STACK_SIZE, 1, 1 }
+
+#define CONFIGURE_EXTRA_TASK_STACKS \
+  (POOLED_STACK_SIZE + OVERSIZED_STACK_SIZE)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
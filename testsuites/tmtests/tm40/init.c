@@ -0,0 +1,189 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+#if defined(BSP_FEATURE_TICKLESS_IDLE)
+
+/*
+ *  Clock ISRs since initialization, provided by the clock driver shell
+ */
+extern volatile uint32_t Clock_driver_ticks;
+
+#define MICROSECONDS_PER_TICK 100
+
+static const rtems_interval Delays[] = { 1, 2, 7, 50, 1000, 12345 };
+
+static volatile bool Timer_fired;
+
+static struct timespec Timer_uptime;
+
+static rtems_timer_service_routine Timer_routine(
+  rtems_id  timer,
+  void     *arg
+)
+{
+  /* The result is checked by the task */
+  (void) rtems_clock_get_uptime( &Timer_uptime );
+  Timer_fired = true;
+}
+
+static uint32_t Microseconds_between(
+  const struct timespec *start,
+  const struct timespec *end
+)
+{
+  return (uint32_t) ( ( end->tv_sec - start->tv_sec ) * 1000000
+    + ( end->tv_nsec - start->tv_nsec ) / 1000 );
+}
+
+static void benchmark_delays( void )
+{
+  rtems_status_code status;
+  struct timespec   start;
+  struct timespec   end;
+  char              message[ 64 ];
+  size_t            i;
+
+  for ( i = 0 ; i < sizeof( Delays ) / sizeof( Delays[ 0 ] ) ; i++ ) {
+    /* Start at a tick boundary */
+    status = rtems_task_wake_after( 1 );
+    directive_failed( status, "rtems_task_wake_after" );
+
+    status = rtems_clock_get_uptime( &start );
+    directive_failed( status, "rtems_clock_get_uptime" );
+
+    status = rtems_task_wake_after( Delays[ i ] );
+    directive_failed( status, "rtems_task_wake_after" );
+
+    status = rtems_clock_get_uptime( &end );
+    directive_failed( status, "rtems_clock_get_uptime" );
+
+    sprintf(
+      message,
+      "rtems_task_wake_after: %" PRIu32 " ticks (us)",
+      Delays[ i ]
+    );
+    put_time( message, Microseconds_between( &start, &end ), 1, 0, 0 );
+  }
+}
+
+static void benchmark_timer( void )
+{
+  rtems_status_code status;
+  rtems_id          timer;
+  struct timespec   start;
+
+  status = rtems_timer_create( rtems_build_name( 'T', 'M', 'R', ' ' ), &timer );
+  directive_failed( status, "rtems_timer_create" );
+
+  status = rtems_task_wake_after( 1 );
+  directive_failed( status, "rtems_task_wake_after" );
+
+  status = rtems_clock_get_uptime( &start );
+  directive_failed( status, "rtems_clock_get_uptime" );
+
+  status = rtems_timer_fire_after( timer, 500, Timer_routine, NULL );
+  directive_failed( status, "rtems_timer_fire_after" );
+
+  while ( !Timer_fired ) {
+    status = rtems_task_wake_after( 1000 );
+    directive_failed( status, "rtems_task_wake_after" );
+  }
+
+  put_time(
+    "rtems_timer_fire_after: 500 ticks (us)",
+    Microseconds_between( &start, &Timer_uptime ),
+    1,
+    0,
+    0
+  );
+
+  status = rtems_timer_delete( timer );
+  directive_failed( status, "rtems_timer_delete" );
+}
+
+static void benchmark_idle_second( void )
+{
+  rtems_status_code status;
+  uint32_t          isrs;
+
+  isrs = Clock_driver_ticks;
+
+  status = rtems_task_wake_after( rtems_clock_get_ticks_per_second() );
+  directive_failed( status, "rtems_task_wake_after" );
+
+  put_time(
+    "clock interrupts per idle second",
+    Clock_driver_ticks - isrs,
+    1,
+    0,
+    0
+  );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 40 ***" );
+
+  benchmark_delays();
+  benchmark_timer();
+  benchmark_idle_second();
+
+  puts( "*** END OF TIME TEST 40 ***" );
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_TICKLESS_IDLE
+#define CONFIGURE_MICROSECONDS_PER_TICK MICROSECONDS_PER_TICK
+#define CONFIGURE_MAXIMUM_TIMERS        1
+
+#else
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  puts( "\n\n*** TIME TEST 40 ***" );
+  puts( "The BSP does not support tickless idle" );
+  puts( "*** END OF TIME TEST 40 ***" );
+
+  rtems_test_exit(0);
+}
+
+#endif
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
@@ -0,0 +1,107 @@
+/*
+ *  COPYRIGHT (c) 1989-2012.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+#define SEMAPHORE_COUNT 50000
+
+#define SEMAPHORES_PER_ALLOCATION 64
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_id Semaphores[ SEMAPHORE_COUNT ];
+
+static uint32_t benchmark_create( void )
+{
+  rtems_status_code status;
+  uint32_t          created;
+  uint32_t          elapsed;
+  uint32_t          worst = 0;
+  uint32_t          total = 0;
+
+  for ( created = 0 ; created < SEMAPHORE_COUNT ; created++ ) {
+    benchmark_timer_initialize();
+      status = rtems_semaphore_create(
+        rtems_build_name( 'O', 'B', 'J', 'T' ),
+        1,
+        RTEMS_DEFAULT_ATTRIBUTES,
+        0,
+        &Semaphores[ created ]
+      );
+    elapsed = benchmark_timer_read();
+
+    if ( status == RTEMS_TOO_MANY )
+      break;
+    directive_failed( status, "rtems_semaphore_create" );
+
+    total += elapsed;
+    if ( elapsed > worst )
+      worst = elapsed;
+  }
+
+  rtems_test_assert( created > SEMAPHORES_PER_ALLOCATION );
+
+  put_time( "rtems_semaphore_create: worst case", worst, 1, 0, 0 );
+  put_time( "rtems_semaphore_create: average", total, created, 0, 0 );
+
+  return created;
+}
+
+static void delete_semaphores( uint32_t count )
+{
+  rtems_status_code status;
+  uint32_t          i;
+
+  for ( i = 0 ; i < count ; i++ ) {
+    status = rtems_semaphore_delete( Semaphores[ i ] );
+    directive_failed( status, "rtems_semaphore_delete" );
+  }
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 41 ***" );
+
+  delete_semaphores( benchmark_create() );
+
+  puts( "*** END OF TIME TEST 41 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS             1
+#define CONFIGURE_MAXIMUM_SEMAPHORES \
+  rtems_resource_unlimited( SEMAPHORES_PER_ALLOCATION )
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */